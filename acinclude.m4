@@ -77,6 +77,9 @@ AC_DEFUN([AX_LIBCPATH_CHECK_LOCAL],
   [dnl Headers included in libcpath/libcpath_path.h
   AC_CHECK_HEADERS([errno.h sys/stat.h sys/syslimits.h])
 
+  dnl Headers included in libcpath/libcpath_directory_handle.c
+  AC_CHECK_HEADERS([fcntl.h])
+
   dnl Path functions used in libcpath/libcpath_path.h
   AC_CHECK_FUNCS([chdir getcwd])
 
@@ -95,6 +98,15 @@ AC_DEFUN([AX_LIBCPATH_CHECK_LOCAL],
     ])
 
   AX_LIBCPATH_CHECK_FUNC_MKDIR
+
+  dnl Directory handle functions used in libcpath/libcpath_directory_handle.c
+  dnl a path based fallback is used when these are not available
+  AC_CHECK_FUNCS([fchdir fstatat mkdirat openat])
+
+  dnl Time function used in libcpath/libcpath_statistics.c
+  dnl the elapsed time is not measured when this is not available
+  AC_SEARCH_LIBS([clock_gettime], [rt])
+  AC_CHECK_FUNCS([clock_gettime])
   ])
 
 dnl Function to check if DLL support is needed
@@ -0,0 +1,478 @@
+/*
+ * Arena functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcpath_arena.h"
+#include "libcpath_definitions.h"
+#include "libcpath_libcerror.h"
+#include "libcpath_memory.h"
+#include "libcpath_types.h"
+
+/* Every allocation is preceded by its size, which is stored in
+ * an aligned header so that the allocation itself remains aligned
+ */
+#define libcpath_arena_align_size( size ) \
+	( ( ( size ) + ( LIBCPATH_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBCPATH_ARENA_ALIGNMENT - 1 ) )
+
+#define LIBCPATH_ARENA_CHUNK_HEADER_SIZE \
+	libcpath_arena_align_size( sizeof( libcpath_arena_chunk_t ) )
+
+/* Creates an arena
+ * Make sure the value arena is referencing, is set to NULL
+ * A chunk size of 0 represents the default chunk size
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_arena_initialize(
+     libcpath_arena_t **arena,
+     size_t chunk_size,
+     libcerror_error_t **error )
+{
+	libcpath_internal_arena_t *internal_arena = NULL;
+	static char *function                     = "libcpath_arena_initialize";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid chunk size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The arena is allocated with the default memory functions
+	 * since it can be used as the memory functions itself
+	 */
+	internal_arena = (libcpath_internal_arena_t *) libcpath_memory_default_allocate(
+	                                                sizeof( libcpath_internal_arena_t ) );
+
+	if( internal_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_arena,
+	     0,
+	     sizeof( libcpath_internal_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( chunk_size == 0 )
+	{
+		chunk_size = LIBCPATH_ARENA_DEFAULT_CHUNK_SIZE;
+	}
+	internal_arena->chunk_size = libcpath_arena_align_size(
+	                              chunk_size );
+
+	*arena = (libcpath_arena_t *) internal_arena;
+
+	return( 1 );
+
+on_error:
+	if( internal_arena != NULL )
+	{
+		libcpath_memory_default_free(
+		 internal_arena );
+	}
+	return( -1 );
+}
+
+/* Frees an arena
+ * All memory allocated in the arena is released
+ * If the arena is used as the memory functions the default memory
+ * functions are restored
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_arena_free(
+     libcpath_arena_t **arena,
+     libcerror_error_t **error )
+{
+	libcpath_arena_chunk_t *chunk             = NULL;
+	libcpath_arena_chunk_t *next_chunk        = NULL;
+	libcpath_internal_arena_t *internal_arena = NULL;
+	static char *function                     = "libcpath_arena_free";
+	int result                                = 1;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		internal_arena = (libcpath_internal_arena_t *) *arena;
+		*arena         = NULL;
+
+		if( libcpath_memory_has_context(
+		     (intptr_t *) internal_arena ) != 0 )
+		{
+			if( libcpath_set_memory_functions(
+			     NULL,
+			     NULL,
+			     NULL,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to restore default memory functions.",
+				 function );
+
+				result = -1;
+			}
+		}
+		chunk = internal_arena->first_chunk;
+
+		while( chunk != NULL )
+		{
+			next_chunk = chunk->next_chunk;
+
+			libcpath_memory_default_free(
+			 chunk );
+
+			chunk = next_chunk;
+		}
+		libcpath_memory_default_free(
+		 internal_arena );
+	}
+	return( result );
+}
+
+/* Resets an arena
+ * All memory allocated in the arena is released, the chunks are retained
+ * so they can be reused
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_arena_reset(
+     libcpath_arena_t *arena,
+     libcerror_error_t **error )
+{
+	libcpath_arena_chunk_t *chunk             = NULL;
+	libcpath_internal_arena_t *internal_arena = NULL;
+	static char *function                     = "libcpath_arena_reset";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	internal_arena = (libcpath_internal_arena_t *) arena;
+
+	for( chunk = internal_arena->first_chunk;
+	     chunk != NULL;
+	     chunk = chunk->next_chunk )
+	{
+		chunk->used_data_size = 0;
+	}
+	internal_arena->current_chunk   = internal_arena->first_chunk;
+	internal_arena->last_allocation = NULL;
+
+	return( 1 );
+}
+
+/* Sets an arena as the memory functions
+ * The memory the library allocates, including the strings it returns,
+ * is then allocated in the arena and released when the arena is reset
+ * or freed. The strings returned must not be freed by the caller
+ * Objects created while the arena is used, such as directory handles and
+ * path builders, must not be used after the arena is reset or freed
+ * Memory the library retains internally, such as the current working
+ * directory cache, is not allocated in the arena
+ * Use NULL to restore the default memory functions
+ * An arena is not thread safe and should only be used by a single thread
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_set_memory_arena(
+     libcpath_arena_t *arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_set_memory_arena";
+	int result            = 0;
+
+	if( arena == NULL )
+	{
+		result = libcpath_set_memory_functions(
+		          NULL,
+		          NULL,
+		          NULL,
+		          NULL,
+		          error );
+	}
+	else
+	{
+		result = libcpath_set_memory_functions(
+		          &libcpath_arena_allocate,
+		          &libcpath_arena_reallocate,
+		          &libcpath_arena_release,
+		          (intptr_t *) arena,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory functions.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Allocates memory in an arena
+ * The memory is allocated in the current chunk, a next chunk is used
+ * or a new chunk is created when it does not fit
+ * Returns a pointer to the allocated memory or NULL on error
+ */
+void *libcpath_arena_allocate(
+       intptr_t *memory_context,
+       size_t size )
+{
+	libcpath_arena_chunk_t *chunk             = NULL;
+	libcpath_internal_arena_t *internal_arena = NULL;
+	uint8_t *allocation                       = NULL;
+	size_t data_size                          = 0;
+	size_t required_size                      = 0;
+
+	if( memory_context == NULL )
+	{
+		return( NULL );
+	}
+	if( size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		return( NULL );
+	}
+	internal_arena = (libcpath_internal_arena_t *) memory_context;
+	required_size  = LIBCPATH_ARENA_ALIGNMENT + libcpath_arena_align_size( size );
+	chunk          = internal_arena->current_chunk;
+
+	if( ( chunk == NULL )
+	 || ( required_size > ( chunk->data_size - chunk->used_data_size ) ) )
+	{
+		/* The chunks after the current chunk are unused
+		 */
+		if( ( chunk != NULL )
+		 && ( chunk->next_chunk != NULL )
+		 && ( required_size <= chunk->next_chunk->data_size ) )
+		{
+			chunk = chunk->next_chunk;
+		}
+		else
+		{
+			data_size = internal_arena->chunk_size;
+
+			if( data_size < required_size )
+			{
+				data_size = required_size;
+			}
+			chunk = (libcpath_arena_chunk_t *) libcpath_memory_default_allocate(
+			                                    LIBCPATH_ARENA_CHUNK_HEADER_SIZE + data_size );
+
+			if( chunk == NULL )
+			{
+				return( NULL );
+			}
+			chunk->data           = &( ( (uint8_t *) chunk )[ LIBCPATH_ARENA_CHUNK_HEADER_SIZE ] );
+			chunk->data_size      = data_size;
+			chunk->used_data_size = 0;
+
+			if( internal_arena->current_chunk == NULL )
+			{
+				chunk->next_chunk           = internal_arena->first_chunk;
+				internal_arena->first_chunk = chunk;
+			}
+			else
+			{
+				chunk->next_chunk                         = internal_arena->current_chunk->next_chunk;
+				internal_arena->current_chunk->next_chunk = chunk;
+			}
+		}
+		internal_arena->current_chunk = chunk;
+	}
+	allocation = &( chunk->data[ chunk->used_data_size + LIBCPATH_ARENA_ALIGNMENT ] );
+
+	*( (size_t *) &( allocation[ -LIBCPATH_ARENA_ALIGNMENT ] ) ) = size;
+
+	chunk->used_data_size          += required_size;
+	internal_arena->last_allocation = allocation;
+
+	return( allocation );
+}
+
+/* Reallocates memory in an arena
+ * The most recent allocation is grown in place when it fits in
+ * the current chunk, otherwise the memory is copied to a new allocation
+ * Returns a pointer to the reallocated memory or NULL on error
+ */
+void *libcpath_arena_reallocate(
+       intptr_t *memory_context,
+       void *buffer,
+       size_t size )
+{
+	libcpath_arena_chunk_t *chunk             = NULL;
+	libcpath_internal_arena_t *internal_arena = NULL;
+	uint8_t *allocation                       = NULL;
+	size_t allocation_offset                  = 0;
+	size_t allocation_size                    = 0;
+
+	if( memory_context == NULL )
+	{
+		return( NULL );
+	}
+	if( buffer == NULL )
+	{
+		return( libcpath_arena_allocate(
+		         memory_context,
+		         size ) );
+	}
+	if( size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		return( NULL );
+	}
+	internal_arena  = (libcpath_internal_arena_t *) memory_context;
+	allocation      = (uint8_t *) buffer;
+	allocation_size = *( (size_t *) &( allocation[ -LIBCPATH_ARENA_ALIGNMENT ] ) );
+
+	if( allocation == internal_arena->last_allocation )
+	{
+		chunk             = internal_arena->current_chunk;
+		allocation_offset = (size_t) ( allocation - chunk->data );
+
+		if( libcpath_arena_align_size( size ) <= ( chunk->data_size - allocation_offset ) )
+		{
+			*( (size_t *) &( allocation[ -LIBCPATH_ARENA_ALIGNMENT ] ) ) = size;
+
+			chunk->used_data_size = allocation_offset + libcpath_arena_align_size( size );
+
+			return( allocation );
+		}
+	}
+	else if( size <= allocation_size )
+	{
+		return( allocation );
+	}
+	allocation = (uint8_t *) libcpath_arena_allocate(
+	                          memory_context,
+	                          size );
+
+	if( allocation == NULL )
+	{
+		return( NULL );
+	}
+	if( allocation_size > size )
+	{
+		allocation_size = size;
+	}
+	if( memory_copy(
+	     allocation,
+	     buffer,
+	     allocation_size ) == NULL )
+	{
+		return( NULL );
+	}
+	return( allocation );
+}
+
+/* Releases memory in an arena
+ * Only the most recent allocation is released, other memory is
+ * released when the arena is reset or freed
+ */
+void libcpath_arena_release(
+      intptr_t *memory_context,
+      void *buffer )
+{
+	libcpath_arena_chunk_t *chunk             = NULL;
+	libcpath_internal_arena_t *internal_arena = NULL;
+	uint8_t *allocation                       = NULL;
+
+	if( ( memory_context == NULL )
+	 || ( buffer == NULL ) )
+	{
+		return;
+	}
+	internal_arena = (libcpath_internal_arena_t *) memory_context;
+	allocation     = (uint8_t *) buffer;
+
+	if( allocation == internal_arena->last_allocation )
+	{
+		chunk = internal_arena->current_chunk;
+
+		chunk->used_data_size           = (size_t) ( allocation - chunk->data ) - LIBCPATH_ARENA_ALIGNMENT;
+		internal_arena->last_allocation = NULL;
+	}
+}
+
@@ -0,0 +1,120 @@
+/*
+ * Arena functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCPATH_ARENA_H )
+#define _LIBCPATH_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcpath_extern.h"
+#include "libcpath_libcerror.h"
+#include "libcpath_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcpath_arena_chunk libcpath_arena_chunk_t;
+
+struct libcpath_arena_chunk
+{
+	/* The next chunk
+	 */
+	libcpath_arena_chunk_t *next_chunk;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The used data size
+	 */
+	size_t used_data_size;
+};
+
+typedef struct libcpath_internal_arena libcpath_internal_arena_t;
+
+struct libcpath_internal_arena
+{
+	/* The chunk size
+	 */
+	size_t chunk_size;
+
+	/* The first chunk
+	 */
+	libcpath_arena_chunk_t *first_chunk;
+
+	/* The current chunk
+	 * This value is NULL if the arena has no chunks
+	 */
+	libcpath_arena_chunk_t *current_chunk;
+
+	/* The most recent allocation
+	 * This allocation is in the current chunk and can be grown or released
+	 * This value is NULL if there is no such allocation
+	 */
+	uint8_t *last_allocation;
+};
+
+LIBCPATH_EXTERN \
+int libcpath_arena_initialize(
+     libcpath_arena_t **arena,
+     size_t chunk_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_arena_free(
+     libcpath_arena_t **arena,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_arena_reset(
+     libcpath_arena_t *arena,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_set_memory_arena(
+     libcpath_arena_t *arena,
+     libcerror_error_t **error );
+
+void *libcpath_arena_allocate(
+       intptr_t *memory_context,
+       size_t size );
+
+void *libcpath_arena_reallocate(
+       intptr_t *memory_context,
+       void *buffer,
+       size_t size );
+
+void libcpath_arena_release(
+      intptr_t *memory_context,
+      void *buffer );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCPATH_ARENA_H ) */
+
@@ -0,0 +1,1376 @@
+/*
+ * Directory cache functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "libcpath_definitions.h"
+#include "libcpath_directory_cache.h"
+#include "libcpath_libcerror.h"
+#include "libcpath_memory.h"
+#include "libcpath_path.h"
+#include "libcpath_system_string.h"
+#include "libcpath_types.h"
+
+/* Creates a directory cache
+ * Make sure the value directory_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_cache_initialize(
+     libcpath_directory_cache_t **directory_cache,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_cache_t *internal_directory_cache = NULL;
+	static char *function                                         = "libcpath_directory_cache_initialize";
+
+	if( directory_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_cache = memory_allocate_structure(
+	                            libcpath_internal_directory_cache_t );
+
+	if( internal_directory_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_directory_cache,
+	     0,
+	     sizeof( libcpath_internal_directory_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear directory cache.",
+		 function );
+
+		goto on_error;
+	}
+	*directory_cache = (libcpath_directory_cache_t *) internal_directory_cache;
+
+	return( 1 );
+
+on_error:
+	if( internal_directory_cache != NULL )
+	{
+		memory_free(
+		 internal_directory_cache );
+	}
+	return( -1 );
+}
+
+/* Frees a directory cache
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_cache_free(
+     libcpath_directory_cache_t **directory_cache,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_cache_t *internal_directory_cache = NULL;
+	static char *function                                         = "libcpath_directory_cache_free";
+	int result                                                    = 1;
+
+	if( directory_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_cache != NULL )
+	{
+		internal_directory_cache = (libcpath_internal_directory_cache_t *) *directory_cache;
+
+		if( libcpath_directory_cache_clear(
+		     *directory_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear directory cache.",
+			 function );
+
+			result = -1;
+		}
+		*directory_cache = NULL;
+
+		if( internal_directory_cache->entries != NULL )
+		{
+			memory_free(
+			 internal_directory_cache->entries );
+		}
+		memory_free(
+		 internal_directory_cache );
+	}
+	return( result );
+}
+
+/* Clears a directory cache
+ * This removes all directories but retains the allocated entries for reuse
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_cache_clear(
+     libcpath_directory_cache_t *directory_cache,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_cache_t *internal_directory_cache = NULL;
+	static char *function                                         = "libcpath_directory_cache_clear";
+	int entry_index                                               = 0;
+
+	if( directory_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_cache = (libcpath_internal_directory_cache_t *) directory_cache;
+
+	for( entry_index = 0;
+	     entry_index < internal_directory_cache->number_of_allocated_entries;
+	     entry_index++ )
+	{
+		if( internal_directory_cache->entries[ entry_index ].name != NULL )
+		{
+			memory_free(
+			 internal_directory_cache->entries[ entry_index ].name );
+		}
+	}
+	if( internal_directory_cache->entries != NULL )
+	{
+		if( memory_set(
+		     internal_directory_cache->entries,
+		     0,
+		     sizeof( libcpath_directory_cache_entry_t ) * internal_directory_cache->number_of_allocated_entries ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entries.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_directory_cache->number_of_directories = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the number of directories
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_cache_get_number_of_directories(
+     libcpath_directory_cache_t *directory_cache,
+     int *number_of_directories,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_cache_t *internal_directory_cache = NULL;
+	static char *function                                         = "libcpath_directory_cache_get_number_of_directories";
+
+	if( directory_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_cache = (libcpath_internal_directory_cache_t *) directory_cache;
+
+	if( number_of_directories == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of directories.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_directories = internal_directory_cache->number_of_directories;
+
+	return( 1 );
+}
+
+/* Calculates the hash of a directory name
+ * The hash is a 32-bit Fowler-Noll-Vo (FNV-1a) hash of the name bytes
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_cache_calculate_hash(
+     const uint8_t *name,
+     size_t name_size,
+     uint32_t *hash,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_directory_cache_calculate_hash";
+	size_t name_index     = 0;
+	uint32_t safe_hash    = 0x811c9dc5UL;
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	for( name_index = 0;
+	     name_index < name_size;
+	     name_index++ )
+	{
+		safe_hash ^= name[ name_index ];
+		safe_hash *= 0x01000193UL;
+	}
+	*hash = safe_hash;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the entry of a directory name
+ * The entries must be allocated
+ * Returns 1 if the directory name was found, 0 if not or -1 on error
+ * If not found the entry index is set to the unused entry where the
+ * directory name can be inserted
+ */
+int libcpath_internal_directory_cache_get_entry_index(
+     libcpath_internal_directory_cache_t *internal_directory_cache,
+     const uint8_t *name,
+     size_t name_size,
+     uint32_t hash,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	libcpath_directory_cache_entry_t *entry = NULL;
+	static char *function                   = "libcpath_internal_directory_cache_get_entry_index";
+	uint32_t entry_mask                     = 0;
+	uint32_t safe_entry_index               = 0;
+
+	if( internal_directory_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_directory_cache->entries == NULL )
+	 || ( internal_directory_cache->number_of_allocated_entries <= 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory cache - missing entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	entry_mask       = (uint32_t) internal_directory_cache->number_of_allocated_entries - 1;
+	safe_entry_index = hash & entry_mask;
+
+	/* The entries are never completely used so the linear probing ends
+	 * at an unused entry
+	 */
+	for( ;; )
+	{
+		entry = &( internal_directory_cache->entries[ safe_entry_index ] );
+
+		if( entry->name == NULL )
+		{
+			break;
+		}
+		if( ( entry->hash == hash )
+		 && ( entry->name_size == name_size )
+		 && ( memory_compare(
+		       entry->name,
+		       name,
+		       name_size ) == 0 ) )
+		{
+			*entry_index = (int) safe_entry_index;
+
+			return( 1 );
+		}
+		safe_entry_index = ( safe_entry_index + 1 ) & entry_mask;
+	}
+	*entry_index = (int) safe_entry_index;
+
+	return( 0 );
+}
+
+/* Resizes the entries
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_directory_cache_resize(
+     libcpath_internal_directory_cache_t *internal_directory_cache,
+     int number_of_allocated_entries,
+     libcerror_error_t **error )
+{
+	libcpath_directory_cache_entry_t *entries = NULL;
+	libcpath_directory_cache_entry_t *entry   = NULL;
+	static char *function                     = "libcpath_internal_directory_cache_resize";
+	size_t entries_size                       = 0;
+	uint32_t entry_mask                       = 0;
+	uint32_t new_entry_index                  = 0;
+	int entry_index                           = 0;
+
+	if( internal_directory_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_allocated_entries <= internal_directory_cache->number_of_directories )
+	 || ( ( number_of_allocated_entries & ( number_of_allocated_entries - 1 ) ) != 0 )
+	 || ( (size_t) number_of_allocated_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libcpath_directory_cache_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of allocated entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entries_size = sizeof( libcpath_directory_cache_entry_t ) * number_of_allocated_entries;
+
+	entries = (libcpath_directory_cache_entry_t *) memory_allocate(
+	                                                entries_size );
+
+	if( entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     entries,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		memory_free(
+		 entries );
+
+		return( -1 );
+	}
+	entry_mask = (uint32_t) number_of_allocated_entries - 1;
+
+	/* The names in the entries are unique so they only need to be
+	 * placed at the first unused entry
+	 */
+	for( entry_index = 0;
+	     entry_index < internal_directory_cache->number_of_allocated_entries;
+	     entry_index++ )
+	{
+		entry = &( internal_directory_cache->entries[ entry_index ] );
+
+		if( entry->name == NULL )
+		{
+			continue;
+		}
+		new_entry_index = entry->hash & entry_mask;
+
+		while( entries[ new_entry_index ].name != NULL )
+		{
+			new_entry_index = ( new_entry_index + 1 ) & entry_mask;
+		}
+		entries[ new_entry_index ] = *entry;
+	}
+	if( internal_directory_cache->entries != NULL )
+	{
+		memory_free(
+		 internal_directory_cache->entries );
+	}
+	internal_directory_cache->entries                     = entries;
+	internal_directory_cache->number_of_allocated_entries = number_of_allocated_entries;
+
+	return( 1 );
+}
+
+/* Determines if the directory cache contains a directory name
+ * Returns 1 if the directory name was found, 0 if not or -1 on error
+ */
+int libcpath_internal_directory_cache_has_directory(
+     libcpath_internal_directory_cache_t *internal_directory_cache,
+     const uint8_t *name,
+     size_t name_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_internal_directory_cache_has_directory";
+	uint32_t hash         = 0;
+	int entry_index       = 0;
+	int result            = 0;
+
+	if( internal_directory_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_directory_cache_calculate_hash(
+	     name,
+	     name_size,
+	     &hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_directory_cache->number_of_directories == 0 )
+	{
+		return( 0 );
+	}
+	result = libcpath_internal_directory_cache_get_entry_index(
+	          internal_directory_cache,
+	          name,
+	          name_size,
+	          hash,
+	          &entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry index.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Inserts a directory name into the directory cache
+ * Returns 1 if successful, 0 if the directory name already exists or -1 on error
+ */
+int libcpath_internal_directory_cache_insert_directory(
+     libcpath_internal_directory_cache_t *internal_directory_cache,
+     const uint8_t *name,
+     size_t name_size,
+     libcerror_error_t **error )
+{
+	libcpath_directory_cache_entry_t *entry = NULL;
+	uint8_t *safe_name                      = NULL;
+	static char *function                   = "libcpath_internal_directory_cache_insert_directory";
+	uint32_t hash                           = 0;
+	int entry_index                         = 0;
+	int number_of_allocated_entries         = 0;
+	int result                              = 0;
+
+	if( internal_directory_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid name size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_directory_cache_calculate_hash(
+	     name,
+	     name_size,
+	     &hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate hash.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the entries at most 3/4 used
+	 */
+	if( ( ( (size_t) internal_directory_cache->number_of_directories + 1 ) * 4 ) > ( (size_t) internal_directory_cache->number_of_allocated_entries * 3 ) )
+	{
+		if( internal_directory_cache->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = 64;
+		}
+		else if( (size_t) internal_directory_cache->number_of_allocated_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( libcpath_directory_cache_entry_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		else
+		{
+			number_of_allocated_entries = internal_directory_cache->number_of_allocated_entries * 2;
+		}
+		if( libcpath_internal_directory_cache_resize(
+		     internal_directory_cache,
+		     number_of_allocated_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = libcpath_internal_directory_cache_get_entry_index(
+	          internal_directory_cache,
+	          name,
+	          name_size,
+	          hash,
+	          &entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry index.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		return( 0 );
+	}
+	safe_name = (uint8_t *) memory_allocate(
+	                         name_size );
+
+	if( safe_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     safe_name,
+	     name,
+	     name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		memory_free(
+		 safe_name );
+
+		return( -1 );
+	}
+	entry = &( internal_directory_cache->entries[ entry_index ] );
+
+	entry->hash      = hash;
+	entry->name      = safe_name;
+	entry->name_size = name_size;
+
+	internal_directory_cache->number_of_directories += 1;
+
+	return( 1 );
+}
+
+/* Makes the directory and all of its missing parent directories
+ * The directory cache remembers the directories that were made or found
+ * to exist, so that making them again costs no system call
+ * The directory name is made a full path, as by libcpath_path_get_full_path,
+ * hence a relative directory name is relative to the current working directory
+ * at the time of the call and ".." segments are applied lexically
+ * Directories that are removed after they were cached are not detected
+ * The mode is ignored on Windows
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_cache_make_directories(
+     libcpath_directory_cache_t *directory_cache,
+     const char *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_cache_t *internal_directory_cache = NULL;
+	char *safe_directory_name                                     = NULL;
+	static char *function                                         = "libcpath_directory_cache_make_directories";
+	size_t name_index                                             = 0;
+	size_t root_length                                            = 0;
+	size_t safe_directory_name_size                               = 0;
+	size_t string_length                                          = 0;
+	int result                                                    = 0;
+
+	if( directory_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_cache = (libcpath_internal_directory_cache_t *) directory_cache;
+
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( directory_name_length == 0 )
+	 || ( directory_name_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The full path is used so that equivalent directory names use the same entry
+	 * and relative directory names do not depend on the current working directory
+	 */
+	if( libcpath_internal_path_get_full_path(
+	     directory_name,
+	     directory_name_length,
+	     &safe_directory_name,
+	     &safe_directory_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine full path.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( safe_directory_name == NULL )
+	 || ( safe_directory_name_size == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing full path.",
+		 function );
+
+		goto on_error;
+	}
+	string_length = safe_directory_name_size - 1;
+
+	if( libcpath_path_get_root_length(
+	     safe_directory_name,
+	     string_length,
+	     &root_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine root length.",
+		 function );
+
+		goto on_error;
+	}
+	if( string_length <= root_length )
+	{
+		memory_free(
+		 safe_directory_name );
+
+		return( 1 );
+	}
+	directory_name_length = string_length;
+
+	/* Walk upwards until a directory is known, could be made or already exists
+	 * the directory name is terminated at each parent directory that is tried
+	 */
+	do
+	{
+		result = libcpath_internal_directory_cache_has_directory(
+		          internal_directory_cache,
+		          (uint8_t *) safe_directory_name,
+		          sizeof( char ) * string_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if directory cache contains directory.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			break;
+		}
+		result = libcpath_path_make_directory_component(
+		          safe_directory_name,
+		          mode,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to make directory.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libcpath_internal_directory_cache_insert_directory(
+			     internal_directory_cache,
+			     (uint8_t *) safe_directory_name,
+			     sizeof( char ) * string_length,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert directory.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+		}
+		name_index = string_length;
+
+		while( ( name_index > root_length )
+		    && ( safe_directory_name[ name_index - 1 ] != (char) LIBCPATH_SEPARATOR ) )
+		{
+			name_index--;
+		}
+		if( name_index <= root_length )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: missing parent directory.",
+			 function );
+
+			goto on_error;
+		}
+		string_length = name_index - 1;
+
+		safe_directory_name[ string_length ] = 0;
+	}
+	while( result == 0 );
+
+	/* Walk downwards and make the remaining directories
+	 * which are known not to exist
+	 */
+	while( string_length < directory_name_length )
+	{
+		safe_directory_name[ string_length++ ] = (char) LIBCPATH_SEPARATOR;
+
+		while( ( string_length < directory_name_length )
+		    && ( safe_directory_name[ string_length ] != 0 ) )
+		{
+			string_length++;
+		}
+		if( libcpath_path_make_directory_component(
+		     safe_directory_name,
+		     mode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to make directory.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcpath_internal_directory_cache_insert_directory(
+		     internal_directory_cache,
+		     (uint8_t *) safe_directory_name,
+		     sizeof( char ) * string_length,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert directory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 safe_directory_name );
+
+	return( 1 );
+
+on_error:
+	if( safe_directory_name != NULL )
+	{
+		memory_free(
+		 safe_directory_name );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+#if defined( WINAPI )
+
+/* Makes the directory and all of its missing parent directories
+ * The directory cache remembers the directories that were made or found
+ * to exist, so that making them again costs no system call
+ * The directory name is made a full path, as by libcpath_path_get_full_path,
+ * hence a relative directory name is relative to the current working directory
+ * at the time of the call and ".." segments are applied lexically
+ * Directories that are removed after they were cached are not detected
+ * The mode is ignored on Windows
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_cache_make_directories_wide(
+     libcpath_directory_cache_t *directory_cache,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_cache_t *internal_directory_cache = NULL;
+	wchar_t *safe_directory_name                                  = NULL;
+	static char *function                                         = "libcpath_directory_cache_make_directories_wide";
+	size_t name_index                                             = 0;
+	size_t root_length                                            = 0;
+	size_t safe_directory_name_size                               = 0;
+	size_t string_length                                          = 0;
+	int result                                                    = 0;
+
+	if( directory_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_cache = (libcpath_internal_directory_cache_t *) directory_cache;
+
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( directory_name_length == 0 )
+	 || ( directory_name_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The full path is used so that equivalent directory names use the same entry
+	 * and relative directory names do not depend on the current working directory
+	 */
+	if( libcpath_internal_path_get_full_path_wide(
+	     directory_name,
+	     directory_name_length,
+	     &safe_directory_name,
+	     &safe_directory_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine full path.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( safe_directory_name == NULL )
+	 || ( safe_directory_name_size == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing full path.",
+		 function );
+
+		goto on_error;
+	}
+	string_length = safe_directory_name_size - 1;
+
+	if( libcpath_path_get_root_length_wide(
+	     safe_directory_name,
+	     string_length,
+	     &root_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine root length.",
+		 function );
+
+		goto on_error;
+	}
+	if( string_length <= root_length )
+	{
+		memory_free(
+		 safe_directory_name );
+
+		return( 1 );
+	}
+	directory_name_length = string_length;
+
+	/* Walk upwards until a directory is known, could be made or already exists
+	 * the directory name is terminated at each parent directory that is tried
+	 */
+	do
+	{
+		result = libcpath_internal_directory_cache_has_directory(
+		          internal_directory_cache,
+		          (uint8_t *) safe_directory_name,
+		          sizeof( wchar_t ) * string_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if directory cache contains directory.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			break;
+		}
+		result = libcpath_path_make_directory_component_wide(
+		          safe_directory_name,
+		          mode,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to make directory.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libcpath_internal_directory_cache_insert_directory(
+			     internal_directory_cache,
+			     (uint8_t *) safe_directory_name,
+			     sizeof( wchar_t ) * string_length,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert directory.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+		}
+		name_index = string_length;
+
+		while( ( name_index > root_length )
+		    && ( safe_directory_name[ name_index - 1 ] != (wchar_t) LIBCPATH_SEPARATOR ) )
+		{
+			name_index--;
+		}
+		if( name_index <= root_length )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: missing parent directory.",
+			 function );
+
+			goto on_error;
+		}
+		string_length = name_index - 1;
+
+		safe_directory_name[ string_length ] = 0;
+	}
+	while( result == 0 );
+
+	/* Walk downwards and make the remaining directories
+	 * which are known not to exist
+	 */
+	while( string_length < directory_name_length )
+	{
+		safe_directory_name[ string_length++ ] = (wchar_t) LIBCPATH_SEPARATOR;
+
+		while( ( string_length < directory_name_length )
+		    && ( safe_directory_name[ string_length ] != 0 ) )
+		{
+			string_length++;
+		}
+		if( libcpath_path_make_directory_component_wide(
+		     safe_directory_name,
+		     mode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to make directory.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcpath_internal_directory_cache_insert_directory(
+		     internal_directory_cache,
+		     (uint8_t *) safe_directory_name,
+		     sizeof( wchar_t ) * string_length,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert directory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 safe_directory_name );
+
+	return( 1 );
+
+on_error:
+	if( safe_directory_name != NULL )
+	{
+		memory_free(
+		 safe_directory_name );
+	}
+	return( -1 );
+}
+
+#else
+
+/* Makes the directory and all of its missing parent directories
+ * This function converts the directory name to a narrow string once
+ * and uses libcpath_directory_cache_make_directories
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_cache_make_directories_wide(
+     libcpath_directory_cache_t *directory_cache,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error )
+{
+	char narrow_directory_name_buffer[ LIBCPATH_SYSTEM_STRING_BUFFER_SIZE ];
+
+	char *narrow_directory_name       = NULL;
+	static char *function             = "libcpath_directory_cache_make_directories_wide";
+	size_t narrow_directory_name_size = 0;
+
+	if( directory_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( directory_name_length == 0 )
+	 || ( directory_name_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_system_string_convert_from_wide_string_with_buffer(
+	     directory_name,
+	     directory_name_length + 1,
+	     narrow_directory_name_buffer,
+	     LIBCPATH_SYSTEM_STRING_BUFFER_SIZE,
+	     &narrow_directory_name,
+	     &narrow_directory_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set narrow directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_directory_cache_make_directories(
+	     directory_cache,
+	     narrow_directory_name,
+	     narrow_directory_name_size - 1,
+	     mode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to make directories.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_directory_name != narrow_directory_name_buffer )
+	{
+		memory_free(
+		 narrow_directory_name );
+	}
+	return( 1 );
+
+on_error:
+	if( ( narrow_directory_name != NULL )
+	 && ( narrow_directory_name != narrow_directory_name_buffer ) )
+	{
+		memory_free(
+		 narrow_directory_name );
+	}
+	return( -1 );
+}
+
+#endif /* defined( WINAPI ) */
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
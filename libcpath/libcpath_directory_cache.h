@@ -0,0 +1,153 @@
+/*
+ * Directory cache functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCPATH_DIRECTORY_CACHE_H )
+#define _LIBCPATH_DIRECTORY_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcpath_extern.h"
+#include "libcpath_libcerror.h"
+#include "libcpath_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcpath_directory_cache_entry libcpath_directory_cache_entry_t;
+
+struct libcpath_directory_cache_entry
+{
+	/* The hash of the directory name
+	 */
+	uint32_t hash;
+
+	/* The directory name
+	 * This contains the narrow or wide directory name without
+	 * the end-of-string character
+	 */
+	uint8_t *name;
+
+	/* The directory name size
+	 * The number of bytes in the directory name
+	 */
+	size_t name_size;
+};
+
+typedef struct libcpath_internal_directory_cache libcpath_internal_directory_cache_t;
+
+struct libcpath_internal_directory_cache
+{
+	/* The entries
+	 * The entries form an open addressing hash table, an entry without
+	 * a name is unused
+	 */
+	libcpath_directory_cache_entry_t *entries;
+
+	/* The number of allocated entries
+	 * This is either 0 or a power of 2
+	 */
+	int number_of_allocated_entries;
+
+	/* The number of directories
+	 */
+	int number_of_directories;
+};
+
+LIBCPATH_EXTERN \
+int libcpath_directory_cache_initialize(
+     libcpath_directory_cache_t **directory_cache,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_directory_cache_free(
+     libcpath_directory_cache_t **directory_cache,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_directory_cache_clear(
+     libcpath_directory_cache_t *directory_cache,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_directory_cache_get_number_of_directories(
+     libcpath_directory_cache_t *directory_cache,
+     int *number_of_directories,
+     libcerror_error_t **error );
+
+int libcpath_directory_cache_calculate_hash(
+     const uint8_t *name,
+     size_t name_size,
+     uint32_t *hash,
+     libcerror_error_t **error );
+
+int libcpath_internal_directory_cache_get_entry_index(
+     libcpath_internal_directory_cache_t *internal_directory_cache,
+     const uint8_t *name,
+     size_t name_size,
+     uint32_t hash,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libcpath_internal_directory_cache_resize(
+     libcpath_internal_directory_cache_t *internal_directory_cache,
+     int number_of_allocated_entries,
+     libcerror_error_t **error );
+
+int libcpath_internal_directory_cache_has_directory(
+     libcpath_internal_directory_cache_t *internal_directory_cache,
+     const uint8_t *name,
+     size_t name_size,
+     libcerror_error_t **error );
+
+int libcpath_internal_directory_cache_insert_directory(
+     libcpath_internal_directory_cache_t *internal_directory_cache,
+     const uint8_t *name,
+     size_t name_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_directory_cache_make_directories(
+     libcpath_directory_cache_t *directory_cache,
+     const char *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBCPATH_EXTERN \
+int libcpath_directory_cache_make_directories_wide(
+     libcpath_directory_cache_t *directory_cache,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCPATH_DIRECTORY_CACHE_H ) */
+
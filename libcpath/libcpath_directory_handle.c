@@ -0,0 +1,2306 @@
+/*
+ * Directory handle functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libcpath_definitions.h"
+#include "libcpath_directory_handle.h"
+#include "libcpath_libcerror.h"
+#include "libcpath_memory.h"
+#include "libcpath_path.h"
+#include "libcpath_system_string.h"
+#include "libcpath_types.h"
+
+#if defined( HAVE_LIBCPATH_DIRECTORY_DESCRIPTOR )
+
+#if !defined( O_CLOEXEC )
+#define O_CLOEXEC	0
+#endif
+
+#if !defined( O_DIRECTORY )
+#define O_DIRECTORY	0
+#endif
+
+#define LIBCPATH_DIRECTORY_HANDLE_OPEN_FLAGS \
+	( O_RDONLY | O_CLOEXEC | O_DIRECTORY )
+
+#endif /* defined( HAVE_LIBCPATH_DIRECTORY_DESCRIPTOR ) */
+
+/* Creates a directory handle
+ * Make sure the value directory_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_handle_initialize(
+     libcpath_directory_handle_t **directory_handle,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_handle_t *internal_directory_handle = NULL;
+	static char *function                                           = "libcpath_directory_handle_initialize";
+
+	if( directory_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_handle = memory_allocate_structure(
+	                             libcpath_internal_directory_handle_t );
+
+	if( internal_directory_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_directory_handle,
+	     0,
+	     sizeof( libcpath_internal_directory_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear directory handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBCPATH_DIRECTORY_DESCRIPTOR )
+	internal_directory_handle->descriptor = -1;
+#endif
+
+	*directory_handle = (libcpath_directory_handle_t *) internal_directory_handle;
+
+	return( 1 );
+
+on_error:
+	if( internal_directory_handle != NULL )
+	{
+		memory_free(
+		 internal_directory_handle );
+	}
+	return( -1 );
+}
+
+/* Frees a directory handle
+ * The directory handle is closed if necessary
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_handle_free(
+     libcpath_directory_handle_t **directory_handle,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_handle_t *internal_directory_handle = NULL;
+	static char *function                                           = "libcpath_directory_handle_free";
+	int result                                                      = 1;
+
+	if( directory_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory_handle != NULL )
+	{
+		internal_directory_handle = (libcpath_internal_directory_handle_t *) *directory_handle;
+
+		if( libcpath_internal_directory_handle_is_open(
+		     internal_directory_handle,
+		     NULL ) == 1 )
+		{
+			if( libcpath_directory_handle_close(
+			     *directory_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close directory handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		*directory_handle = NULL;
+
+		memory_free(
+		 internal_directory_handle );
+	}
+	return( result );
+}
+
+/* Determines if the directory handle is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libcpath_internal_directory_handle_is_open(
+     libcpath_internal_directory_handle_t *internal_directory_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_internal_directory_handle_is_open";
+
+	if( internal_directory_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCPATH_DIRECTORY_DESCRIPTOR )
+	if( internal_directory_handle->descriptor == -1 )
+	{
+		return( 0 );
+	}
+#elif defined( HAVE_WIDE_CHARACTER_TYPE ) && defined( WINAPI )
+	if( ( internal_directory_handle->name == NULL )
+	 && ( internal_directory_handle->name_wide == NULL ) )
+	{
+		return( 0 );
+	}
+#else
+	if( internal_directory_handle->name == NULL )
+	{
+		return( 0 );
+	}
+#endif
+	return( 1 );
+}
+
+#if defined( HAVE_LIBCPATH_DIRECTORY_DESCRIPTOR )
+
+/* Opens a directory handle
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_handle_open(
+     libcpath_directory_handle_t *directory_handle,
+     const char *directory_name,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_handle_t *internal_directory_handle = NULL;
+	static char *function                                           = "libcpath_directory_handle_open";
+
+	if( directory_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_handle = (libcpath_internal_directory_handle_t *) directory_handle;
+
+	if( internal_directory_handle->descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_handle->descriptor = open(
+	                                         directory_name,
+	                                         LIBCPATH_DIRECTORY_HANDLE_OPEN_FLAGS );
+
+	if( internal_directory_handle->descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open directory.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens a directory handle relative to a parent directory handle
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_handle_open_at(
+     libcpath_directory_handle_t *directory_handle,
+     libcpath_directory_handle_t *parent_directory_handle,
+     const char *directory_name,
+     size_t directory_name_length,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_handle_t *internal_directory_handle        = NULL;
+	libcpath_internal_directory_handle_t *internal_parent_directory_handle = NULL;
+	char *safe_directory_name                                              = NULL;
+	static char *function                                                  = "libcpath_directory_handle_open_at";
+
+	if( directory_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_handle = (libcpath_internal_directory_handle_t *) directory_handle;
+
+	if( internal_directory_handle->descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( parent_directory_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent directory handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parent_directory_handle = (libcpath_internal_directory_handle_t *) parent_directory_handle;
+
+	if( internal_parent_directory_handle->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid parent directory handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( directory_name_length == 0 )
+	 || ( directory_name_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_directory_name = narrow_string_allocate(
+	                       directory_name_length + 1 );
+
+	if( safe_directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     safe_directory_name,
+	     directory_name,
+	     directory_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory name.",
+		 function );
+
+		goto on_error;
+	}
+	safe_directory_name[ directory_name_length ] = 0;
+
+	internal_directory_handle->descriptor = openat(
+	                                         internal_parent_directory_handle->descriptor,
+	                                         safe_directory_name,
+	                                         LIBCPATH_DIRECTORY_HANDLE_OPEN_FLAGS );
+
+	if( internal_directory_handle->descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open directory.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 safe_directory_name );
+
+	return( 1 );
+
+on_error:
+	if( safe_directory_name != NULL )
+	{
+		memory_free(
+		 safe_directory_name );
+	}
+	return( -1 );
+}
+
+/* Closes a directory handle
+ * Returns 0 if successful or -1 on error
+ */
+int libcpath_directory_handle_close(
+     libcpath_directory_handle_t *directory_handle,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_handle_t *internal_directory_handle = NULL;
+	static char *function                                           = "libcpath_directory_handle_close";
+	int result                                                      = 0;
+
+	if( directory_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_handle = (libcpath_internal_directory_handle_t *) directory_handle;
+
+	if( internal_directory_handle->descriptor != -1 )
+	{
+		if( close(
+		     internal_directory_handle->descriptor ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to close directory.",
+			 function );
+
+			result = -1;
+		}
+		internal_directory_handle->descriptor = -1;
+	}
+	return( result );
+}
+
+/* Changes the current working directory to the directory of the handle
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_handle_change_directory(
+     libcpath_directory_handle_t *directory_handle,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_handle_t *internal_directory_handle = NULL;
+	static char *function                                           = "libcpath_directory_handle_change_directory";
+
+	if( directory_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_handle = (libcpath_internal_directory_handle_t *) directory_handle;
+
+	if( internal_directory_handle->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( fchdir(
+	     internal_directory_handle->descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 errno,
+		 "%s: unable to change directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_clear_current_working_directory_cache(
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear current working directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Makes a directory relative to the directory handle
+ * An already existing directory is not considered an error
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_handle_make_directory_at(
+     libcpath_directory_handle_t *directory_handle,
+     const char *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error )
+{
+	struct stat file_statistics;
+
+	libcpath_internal_directory_handle_t *internal_directory_handle = NULL;
+	char *safe_directory_name                                       = NULL;
+	static char *function                                           = "libcpath_directory_handle_make_directory_at";
+	int error_code                                                  = 0;
+
+	if( directory_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_handle = (libcpath_internal_directory_handle_t *) directory_handle;
+
+	if( internal_directory_handle->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( directory_name_length == 0 )
+	 || ( directory_name_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_directory_name = narrow_string_allocate(
+	                       directory_name_length + 1 );
+
+	if( safe_directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     safe_directory_name,
+	     directory_name,
+	     directory_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory name.",
+		 function );
+
+		goto on_error;
+	}
+	safe_directory_name[ directory_name_length ] = 0;
+
+	if( mkdirat(
+	     internal_directory_handle->descriptor,
+	     safe_directory_name,
+	     (mode_t) mode ) != 0 )
+	{
+		error_code = errno;
+
+		if( ( error_code != EEXIST )
+		 || ( fstatat(
+		       internal_directory_handle->descriptor,
+		       safe_directory_name,
+		       &file_statistics,
+		       0 ) != 0 )
+		 || ( S_ISDIR( file_statistics.st_mode ) == 0 ) )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 error_code,
+			 "%s: unable to make directory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 safe_directory_name );
+
+	return( 1 );
+
+on_error:
+	if( safe_directory_name != NULL )
+	{
+		memory_free(
+		 safe_directory_name );
+	}
+	return( -1 );
+}
+
+/* Makes a directory and all of its missing parent directories relative
+ * to the directory handle
+ * Every directory is looked up relative to its parent directory, so that
+ * each step resolves a single path component
+ * An already existing directory is not considered an error
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_handle_make_directories_at(
+     libcpath_directory_handle_t *directory_handle,
+     const char *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_handle_t *internal_directory_handle = NULL;
+	char *safe_directory_name                                       = NULL;
+	static char *function                                           = "libcpath_directory_handle_make_directories_at";
+	size_t name_index                                               = 0;
+	size_t segment_length                                           = 0;
+	size_t segment_start_index                                      = 0;
+	int descriptor                                                  = -1;
+	int error_code                                                  = 0;
+	int parent_descriptor                                           = -1;
+	int parent_was_made                                             = 0;
+
+	if( directory_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_handle = (libcpath_internal_directory_handle_t *) directory_handle;
+
+	if( internal_directory_handle->descriptor == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( directory_name_length == 0 )
+	 || ( directory_name_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name[ 0 ] == (char) LIBCPATH_SEPARATOR )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported absolute directory name.",
+		 function );
+
+		return( -1 );
+	}
+	safe_directory_name = narrow_string_allocate(
+	                       directory_name_length + 1 );
+
+	if( safe_directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     safe_directory_name,
+	     directory_name,
+	     directory_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory name.",
+		 function );
+
+		goto on_error;
+	}
+	safe_directory_name[ directory_name_length ] = 0;
+
+	parent_descriptor = internal_directory_handle->descriptor;
+
+	while( name_index < directory_name_length )
+	{
+		segment_start_index = name_index;
+
+		while( ( name_index < directory_name_length )
+		    && ( safe_directory_name[ name_index ] != (char) LIBCPATH_SEPARATOR ) )
+		{
+			name_index++;
+		}
+		segment_length = name_index - segment_start_index;
+
+		/* Terminate the segment, the end of the directory name already is
+		 */
+		safe_directory_name[ name_index++ ] = 0;
+
+		if( ( segment_length == 0 )
+		 || ( ( segment_length == 1 )
+		  &&  ( safe_directory_name[ segment_start_index ] == '.' ) ) )
+		{
+			continue;
+		}
+		/* A directory in a directory that was just made does not exist yet
+		 */
+		descriptor = -1;
+
+		if( parent_was_made == 0 )
+		{
+			descriptor = openat(
+			              parent_descriptor,
+			              &( safe_directory_name[ segment_start_index ] ),
+			              LIBCPATH_DIRECTORY_HANDLE_OPEN_FLAGS );
+
+			if( ( descriptor == -1 )
+			 && ( errno != ENOENT ) )
+			{
+				error_code = errno;
+
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 error_code,
+				 "%s: unable to open directory.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( descriptor == -1 )
+		{
+			if( mkdirat(
+			     parent_descriptor,
+			     &( safe_directory_name[ segment_start_index ] ),
+			     (mode_t) mode ) == 0 )
+			{
+				parent_was_made = 1;
+			}
+			else if( errno != EEXIST )
+			{
+				error_code = errno;
+
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 error_code,
+				 "%s: unable to make directory.",
+				 function );
+
+				goto on_error;
+			}
+			descriptor = openat(
+			              parent_descriptor,
+			              &( safe_directory_name[ segment_start_index ] ),
+			              LIBCPATH_DIRECTORY_HANDLE_OPEN_FLAGS );
+
+			if( descriptor == -1 )
+			{
+				error_code = errno;
+
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 error_code,
+				 "%s: unable to open directory.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( parent_descriptor != internal_directory_handle->descriptor )
+		{
+			close(
+			 parent_descriptor );
+		}
+		parent_descriptor = descriptor;
+		descriptor        = -1;
+	}
+	if( parent_descriptor != internal_directory_handle->descriptor )
+	{
+		close(
+		 parent_descriptor );
+	}
+	memory_free(
+	 safe_directory_name );
+
+	return( 1 );
+
+on_error:
+	if( ( parent_descriptor != -1 )
+	 && ( parent_descriptor != internal_directory_handle->descriptor ) )
+	{
+		close(
+		 parent_descriptor );
+	}
+	if( safe_directory_name != NULL )
+	{
+		memory_free(
+		 safe_directory_name );
+	}
+	return( -1 );
+}
+
+#else
+
+/* Opens a directory handle
+ * This function retains the directory name since the *at functions are not available
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_handle_open(
+     libcpath_directory_handle_t *directory_handle,
+     const char *directory_name,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_handle_t *internal_directory_handle = NULL;
+	static char *function                                           = "libcpath_directory_handle_open";
+	size_t directory_name_length                                    = 0;
+
+	if( directory_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_handle = (libcpath_internal_directory_handle_t *) directory_handle;
+
+	if( libcpath_internal_directory_handle_is_open(
+	     internal_directory_handle,
+	     NULL ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	directory_name_length = narrow_string_length(
+	                         directory_name );
+
+	if( ( directory_name_length == 0 )
+	 || ( directory_name_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_handle->name = narrow_string_allocate(
+	                                   directory_name_length + 1 );
+
+	if( internal_directory_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     internal_directory_handle->name,
+	     directory_name,
+	     directory_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory name.",
+		 function );
+
+		goto on_error;
+	}
+	internal_directory_handle->name[ directory_name_length ] = 0;
+
+	internal_directory_handle->name_size = directory_name_length + 1;
+
+	return( 1 );
+
+on_error:
+	if( internal_directory_handle->name != NULL )
+	{
+		memory_free(
+		 internal_directory_handle->name );
+
+		internal_directory_handle->name = NULL;
+	}
+	return( -1 );
+}
+
+/* Opens a directory handle relative to a parent directory handle
+ * This function retains the joined directory name since the *at functions are not available
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_handle_open_at(
+     libcpath_directory_handle_t *directory_handle,
+     libcpath_directory_handle_t *parent_directory_handle,
+     const char *directory_name,
+     size_t directory_name_length,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_handle_t *internal_directory_handle        = NULL;
+	libcpath_internal_directory_handle_t *internal_parent_directory_handle = NULL;
+	static char *function                                                  = "libcpath_directory_handle_open_at";
+
+	if( directory_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_handle = (libcpath_internal_directory_handle_t *) directory_handle;
+
+	if( libcpath_internal_directory_handle_is_open(
+	     internal_directory_handle,
+	     NULL ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( parent_directory_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent directory handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parent_directory_handle = (libcpath_internal_directory_handle_t *) parent_directory_handle;
+
+	if( internal_parent_directory_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid parent directory handle - missing narrow name.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( directory_name_length == 0 )
+	 || ( directory_name_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_join(
+	     &( internal_directory_handle->name ),
+	     &( internal_directory_handle->name_size ),
+	     internal_parent_directory_handle->name,
+	     internal_parent_directory_handle->name_size - 1,
+	     directory_name,
+	     directory_name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to join directory name.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes a directory handle
+ * Returns 0 if successful or -1 on error
+ */
+int libcpath_directory_handle_close(
+     libcpath_directory_handle_t *directory_handle,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_handle_t *internal_directory_handle = NULL;
+	static char *function                                           = "libcpath_directory_handle_close";
+
+	if( directory_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_handle = (libcpath_internal_directory_handle_t *) directory_handle;
+
+	if( internal_directory_handle->name != NULL )
+	{
+		memory_free(
+		 internal_directory_handle->name );
+
+		internal_directory_handle->name      = NULL;
+		internal_directory_handle->name_size = 0;
+	}
+#if defined( HAVE_WIDE_CHARACTER_TYPE ) && defined( WINAPI )
+	if( internal_directory_handle->name_wide != NULL )
+	{
+		memory_free(
+		 internal_directory_handle->name_wide );
+
+		internal_directory_handle->name_wide      = NULL;
+		internal_directory_handle->name_wide_size = 0;
+	}
+#endif
+	return( 0 );
+}
+
+/* Changes the current working directory to the directory of the handle
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_handle_change_directory(
+     libcpath_directory_handle_t *directory_handle,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_handle_t *internal_directory_handle = NULL;
+	static char *function                                           = "libcpath_directory_handle_change_directory";
+	int result                                                      = 0;
+
+	if( directory_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_handle = (libcpath_internal_directory_handle_t *) directory_handle;
+
+	if( internal_directory_handle->name != NULL )
+	{
+		result = libcpath_path_change_directory(
+		          internal_directory_handle->name,
+		          error );
+	}
+#if defined( HAVE_WIDE_CHARACTER_TYPE ) && defined( WINAPI )
+	else if( internal_directory_handle->name_wide != NULL )
+	{
+		result = libcpath_path_change_directory_wide(
+		          internal_directory_handle->name_wide,
+		          error );
+	}
+#endif
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory handle - not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to change directory.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Makes a directory relative to the directory handle
+ * This function joins the directory names since the *at functions are not available
+ * An already existing directory is not considered an error
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_handle_make_directory_at(
+     libcpath_directory_handle_t *directory_handle,
+     const char *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_handle_t *internal_directory_handle = NULL;
+	char *path                                                      = NULL;
+	static char *function                                           = "libcpath_directory_handle_make_directory_at";
+	size_t path_size                                                = 0;
+	int result                                                      = 0;
+
+	if( directory_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_handle = (libcpath_internal_directory_handle_t *) directory_handle;
+
+	if( internal_directory_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory handle - missing narrow name.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( directory_name_length == 0 )
+	 || ( directory_name_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_join(
+	     &path,
+	     &path_size,
+	     internal_directory_handle->name,
+	     internal_directory_handle->name_size - 1,
+	     directory_name,
+	     directory_name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to join directory name.",
+		 function );
+
+		goto on_error;
+	}
+	result = libcpath_path_make_directory_component(
+	          path,
+	          mode,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to make directory.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 path );
+
+	return( 1 );
+
+on_error:
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	return( -1 );
+}
+
+/* Makes a directory and all of its missing parent directories relative
+ * to the directory handle
+ * This function joins the directory names since the *at functions are not available
+ * An already existing directory is not considered an error
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_handle_make_directories_at(
+     libcpath_directory_handle_t *directory_handle,
+     const char *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_handle_t *internal_directory_handle = NULL;
+	char *path                                                      = NULL;
+	static char *function                                           = "libcpath_directory_handle_make_directories_at";
+	size_t path_size                                                = 0;
+
+	if( directory_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_handle = (libcpath_internal_directory_handle_t *) directory_handle;
+
+	if( internal_directory_handle->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory handle - missing narrow name.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( directory_name_length == 0 )
+	 || ( directory_name_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name[ 0 ] == (char) LIBCPATH_SEPARATOR )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported absolute directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_join(
+	     &path,
+	     &path_size,
+	     internal_directory_handle->name,
+	     internal_directory_handle->name_size - 1,
+	     directory_name,
+	     directory_name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to join directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_internal_path_make_directories(
+	     path,
+	     path_size - 1,
+	     mode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to make directories.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 path );
+
+	return( 1 );
+
+on_error:
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBCPATH_DIRECTORY_DESCRIPTOR ) */
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+#if !defined( WINAPI )
+
+/* Retrieves a narrow name from a wide name
+ * The narrow name is stored in the buffer if it is large enough, otherwise
+ * it is allocated and should be freed if it does not point to the buffer
+ * The narrow name size includes the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_handle_get_narrow_name(
+     const wchar_t *name,
+     size_t name_length,
+     char *buffer,
+     size_t buffer_size,
+     char **narrow_name,
+     size_t *narrow_name_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_directory_handle_get_narrow_name";
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_length == 0 )
+	 || ( name_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_system_string_convert_from_wide_string_with_buffer(
+	     name,
+	     name_length + 1,
+	     buffer,
+	     buffer_size,
+	     narrow_name,
+	     narrow_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set narrow name.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens a directory handle
+ * This function converts the directory name to a narrow string
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_handle_open_wide(
+     libcpath_directory_handle_t *directory_handle,
+     const wchar_t *directory_name,
+     libcerror_error_t **error )
+{
+	char narrow_directory_name_buffer[ LIBCPATH_SYSTEM_STRING_BUFFER_SIZE ];
+
+	char *narrow_directory_name       = NULL;
+	static char *function             = "libcpath_directory_handle_open_wide";
+	size_t narrow_directory_name_size = 0;
+
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_directory_handle_get_narrow_name(
+	     directory_name,
+	     wide_string_length(
+	      directory_name ),
+	     narrow_directory_name_buffer,
+	     LIBCPATH_SYSTEM_STRING_BUFFER_SIZE,
+	     &narrow_directory_name,
+	     &narrow_directory_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to retrieve narrow directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_directory_handle_open(
+	     directory_handle,
+	     narrow_directory_name,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_directory_name != narrow_directory_name_buffer )
+	{
+		memory_free(
+		 narrow_directory_name );
+	}
+	return( 1 );
+
+on_error:
+	if( ( narrow_directory_name != NULL )
+	 && ( narrow_directory_name != narrow_directory_name_buffer ) )
+	{
+		memory_free(
+		 narrow_directory_name );
+	}
+	return( -1 );
+}
+
+/* Opens a directory handle relative to a parent directory handle
+ * This function converts the directory name to a narrow string
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_handle_open_at_wide(
+     libcpath_directory_handle_t *directory_handle,
+     libcpath_directory_handle_t *parent_directory_handle,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     libcerror_error_t **error )
+{
+	char narrow_directory_name_buffer[ LIBCPATH_SYSTEM_STRING_BUFFER_SIZE ];
+
+	char *narrow_directory_name       = NULL;
+	static char *function             = "libcpath_directory_handle_open_at_wide";
+	size_t narrow_directory_name_size = 0;
+
+	if( libcpath_directory_handle_get_narrow_name(
+	     directory_name,
+	     directory_name_length,
+	     narrow_directory_name_buffer,
+	     LIBCPATH_SYSTEM_STRING_BUFFER_SIZE,
+	     &narrow_directory_name,
+	     &narrow_directory_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to retrieve narrow directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_directory_handle_open_at(
+	     directory_handle,
+	     parent_directory_handle,
+	     narrow_directory_name,
+	     narrow_directory_name_size - 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open directory handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_directory_name != narrow_directory_name_buffer )
+	{
+		memory_free(
+		 narrow_directory_name );
+	}
+	return( 1 );
+
+on_error:
+	if( ( narrow_directory_name != NULL )
+	 && ( narrow_directory_name != narrow_directory_name_buffer ) )
+	{
+		memory_free(
+		 narrow_directory_name );
+	}
+	return( -1 );
+}
+
+/* Makes a directory relative to the directory handle
+ * This function converts the directory name to a narrow string
+ * An already existing directory is not considered an error
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_handle_make_directory_at_wide(
+     libcpath_directory_handle_t *directory_handle,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error )
+{
+	char narrow_directory_name_buffer[ LIBCPATH_SYSTEM_STRING_BUFFER_SIZE ];
+
+	char *narrow_directory_name       = NULL;
+	static char *function             = "libcpath_directory_handle_make_directory_at_wide";
+	size_t narrow_directory_name_size = 0;
+
+	if( libcpath_directory_handle_get_narrow_name(
+	     directory_name,
+	     directory_name_length,
+	     narrow_directory_name_buffer,
+	     LIBCPATH_SYSTEM_STRING_BUFFER_SIZE,
+	     &narrow_directory_name,
+	     &narrow_directory_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to retrieve narrow directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_directory_handle_make_directory_at(
+	     directory_handle,
+	     narrow_directory_name,
+	     narrow_directory_name_size - 1,
+	     mode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to make directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_directory_name != narrow_directory_name_buffer )
+	{
+		memory_free(
+		 narrow_directory_name );
+	}
+	return( 1 );
+
+on_error:
+	if( ( narrow_directory_name != NULL )
+	 && ( narrow_directory_name != narrow_directory_name_buffer ) )
+	{
+		memory_free(
+		 narrow_directory_name );
+	}
+	return( -1 );
+}
+
+/* Makes a directory and all of its missing parent directories relative
+ * to the directory handle
+ * This function converts the directory name to a narrow string
+ * An already existing directory is not considered an error
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_handle_make_directories_at_wide(
+     libcpath_directory_handle_t *directory_handle,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error )
+{
+	char narrow_directory_name_buffer[ LIBCPATH_SYSTEM_STRING_BUFFER_SIZE ];
+
+	char *narrow_directory_name       = NULL;
+	static char *function             = "libcpath_directory_handle_make_directories_at_wide";
+	size_t narrow_directory_name_size = 0;
+
+	if( libcpath_directory_handle_get_narrow_name(
+	     directory_name,
+	     directory_name_length,
+	     narrow_directory_name_buffer,
+	     LIBCPATH_SYSTEM_STRING_BUFFER_SIZE,
+	     &narrow_directory_name,
+	     &narrow_directory_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to retrieve narrow directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_directory_handle_make_directories_at(
+	     directory_handle,
+	     narrow_directory_name,
+	     narrow_directory_name_size - 1,
+	     mode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to make directories.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_directory_name != narrow_directory_name_buffer )
+	{
+		memory_free(
+		 narrow_directory_name );
+	}
+	return( 1 );
+
+on_error:
+	if( ( narrow_directory_name != NULL )
+	 && ( narrow_directory_name != narrow_directory_name_buffer ) )
+	{
+		memory_free(
+		 narrow_directory_name );
+	}
+	return( -1 );
+}
+
+#else
+
+/* Opens a directory handle
+ * This function retains the directory name since the *at functions are not available
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_handle_open_wide(
+     libcpath_directory_handle_t *directory_handle,
+     const wchar_t *directory_name,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_handle_t *internal_directory_handle = NULL;
+	static char *function                                           = "libcpath_directory_handle_open_wide";
+	size_t directory_name_length                                    = 0;
+
+	if( directory_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_handle = (libcpath_internal_directory_handle_t *) directory_handle;
+
+	if( libcpath_internal_directory_handle_is_open(
+	     internal_directory_handle,
+	     NULL ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	directory_name_length = wide_string_length(
+	                         directory_name );
+
+	if( ( directory_name_length == 0 )
+	 || ( directory_name_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_handle->name_wide = wide_string_allocate(
+	                                        directory_name_length + 1 );
+
+	if( internal_directory_handle->name_wide == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( wide_string_copy(
+	     internal_directory_handle->name_wide,
+	     directory_name,
+	     directory_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory name.",
+		 function );
+
+		goto on_error;
+	}
+	internal_directory_handle->name_wide[ directory_name_length ] = 0;
+
+	internal_directory_handle->name_wide_size = directory_name_length + 1;
+
+	return( 1 );
+
+on_error:
+	if( internal_directory_handle->name_wide != NULL )
+	{
+		memory_free(
+		 internal_directory_handle->name_wide );
+
+		internal_directory_handle->name_wide = NULL;
+	}
+	return( -1 );
+}
+
+/* Opens a directory handle relative to a parent directory handle
+ * This function retains the joined directory name since the *at functions are not available
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_handle_open_at_wide(
+     libcpath_directory_handle_t *directory_handle,
+     libcpath_directory_handle_t *parent_directory_handle,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_handle_t *internal_directory_handle        = NULL;
+	libcpath_internal_directory_handle_t *internal_parent_directory_handle = NULL;
+	static char *function                                                  = "libcpath_directory_handle_open_at_wide";
+
+	if( directory_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_handle = (libcpath_internal_directory_handle_t *) directory_handle;
+
+	if( libcpath_internal_directory_handle_is_open(
+	     internal_directory_handle,
+	     NULL ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( parent_directory_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent directory handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_parent_directory_handle = (libcpath_internal_directory_handle_t *) parent_directory_handle;
+
+	if( internal_parent_directory_handle->name_wide == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid parent directory handle - missing wide name.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( directory_name_length == 0 )
+	 || ( directory_name_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_join_wide(
+	     &( internal_directory_handle->name_wide ),
+	     &( internal_directory_handle->name_wide_size ),
+	     internal_parent_directory_handle->name_wide,
+	     internal_parent_directory_handle->name_wide_size - 1,
+	     directory_name,
+	     directory_name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to join directory name.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Makes a directory relative to the directory handle
+ * This function joins the directory names since the *at functions are not available
+ * An already existing directory is not considered an error
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_handle_make_directory_at_wide(
+     libcpath_directory_handle_t *directory_handle,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_handle_t *internal_directory_handle = NULL;
+	wchar_t *path                                                   = NULL;
+	static char *function                                           = "libcpath_directory_handle_make_directory_at_wide";
+	size_t path_size                                                = 0;
+	int result                                                      = 0;
+
+	if( directory_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_handle = (libcpath_internal_directory_handle_t *) directory_handle;
+
+	if( internal_directory_handle->name_wide == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory handle - missing wide name.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( directory_name_length == 0 )
+	 || ( directory_name_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_join_wide(
+	     &path,
+	     &path_size,
+	     internal_directory_handle->name_wide,
+	     internal_directory_handle->name_wide_size - 1,
+	     directory_name,
+	     directory_name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to join directory name.",
+		 function );
+
+		goto on_error;
+	}
+	result = libcpath_path_make_directory_component_wide(
+	          path,
+	          mode,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to make directory.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 path );
+
+	return( 1 );
+
+on_error:
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	return( -1 );
+}
+
+/* Makes a directory and all of its missing parent directories relative
+ * to the directory handle
+ * This function joins the directory names since the *at functions are not available
+ * An already existing directory is not considered an error
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_directory_handle_make_directories_at_wide(
+     libcpath_directory_handle_t *directory_handle,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error )
+{
+	libcpath_internal_directory_handle_t *internal_directory_handle = NULL;
+	wchar_t *path                                                   = NULL;
+	static char *function                                           = "libcpath_directory_handle_make_directories_at_wide";
+	size_t path_size                                                = 0;
+
+	if( directory_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_directory_handle = (libcpath_internal_directory_handle_t *) directory_handle;
+
+	if( internal_directory_handle->name_wide == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory handle - missing wide name.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( directory_name_length == 0 )
+	 || ( directory_name_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name[ 0 ] == (wchar_t) LIBCPATH_SEPARATOR )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported absolute directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_join_wide(
+	     &path,
+	     &path_size,
+	     internal_directory_handle->name_wide,
+	     internal_directory_handle->name_wide_size - 1,
+	     directory_name,
+	     directory_name_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to join directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_internal_path_make_directories_wide(
+	     path,
+	     path_size - 1,
+	     mode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to make directories.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 path );
+
+	return( 1 );
+
+on_error:
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	return( -1 );
+}
+
+#endif /* !defined( WINAPI ) */
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
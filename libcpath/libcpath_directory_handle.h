@@ -0,0 +1,181 @@
+/*
+ * Directory handle functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCPATH_DIRECTORY_HANDLE_H )
+#define _LIBCPATH_DIRECTORY_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcpath_extern.h"
+#include "libcpath_libcerror.h"
+#include "libcpath_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* A directory handle wraps a directory file descriptor when the *at
+ * functions are available, otherwise it falls back to the directory name
+ */
+#if !defined( WINAPI ) && defined( HAVE_FCHDIR ) && defined( HAVE_FSTATAT ) && defined( HAVE_MKDIRAT ) && defined( HAVE_OPENAT )
+#define HAVE_LIBCPATH_DIRECTORY_DESCRIPTOR	1
+#endif
+
+typedef struct libcpath_internal_directory_handle libcpath_internal_directory_handle_t;
+
+struct libcpath_internal_directory_handle
+{
+#if defined( HAVE_LIBCPATH_DIRECTORY_DESCRIPTOR )
+	/* The directory file descriptor
+	 * This value is -1 if the directory handle is not open
+	 */
+	int descriptor;
+
+#else
+	/* The narrow directory name
+	 */
+	char *name;
+
+	/* The narrow directory name size
+	 */
+	size_t name_size;
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE ) && defined( WINAPI )
+	/* The wide directory name
+	 */
+	wchar_t *name_wide;
+
+	/* The wide directory name size
+	 */
+	size_t name_wide_size;
+#endif
+
+#endif /* defined( HAVE_LIBCPATH_DIRECTORY_DESCRIPTOR ) */
+};
+
+LIBCPATH_EXTERN \
+int libcpath_directory_handle_initialize(
+     libcpath_directory_handle_t **directory_handle,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_directory_handle_free(
+     libcpath_directory_handle_t **directory_handle,
+     libcerror_error_t **error );
+
+int libcpath_internal_directory_handle_is_open(
+     libcpath_internal_directory_handle_t *internal_directory_handle,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_directory_handle_open(
+     libcpath_directory_handle_t *directory_handle,
+     const char *directory_name,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_directory_handle_open_at(
+     libcpath_directory_handle_t *directory_handle,
+     libcpath_directory_handle_t *parent_directory_handle,
+     const char *directory_name,
+     size_t directory_name_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_directory_handle_close(
+     libcpath_directory_handle_t *directory_handle,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_directory_handle_change_directory(
+     libcpath_directory_handle_t *directory_handle,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_directory_handle_make_directory_at(
+     libcpath_directory_handle_t *directory_handle,
+     const char *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_directory_handle_make_directories_at(
+     libcpath_directory_handle_t *directory_handle,
+     const char *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+#if !defined( WINAPI )
+
+int libcpath_directory_handle_get_narrow_name(
+     const wchar_t *name,
+     size_t name_length,
+     char *buffer,
+     size_t buffer_size,
+     char **narrow_name,
+     size_t *narrow_name_size,
+     libcerror_error_t **error );
+
+#endif /* !defined( WINAPI ) */
+
+LIBCPATH_EXTERN \
+int libcpath_directory_handle_open_wide(
+     libcpath_directory_handle_t *directory_handle,
+     const wchar_t *directory_name,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_directory_handle_open_at_wide(
+     libcpath_directory_handle_t *directory_handle,
+     libcpath_directory_handle_t *parent_directory_handle,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_directory_handle_make_directory_at_wide(
+     libcpath_directory_handle_t *directory_handle,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_directory_handle_make_directories_at_wide(
+     libcpath_directory_handle_t *directory_handle,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCPATH_DIRECTORY_HANDLE_H ) */
+
@@ -0,0 +1,276 @@
+/*
+ * Memory functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcpath_libcerror.h"
+#include "libcpath_memory.h"
+#include "libcpath_path.h"
+#include "libcpath_statistics.h"
+
+static void *(*libcpath_memory_allocate_function)( intptr_t *memory_context, size_t size )                  = NULL;
+static void *(*libcpath_memory_reallocate_function)( intptr_t *memory_context, void *buffer, size_t size ) = NULL;
+static void (*libcpath_memory_free_function)( intptr_t *memory_context, void *buffer )                    = NULL;
+static intptr_t *libcpath_memory_context                                                                   = NULL;
+
+/* Sets the memory functions
+ * The memory functions are used for all memory the library allocates,
+ * including the strings it returns, which must then be freed with
+ * the free function
+ * The reallocate function must behave as realloc does and allocate
+ * the buffer when it is NULL
+ * Set all functions to NULL to restore the default memory functions
+ * This function should be called before any other library function
+ * and the memory functions should not be changed while memory allocated
+ * by the library and returned to the caller is still in use
+ * Memory that is held internally, such as the current working directory
+ * cache, is freed before the memory functions are changed
+ * This function is not thread-safe and should not be called while other
+ * threads use the library
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_set_memory_functions(
+     void *(*allocate_function)(
+             intptr_t *memory_context,
+             size_t size ),
+     void *(*reallocate_function)(
+             intptr_t *memory_context,
+             void *buffer,
+             size_t size ),
+     void (*free_function)(
+            intptr_t *memory_context,
+            void *buffer ),
+     intptr_t *memory_context,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_set_memory_functions";
+
+	if( ( allocate_function == NULL )
+	 && ( reallocate_function == NULL )
+	 && ( free_function == NULL ) )
+	{
+		memory_context = NULL;
+	}
+	else if( ( allocate_function == NULL )
+	      || ( reallocate_function == NULL )
+	      || ( free_function == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory functions - all functions must be set or all must be NULL.",
+		 function );
+
+		return( -1 );
+	}
+	/* Clear the internally held memory before the memory functions are changed
+	 */
+	if( libcpath_path_clear_current_working_directory_cache(
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear current working directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	libcpath_memory_allocate_function   = allocate_function;
+	libcpath_memory_reallocate_function = reallocate_function;
+	libcpath_memory_free_function       = free_function;
+	libcpath_memory_context             = memory_context;
+
+	return( 1 );
+}
+
+/* Determines if the memory functions that were set use a specific memory context
+ * Returns 1 if the memory context is used or 0 if not
+ */
+int libcpath_memory_has_context(
+     intptr_t *memory_context )
+{
+	if( ( memory_context == NULL )
+	 || ( memory_context != libcpath_memory_context ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Allocates memory
+ * The memory is allocated by the allocate function that was set or
+ * by the default allocate function otherwise
+ * Returns a pointer to the allocated memory or NULL on error
+ */
+void *libcpath_memory_allocate(
+       size_t size )
+{
+	libcpath_statistics_count_allocation(
+	 size );
+
+	if( libcpath_memory_allocate_function != NULL )
+	{
+		return( libcpath_memory_allocate_function(
+		         libcpath_memory_context,
+		         size ) );
+	}
+	return( libcpath_memory_default_allocate(
+	         size ) );
+}
+
+/* Reallocates memory
+ * The memory is reallocated by the reallocate function that was set or
+ * by the default reallocate function otherwise
+ * Returns a pointer to the reallocated memory or NULL on error
+ */
+void *libcpath_memory_reallocate(
+       void *buffer,
+       size_t size )
+{
+	libcpath_statistics_count_allocation(
+	 size );
+
+	if( libcpath_memory_reallocate_function != NULL )
+	{
+		return( libcpath_memory_reallocate_function(
+		         libcpath_memory_context,
+		         buffer,
+		         size ) );
+	}
+	return( libcpath_memory_default_reallocate(
+	         buffer,
+	         size ) );
+}
+
+/* Frees memory
+ * The memory is freed by the free function that was set or
+ * by the default free function otherwise
+ */
+void libcpath_memory_free(
+      void *buffer )
+{
+	if( buffer == NULL )
+	{
+		return;
+	}
+	if( libcpath_memory_free_function != NULL )
+	{
+		libcpath_memory_free_function(
+		 libcpath_memory_context,
+		 buffer );
+	}
+	else
+	{
+		libcpath_memory_default_free(
+		 buffer );
+	}
+}
+
+/* Allocates memory the same way as memory_allocate in common/memory.h does
+ * Returns a pointer to the allocated memory or NULL on error
+ */
+void *libcpath_memory_default_allocate(
+       size_t size )
+{
+#if defined( HAVE_GLIB_H )
+	return( g_malloc(
+	         (gsize) size ) );
+
+#elif defined( WINAPI )
+	return( HeapAlloc(
+	         GetProcessHeap(),
+	         0,
+	         (SIZE_T) size ) );
+
+#else
+	return( malloc(
+	         size ) );
+
+#endif
+}
+
+/* Reallocates memory the same way as memory_reallocate in common/memory.h does
+ * Returns a pointer to the reallocated memory or NULL on error
+ */
+void *libcpath_memory_default_reallocate(
+       void *buffer,
+       size_t size )
+{
+#if defined( HAVE_GLIB_H )
+	return( g_realloc(
+	         (gpointer) buffer,
+	         (gsize) size ) );
+
+#elif defined( WINAPI )
+	/* HeapReAlloc does not allocate empty (NULL) buffers as realloc does
+	 */
+	if( buffer == NULL )
+	{
+		return( HeapAlloc(
+		         GetProcessHeap(),
+		         0,
+		         (SIZE_T) size ) );
+	}
+	return( HeapReAlloc(
+	         GetProcessHeap(),
+	         0,
+	         (LPVOID) buffer,
+	         (SIZE_T) size ) );
+
+#else
+	return( realloc(
+	         buffer,
+	         size ) );
+
+#endif
+}
+
+/* Frees memory the same way as memory_free in common/memory.h does
+ */
+void libcpath_memory_default_free(
+      void *buffer )
+{
+	if( buffer == NULL )
+	{
+		return;
+	}
+#if defined( HAVE_GLIB_H )
+	g_free(
+	 (gpointer) buffer );
+
+#elif defined( WINAPI )
+	HeapFree(
+	 GetProcessHeap(),
+	 0,
+	 (LPVOID) buffer );
+
+#else
+	free(
+	 buffer );
+
+#endif
+}
+
@@ -0,0 +1,96 @@
+/*
+ * Memory functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCPATH_MEMORY_H )
+#define _LIBCPATH_MEMORY_H
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libcpath_extern.h"
+#include "libcpath_libcerror.h"
+#include "libcpath_statistics.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+LIBCPATH_EXTERN \
+int libcpath_set_memory_functions(
+     void *(*allocate_function)(
+             intptr_t *memory_context,
+             size_t size ),
+     void *(*reallocate_function)(
+             intptr_t *memory_context,
+             void *buffer,
+             size_t size ),
+     void (*free_function)(
+            intptr_t *memory_context,
+            void *buffer ),
+     intptr_t *memory_context,
+     libcerror_error_t **error );
+
+int libcpath_memory_has_context(
+     intptr_t *memory_context );
+
+void *libcpath_memory_allocate(
+       size_t size );
+
+void *libcpath_memory_reallocate(
+       void *buffer,
+       size_t size );
+
+void libcpath_memory_free(
+      void *buffer );
+
+void *libcpath_memory_default_allocate(
+       size_t size );
+
+void *libcpath_memory_default_reallocate(
+       void *buffer,
+       size_t size );
+
+void libcpath_memory_default_free(
+      void *buffer );
+
+/* Redirect the memory allocation functions so that the allocations
+ * can be made by the memory functions set by the caller and can be
+ * attributed to the public function that made them
+ */
+#undef memory_allocate
+#define memory_allocate( size ) \
+	libcpath_memory_allocate( size )
+
+#undef memory_reallocate
+#define memory_reallocate( buffer, size ) \
+	libcpath_memory_reallocate( (void *) buffer, size )
+
+#undef memory_free
+#define memory_free( buffer ) \
+	libcpath_memory_free( (void *) buffer )
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCPATH_MEMORY_H ) */
+
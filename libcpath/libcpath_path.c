@@ -46,11 +46,30 @@
 #include <unistd.h>
 #endif
 
+#if defined( __SSE2__ )
+#include <emmintrin.h>
+#endif
+
 #include "libcpath_definitions.h"
 #include "libcpath_libcerror.h"
-#include "libcpath_libcsplit.h"
+#include "libcpath_memory.h"
 #include "libcpath_path.h"
+#include "libcpath_statistics.h"
 #include "libcpath_system_string.h"
+#include "libcpath_unused.h"
+
+/* The current working directory cache
+ * The cache is process-wide and is not synchronized, hence path resolution
+ * is single-threaded while the cache is enabled
+ */
+static int libcpath_path_current_working_directory_cache_enabled             = 0;
+static char *libcpath_path_current_working_directory_cache                   = NULL;
+static size_t libcpath_path_current_working_directory_cache_length           = 0;
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+static wchar_t *libcpath_path_current_working_directory_cache_wide           = NULL;
+static size_t libcpath_path_current_working_directory_cache_wide_length      = 0;
+#endif
 
 #if defined( WINAPI ) && ( WINVER <= 0x0500 )
 
@@ -147,17 +166,18 @@ BOOL libcpath_SetCurrentDirectoryA(
 
 #if defined( WINAPI )
 
-/* Changes the directory
+/* Changes the directory and retrieves the system error code
  * This function uses the WINAPI function for Windows XP (0x0501) or later
  * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
- * Returns 1 if successful or -1 on error
+ * The error code contains the system error code if the directory could not be changed
+ * Returns 1 if successful, 0 if the directory does not exist or -1 on error
  */
-int libcpath_path_change_directory(
+int libcpath_internal_path_change_directory_with_error_code(
      const char *directory_name,
+     uint32_t *error_code,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_path_change_directory";
-	DWORD error_code      = 0;
+	static char *function = "libcpath_path_change_directory_with_error_code";
 
 	if( directory_name == NULL )
 	{
@@ -170,6 +190,19 @@ int libcpath_path_change_directory(
 
 		return( -1 );
 	}
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
+	*error_code = 0;
+
 #if WINVER <= 0x0500
 	if( libcpath_SetCurrentDirectoryA(
 	     directory_name ) == 0 )
@@ -178,32 +211,51 @@ int libcpath_path_change_directory(
 	     directory_name ) == 0 )
 #endif
 	{
-		error_code = GetLastError();
+		*error_code = (uint32_t) GetLastError();
 
+		if( ( *error_code == (uint32_t) ERROR_FILE_NOT_FOUND )
+		 || ( *error_code == (uint32_t) ERROR_PATH_NOT_FOUND ) )
+		{
+			return( 0 );
+		}
 		libcerror_system_set_error(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 error_code,
+		 *error_code,
 		 "%s: unable to change directory.",
 		 function );
 
 		return( -1 );
 	}
+	if( libcpath_path_clear_current_working_directory_cache(
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear current working directory cache.",
+		 function );
+
+		return( -1 );
+	}
 	return( 1 );
 }
 
 #elif defined( HAVE_CHDIR )
 
-/* Changes the directory
+/* Changes the directory and retrieves the system error code
  * This function uses the POSIX chdir function or equivalent
- * Returns 1 if successful or -1 on error
+ * The error code contains the system error code if the directory could not be changed
+ * Returns 1 if successful, 0 if the directory does not exist or -1 on error
  */
-int libcpath_path_change_directory(
+int libcpath_internal_path_change_directory_with_error_code(
      const char *directory_name,
+     uint32_t *error_code,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_path_change_directory";
+	static char *function = "libcpath_path_change_directory_with_error_code";
 
 	if( directory_name == NULL )
 	{
@@ -216,19 +268,50 @@ int libcpath_path_change_directory(
 
 		return( -1 );
 	}
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
+	*error_code = 0;
+
 	if( chdir(
 	     directory_name ) != 0 )
 	{
+		*error_code = (uint32_t) errno;
+
+		if( *error_code == (uint32_t) ENOENT )
+		{
+			return( 0 );
+		}
 		libcerror_system_set_error(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 errno,
+		 *error_code,
 		 "%s: unable to change directory.",
 		 function );
 
 		return( -1 );
 	}
+	if( libcpath_path_clear_current_working_directory_cache(
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear current working directory cache.",
+		 function );
+
+		return( -1 );
+	}
 	return( 1 );
 }
 
@@ -236,6 +319,48 @@ int libcpath_path_change_directory(
 #error Missing change directory function
 #endif
 
+/* Changes the directory
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_change_directory(
+     const char *directory_name,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_change_directory";
+	uint32_t error_code   = 0;
+	int result            = 0;
+
+	result = libcpath_internal_path_change_directory_with_error_code(
+	          directory_name,
+	          &error_code,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to change directory.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 error_code,
+		 "%s: unable to change directory.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 #if defined( WINAPI ) && ( WINVER <= 0x0500 )
 
 /* Cross Windows safe version of GetCurrentDirectoryA
@@ -289,7 +414,7 @@ DWORD libcpath_GetCurrentDirectoryA(
  * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_get_current_working_directory(
+int libcpath_internal_path_get_current_working_directory(
      char **current_working_directory,
      size_t *current_working_directory_size,
      libcerror_error_t **error )
@@ -438,7 +563,7 @@ on_error:
  * This function uses the POSIX getcwd function or equivalent
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_get_current_working_directory(
+int libcpath_internal_path_get_current_working_directory(
      char **current_working_directory,
      size_t *current_working_directory_size,
      libcerror_error_t **error )
@@ -542,545 +667,437 @@ on_error:
 #error Missing get current working directory function
 #endif
 
-#if defined( WINAPI ) && ( WINVER <= 0x0500 )
-
-/* Cross Windows safe version of GetFullPathNameA
- * Returns the number of characters in the current directory string or 0 on error
- */
-DWORD libcpath_GetFullPathNameA(
-       LPCSTR filename,
-       DWORD  buffer_size,
-       LPSTR  buffer,
-       LPSTR  *file_part )
-{
-	FARPROC function       = NULL;
-	HMODULE library_handle = NULL;
-	DWORD result           = 0;
-
-	library_handle = LoadLibrary(
-	                  _SYSTEM_STRING( "kernel32.dll" ) );
-
-	if( library_handle == NULL )
-	{
-		return( 0 );
-	}
-	function = GetProcAddress(
-		    library_handle,
-		    (LPCSTR) "GetFullPathNameA" );
-
-	if( function != NULL )
-	{
-		result = function(
-			  filename,
-			  buffer_size,
-			  buffer,
-			  file_part );
-	}
-	/* This call should be after using the function
-	 * in most cases kernel32.dll will still be available after free
-	 */
-	if( FreeLibrary(
-	     library_handle ) != TRUE )
-	{
-		libcpath_CloseHandle(
-		 library_handle );
-
-		return( 0 );
-	}
-	return( result );
-}
-
-#endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
-
-#if defined( WINAPI )
-
-/* Determines the path type
+/* Retrieves the current working directory with its exact size
+ * Unlike libcpath_path_get_current_working_directory, which allocates and
+ * clears PATH_MAX bytes, the current working directory is first retrieved
+ * into a small buffer on the stack. The buffer is grown while getcwd fails
+ * with ERANGE, hence a current working directory longer than PATH_MAX is
+ * supported as well.
+ *
+ * The current working directory size contains the exact size of the current
+ * working directory, including the end-of-string character
+ *
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_get_path_type(
-     const char *path,
-     size_t path_length,
-     uint8_t *path_type,
+int libcpath_internal_path_get_current_working_directory_exact(
+     char **current_working_directory,
+     size_t *current_working_directory_size,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_path_get_path_type";
+#if !defined( WINAPI )
+	char stack_current_working_directory[ 256 ];
+
+	char *current_working_directory_buffer       = NULL;
+	char *safe_current_working_directory         = NULL;
+	size_t current_working_directory_buffer_size = 0;
+	size_t current_working_directory_length      = 0;
+	int error_code                               = 0;
+#endif
+	static char *function                        = "libcpath_path_get_current_working_directory_exact";
 
-	if( path == NULL )
+	if( current_working_directory == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path.",
+		 "%s: invalid current working directory.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( path_length == 0 )
-	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	if( *current_working_directory != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid path length value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid current working directory value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( path_type == NULL )
+	if( current_working_directory_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path type.",
+		 "%s: invalid current working directory size.",
 		 function );
 
 		return( -1 );
 	}
-	*path_type = LIBCPATH_TYPE_RELATIVE;
-
-	/* Determine if the path is a special path
-	 * device path prefix:          \\.\
-	 * extended-length path prefix: \\?\
+#if defined( WINAPI )
+	/* The WINAPI version already retrieves the size of the current working directory first
 	 */
-	if( ( path_length >= 4 )
-	 && ( path[ 0 ] == '\\' )
-	 && ( path[ 1 ] == '\\' )
-	 && ( ( path[ 2 ] == '.' )
-	  ||  ( path[ 2 ] == '?' ) )
-	 && ( path[ 3 ] == '\\' ) )
+	if( libcpath_internal_path_get_current_working_directory(
+	     current_working_directory,
+	     current_working_directory_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current working directory.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+#else
+	current_working_directory_buffer      = stack_current_working_directory;
+	current_working_directory_buffer_size = sizeof( stack_current_working_directory );
+
+	while( getcwd(
+	        current_working_directory_buffer,
+	        current_working_directory_buffer_size ) == NULL )
 	{
-		if( path[ 2 ] == '.' )
+		error_code = errno;
+
+		if( error_code != ERANGE )
 		{
-			*path_type = LIBCPATH_TYPE_DEVICE;
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 error_code,
+			 "%s: unable to retrieve current working directory.",
+			 function );
+
+			goto on_error;
 		}
-		/* Determine if the path in an extended-length UNC path
-		 * \\?\UNC\server\share
-		 */
-		else if( ( path_length >= 8 )
-		      && ( path[ 4 ] == 'U' )
-		      && ( path[ 5 ] == 'N' )
-		      && ( path[ 6 ] == 'C' )
-		      && ( path[ 7 ] == '\\' ) )
+		if( current_working_directory_buffer != stack_current_working_directory )
 		{
-			*path_type = LIBCPATH_TYPE_EXTENDED_LENGTH_UNC;
+			memory_free(
+			 current_working_directory_buffer );
 		}
-		else
+		current_working_directory_buffer = NULL;
+
+		if( current_working_directory_buffer_size > ( (size_t) SSIZE_MAX / 2 ) )
 		{
-			*path_type = LIBCPATH_TYPE_EXTENDED_LENGTH;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid current working directory buffer size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		current_working_directory_buffer_size *= 2;
+
+		current_working_directory_buffer = narrow_string_allocate(
+		                                    current_working_directory_buffer_size );
+
+		if( current_working_directory_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create current working directory buffer.",
+			 function );
+
+			goto on_error;
 		}
 	}
-	/* Determine if the path is an UNC path
-	 * \\server\share
-	 */
-	else if( ( path_length >= 2 )
-	      && ( path[ 0 ] == '\\' )
-	      && ( path[ 1 ] == '\\' ) )
-	{
-		*path_type = LIBCPATH_TYPE_UNC;
-	}
-	else if( path[ 0 ] == '\\' )
-	{
-		*path_type = LIBCPATH_TYPE_ABSOLUTE;
-	}
-	else if( ( path_length >= 3 )
-	      && ( path[ 1 ] == ':' )
-	      && ( path[ 2 ] == '\\' )
-	      && ( ( ( path[ 0 ] >= 'A' )
-	        &&   ( path[ 0 ] <= 'Z' ) )
-	       ||  ( ( path[ 0 ] >= 'a' )
-	        &&   ( path[ 0 ] <= 'z' ) ) ) )
-	{
-		*path_type = LIBCPATH_TYPE_ABSOLUTE;
-	}
-	return( 1 );
-}
+	current_working_directory_length = narrow_string_length(
+	                                    current_working_directory_buffer );
 
-/* Determines the volume name
- * Returns 1 if successful or -1 on error
- */
-int libcpath_path_get_volume_name(
-     const char *path,
-     size_t path_length,
-     char **volume_name,
-     size_t *volume_name_length,
-     size_t *directory_name_index,
-     libcerror_error_t **error )
-{
-	static char *function    = "libcpath_path_get_volume_name";
-	size_t path_index        = 0;
-	size_t share_name_index  = 0;
-	size_t volume_name_index = 0;
+	safe_current_working_directory = narrow_string_allocate(
+	                                  current_working_directory_length + 1 );
 
-	if( path == NULL )
+	if( safe_current_working_directory == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create current working directory.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( ( path_length == 0 )
-	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid path length value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
-	if( volume_name == NULL )
+	if( narrow_string_copy(
+	     safe_current_working_directory,
+	     current_working_directory_buffer,
+	     current_working_directory_length ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume name.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy current working directory.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( volume_name_length == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume name length.",
-		 function );
+	safe_current_working_directory[ current_working_directory_length ] = 0;
 
-		return( -1 );
-	}
-	if( directory_name_index == NULL )
+	if( current_working_directory_buffer != stack_current_working_directory )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory name index.",
-		 function );
-
-		return( -1 );
+		memory_free(
+		 current_working_directory_buffer );
 	}
-	*volume_name          = NULL;
-	*volume_name_length   = 0;
-	*directory_name_index = 0;
+	*current_working_directory      = safe_current_working_directory;
+	*current_working_directory_size = current_working_directory_length + 1;
 
-	/* Determine if the path is a special path
-	 * device path prefix:          \\.\
-	 * extended-length path prefix: \\?\
-	 */
-	if( ( path_length >= 4 )
-	 && ( path[ 0 ] == '\\' )
-	 && ( path[ 1 ] == '\\' )
-	 && ( ( path[ 2 ] == '.' )
-	  ||  ( path[ 2 ] == '?' ) )
-	 && ( path[ 3 ] == '\\' ) )
+	return( 1 );
+
+on_error:
+	if( safe_current_working_directory != NULL )
 	{
-		if( path[ 2 ] == '.' )
-		{
-			volume_name_index = 4;
-		}
-		/* Determine if the path in an extended-length UNC path
-		 * \\?\UNC\server\share
-		 */
-		else if( ( path_length >= 8 )
-		      && ( path[ 4 ] == 'U' )
-		      && ( path[ 5 ] == 'N' )
-		      && ( path[ 6 ] == 'C' )
-		      && ( path[ 7 ] == '\\' ) )
-		{
-			volume_name_index = 8;
-		}
-		else
-		{
-			volume_name_index = 4;
-		}
+		memory_free(
+		 safe_current_working_directory );
 	}
-	/* Determine if the path is an UNC path
-	 * \\server\share
-	 */
-	else if( ( path_length >= 2 )
-	      && ( path[ 0 ] == '\\' )
-	      && ( path[ 1 ] == '\\' ) )
+	if( ( current_working_directory_buffer != NULL )
+	 && ( current_working_directory_buffer != stack_current_working_directory ) )
 	{
-		volume_name_index = 2;
+		memory_free(
+		 current_working_directory_buffer );
 	}
-	/* Check if the path contains a volume letter
-	 */
-	if( ( path_length >= 2 )
-	 && ( volume_name_index <= ( path_length - 2 ) )
-	 && ( path[ volume_name_index + 1 ] == ':' )
-	 && ( ( ( path[ volume_name_index ] >= 'A' )
-	   &&   ( path[ volume_name_index ] <= 'Z' ) )
-	  ||  ( ( path[ volume_name_index ] >= 'a' )
-	   &&   ( path[ volume_name_index ] <= 'z' ) ) ) )
-	{
-		path_index = volume_name_index + 2;
+	return( -1 );
+#endif /* defined( WINAPI ) */
+}
 
-		if( ( path_index < path_length )
-		 && ( path[ path_index ] == '\\' ) )
-		{
-			path_index++;
-		}
-		*volume_name        = (char *) &( path[ volume_name_index ] );
-		*volume_name_length = path_index - volume_name_index;
+/* Enables the current working directory cache
+ * If enabled the current working directory is retrieved once and reused when
+ * determining the full path of relative paths, until it is cleared by
+ * libcpath_path_change_directory or refreshed
+ *
+ * The cache is process-wide and is not synchronized, while the cache is
+ * enabled the path functions that determine full paths must not be called
+ * from multiple threads at the same time
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_enable_current_working_directory_cache(
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_enable_current_working_directory_cache";
 
-		if( path[ path_index - 1 ] == '\\' )
-		{
-			*volume_name_length -= 1;
-		}
-		*directory_name_index = path_index;
-	}
-	else if( volume_name_index == 4 )
+	if( libcpath_path_clear_current_working_directory_cache(
+	     error ) != 1 )
 	{
-		for( path_index = volume_name_index;
-		     path_index < path_length;
-		     path_index++ )
-		{
-			if( path[ path_index ] == '\\' )
-			{
-				path_index++;
-
-				break;
-			}
-		}
-		*volume_name        = (char *) &( path[ 4 ] );
-		*volume_name_length = path_index - 4;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear current working directory cache.",
+		 function );
 
-		if( path[ path_index - 1 ] == '\\' )
-		{
-			*volume_name_length -= 1;
-		}
-		*directory_name_index = path_index;
+		return( -1 );
 	}
-	else if( ( volume_name_index == 2 )
-	      || ( volume_name_index == 8 ) )
-	{
-		for( share_name_index = volume_name_index;
-		     share_name_index < path_length;
-		     share_name_index++ )
-		{
-			if( path[ share_name_index ] == '\\' )
-			{
-				share_name_index++;
+	libcpath_path_current_working_directory_cache_enabled = 1;
 
-				break;
-			}
-		}
-		if( share_name_index > path_length )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid path - missing share name.",
-			 function );
-
-			return( -1 );
-		}
-		for( path_index = share_name_index;
-		     path_index < path_length;
-		     path_index++ )
-		{
-			if( path[ path_index ] == '\\' )
-			{
-				path_index++;
-
-				break;
-			}
-		}
-		*volume_name        = (char *) &( path[ volume_name_index ] );
-		*volume_name_length = path_index - volume_name_index;
-
-		if( path[ path_index - 1 ] == '\\' )
-		{
-			*volume_name_length -= 1;
-		}
-		*directory_name_index = path_index;
-	}
 	return( 1 );
 }
 
-/* Retrieves the current working directory of a specific volume
+/* Disables the current working directory cache
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_get_current_working_directory_by_volume(
-     char *volume_name,
-     size_t volume_name_length,
-     char **current_working_directory,
-     size_t *current_working_directory_size,
+int libcpath_path_disable_current_working_directory_cache(
      libcerror_error_t **error )
 {
-	static char *function                     = "libcpath_path_get_current_working_directory_by_volume";
-	char *safe_current_working_directory      = NULL;
-	DWORD error_code                          = 0;
-	DWORD result                              = 0;
-	DWORD safe_current_working_directory_size = 0;
+	static char *function = "libcpath_path_disable_current_working_directory_cache";
 
-	if( volume_name == NULL )
+	if( libcpath_path_clear_current_working_directory_cache(
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume name.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear current working directory cache.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( volume_name_length == 0 )
-	 || ( volume_name_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	libcpath_path_current_working_directory_cache_enabled = 0;
+
+	return( 1 );
+}
+
+/* Refreshes the current working directory cache
+ * This function should be called when the current working directory was changed
+ * by other means than libcpath_path_change_directory
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_refresh_current_working_directory_cache(
+     libcerror_error_t **error )
+{
+	const char *current_working_directory   = NULL;
+	static char *function                   = "libcpath_path_refresh_current_working_directory_cache";
+	size_t current_working_directory_length = 0;
+
+	if( libcpath_path_clear_current_working_directory_cache(
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid volume name length value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear current working directory cache.",
 		 function );
 
 		return( -1 );
 	}
-	if( current_working_directory == NULL )
+	if( libcpath_path_get_cached_current_working_directory(
+	     &current_working_directory,
+	     &current_working_directory_length,
+	     error ) == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid current working directory.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached current working directory.",
 		 function );
 
 		return( -1 );
 	}
-	if( *current_working_directory != NULL )
+	return( 1 );
+}
+
+/* Clears the current working directory cache
+ * The cached current working directory is retrieved again when needed
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_clear_current_working_directory_cache(
+     libcerror_error_t **error )
+{
+	LIBCPATH_UNREFERENCED_PARAMETER( error )
+
+	if( libcpath_path_current_working_directory_cache != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid current working directory value already set.",
-		 function );
+		libcpath_memory_default_free(
+		 libcpath_path_current_working_directory_cache );
 
-		return( -1 );
+		libcpath_path_current_working_directory_cache = NULL;
 	}
-	if( current_working_directory_size == NULL )
+	libcpath_path_current_working_directory_cache_length = 0;
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	if( libcpath_path_current_working_directory_cache_wide != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid current working directory size.",
-		 function );
+		libcpath_memory_default_free(
+		 libcpath_path_current_working_directory_cache_wide );
 
-		return( -1 );
+		libcpath_path_current_working_directory_cache_wide = NULL;
 	}
-#if WINVER <= 0x0500
-	safe_current_working_directory_size = libcpath_GetFullPathNameA(
-	                                       volume_name,
-	                                       0,
-	                                       NULL,
-	                                       NULL );
-#else
-	safe_current_working_directory_size = GetFullPathNameA(
-	                                       volume_name,
-	                                       0,
-	                                       NULL,
-	                                       NULL );
+	libcpath_path_current_working_directory_cache_wide_length = 0;
 #endif
-	if( safe_current_working_directory_size == 0 )
+	return( 1 );
+}
+
+/* Retrieves the cached current working directory
+ * The current working directory is retrieved if it is not cached yet.
+ * The cached current working directory is owned by the cache and
+ * should not be freed
+ * Returns 1 if successful, 0 if the cache is not enabled or -1 on error
+ */
+int libcpath_path_get_cached_current_working_directory(
+     const char **current_working_directory,
+     size_t *current_working_directory_length,
+     libcerror_error_t **error )
+{
+	char *safe_current_working_directory       = NULL;
+	static char *function                      = "libcpath_path_get_cached_current_working_directory";
+	size_t safe_current_working_directory_size = 0;
+
+	if( current_working_directory == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve current working directory size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( (size_t) safe_current_working_directory_size > (size_t) SSIZE_MAX )
+	if( current_working_directory_length == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid current working directory size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory length.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	safe_current_working_directory = narrow_string_allocate(
-	                                  safe_current_working_directory_size );
-
-	if( safe_current_working_directory == NULL )
+	if( libcpath_path_current_working_directory_cache_enabled == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create current working directory.",
-		 function );
-
-		goto on_error;
+		return( 0 );
 	}
-	if( memory_set(
-	     safe_current_working_directory,
-	     0,
-	     sizeof( char ) * safe_current_working_directory_size ) == NULL )
+	if( libcpath_path_current_working_directory_cache == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear current working directory.",
-		 function );
+		if( libcpath_internal_path_get_current_working_directory_exact(
+		     &safe_current_working_directory,
+		     &safe_current_working_directory_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve current working directory.",
+			 function );
 
-		goto on_error;
-	}
-#if WINVER <= 0x0500
-	result = libcpath_GetFullPathNameA(
-	          volume_name,
-	          safe_current_working_directory_size,
-	          safe_current_working_directory,
-	          NULL );
-#else
-	result = GetFullPathNameA(
-	          volume_name,
-	          safe_current_working_directory_size,
-	          safe_current_working_directory,
-	          NULL );
-#endif
-	/* Note that safe_current_working_directory_size can be larger than result
-	 */
-	if( ( result == 0 )
-	 || ( result > safe_current_working_directory_size ) )
-	{
-		error_code = GetLastError();
+			goto on_error;
+		}
+		/* The cache is allocated with the default memory functions since it
+		 * outlives memory allocated by the memory functions set by the caller,
+		 * such as an arena that is reset
+		 */
+		libcpath_path_current_working_directory_cache = (char *) libcpath_memory_default_allocate(
+		                                                 sizeof( char ) * safe_current_working_directory_size );
 
-		libcerror_system_set_error(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 error_code,
-		 "%s: unable to retrieve current working directory.",
-		 function );
+		if( libcpath_path_current_working_directory_cache == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create current working directory cache.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+		if( memory_copy(
+		     libcpath_path_current_working_directory_cache,
+		     safe_current_working_directory,
+		     sizeof( char ) * safe_current_working_directory_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy current working directory to cache.",
+			 function );
+
+			goto on_error;
+		}
+		libcpath_path_current_working_directory_cache_length = safe_current_working_directory_size - 1;
+
+		memory_free(
+		 safe_current_working_directory );
 	}
-	*current_working_directory      = safe_current_working_directory;
-	*current_working_directory_size = (size_t) safe_current_working_directory_size;
+	*current_working_directory        = libcpath_path_current_working_directory_cache;
+	*current_working_directory_length = libcpath_path_current_working_directory_cache_length;
 
 	return( 1 );
 
 on_error:
+	if( libcpath_path_current_working_directory_cache != NULL )
+	{
+		libcpath_memory_default_free(
+		 libcpath_path_current_working_directory_cache );
+
+		libcpath_path_current_working_directory_cache = NULL;
+	}
 	if( safe_current_working_directory != NULL )
 	{
 		memory_free(
@@ -1089,69 +1106,76 @@ on_error:
 	return( -1 );
 }
 
-/* Determines the full path of the Windows path specified
- * The function uses the extended-length path format
- * (path with \\?\ prefix)
- *
- * Multiple successive \ not at the start of the path are combined into one
- *
- * Scenario's that are considered full paths:
- * Device path:			\\.\PhysicalDrive0
- * Extended-length path:	\\?\C:\directory\file.txt
- * Extended-length UNC path:	\\?\UNC\server\share\directory\file.txt
- *
- * Scenario's that are not considered full paths:
- * Local 'absolute' path:	\directory\file.txt
- *                       	\directory\\file.txt
- * Local 'relative' path:	..\directory\file.txt
- * Local 'relative' path:	.\directory\file.txt
- * Volume 'absolute' path:	C:\directory\file.txt
- *                              C:\..\directory\file.txt
- * Volume 'relative' path:	C:directory\file.txt
- * UNC path:			\\server\share\directory\file.txt
- *
- * TODO handle:
- * Volume device path:		\\.\C:
- * Volume file system path:	\\.\C:\
- *
+#if defined( WINAPI ) && ( WINVER <= 0x0500 )
+
+/* Cross Windows safe version of GetFullPathNameA
+ * Returns the number of characters in the current directory string or 0 on error
+ */
+DWORD libcpath_GetFullPathNameA(
+       LPCSTR filename,
+       DWORD  buffer_size,
+       LPSTR  buffer,
+       LPSTR  *file_part )
+{
+	FARPROC function       = NULL;
+	HMODULE library_handle = NULL;
+	DWORD result           = 0;
+
+	library_handle = LoadLibrary(
+	                  _SYSTEM_STRING( "kernel32.dll" ) );
+
+	if( library_handle == NULL )
+	{
+		return( 0 );
+	}
+	function = GetProcAddress(
+		    library_handle,
+		    (LPCSTR) "GetFullPathNameA" );
+
+	if( function != NULL )
+	{
+		result = function(
+			  filename,
+			  buffer_size,
+			  buffer,
+			  file_part );
+	}
+	/* This call should be after using the function
+	 * in most cases kernel32.dll will still be available after free
+	 */
+	if( FreeLibrary(
+	     library_handle ) != TRUE )
+	{
+		libcpath_CloseHandle(
+		 library_handle );
+
+		return( 0 );
+	}
+	return( result );
+}
+
+#endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+
+/* Parses a path using the Windows path syntax
+ * This function is available on all platforms and does not access the file system
+ * The volume name and directory name are returned as indexes into the path
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_get_full_path(
+int libcpath_path_parse_windows_path(
      const char *path,
      size_t path_length,
-     char **full_path,
-     size_t *full_path_size,
+     uint8_t *path_type,
+     size_t *volume_name_index,
+     size_t *volume_name_length,
+     size_t *directory_name_index,
      libcerror_error_t **error )
 {
-	libcsplit_narrow_split_string_t *current_directory_split_string = NULL;
-	libcsplit_narrow_split_string_t *path_split_string              = NULL;
-	char *current_directory                                         = NULL;
-	char *current_directory_string_segment                          = NULL;
-	char *full_path_prefix                                          = NULL;
-	char *last_used_path_string_segment                             = NULL;
-	char *path_string_segment                                       = NULL;
-	char *safe_full_path                                            = NULL;
-	char *volume_name                                               = NULL;
-	static char *function                                           = "libcpath_path_get_full_path";
-	size_t current_directory_length                                 = 0;
-	size_t current_directory_name_index                             = 0;
-	size_t current_directory_size                                   = 0;
-	size_t current_directory_string_segment_size                    = 0;
-	size_t full_path_index                                          = 0;
-	size_t full_path_prefix_length                                  = 0;
-	size_t last_used_path_string_segment_size                       = 0;
-	size_t path_directory_name_index                                = 0;
-	size_t path_string_segment_length                               = 0;
-	size_t path_string_segment_size                                 = 0;
-	size_t safe_full_path_size                                      = 0;
-	size_t volume_name_length                                       = 0;
-	uint8_t path_type                                               = LIBCPATH_TYPE_RELATIVE;
-	int current_directory_number_of_segments                        = 0;
-	int current_directory_segment_index                             = 0;
-	int last_used_path_segment_index                                = -1;
-	int path_number_of_segments                                     = 0;
-	int path_segment_index                                          = 0;
-	int result                                                      = 0;
+	static char *function         = "libcpath_path_parse_windows_path";
+	size_t path_index             = 0;
+	size_t safe_volume_name_index = 0;
+	size_t server_name_end_index  = 0;
+	size_t volume_name_end_index  = 0;
+	uint8_t safe_path_type        = LIBCPATH_WINDOWS_PATH_TYPE_RELATIVE;
 
 	if( path == NULL )
 	{
@@ -1176,564 +1200,8676 @@ int libcpath_path_get_full_path(
 
 		return( -1 );
 	}
-	if( full_path == NULL )
+	if( path_type == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid full path.",
+		 "%s: invalid path type.",
 		 function );
 
 		return( -1 );
 	}
-	if( *full_path != NULL )
+	if( volume_name_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid full path value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume name index.",
 		 function );
 
 		return( -1 );
 	}
-	if( full_path_size == NULL )
+	if( volume_name_length == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid full path size.",
+		 "%s: invalid volume name length.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcpath_path_get_path_type(
-	     path,
-	     path_length,
-	     &path_type,
-	     error ) != 1 )
+	if( directory_name_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine path type.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name index.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcpath_path_get_volume_name(
-	     path,
-	     path_length,
-	     &volume_name,
-	     &volume_name_length,
-	     &path_directory_name_index,
-	     error ) != 1 )
+	/* Classify the prefix, every character is inspected at most once
+	 * device path prefix:              \\.\
+	 * extended-length path prefix:     \\?\
+	 * extended-length UNC path prefix: \\?\UNC\
+	 * UNC path prefix:                 \\
+	 */
+	if( path[ 0 ] == '\\' )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine volume name.",
-		 function );
+		safe_path_type = LIBCPATH_WINDOWS_PATH_TYPE_ABSOLUTE;
 
-		goto on_error;
+		if( ( path_length >= 2 )
+		 && ( path[ 1 ] == '\\' ) )
+		{
+			safe_path_type         = LIBCPATH_WINDOWS_PATH_TYPE_UNC;
+			safe_volume_name_index = 2;
+
+			if( ( path_length >= 4 )
+			 && ( ( path[ 2 ] == '.' )
+			  ||  ( path[ 2 ] == '?' ) )
+			 && ( path[ 3 ] == '\\' ) )
+			{
+				safe_volume_name_index = 4;
+
+				if( path[ 2 ] == '.' )
+				{
+					safe_path_type = LIBCPATH_WINDOWS_PATH_TYPE_DEVICE;
+				}
+				else if( ( path_length >= 8 )
+				      && ( path[ 4 ] == 'U' )
+				      && ( path[ 5 ] == 'N' )
+				      && ( path[ 6 ] == 'C' )
+				      && ( path[ 7 ] == '\\' ) )
+				{
+					safe_path_type         = LIBCPATH_WINDOWS_PATH_TYPE_EXTENDED_LENGTH_UNC;
+					safe_volume_name_index = 8;
+				}
+				else
+				{
+					safe_path_type = LIBCPATH_WINDOWS_PATH_TYPE_EXTENDED_LENGTH;
+				}
+			}
+		}
 	}
-	/* If the path is a device path, an extended-length path or an UNC
-	 * do not bother to lookup the current working directory
+	path_index = safe_volume_name_index;
+
+	/* Check if the path contains a volume letter
 	 */
-	if( ( path_type != LIBCPATH_TYPE_DEVICE )
-	 && ( path_type != LIBCPATH_TYPE_EXTENDED_LENGTH )
-	 && ( path_type != LIBCPATH_TYPE_EXTENDED_LENGTH_UNC )
-	 && ( path_type != LIBCPATH_TYPE_UNC ) )
+	if( ( ( path_length - path_index ) >= 2 )
+	 && ( path[ path_index + 1 ] == ':' )
+	 && ( ( ( path[ path_index ] >= 'A' )
+	   &&   ( path[ path_index ] <= 'Z' ) )
+	  ||  ( ( path[ path_index ] >= 'a' )
+	   &&   ( path[ path_index ] <= 'z' ) ) ) )
 	{
-		if( volume_name == NULL )
+		path_index           += 2;
+		volume_name_end_index = path_index;
+
+		if( path_index < path_length )
 		{
-			result = libcpath_path_get_current_working_directory(
-			          &current_directory,
-			          &current_directory_size,
-			          error );
+			if( path[ path_index ] == '\\' )
+			{
+				if( safe_path_type == LIBCPATH_WINDOWS_PATH_TYPE_RELATIVE )
+				{
+					safe_path_type = LIBCPATH_WINDOWS_PATH_TYPE_ABSOLUTE;
+				}
+				path_index++;
+			}
 		}
-		else
+	}
+	else if( ( safe_path_type == LIBCPATH_WINDOWS_PATH_TYPE_DEVICE )
+	      || ( safe_path_type == LIBCPATH_WINDOWS_PATH_TYPE_EXTENDED_LENGTH ) )
+	{
+		while( ( path_index < path_length )
+		    && ( path[ path_index ] != '\\' ) )
 		{
-			result = libcpath_path_get_current_working_directory_by_volume(
-			          volume_name,
-			          volume_name_length,
-			          &current_directory,
-			          &current_directory_size,
-			          error );
+			path_index++;
 		}
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve current working directory.",
-			 function );
+		volume_name_end_index = path_index;
 
-			goto on_error;
-		}
-		if( volume_name == NULL )
+		if( path_index < path_length )
 		{
-			/* Determine the volume name using the current working directory if necessary
-			 */
-			if( libcpath_path_get_volume_name(
-			     current_directory,
-			     current_directory_size - 1,
-			     &volume_name,
-			     &volume_name_length,
-			     &current_directory_name_index,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to determine volume name from current working directory.",
-				 function );
-
-				goto on_error;
-			}
+			path_index++;
 		}
 	}
-	/* The full path prefix consists of "\\?\" or "\\.\"
-	 */
-	full_path_prefix_length = 4;
-
-	if( volume_name != NULL )
+	else if( ( safe_path_type == LIBCPATH_WINDOWS_PATH_TYPE_EXTENDED_LENGTH_UNC )
+	      || ( safe_path_type == LIBCPATH_WINDOWS_PATH_TYPE_UNC ) )
 	{
-		/* Add the volume or device name
+		/* The volume name consists of: server\share
 		 */
-		full_path_prefix_length += volume_name_length;
-	}
-	if( ( path_type == LIBCPATH_TYPE_EXTENDED_LENGTH_UNC )
-	 || ( path_type == LIBCPATH_TYPE_UNC ) )
-	{
-		/* Add the "UNC\" prefix
-		 */
-		full_path_prefix_length += 4;
-	}
-	if( ( current_directory != NULL )
-	 && ( current_directory_name_index < current_directory_size ) )
-	{
-		current_directory_length = narrow_string_length(
-		                            &( current_directory[ current_directory_name_index ] ) );
-
-		if( libcsplit_narrow_string_split(
-		     &( current_directory[ current_directory_name_index ] ),
-		     current_directory_length + 1,
-		     '\\',
-		     &current_directory_split_string,
-		     error ) != 1 )
+		while( ( path_index < path_length )
+		    && ( path[ path_index ] != '\\' ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to split current working directory.",
-			 function );
+			path_index++;
+		}
+		server_name_end_index = path_index;
 
-			goto on_error;
+		if( path_index < path_length )
+		{
+			path_index++;
 		}
-		if( libcsplit_narrow_split_string_get_number_of_segments(
-		     current_directory_split_string,
-		     &current_directory_number_of_segments,
-		     error ) != 1 )
+		while( ( path_index < path_length )
+		    && ( path[ path_index ] != '\\' ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of current working directory string segments.",
-			 function );
-
-			goto on_error;
+			path_index++;
 		}
-		current_directory_segment_index = current_directory_number_of_segments - 1;
-
-		if( path_type == LIBCPATH_TYPE_RELATIVE )
+		/* Without a share name the volume name consists of the server name
+		 */
+		if( path_index > ( server_name_end_index + 1 ) )
 		{
-			/* If the path is relative
-			 * add the size of the current working directory
-			 * a directory separator, if necessary
-			 */
-			safe_full_path_size += ( current_directory_size - ( current_directory_name_index + 1 ) );
-
-			if( ( current_directory_size >= 2 )
-			 && ( current_directory[ current_directory_size - 2 ] != '\\' ) )
-			{
-				safe_full_path_size += 1;
-			}
+			volume_name_end_index = path_index;
+		}
+		else
+		{
+			volume_name_end_index = server_name_end_index;
+		}
+		if( path_index < path_length )
+		{
+			path_index++;
 		}
 	}
-	if( libcsplit_narrow_string_split(
-	     &( path[ path_directory_name_index ] ),
-	     path_length - path_directory_name_index + 1,
-	     '\\',
-	     &path_split_string,
+	else
+	{
+		path_index = 0;
+	}
+	*path_type            = safe_path_type;
+	*volume_name_index    = safe_volume_name_index;
+	*volume_name_length   = volume_name_end_index - safe_volume_name_index;
+	*directory_name_index = path_index;
+
+	return( 1 );
+}
+
+#if defined( WINAPI )
+
+/* Determines the path type
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_path_type(
+     const char *path,
+     size_t path_length,
+     uint8_t *path_type,
+     libcerror_error_t **error )
+{
+	static char *function       = "libcpath_path_get_path_type";
+	size_t directory_name_index = 0;
+	size_t volume_name_index    = 0;
+	size_t volume_name_length   = 0;
+
+	if( libcpath_path_parse_windows_path(
+	     path,
+	     path_length,
+	     path_type,
+	     &volume_name_index,
+	     &volume_name_length,
+	     &directory_name_index,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to split path.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse path.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( path_split_string != NULL )
-	{
-		if( libcsplit_narrow_split_string_get_number_of_segments(
-		     path_split_string,
-		     &path_number_of_segments,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of path string segments.",
-			 function );
-
-			goto on_error;
-		}
-		for( path_segment_index = 0;
-		     path_segment_index < path_number_of_segments;
-		     path_segment_index++ )
-		{
-			if( libcsplit_narrow_split_string_get_segment_by_index(
-			     path_split_string,
-			     path_segment_index,
-			     &path_string_segment,
-			     &path_string_segment_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve path string segment: %d.",
-				 function,
-				 path_segment_index );
+	return( 1 );
+}
 
-				goto on_error;
-			}
-			if( path_string_segment == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing path string segment: %d.",
-				 function,
-				 path_segment_index );
+/* Determines the volume name
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_volume_name(
+     const char *path,
+     size_t path_length,
+     char **volume_name,
+     size_t *volume_name_length,
+     size_t *directory_name_index,
+     libcerror_error_t **error )
+{
+	static char *function    = "libcpath_path_get_volume_name";
+	size_t volume_name_index = 0;
+	uint8_t path_type        = 0;
 
-				goto on_error;
-			}
-			/* If the path is "" (empty) or "." (current) ignore the entry
-			 */
-			if( ( path_string_segment_size <= 1 )
-			 || ( ( path_string_segment_size == 2 )
-			  &&  ( path_string_segment[ 0 ] == '.' ) ) )
-			{
-				if( libcsplit_narrow_split_string_set_segment_by_index(
-				     path_split_string,
-				     path_segment_index,
-				     NULL,
-				     0,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set path string segment: %d.",
-					 function,
-					 path_segment_index );
+	if( volume_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume name.",
+		 function );
 
-					goto on_error;
-				}
-			}
-			/* If the path is ".." (parent) reverse the current path by one directory
-			 */
-			else if( ( path_string_segment_size == 3 )
-			      && ( path_string_segment[ 0 ] == '.' )
-			      && ( path_string_segment[ 1 ] == '.' ) )
-			{
-				if( ( current_directory_split_string != NULL )
-				 && ( last_used_path_segment_index == -1 ) )
-				{
-					if( libcsplit_narrow_split_string_get_segment_by_index(
-					     current_directory_split_string,
-					     current_directory_segment_index,
-					     &current_directory_string_segment,
-					     &current_directory_string_segment_size,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve current working directory string segment: %d.",
-						 function,
-						 current_directory_segment_index );
-
-						goto on_error;
-					}
-					if( current_directory_string_segment == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-						 "%s: missing current working directory string segment: %d.",
-						 function,
-						 current_directory_segment_index );
-
-						goto on_error;
-					}
-					/* Remove the size of the parent directory name and a directory separator
-					 * Note that the size includes the end of string character
-					 */
-					if( current_directory_string_segment_size < safe_full_path_size )
-					{
-						safe_full_path_size -= current_directory_string_segment_size;
-					}
-					else
-					{
-						safe_full_path_size = 0;
-					}
-					if( libcsplit_narrow_split_string_set_segment_by_index(
-					     current_directory_split_string,
-					     current_directory_segment_index,
-					     NULL,
-					     0,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-						 "%s: unable to set current working directory string segment: %d.",
-						 function,
-						 current_directory_segment_index );
-
-						goto on_error;
-					}
-					current_directory_segment_index--;
-				}
-				else if( last_used_path_segment_index >= 0 )
-				{
-					if( libcsplit_narrow_split_string_get_segment_by_index(
-					     path_split_string,
-					     last_used_path_segment_index,
-					     &last_used_path_string_segment,
-					     &last_used_path_string_segment_size,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve last used path string segment: %d.",
-						 function,
-						 last_used_path_segment_index );
-
-						goto on_error;
-					}
-					if( last_used_path_string_segment == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-						 "%s: missing last used path string string segment: %d.",
-						 function,
-						 last_used_path_segment_index );
-
-						goto on_error;
-					}
-					/* Remove the size of the parent directory name and a directory separator
-					 * Note that the size includes the end of string character
-					 */
-					if( current_directory_string_segment_size < safe_full_path_size )
-					{
-						safe_full_path_size -= last_used_path_string_segment_size;
-					}
-					else
-					{
-						safe_full_path_size = 0;
-					}
-					if( libcsplit_narrow_split_string_set_segment_by_index(
-					     path_split_string,
-					     last_used_path_segment_index,
-					     NULL,
-					     0,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-						 "%s: unable to set path string segment: %d.",
-						 function,
-						 last_used_path_segment_index );
-
-						goto on_error;
-					}
-					/* Find the previous path split value that contains a name
-					 */
-					while( last_used_path_segment_index > 0 )
-					{
-						last_used_path_segment_index--;
-
-						if( libcsplit_narrow_split_string_get_segment_by_index(
-						     path_split_string,
-						     last_used_path_segment_index,
-						     &last_used_path_string_segment,
-						     &last_used_path_string_segment_size,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-							 "%s: unable to retrieve last used path string segment: %d.",
-							 function,
-							 last_used_path_segment_index );
-
-							goto on_error;
-						}
-						if( last_used_path_string_segment_size != 0 )
-						{
-							break;
-						}
-					}
-				}
-				if( libcsplit_narrow_split_string_set_segment_by_index(
-				     path_split_string,
-				     path_segment_index,
-				     NULL,
-				     0,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set path string segment: %d.",
-					 function,
-					 path_segment_index );
+		return( -1 );
+	}
+	*volume_name = NULL;
 
-					goto on_error;
-				}
-			}
-			else
-			{
-				/* Add the size of the directory or file name and a directory separator
-				 * Note that the size includes the end of string character
-				 */
-				safe_full_path_size += path_string_segment_size;
+	if( libcpath_path_parse_windows_path(
+	     path,
+	     path_length,
+	     &path_type,
+	     &volume_name_index,
+	     volume_name_length,
+	     directory_name_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse path.",
+		 function );
 
-				last_used_path_segment_index = path_segment_index;
-			}
-		}
-		/* Use the size reserved of the last directory separator for
-		 * the directory separator after the path prefix.
-		 */
+		return( -1 );
 	}
-	safe_full_path_size += full_path_prefix_length + 1;
-
-	full_path_index = 0;
+	if( *volume_name_length > 0 )
+	{
+		*volume_name = (char *) &( path[ volume_name_index ] );
+	}
+	return( 1 );
+}
 
-	safe_full_path = narrow_string_allocate(
-	                  safe_full_path_size );
+/* Retrieves the current working directory of a specific volume
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_current_working_directory_by_volume(
+     char *volume_name,
+     size_t volume_name_length,
+     char **current_working_directory,
+     size_t *current_working_directory_size,
+     libcerror_error_t **error )
+{
+	static char *function                     = "libcpath_path_get_current_working_directory_by_volume";
+	char *safe_current_working_directory      = NULL;
+	DWORD error_code                          = 0;
+	DWORD result                              = 0;
+	DWORD safe_current_working_directory_size = 0;
 
-	if( safe_full_path == NULL )
+	if( volume_name == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create full path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume name.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( memory_set(
-	     safe_full_path,
-	     0,
-	     sizeof( char ) * safe_full_path_size ) == NULL )
+	if( ( volume_name_length == 0 )
+	 || ( volume_name_length > (size_t) ( SSIZE_MAX - 1 ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear full path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume name length value out of bounds.",
 		 function );
 
-		goto on_error;
-	}
-	if( path_type == LIBCPATH_TYPE_DEVICE )
-	{
-		full_path_prefix        = "\\\\.\\";
-		full_path_prefix_length = 4;
-	}
-	else
-	{
-		full_path_prefix        = "\\\\?\\";
-		full_path_prefix_length = 4;
+		return( -1 );
 	}
-	if( full_path_prefix_length > ( safe_full_path_size - full_path_index ) )
+	if( current_working_directory == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid full path size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( narrow_string_copy(
-	     &( safe_full_path[ full_path_index ] ),
-	     full_path_prefix,
-	     full_path_prefix_length ) == NULL )
+	if( *current_working_directory != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set prefix in full path.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid current working directory value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	full_path_index += full_path_prefix_length;
-
-	/* If there is a share name the path is an UNC path
-	 */
-	if( ( path_type == LIBCPATH_TYPE_EXTENDED_LENGTH_UNC )
-	 || ( path_type == LIBCPATH_TYPE_UNC ) )
+	if( current_working_directory_size == NULL )
 	{
-		if( ( safe_full_path_size - full_path_index ) < 4 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid full path size value out of bounds.",
-			 function );
-
-			goto on_error;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory size.",
+		 function );
+
+		return( -1 );
+	}
+#if WINVER <= 0x0500
+	safe_current_working_directory_size = libcpath_GetFullPathNameA(
+	                                       volume_name,
+	                                       0,
+	                                       NULL,
+	                                       NULL );
+#else
+	safe_current_working_directory_size = GetFullPathNameA(
+	                                       volume_name,
+	                                       0,
+	                                       NULL,
+	                                       NULL );
+#endif
+	if( safe_current_working_directory_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current working directory size.",
+		 function );
+
+		goto on_error;
+	}
+	if( (size_t) safe_current_working_directory_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid current working directory size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	safe_current_working_directory = narrow_string_allocate(
+	                                  safe_current_working_directory_size );
+
+	if( safe_current_working_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create current working directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_current_working_directory,
+	     0,
+	     sizeof( char ) * safe_current_working_directory_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear current working directory.",
+		 function );
+
+		goto on_error;
+	}
+#if WINVER <= 0x0500
+	result = libcpath_GetFullPathNameA(
+	          volume_name,
+	          safe_current_working_directory_size,
+	          safe_current_working_directory,
+	          NULL );
+#else
+	result = GetFullPathNameA(
+	          volume_name,
+	          safe_current_working_directory_size,
+	          safe_current_working_directory,
+	          NULL );
+#endif
+	/* Note that safe_current_working_directory_size can be larger than result
+	 */
+	if( ( result == 0 )
+	 || ( result > safe_current_working_directory_size ) )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 error_code,
+		 "%s: unable to retrieve current working directory.",
+		 function );
+
+		goto on_error;
+	}
+	*current_working_directory      = safe_current_working_directory;
+	*current_working_directory_size = (size_t) safe_current_working_directory_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_current_working_directory != NULL )
+	{
+		memory_free(
+		 safe_current_working_directory );
+	}
+	return( -1 );
+}
+
+/* Determines the full path of the Windows path specified
+ * The function uses the extended-length path format
+ * (path with \\?\ prefix)
+ *
+ * Multiple successive \ not at the start of the path are combined into one
+ *
+ * Scenario's that are considered full paths:
+ * Device path:			\\.\PhysicalDrive0
+ * Extended-length path:	\\?\C:\directory\file.txt
+ * Extended-length UNC path:	\\?\UNC\server\share\directory\file.txt
+ *
+ * Scenario's that are not considered full paths:
+ * Local 'absolute' path:	\directory\file.txt
+ *                       	\directory\\file.txt
+ * Local 'relative' path:	..\directory\file.txt
+ * Local 'relative' path:	.\directory\file.txt
+ * Volume 'absolute' path:	C:\directory\file.txt
+ *                              C:\..\directory\file.txt
+ * Volume 'relative' path:	C:directory\file.txt
+ * UNC path:			\\server\share\directory\file.txt
+ *
+ * TODO handle:
+ * Volume device path:		\\.\C:
+ * Volume file system path:	\\.\C:\
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_get_full_path(
+     const char *path,
+     size_t path_length,
+     char **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error )
+{
+	char *current_directory             = NULL;
+	char *full_path_prefix              = NULL;
+	char *safe_full_path                = NULL;
+	char *volume_name                   = NULL;
+	static char *function               = "libcpath_path_get_full_path";
+	size_t current_directory_length     = 0;
+	size_t current_directory_name_index = 0;
+	size_t current_directory_size       = 0;
+	size_t full_path_index              = 0;
+	size_t full_path_prefix_length      = 0;
+	size_t path_directory_name_index    = 0;
+	size_t safe_full_path_size          = 0;
+	size_t volume_name_length           = 0;
+	uint8_t path_type                   = LIBCPATH_TYPE_RELATIVE;
+	int result                          = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_length == 0 )
+	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *full_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_get_path_type(
+	     path,
+	     path_length,
+	     &path_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine path type.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_path_get_volume_name(
+	     path,
+	     path_length,
+	     &volume_name,
+	     &volume_name_length,
+	     &path_directory_name_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine volume name.",
+		 function );
+
+		goto on_error;
+	}
+	/* If the path is a device path, an extended-length path or an UNC
+	 * do not bother to lookup the current working directory
+	 */
+	if( ( path_type != LIBCPATH_TYPE_DEVICE )
+	 && ( path_type != LIBCPATH_TYPE_EXTENDED_LENGTH )
+	 && ( path_type != LIBCPATH_TYPE_EXTENDED_LENGTH_UNC )
+	 && ( path_type != LIBCPATH_TYPE_UNC ) )
+	{
+		if( volume_name == NULL )
+		{
+			result = libcpath_internal_path_get_current_working_directory(
+			          &current_directory,
+			          &current_directory_size,
+			          error );
+		}
+		else
+		{
+			result = libcpath_path_get_current_working_directory_by_volume(
+			          volume_name,
+			          volume_name_length,
+			          &current_directory,
+			          &current_directory_size,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve current working directory.",
+			 function );
+
+			goto on_error;
+		}
+		if( volume_name == NULL )
+		{
+			/* Determine the volume name using the current working directory if necessary
+			 */
+			if( libcpath_path_get_volume_name(
+			     current_directory,
+			     current_directory_size - 1,
+			     &volume_name,
+			     &volume_name_length,
+			     &current_directory_name_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine volume name from current working directory.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	/* The full path prefix consists of "\\?\" or "\\.\"
+	 */
+	full_path_prefix_length = 4;
+
+	if( volume_name != NULL )
+	{
+		/* Add the volume or device name
+		 */
+		full_path_prefix_length += volume_name_length;
+	}
+	if( ( path_type == LIBCPATH_TYPE_EXTENDED_LENGTH_UNC )
+	 || ( path_type == LIBCPATH_TYPE_UNC ) )
+	{
+		/* Add the "UNC\" prefix
+		 */
+		full_path_prefix_length += 4;
+	}
+	if( ( path_type == LIBCPATH_TYPE_RELATIVE )
+	 && ( current_directory != NULL )
+	 && ( current_directory_name_index < current_directory_size ) )
+	{
+		current_directory_length = narrow_string_length(
+		                            &( current_directory[ current_directory_name_index ] ) );
+	}
+	/* Every segment is stored with a trailing directory separator, hence the full path
+	 * never needs more than the prefix and its directory separator, the length of the
+	 * inputs and a directory separator per input
+	 */
+	safe_full_path_size = full_path_prefix_length + 1 + ( current_directory_length + 1 ) + ( path_length - path_directory_name_index ) + 1;
+
+	full_path_index = 0;
+
+	safe_full_path = narrow_string_allocate(
+	                  safe_full_path_size );
+
+	if( safe_full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create full path.",
+		 function );
+
+		goto on_error;
+	}
+	if( path_type == LIBCPATH_TYPE_DEVICE )
+	{
+		full_path_prefix        = "\\\\.\\";
+		full_path_prefix_length = 4;
+	}
+	else
+	{
+		full_path_prefix        = "\\\\?\\";
+		full_path_prefix_length = 4;
+	}
+	if( full_path_prefix_length > ( safe_full_path_size - full_path_index ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid full path size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     &( safe_full_path[ full_path_index ] ),
+	     full_path_prefix,
+	     full_path_prefix_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set prefix in full path.",
+		 function );
+
+		goto on_error;
+	}
+	full_path_index += full_path_prefix_length;
+
+	/* If there is a share name the path is an UNC path
+	 */
+	if( ( path_type == LIBCPATH_TYPE_EXTENDED_LENGTH_UNC )
+	 || ( path_type == LIBCPATH_TYPE_UNC ) )
+	{
+		if( ( safe_full_path_size - full_path_index ) < 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid full path size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( narrow_string_copy(
+		     &( safe_full_path[ full_path_index ] ),
+		     "UNC\\",
+		     4 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set UNC\\ prefix in full path.",
+			 function );
+
+			goto on_error;
+		}
+		full_path_index += 4;
+	}
+	if( volume_name != NULL )
+	{
+		if( volume_name_length > ( safe_full_path_size - full_path_index ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid full path size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( narrow_string_copy(
+		     &( safe_full_path[ full_path_index ] ),
+		     volume_name,
+		     volume_name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set volume name in full path.",
+			 function );
+
+			goto on_error;
+		}
+		full_path_index += volume_name_length;
+
+		safe_full_path[ full_path_index++ ] = '\\';
+	}
+	/* The segments are normalized after the prefix, so that a ".." (parent directory)
+	 * segment never removes the volume name
+	 */
+	full_path_prefix_length = full_path_index;
+
+	/* If the path is relative
+	 * add the current working directory segments
+	 */
+	if( current_directory_length > 0 )
+	{
+		if( libcpath_path_append_normalized_segments(
+		     safe_full_path,
+		     safe_full_path_size,
+		     full_path_prefix_length,
+		     &full_path_index,
+		     &( current_directory[ current_directory_name_index ] ),
+		     current_directory_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append current working directory segments to full path.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcpath_path_append_normalized_segments(
+	     safe_full_path,
+	     safe_full_path_size,
+	     full_path_prefix_length,
+	     &full_path_index,
+	     &( path[ path_directory_name_index ] ),
+	     path_length - path_directory_name_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append path segments to full path.",
+		 function );
+
+		goto on_error;
+	}
+	/* Replace the directory separator of the last segment by the end-of-string character
+	 */
+	safe_full_path[ full_path_index - 1 ] = 0;
+
+	if( current_directory != NULL )
+	{
+		memory_free(
+		 current_directory );
+	}
+	*full_path      = safe_full_path;
+	*full_path_size = full_path_index;
+
+	return( 1 );
+
+on_error:
+	if( safe_full_path != NULL )
+	{
+		memory_free(
+		 safe_full_path );
+	}
+	if( current_directory != NULL )
+	{
+		memory_free(
+		 current_directory );
+	}
+	return( -1 );
+}
+
+/* Determines the full path of the Windows path specified into a buffer
+ * The full path is determined by libcpath_path_get_full_path and copied
+ * into the buffer, since the volume name can only be determined using
+ * a temporary buffer
+ *
+ * The required full path size is set to the size of the full path, including
+ * the end-of-string character, also when the full path is too small
+ *
+ * Returns 1 if successful, 0 if the full path is too small or -1 on error
+ */
+int libcpath_internal_path_get_full_path_to_buffer(
+     const char *path,
+     size_t path_length,
+     char *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     libcerror_error_t **error )
+{
+	char *safe_full_path       = NULL;
+	static char *function      = "libcpath_path_get_full_path_to_buffer";
+	size_t safe_full_path_size = 0;
+	int result                 = 0;
+
+	if( full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid full path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_full_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required full path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_internal_path_get_full_path(
+	     path,
+	     path_length,
+	     &safe_full_path,
+	     &safe_full_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine full path.",
+		 function );
+
+		goto on_error;
+	}
+	if( safe_full_path_size <= full_path_size )
+	{
+		if( memory_copy(
+		     full_path,
+		     safe_full_path,
+		     sizeof( char ) * safe_full_path_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy full path.",
+			 function );
+
+			goto on_error;
+		}
+		result = 1;
+	}
+	memory_free(
+	 safe_full_path );
+
+	*required_full_path_size = safe_full_path_size;
+
+	return( result );
+
+on_error:
+	if( safe_full_path != NULL )
+	{
+		memory_free(
+		 safe_full_path );
+	}
+	return( -1 );
+}
+
+/* Determines the full paths of the Windows paths specified
+ * The full paths are stored as consecutive strings in one buffer, the offset
+ * of each full path in the buffer is stored in the full path offsets.
+ * The full path of every path is determined by libcpath_path_get_full_path,
+ * since the volume name can only be determined using a temporary buffer
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_get_full_paths(
+     const char **paths,
+     const size_t *path_lengths,
+     int number_of_paths,
+     char **full_paths,
+     size_t *full_paths_size,
+     size_t **full_path_offsets,
+     libcerror_error_t **error )
+{
+	char *full_path                = NULL;
+	char *safe_full_paths          = NULL;
+	size_t *safe_full_path_offsets = NULL;
+	void *reallocation             = NULL;
+	static char *function          = "libcpath_path_get_full_paths";
+	size_t full_path_size          = 0;
+	size_t full_paths_offset       = 0;
+	size_t safe_full_paths_size    = 0;
+	int path_number                = 0;
+
+	if( paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid paths.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_lengths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path lengths.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_paths < 0 )
+	 || ( (size_t) number_of_paths > (size_t) ( SSIZE_MAX / sizeof( size_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of paths value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full paths.",
+		 function );
+
+		return( -1 );
+	}
+	if( *full_paths != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full paths value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_paths_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full paths size.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( *full_path_offsets != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full path offsets value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_paths == 0 )
+	{
+		*full_paths_size = 0;
+
+		return( 1 );
+	}
+	safe_full_path_offsets = (size_t *) memory_allocate(
+	                                     sizeof( size_t ) * number_of_paths );
+
+	if( safe_full_path_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create full path offsets.",
+		 function );
+
+		goto on_error;
+	}
+	for( path_number = 0;
+	     path_number < number_of_paths;
+	     path_number++ )
+	{
+		if( libcpath_internal_path_get_full_path(
+		     paths[ path_number ],
+		     path_lengths[ path_number ],
+		     &full_path,
+		     &full_path_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine full path: %d.",
+			 function,
+			 path_number );
+
+			goto on_error;
+		}
+		if( ( full_paths_offset + full_path_size ) > safe_full_paths_size )
+		{
+			/* Grow the full paths at least twofold to limit the number of reallocations
+			 */
+			if( ( full_paths_offset + full_path_size ) > ( safe_full_paths_size * 2 ) )
+			{
+				safe_full_paths_size = full_paths_offset + full_path_size;
+			}
+			else
+			{
+				safe_full_paths_size *= 2;
+			}
+			if( safe_full_paths_size > (size_t) SSIZE_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid full paths size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			reallocation = memory_reallocate(
+			                safe_full_paths,
+			                sizeof( char ) * safe_full_paths_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize full paths.",
+				 function );
+
+				goto on_error;
+			}
+			safe_full_paths = (char *) reallocation;
+		}
+		if( memory_copy(
+		     &( safe_full_paths[ full_paths_offset ] ),
+		     full_path,
+		     sizeof( char ) * full_path_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy full path: %d.",
+			 function,
+			 path_number );
+
+			goto on_error;
+		}
+		memory_free(
+		 full_path );
+
+		full_path = NULL;
+
+		safe_full_path_offsets[ path_number ] = full_paths_offset;
+
+		full_paths_offset += full_path_size;
+	}
+	*full_paths        = safe_full_paths;
+	*full_paths_size   = full_paths_offset;
+	*full_path_offsets = safe_full_path_offsets;
+
+	return( 1 );
+
+on_error:
+	if( full_path != NULL )
+	{
+		memory_free(
+		 full_path );
+	}
+	if( safe_full_paths != NULL )
+	{
+		memory_free(
+		 safe_full_paths );
+	}
+	if( safe_full_path_offsets != NULL )
+	{
+		memory_free(
+		 safe_full_path_offsets );
+	}
+	return( -1 );
+}
+
+#else
+
+/* Determines the full path of the POSIX path specified
+ * Multiple successive / are combined into one
+ *
+ * Scenarios:
+ * /home/user/file.txt
+ * /home/user//file.txt
+ * /home/user/../user/file.txt
+ * /../home/user/file.txt
+ * user/../user/file.txt
+ *
+ * The segments of the current working directory and the path are normalized
+ * directly into the full path, without splitting them first
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_get_full_path(
+     const char *path,
+     size_t path_length,
+     char **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error )
+{
+	char full_path_prefix[ 3 ];
+
+	const char *working_directory   = NULL;
+	char *current_directory         = NULL;
+	char *safe_full_path            = NULL;
+	static char *function           = "libcpath_path_get_full_path";
+	size_t current_directory_index  = 0;
+	size_t current_directory_length = 0;
+	size_t current_directory_size   = 0;
+	size_t full_path_prefix_length  = 0;
+	size_t path_index               = 0;
+	size_t safe_full_path_size      = 0;
+	uint8_t path_type               = LIBCPATH_TYPE_RELATIVE;
+	int result                      = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( __MINGW32__ )
+	if( ( path_length < 2 )
+	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+#else
+	if( ( path_length < 1 )
+	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *full_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( __MINGW32__ )
+	if( path[ 1 ] == ':' )
+	{
+		path_index = 2;
+	}
+	current_directory_index = 3;
+#endif
+	if( ( path_index < path_length )
+	 && ( path[ path_index ] == LIBCPATH_SEPARATOR ) )
+	{
+		path_type = LIBCPATH_TYPE_ABSOLUTE;
+	}
+	if( ( path_type == LIBCPATH_TYPE_RELATIVE )
+	 || ( path_index != current_directory_index ) )
+	{
+		result = libcpath_path_get_cached_current_working_directory(
+		          &working_directory,
+		          &current_directory_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cached current working directory.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libcpath_internal_path_get_current_working_directory_exact(
+			     &current_directory,
+			     &current_directory_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve current working directory.",
+				 function );
+
+				goto on_error;
+			}
+			if( current_directory == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing current working directory.",
+				 function );
+
+				goto on_error;
+			}
+			current_directory_length = current_directory_size - 1;
+
+			working_directory = current_directory;
+		}
+		if( current_directory_index > current_directory_length )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid current working directory length value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		current_directory_length -= current_directory_index;
+	}
+#if defined( __MINGW32__ )
+	/* The full path is prefixed with a drive letter, a colon and a directory separator
+	 */
+	if( path_index == 2 )
+	{
+		full_path_prefix[ full_path_prefix_length++ ] = path[ 0 ];
+	}
+	else
+	{
+		full_path_prefix[ full_path_prefix_length++ ] = working_directory[ 0 ];
+	}
+	full_path_prefix[ full_path_prefix_length++ ] = ':';
+#endif
+	/* The full path is prefixed with a directory separator
+	 */
+	full_path_prefix[ full_path_prefix_length++ ] = LIBCPATH_SEPARATOR;
+
+	/* Every segment is stored with a trailing directory separator, hence the full path
+	 * never needs more than the length of the inputs, a directory separator per input
+	 * and the prefix
+	 */
+	safe_full_path_size = full_path_prefix_length + ( path_length - path_index ) + 1;
+
+	if( path_type == LIBCPATH_TYPE_RELATIVE )
+	{
+		safe_full_path_size += current_directory_length + 1;
+	}
+	safe_full_path = narrow_string_allocate(
+	                  safe_full_path_size );
+
+	if( safe_full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create full path.",
+		 function );
+
+		goto on_error;
+	}
+	/* If the path is relative
+	 * the current working directory segments are added
+	 */
+	if( path_type == LIBCPATH_TYPE_RELATIVE )
+	{
+		result = libcpath_path_resolve_full_path(
+		          full_path_prefix,
+		          full_path_prefix_length,
+		          &( working_directory[ current_directory_index ] ),
+		          current_directory_length,
+		          &( path[ path_index ] ),
+		          path_length - path_index,
+		          safe_full_path,
+		          safe_full_path_size,
+		          full_path_size,
+		          error );
+	}
+	else
+	{
+		result = libcpath_path_resolve_full_path(
+		          full_path_prefix,
+		          full_path_prefix_length,
+		          NULL,
+		          0,
+		          &( path[ path_index ] ),
+		          path_length - path_index,
+		          safe_full_path,
+		          safe_full_path_size,
+		          full_path_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve full path.",
+		 function );
+
+		goto on_error;
+	}
+	if( current_directory != NULL )
+	{
+		memory_free(
+		 current_directory );
+	}
+	*full_path = safe_full_path;
+
+	return( 1 );
+
+on_error:
+	if( safe_full_path != NULL )
+	{
+		memory_free(
+		 safe_full_path );
+	}
+	if( current_directory != NULL )
+	{
+		memory_free(
+		 current_directory );
+	}
+	return( -1 );
+}
+
+/* Determines the full path of the POSIX path specified into a buffer
+ * This function does not allocate memory, the current working directory
+ * is retrieved into a buffer on the stack
+ *
+ * The required full path size is set to the size of the full path, including
+ * the end-of-string character, also when the full path is too small
+ *
+ * Returns 1 if successful, 0 if the full path is too small or -1 on error
+ */
+int libcpath_internal_path_get_full_path_to_buffer(
+     const char *path,
+     size_t path_length,
+     char *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     libcerror_error_t **error )
+{
+	char current_directory[ PATH_MAX ];
+	char full_path_prefix[ 3 ];
+
+	const char *working_directory   = NULL;
+	static char *function           = "libcpath_path_get_full_path_to_buffer";
+	size_t current_directory_index  = 0;
+	size_t current_directory_length = 0;
+	size_t full_path_prefix_length  = 0;
+	size_t path_index               = 0;
+	uint8_t path_type               = LIBCPATH_TYPE_RELATIVE;
+	int result                      = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( __MINGW32__ )
+	if( ( path_length < 2 )
+	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+#else
+	if( ( path_length < 1 )
+	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid full path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_full_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required full path size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( __MINGW32__ )
+	if( path[ 1 ] == ':' )
+	{
+		path_index = 2;
+	}
+	current_directory_index = 3;
+#endif
+	if( ( path_index < path_length )
+	 && ( path[ path_index ] == LIBCPATH_SEPARATOR ) )
+	{
+		path_type = LIBCPATH_TYPE_ABSOLUTE;
+	}
+	if( ( path_type == LIBCPATH_TYPE_RELATIVE )
+	 || ( path_index != current_directory_index ) )
+	{
+		result = libcpath_path_get_cached_current_working_directory(
+		          &working_directory,
+		          &current_directory_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cached current working directory.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			if( getcwd(
+			     current_directory,
+			     PATH_MAX ) == NULL )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 errno,
+				 "%s: unable to retrieve current working directory.",
+				 function );
+
+				return( -1 );
+			}
+			current_directory_length = narrow_string_length(
+			                            current_directory );
+
+			working_directory = current_directory;
+		}
+		if( current_directory_index > current_directory_length )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid current working directory length value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		current_directory_length -= current_directory_index;
+	}
+#if defined( __MINGW32__ )
+	/* The full path is prefixed with a drive letter, a colon and a directory separator
+	 */
+	if( path_index == 2 )
+	{
+		full_path_prefix[ full_path_prefix_length++ ] = path[ 0 ];
+	}
+	else
+	{
+		full_path_prefix[ full_path_prefix_length++ ] = working_directory[ 0 ];
+	}
+	full_path_prefix[ full_path_prefix_length++ ] = ':';
+#endif
+	/* The full path is prefixed with a directory separator
+	 */
+	full_path_prefix[ full_path_prefix_length++ ] = LIBCPATH_SEPARATOR;
+
+	/* If the path is relative
+	 * the current working directory segments are added
+	 */
+	if( path_type == LIBCPATH_TYPE_RELATIVE )
+	{
+		result = libcpath_path_resolve_full_path(
+		          full_path_prefix,
+		          full_path_prefix_length,
+		          &( working_directory[ current_directory_index ] ),
+		          current_directory_length,
+		          &( path[ path_index ] ),
+		          path_length - path_index,
+		          full_path,
+		          full_path_size,
+		          required_full_path_size,
+		          error );
+	}
+	else
+	{
+		result = libcpath_path_resolve_full_path(
+		          full_path_prefix,
+		          full_path_prefix_length,
+		          NULL,
+		          0,
+		          &( path[ path_index ] ),
+		          path_length - path_index,
+		          full_path,
+		          full_path_size,
+		          required_full_path_size,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve full path.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Determines the full paths of the POSIX paths specified
+ * The full paths are stored as consecutive strings in one buffer, the offset
+ * of each full path in the buffer is stored in the full path offsets.
+ * The current working directory is retrieved at most once for all paths.
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_get_full_paths(
+     const char **paths,
+     const size_t *path_lengths,
+     int number_of_paths,
+     char **full_paths,
+     size_t *full_paths_size,
+     size_t **full_path_offsets,
+     libcerror_error_t **error )
+{
+	char full_path_prefix[ 3 ];
+
+	const char *path                = NULL;
+	const char *working_directory   = NULL;
+	char *current_directory         = NULL;
+	char *safe_full_paths           = NULL;
+	size_t *safe_full_path_offsets  = NULL;
+	static char *function           = "libcpath_path_get_full_paths";
+	size_t current_directory_index  = 0;
+	size_t current_directory_length = 0;
+	size_t current_directory_size   = 0;
+	size_t full_path_prefix_length  = 0;
+	size_t full_path_size           = 0;
+	size_t full_paths_offset        = 0;
+	size_t path_index               = 0;
+	size_t path_length              = 0;
+	size_t safe_full_paths_size     = 0;
+	uint8_t path_type               = LIBCPATH_TYPE_RELATIVE;
+	int path_number                 = 0;
+	int result                      = 0;
+
+	if( paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid paths.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_lengths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path lengths.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_paths < 0 )
+	 || ( (size_t) number_of_paths > (size_t) ( SSIZE_MAX / sizeof( size_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of paths value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full paths.",
+		 function );
+
+		return( -1 );
+	}
+	if( *full_paths != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full paths value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_paths_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full paths size.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( *full_path_offsets != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full path offsets value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_paths == 0 )
+	{
+		*full_paths_size = 0;
+
+		return( 1 );
+	}
+#if defined( __MINGW32__ )
+	current_directory_index = 3;
+	full_path_prefix_length = 3;
+#else
+	full_path_prefix_length = 1;
+#endif
+	/* Validate the paths and determine the maximum size of all full paths
+	 */
+	for( path_number = 0;
+	     path_number < number_of_paths;
+	     path_number++ )
+	{
+		path        = paths[ path_number ];
+		path_length = path_lengths[ path_number ];
+
+		if( path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid path: %d.",
+			 function,
+			 path_number );
+
+			goto on_error;
+		}
+#if defined( __MINGW32__ )
+		if( ( path_length < 2 )
+		 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+#else
+		if( ( path_length < 1 )
+		 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid path: %d length value out of bounds.",
+			 function,
+			 path_number );
+
+			goto on_error;
+		}
+		path_index = 0;
+		path_type  = LIBCPATH_TYPE_RELATIVE;
+
+#if defined( __MINGW32__ )
+		if( path[ 1 ] == ':' )
+		{
+			path_index = 2;
+		}
+#endif
+		if( ( path_index < path_length )
+		 && ( path[ path_index ] == LIBCPATH_SEPARATOR ) )
+		{
+			path_type = LIBCPATH_TYPE_ABSOLUTE;
+		}
+		if( ( working_directory == NULL )
+		 && ( ( path_type == LIBCPATH_TYPE_RELATIVE )
+		  || ( path_index != current_directory_index ) ) )
+		{
+			result = libcpath_path_get_cached_current_working_directory(
+			          &working_directory,
+			          &current_directory_length,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve cached current working directory.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				if( libcpath_internal_path_get_current_working_directory_exact(
+				     &current_directory,
+				     &current_directory_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve current working directory.",
+					 function );
+
+					goto on_error;
+				}
+				if( current_directory == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing current working directory.",
+					 function );
+
+					goto on_error;
+				}
+				current_directory_length = current_directory_size - 1;
+
+				working_directory = current_directory;
+			}
+			if( current_directory_index > current_directory_length )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid current working directory length value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			current_directory_length -= current_directory_index;
+		}
+		/* Every segment is stored with a trailing directory separator, hence the full path
+		 * never needs more than the length of the inputs, a directory separator per input
+		 * and the prefix
+		 */
+		full_path_size = full_path_prefix_length + ( path_length - path_index ) + 1;
+
+		if( path_type == LIBCPATH_TYPE_RELATIVE )
+		{
+			full_path_size += current_directory_length + 1;
+		}
+		if( full_path_size > ( (size_t) SSIZE_MAX - safe_full_paths_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid full paths size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		safe_full_paths_size += full_path_size;
+	}
+	safe_full_path_offsets = (size_t *) memory_allocate(
+	                                     sizeof( size_t ) * number_of_paths );
+
+	if( safe_full_path_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create full path offsets.",
+		 function );
+
+		goto on_error;
+	}
+	safe_full_paths = narrow_string_allocate(
+	                   safe_full_paths_size );
+
+	if( safe_full_paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create full paths.",
+		 function );
+
+		goto on_error;
+	}
+	/* Resolve the full paths, since the size of every full path was accounted
+	 * for each full path is normalized in a single forward scan
+	 */
+	for( path_number = 0;
+	     path_number < number_of_paths;
+	     path_number++ )
+	{
+		path                    = paths[ path_number ];
+		path_length             = path_lengths[ path_number ];
+		path_index              = 0;
+		path_type               = LIBCPATH_TYPE_RELATIVE;
+		full_path_prefix_length = 0;
+
+#if defined( __MINGW32__ )
+		if( path[ 1 ] == ':' )
+		{
+			path_index = 2;
+		}
+#endif
+		if( ( path_index < path_length )
+		 && ( path[ path_index ] == LIBCPATH_SEPARATOR ) )
+		{
+			path_type = LIBCPATH_TYPE_ABSOLUTE;
+		}
+#if defined( __MINGW32__ )
+		/* The full path is prefixed with a drive letter, a colon and a directory separator
+		 */
+		if( path_index == 2 )
+		{
+			full_path_prefix[ full_path_prefix_length++ ] = path[ 0 ];
+		}
+		else
+		{
+			full_path_prefix[ full_path_prefix_length++ ] = working_directory[ 0 ];
+		}
+		full_path_prefix[ full_path_prefix_length++ ] = ':';
+#endif
+		/* The full path is prefixed with a directory separator
+		 */
+		full_path_prefix[ full_path_prefix_length++ ] = LIBCPATH_SEPARATOR;
+
+		/* If the path is relative
+		 * the current working directory segments are added
+		 */
+		if( path_type == LIBCPATH_TYPE_RELATIVE )
+		{
+			result = libcpath_path_resolve_full_path(
+			          full_path_prefix,
+			          full_path_prefix_length,
+			          &( working_directory[ current_directory_index ] ),
+			          current_directory_length,
+			          &( path[ path_index ] ),
+			          path_length - path_index,
+			          &( safe_full_paths[ full_paths_offset ] ),
+			          safe_full_paths_size - full_paths_offset,
+			          &full_path_size,
+			          error );
+		}
+		else
+		{
+			result = libcpath_path_resolve_full_path(
+			          full_path_prefix,
+			          full_path_prefix_length,
+			          NULL,
+			          0,
+			          &( path[ path_index ] ),
+			          path_length - path_index,
+			          &( safe_full_paths[ full_paths_offset ] ),
+			          safe_full_paths_size - full_paths_offset,
+			          &full_path_size,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to resolve full path: %d.",
+			 function,
+			 path_number );
+
+			goto on_error;
+		}
+		safe_full_path_offsets[ path_number ] = full_paths_offset;
+
+		full_paths_offset += full_path_size;
+	}
+	if( current_directory != NULL )
+	{
+		memory_free(
+		 current_directory );
+	}
+	*full_paths        = safe_full_paths;
+	*full_paths_size   = full_paths_offset;
+	*full_path_offsets = safe_full_path_offsets;
+
+	return( 1 );
+
+on_error:
+	if( safe_full_paths != NULL )
+	{
+		memory_free(
+		 safe_full_paths );
+	}
+	if( safe_full_path_offsets != NULL )
+	{
+		memory_free(
+		 safe_full_path_offsets );
+	}
+	if( current_directory != NULL )
+	{
+		memory_free(
+		 current_directory );
+	}
+	return( -1 );
+}
+
+#endif /* defined( WINAPI ) */
+
+/* Retrieves the first segment of a path
+ * The segment is a view into the path, it is not copied and not terminated
+ * by an end-of-string character
+ *
+ * The path index is set to the start of the next segment, so that the
+ * remaining segments can be retrieved with libcpath_path_get_next_segment
+ *
+ * Returns 1 if successful, 0 if the path has no (remaining) segments or -1 on error
+ */
+int libcpath_path_get_first_segment(
+     const char *path,
+     size_t path_length,
+     size_t *path_index,
+     const char **segment,
+     size_t *segment_length,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_get_first_segment";
+	int result            = 0;
+
+	if( path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path index.",
+		 function );
+
+		return( -1 );
+	}
+	*path_index = 0;
+
+	result = libcpath_path_get_next_segment(
+	          path,
+	          path_length,
+	          path_index,
+	          segment,
+	          segment_length,
+	          flags,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first segment.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the next segment of a path
+ * The segments are separated by the directory separator, where a path without
+ * directory separators consists of a single segment. Empty segments, such as
+ * those of successive directory separators, and "." (current directory)
+ * segments are skipped if the corresponding segment flags are set.
+ *
+ * The segment is a view into the path, it is not copied and not terminated
+ * by an end-of-string character, hence no memory is allocated
+ *
+ * The path index contains the start of the segment to retrieve and is set to
+ * the start of the next segment, or beyond the end of the path after the last
+ * segment
+ *
+ * Returns 1 if successful, 0 if the path has no (remaining) segments or -1 on error
+ */
+int libcpath_path_get_next_segment(
+     const char *path,
+     size_t path_length,
+     size_t *path_index,
+     const char **segment,
+     size_t *segment_length,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function      = "libcpath_path_get_next_segment";
+	size_t safe_path_index     = 0;
+	size_t safe_segment_length = 0;
+	size_t segment_start_index = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path index.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment length.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & ~( LIBCPATH_SEGMENT_FLAG_SKIP_EMPTY | LIBCPATH_SEGMENT_FLAG_SKIP_CURRENT ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags.",
+		 function );
+
+		return( -1 );
+	}
+	safe_path_index = *path_index;
+
+	while( safe_path_index <= path_length )
+	{
+		segment_start_index = safe_path_index;
+
+		while( ( safe_path_index < path_length )
+		    && ( path[ safe_path_index ] != LIBCPATH_SEPARATOR ) )
+		{
+			safe_path_index++;
+		}
+		safe_segment_length = safe_path_index - segment_start_index;
+
+		/* Skip the directory separator, after the last segment this moves
+		 * the path index beyond the end of the path
+		 */
+		safe_path_index++;
+
+		if( ( ( flags & LIBCPATH_SEGMENT_FLAG_SKIP_EMPTY ) != 0 )
+		 && ( safe_segment_length == 0 ) )
+		{
+			continue;
+		}
+		if( ( ( flags & LIBCPATH_SEGMENT_FLAG_SKIP_CURRENT ) != 0 )
+		 && ( safe_segment_length == 1 )
+		 && ( path[ segment_start_index ] == '.' ) )
+		{
+			continue;
+		}
+		*path_index     = safe_path_index;
+		*segment        = &( path[ segment_start_index ] );
+		*segment_length = safe_segment_length;
+
+		return( 1 );
+	}
+	*path_index = safe_path_index;
+
+	return( 0 );
+}
+
+/* Appends the normalized segments of a path to a full path
+ * Empty segments, such as those of successive directory separators, and
+ * "." (current directory) segments are ignored. A ".." (parent directory)
+ * segment removes the last segment from the full path, but never the prefix.
+ * If the full path is relative, i.e. the prefix does not end with a directory
+ * separator, a ".." segment that cannot be applied is retained.
+ *
+ * Every segment is appended with a trailing directory separator, so that the
+ * full path itself is used as the stack of segments and no split strings
+ * need to be allocated.
+ *
+ * The full path index contains the index of the end of the full path
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_append_normalized_segments(
+     char *full_path,
+     size_t full_path_size,
+     size_t full_path_prefix_length,
+     size_t *full_path_index,
+     const char *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	static char *function       = "libcpath_path_append_normalized_segments";
+	const char *segment         = NULL;
+	size_t path_index           = 0;
+	size_t safe_full_path_index = 0;
+	size_t segment_length       = 0;
+	int last_segment_is_parent  = 0;
+	int result                  = 0;
+
+	if( full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid full path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_prefix_length > full_path_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid full path prefix length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path index.",
+		 function );
+
+		return( -1 );
+	}
+	safe_full_path_index = *full_path_index;
+
+	if( ( safe_full_path_index < full_path_prefix_length )
+	 || ( safe_full_path_index > full_path_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid full path index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Empty segments, such as those of successive directory separators, and
+	 * "." (current directory) segments are skipped by the segment iterator
+	 */
+	while( path_index <= path_length )
+	{
+		result = libcpath_path_get_next_segment(
+		          path,
+		          path_length,
+		          &path_index,
+		          &segment,
+		          &segment_length,
+		          LIBCPATH_SEGMENT_FLAG_SKIP_EMPTY | LIBCPATH_SEGMENT_FLAG_SKIP_CURRENT,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path segment.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		/* If the segment is ".." (parent) remove the last segment and its directory separator
+		 */
+		if( ( segment_length == 2 )
+		 && ( segment[ 0 ] == '.' )
+		 && ( segment[ 1 ] == '.' ) )
+		{
+			/* The last segment cannot be removed if it is ".." (parent) itself
+			 */
+			if( ( safe_full_path_index >= ( full_path_prefix_length + 3 ) )
+			 && ( full_path[ safe_full_path_index - 3 ] == '.' )
+			 && ( full_path[ safe_full_path_index - 2 ] == '.' )
+			 && ( ( safe_full_path_index == ( full_path_prefix_length + 3 ) )
+			  ||  ( full_path[ safe_full_path_index - 4 ] == LIBCPATH_SEPARATOR ) ) )
+			{
+				last_segment_is_parent = 1;
+			}
+			else
+			{
+				last_segment_is_parent = 0;
+			}
+			if( ( safe_full_path_index > full_path_prefix_length )
+			 && ( last_segment_is_parent == 0 ) )
+			{
+				safe_full_path_index--;
+
+				while( ( safe_full_path_index > full_path_prefix_length )
+				    && ( full_path[ safe_full_path_index - 1 ] != LIBCPATH_SEPARATOR ) )
+				{
+					safe_full_path_index--;
+				}
+				continue;
+			}
+			/* An absolute full path has no parent beyond its prefix
+			 */
+			if( ( full_path_prefix_length > 0 )
+			 && ( full_path[ full_path_prefix_length - 1 ] == LIBCPATH_SEPARATOR ) )
+			{
+				continue;
+			}
+		}
+		/* Note that here we should have room for the segment and a directory separator
+		 */
+		if( segment_length >= ( full_path_size - safe_full_path_index ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid full path size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( narrow_string_copy(
+		     &( full_path[ safe_full_path_index ] ),
+		     segment,
+		     segment_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy path segment to full path.",
+			 function );
+
+			return( -1 );
+		}
+		safe_full_path_index += segment_length;
+
+		full_path[ safe_full_path_index++ ] = LIBCPATH_SEPARATOR;
+	}
+	*full_path_index = safe_full_path_index;
+
+	return( 1 );
+}
+
+/* Determines the length of the normalized segments of a path
+ * The path is scanned from the end, so that the ".." (parent directory)
+ * segments can be applied without storing the segments.
+ *
+ * The number of parent segments contains the number of ".." segments that
+ * were not applied and must be applied to segments preceding the path.
+ * The segments length is increased with the length of every remaining
+ * segment and a directory separator.
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_normalized_segments_length(
+     const char *path,
+     size_t path_length,
+     size_t *number_of_parent_segments,
+     size_t *segments_length,
+     libcerror_error_t **error )
+{
+	static char *function                 = "libcpath_path_get_normalized_segments_length";
+	size_t path_index                     = 0;
+	size_t safe_number_of_parent_segments = 0;
+	size_t safe_segments_length           = 0;
+	size_t segment_end_index              = 0;
+	size_t segment_length                 = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_parent_segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of parent segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( segments_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segments length.",
+		 function );
+
+		return( -1 );
+	}
+	safe_number_of_parent_segments = *number_of_parent_segments;
+	safe_segments_length           = *segments_length;
+
+	path_index = path_length;
+
+	while( path_index > 0 )
+	{
+		segment_end_index = path_index;
+
+		while( ( path_index > 0 )
+		    && ( path[ path_index - 1 ] != LIBCPATH_SEPARATOR ) )
+		{
+			path_index--;
+		}
+		segment_length = segment_end_index - path_index;
+
+		/* If the segment is "" (empty) or "." (current) ignore it
+		 */
+		if( ( segment_length == 0 )
+		 || ( ( segment_length == 1 )
+		  &&  ( path[ path_index ] == '.' ) ) )
+		{
+		}
+		/* If the segment is ".." (parent) skip the preceding segment
+		 */
+		else if( ( segment_length == 2 )
+		      && ( path[ path_index ] == '.' )
+		      && ( path[ path_index + 1 ] == '.' ) )
+		{
+			safe_number_of_parent_segments++;
+		}
+		else if( safe_number_of_parent_segments > 0 )
+		{
+			safe_number_of_parent_segments--;
+		}
+		else
+		{
+			safe_segments_length += segment_length + 1;
+		}
+		/* Skip the directory separator
+		 */
+		if( path_index > 0 )
+		{
+			path_index--;
+		}
+	}
+	*number_of_parent_segments = safe_number_of_parent_segments;
+	*segments_length           = safe_segments_length;
+
+	return( 1 );
+}
+
+/* Prepends the normalized segments of a path to a full path
+ * This is the reverse of libcpath_path_append_normalized_segments, the path
+ * is scanned from the end and the segments are written in front of the
+ * full path index, with a trailing directory separator.
+ *
+ * The number of parent segments contains the number of ".." segments that
+ * were not applied and must be applied to segments preceding the path.
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_prepend_normalized_segments(
+     char *full_path,
+     size_t full_path_size,
+     size_t full_path_prefix_length,
+     size_t *full_path_index,
+     const char *path,
+     size_t path_length,
+     size_t *number_of_parent_segments,
+     libcerror_error_t **error )
+{
+	static char *function                 = "libcpath_path_prepend_normalized_segments";
+	size_t path_index                     = 0;
+	size_t safe_full_path_index           = 0;
+	size_t safe_number_of_parent_segments = 0;
+	size_t segment_end_index              = 0;
+	size_t segment_length                 = 0;
+
+	if( full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid full path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_prefix_length > full_path_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid full path prefix length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path index.",
+		 function );
+
+		return( -1 );
+	}
+	safe_full_path_index = *full_path_index;
+
+	if( ( safe_full_path_index < full_path_prefix_length )
+	 || ( safe_full_path_index > full_path_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid full path index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_parent_segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of parent segments.",
+		 function );
+
+		return( -1 );
+	}
+	safe_number_of_parent_segments = *number_of_parent_segments;
+
+	path_index = path_length;
+
+	while( path_index > 0 )
+	{
+		segment_end_index = path_index;
+
+		while( ( path_index > 0 )
+		    && ( path[ path_index - 1 ] != LIBCPATH_SEPARATOR ) )
+		{
+			path_index--;
+		}
+		segment_length = segment_end_index - path_index;
+
+		/* If the segment is "" (empty) or "." (current) ignore it
+		 */
+		if( ( segment_length == 0 )
+		 || ( ( segment_length == 1 )
+		  &&  ( path[ path_index ] == '.' ) ) )
+		{
+		}
+		/* If the segment is ".." (parent) skip the preceding segment
+		 */
+		else if( ( segment_length == 2 )
+		      && ( path[ path_index ] == '.' )
+		      && ( path[ path_index + 1 ] == '.' ) )
+		{
+			safe_number_of_parent_segments++;
+		}
+		else if( safe_number_of_parent_segments > 0 )
+		{
+			safe_number_of_parent_segments--;
+		}
+		else
+		{
+			/* Note that here we should have room for the segment and a directory separator
+			 */
+			if( segment_length >= ( safe_full_path_index - full_path_prefix_length ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid full path size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			safe_full_path_index -= segment_length + 1;
+
+			if( narrow_string_copy(
+			     &( full_path[ safe_full_path_index ] ),
+			     &( path[ path_index ] ),
+			     segment_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy path segment to full path.",
+				 function );
+
+				return( -1 );
+			}
+			full_path[ safe_full_path_index + segment_length ] = LIBCPATH_SEPARATOR;
+		}
+		/* Skip the directory separator
+		 */
+		if( path_index > 0 )
+		{
+			path_index--;
+		}
+	}
+	*full_path_index           = safe_full_path_index;
+	*number_of_parent_segments = safe_number_of_parent_segments;
+
+	return( 1 );
+}
+
+/* Resolves a path relative to a base directory into a full path
+ * The base directory is optional and must be a full path without its prefix.
+ *
+ * If the full path is large enough to contain the prefix, the base directory,
+ * the path and a directory separator for both, the segments are normalized
+ * in a single forward scan. Otherwise the exact size is determined first and
+ * the segments are written from the end of the full path, so that the full
+ * path is never larger than the result.
+ *
+ * Returns 1 if successful, 0 if the full path is too small or -1 on error
+ */
+int libcpath_path_resolve_full_path(
+     const char *full_path_prefix,
+     size_t full_path_prefix_length,
+     const char *base_directory,
+     size_t base_directory_length,
+     const char *path,
+     size_t path_length,
+     char *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     libcerror_error_t **error )
+{
+	static char *function            = "libcpath_path_resolve_full_path";
+	size_t full_path_index           = 0;
+	size_t maximum_full_path_size    = 0;
+	size_t number_of_parent_segments = 0;
+	size_t safe_full_path_size       = 0;
+	size_t segments_length           = 0;
+
+	if( full_path_prefix == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path prefix.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_prefix_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid full path prefix length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_directory_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid base directory length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid full path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_full_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required full path size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every segment is stored with a trailing directory separator, hence the full path
+	 * never needs more than the length of the inputs, a directory separator per input
+	 * and the prefix
+	 */
+	maximum_full_path_size = full_path_prefix_length + path_length + 1;
+
+	if( base_directory != NULL )
+	{
+		maximum_full_path_size += base_directory_length + 1;
+	}
+	if( full_path_size >= maximum_full_path_size )
+	{
+		if( narrow_string_copy(
+		     full_path,
+		     full_path_prefix,
+		     full_path_prefix_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy prefix to full path.",
+			 function );
+
+			return( -1 );
+		}
+		full_path_index = full_path_prefix_length;
+
+		if( base_directory != NULL )
+		{
+			if( libcpath_path_append_normalized_segments(
+			     full_path,
+			     full_path_size,
+			     full_path_prefix_length,
+			     &full_path_index,
+			     base_directory,
+			     base_directory_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append base directory segments to full path.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libcpath_path_append_normalized_segments(
+		     full_path,
+		     full_path_size,
+		     full_path_prefix_length,
+		     &full_path_index,
+		     path,
+		     path_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append path segments to full path.",
+			 function );
+
+			return( -1 );
+		}
+		/* Remove the directory separator of the last segment
+		 */
+		if( full_path_index > full_path_prefix_length )
+		{
+			full_path_index--;
+		}
+		full_path[ full_path_index ] = 0;
+
+		*required_full_path_size = full_path_index + 1;
+
+		return( 1 );
+	}
+	if( libcpath_path_get_normalized_segments_length(
+	     path,
+	     path_length,
+	     &number_of_parent_segments,
+	     &segments_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine path segments length.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_directory != NULL )
+	{
+		if( libcpath_path_get_normalized_segments_length(
+		     base_directory,
+		     base_directory_length,
+		     &number_of_parent_segments,
+		     &segments_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine base directory segments length.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The directory separator of the last segment is replaced by the end of string character
+	 */
+	if( segments_length == 0 )
+	{
+		safe_full_path_size = full_path_prefix_length + 1;
+	}
+	else
+	{
+		safe_full_path_size = full_path_prefix_length + segments_length;
+	}
+	*required_full_path_size = safe_full_path_size;
+
+	if( safe_full_path_size > full_path_size )
+	{
+		return( 0 );
+	}
+	if( narrow_string_copy(
+	     full_path,
+	     full_path_prefix,
+	     full_path_prefix_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy prefix to full path.",
+		 function );
+
+		return( -1 );
+	}
+	full_path_index           = full_path_prefix_length + segments_length;
+	number_of_parent_segments = 0;
+
+	if( libcpath_path_prepend_normalized_segments(
+	     full_path,
+	     full_path_size,
+	     full_path_prefix_length,
+	     &full_path_index,
+	     path,
+	     path_length,
+	     &number_of_parent_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to prepend path segments to full path.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_directory != NULL )
+	{
+		if( libcpath_path_prepend_normalized_segments(
+		     full_path,
+		     full_path_size,
+		     full_path_prefix_length,
+		     &full_path_index,
+		     base_directory,
+		     base_directory_length,
+		     &number_of_parent_segments,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to prepend base directory segments to full path.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	full_path[ safe_full_path_size - 1 ] = 0;
+
+	return( 1 );
+}
+
+/* The size of the sanitized version of a character, indexed by its byte value
+ * 1 if the character is not escaped, 2 if the character is the escape character
+ * and 4 if the character is escaped as an hexadecimal value, such as \x01
+ */
+static const uint8_t libcpath_path_sanitized_character_sizes[ 256 ] = {
+	/* 0x00 - 0x0f */
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	/* 0x10 - 0x1f */
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	/* 0x20 - 0x2f, escapes ! $ % & * + and on Windows / */
+#if defined( WINAPI )
+	1, 4, 1, 1, 4, 4, 4, 1, 1, 1, 4, 4, 1, 1, 1, 4,
+#else
+	1, 4, 1, 1, 4, 4, 4, 1, 1, 1, 4, 4, 1, 1, 1, 1,
+#endif
+	/* 0x30 - 0x3f, escapes : ; < > ? */
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4, 4, 4, 1, 4, 4,
+	/* 0x40 - 0x4f */
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	/* 0x50 - 0x5f, escape character ^ on Windows and \ otherwise */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+#else
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1,
+#endif
+	/* 0x60 - 0x6f */
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	/* 0x70 - 0x7f, escapes | and 0x7f */
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 4, 1, 1, 4,
+	/* 0x80 - 0xff */
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+
+/* The hexadecimal digits of an escaped character
+ * Note that the nibble value 10 is represented as ':', this is retained
+ * so that previously sanitized names remain the same
+ */
+static const char libcpath_path_sanitized_character_digits[ 17 ] = "0123456789:bcdef";
+
+#if defined( __SSE2__ )
+
+/* The characters, other than the control characters, that are escaped
+ * according to the sanitized character sizes table
+ */
+static const char libcpath_path_escaped_characters[] = {
+	'!', '$', '%', '&', '*', '+', ':', ';', '<', '>', '?', '|', 0x7f,
+#if defined( WINAPI )
+	'/',
+#endif
+	LIBCPATH_ESCAPE_CHARACTER };
+
+#endif /* defined( __SSE2__ ) */
+
+/* Retrieves the size of a sanitized version of the path character
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_sanitized_character_size(
+     char character,
+     size_t *sanitized_character_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_get_sanitized_character_size";
+
+	if( sanitized_character_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized character size.",
+		 function );
+
+		return( -1 );
+	}
+	*sanitized_character_size = libcpath_path_sanitized_character_sizes[ (uint8_t) character ];
+
+	return( 1 );
+}
+
+/* Retrieves a sanitized version of the path character
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_sanitized_character(
+     char character,
+     size_t sanitized_character_size,
+     char *sanitized_path,
+     size_t sanitized_path_size,
+     size_t *sanitized_path_index,
+     libcerror_error_t **error )
+{
+	static char *function            = "libcpath_path_get_sanitized_character";
+	size_t safe_sanitized_path_index = 0;
+	char lower_nibble                = 0;
+	char upper_nibble                = 0;
+
+	if( ( sanitized_character_size != 1 )
+	 && ( sanitized_character_size != 2 )
+	 && ( sanitized_character_size != 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sanitized character size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized path.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized path index.",
+		 function );
+
+		return( -1 );
+	}
+	safe_sanitized_path_index = *sanitized_path_index;
+
+	if( safe_sanitized_path_index > sanitized_path_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sanitized path index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sanitized_character_size > sanitized_path_size )
+	 || ( safe_sanitized_path_index > ( sanitized_path_size - sanitized_character_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid sanitized path size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_character_size == 1 )
+	{
+		sanitized_path[ safe_sanitized_path_index++ ] = character;
+	}
+	else if( sanitized_character_size == 2 )
+	{
+		sanitized_path[ safe_sanitized_path_index++ ] = LIBCPATH_ESCAPE_CHARACTER;
+		sanitized_path[ safe_sanitized_path_index++ ] = LIBCPATH_ESCAPE_CHARACTER;
+	}
+	else if( sanitized_character_size == 4 )
+	{
+		lower_nibble = character & 0x0f;
+		upper_nibble = ( character >> 4 ) & 0x0f;
+
+		if( lower_nibble > 10 )
+		{
+			lower_nibble += 'a' - 10;
+		}
+		else
+		{
+			lower_nibble += '0';
+		}
+		if( upper_nibble > 10 )
+		{
+			upper_nibble += 'a' - 10;
+		}
+		else
+		{
+			upper_nibble += '0';
+		}
+		sanitized_path[ safe_sanitized_path_index++ ] = LIBCPATH_ESCAPE_CHARACTER;
+		sanitized_path[ safe_sanitized_path_index++ ] = 'x';
+		sanitized_path[ safe_sanitized_path_index++ ] = upper_nibble;
+		sanitized_path[ safe_sanitized_path_index++ ] = lower_nibble;
+	}
+	*sanitized_path_index = safe_sanitized_path_index;
+
+	return( 1 );
+}
+
+/* Determines the length of the leading part of a string that does not need
+ * to be escaped and hence can be copied as-is into the sanitized string
+ * If SSE2 is available 16 characters are tested at a time
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_unescaped_string_length(
+     const char *string,
+     size_t string_length,
+     uint8_t escape_separator,
+     size_t *unescaped_string_length,
+     libcerror_error_t **error )
+{
+#if defined( __SSE2__ )
+	__m128i escaped_characters[ sizeof( libcpath_path_escaped_characters ) + 1 ];
+
+	__m128i block                       = _mm_setzero_si128();
+	__m128i control_characters_maximum  = _mm_setzero_si128();
+	__m128i escaped_characters_mask     = _mm_setzero_si128();
+	size_t escaped_character_index      = 0;
+	size_t number_of_escaped_characters = 0;
+#endif
+	static char *function               = "libcpath_path_get_unescaped_string_length";
+	size_t string_index                 = 0;
+	uint8_t byte_value                  = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( unescaped_string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unescaped string length.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( __SSE2__ )
+	if( string_length >= 16 )
+	{
+		for( escaped_character_index = 0;
+		     escaped_character_index < sizeof( libcpath_path_escaped_characters );
+		     escaped_character_index++ )
+		{
+			escaped_characters[ number_of_escaped_characters++ ] = _mm_set1_epi8(
+			                                                        libcpath_path_escaped_characters[ escaped_character_index ] );
+		}
+		if( escape_separator != 0 )
+		{
+			escaped_characters[ number_of_escaped_characters++ ] = _mm_set1_epi8(
+			                                                        LIBCPATH_SEPARATOR );
+		}
+		control_characters_maximum = _mm_set1_epi8(
+		                              0x1f );
+
+		while( ( string_length - string_index ) >= 16 )
+		{
+			block = _mm_loadu_si128(
+			         (const __m128i *) &( string[ string_index ] ) );
+
+			/* A character is a control character if it is equal to the minimum
+			 * of the character and 0x1f
+			 */
+			escaped_characters_mask = _mm_cmpeq_epi8(
+			                           _mm_min_epu8(
+			                            block,
+			                            control_characters_maximum ),
+			                           block );
+
+			for( escaped_character_index = 0;
+			     escaped_character_index < number_of_escaped_characters;
+			     escaped_character_index++ )
+			{
+				escaped_characters_mask = _mm_or_si128(
+				                           escaped_characters_mask,
+				                           _mm_cmpeq_epi8(
+				                            block,
+				                            escaped_characters[ escaped_character_index ] ) );
+			}
+			/* The position of the escaped character within the block is
+			 * determined by the character by character test below
+			 */
+			if( _mm_movemask_epi8(
+			     escaped_characters_mask ) != 0 )
+			{
+				break;
+			}
+			string_index += 16;
+		}
+	}
+#endif /* defined( __SSE2__ ) */
+
+	while( string_index < string_length )
+	{
+		if( ( escape_separator != 0 )
+		 && ( string[ string_index ] == LIBCPATH_SEPARATOR ) )
+		{
+			break;
+		}
+		byte_value = (uint8_t) string[ string_index ];
+
+		if( libcpath_path_sanitized_character_sizes[ byte_value ] != 1 )
+		{
+			break;
+		}
+		string_index++;
+	}
+	*unescaped_string_length = string_index;
+
+	return( 1 );
+}
+
+/* Retrieves a sanitized version of a string
+ * Runs of characters that do not need to be escaped are determined by
+ * libcpath_path_get_unescaped_string_length and copied as-is, every other
+ * character is classified with a single lookup in the sanitized character
+ * sizes table.
+ *
+ * If sanitized string is NULL only the required sanitized string size is
+ * determined, otherwise the sanitized string is written in the same pass.
+ * The required sanitized string size includes the end-of-string character.
+ *
+ * If escape separator is set the directory separator is escaped as well,
+ * which is used to sanitize filenames
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_sanitized_string(
+     const char *string,
+     size_t string_length,
+     uint8_t escape_separator,
+     char *sanitized_string,
+     size_t sanitized_string_size,
+     size_t *required_sanitized_string_size,
+     libcerror_error_t **error )
+{
+	static char *function             = "libcpath_path_get_sanitized_string";
+	size_t safe_sanitized_string_size = 0;
+	size_t sanitized_character_size   = 0;
+	size_t sanitized_string_index     = 0;
+	size_t string_index               = 0;
+	size_t unescaped_string_length    = 0;
+	uint8_t byte_value                = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_sanitized_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required sanitized string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_string == NULL )
+	{
+		safe_sanitized_string_size = 1;
+
+		for( string_index = 0;
+		     string_index < string_length;
+		     string_index++ )
+		{
+			if( libcpath_path_get_unescaped_string_length(
+			     &( string[ string_index ] ),
+			     string_length - string_index,
+			     escape_separator,
+			     &unescaped_string_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine unescaped string length.",
+				 function );
+
+				return( -1 );
+			}
+			safe_sanitized_string_size += unescaped_string_length;
+			string_index               += unescaped_string_length;
+
+			if( string_index >= string_length )
+			{
+				break;
+			}
+			if( ( escape_separator != 0 )
+			 && ( string[ string_index ] == LIBCPATH_SEPARATOR ) )
+			{
+				safe_sanitized_string_size += 4;
+			}
+			else
+			{
+				byte_value = (uint8_t) string[ string_index ];
+
+				safe_sanitized_string_size += libcpath_path_sanitized_character_sizes[ byte_value ];
+			}
+		}
+		*required_sanitized_string_size = safe_sanitized_string_size;
+
+		return( 1 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( libcpath_path_get_unescaped_string_length(
+		     &( string[ string_index ] ),
+		     string_length - string_index,
+		     escape_separator,
+		     &unescaped_string_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine unescaped string length.",
+			 function );
+
+			return( -1 );
+		}
+		if( unescaped_string_length > 0 )
+		{
+			if( unescaped_string_length > ( sanitized_string_size - sanitized_string_index ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid sanitized string size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     &( sanitized_string[ sanitized_string_index ] ),
+			     &( string[ string_index ] ),
+			     sizeof( char ) * unescaped_string_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy unescaped string.",
+				 function );
+
+				return( -1 );
+			}
+			sanitized_string_index += unescaped_string_length;
+			string_index           += unescaped_string_length;
+
+			if( string_index >= string_length )
+			{
+				break;
+			}
+		}
+		byte_value = (uint8_t) string[ string_index ];
+
+		if( ( escape_separator != 0 )
+		 && ( string[ string_index ] == LIBCPATH_SEPARATOR ) )
+		{
+			sanitized_character_size = 4;
+		}
+		else
+		{
+			sanitized_character_size = libcpath_path_sanitized_character_sizes[ byte_value ];
+		}
+		if( sanitized_character_size > ( sanitized_string_size - sanitized_string_index ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid sanitized string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( sanitized_character_size == 1 )
+		{
+			sanitized_string[ sanitized_string_index++ ] = string[ string_index ];
+		}
+		else if( sanitized_character_size == 2 )
+		{
+			sanitized_string[ sanitized_string_index++ ] = LIBCPATH_ESCAPE_CHARACTER;
+			sanitized_string[ sanitized_string_index++ ] = LIBCPATH_ESCAPE_CHARACTER;
+		}
+		else
+		{
+			sanitized_string[ sanitized_string_index++ ] = LIBCPATH_ESCAPE_CHARACTER;
+			sanitized_string[ sanitized_string_index++ ] = 'x';
+			sanitized_string[ sanitized_string_index++ ] = libcpath_path_sanitized_character_digits[ byte_value >> 4 ];
+			sanitized_string[ sanitized_string_index++ ] = libcpath_path_sanitized_character_digits[ byte_value & 0x0f ];
+		}
+	}
+	if( sanitized_string_index >= sanitized_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sanitized string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	sanitized_string[ sanitized_string_index++ ] = 0;
+
+	*required_sanitized_string_size = sanitized_string_index;
+
+	return( 1 );
+}
+
+/* Retrieves a sanitized version of the filename
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_get_sanitized_filename(
+     const char *filename,
+     size_t filename_length,
+     char **sanitized_filename,
+     size_t *sanitized_filename_size,
+     libcerror_error_t **error )
+{
+	static char *function               = "libcpath_path_get_sanitized_filename";
+	char *safe_sanitized_filename       = NULL;
+	size_t safe_sanitized_filename_size = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sanitized_filename != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sanitized filename value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_filename_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized filename size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_get_sanitized_string(
+	     filename,
+	     filename_length,
+	     1,
+	     NULL,
+	     0,
+	     &safe_sanitized_filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine sanitized filename size.",
+		 function );
+
+		goto on_error;
+	}
+	if( safe_sanitized_filename_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized filename size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	safe_sanitized_filename = narrow_string_allocate(
+	                           safe_sanitized_filename_size );
+
+	if( safe_sanitized_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sanitized filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_path_get_sanitized_string(
+	     filename,
+	     filename_length,
+	     1,
+	     safe_sanitized_filename,
+	     safe_sanitized_filename_size,
+	     &safe_sanitized_filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine sanitized filename.",
+		 function );
+
+		goto on_error;
+	}
+
+	*sanitized_filename      = safe_sanitized_filename;
+	*sanitized_filename_size = safe_sanitized_filename_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_sanitized_filename != NULL )
+	{
+		memory_free(
+		 safe_sanitized_filename );
+	}
+	return( -1 );
+}
+
+/* Retrieves a sanitized version of the filename into a buffer
+ * This function does not allocate memory
+ *
+ * The required sanitized filename size is set to the size of the sanitized
+ * filename, including the end-of-string character, also when the sanitized
+ * filename is too small
+ *
+ * Returns 1 if successful, 0 if the sanitized filename is too small or -1 on error
+ */
+int libcpath_internal_path_get_sanitized_filename_to_buffer(
+     const char *filename,
+     size_t filename_length,
+     char *sanitized_filename,
+     size_t sanitized_filename_size,
+     size_t *required_sanitized_filename_size,
+     libcerror_error_t **error )
+{
+	static char *function               = "libcpath_path_get_sanitized_filename_to_buffer";
+	size_t safe_sanitized_filename_size = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_filename_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized filename size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_sanitized_filename_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required sanitized filename size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_get_sanitized_string(
+	     filename,
+	     filename_length,
+	     1,
+	     NULL,
+	     0,
+	     &safe_sanitized_filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine sanitized filename size.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_sanitized_filename_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized filename size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*required_sanitized_filename_size = safe_sanitized_filename_size;
+
+	if( safe_sanitized_filename_size > sanitized_filename_size )
+	{
+		return( 0 );
+	}
+	if( libcpath_path_get_sanitized_string(
+	     filename,
+	     filename_length,
+	     1,
+	     sanitized_filename,
+	     sanitized_filename_size,
+	     &safe_sanitized_filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine sanitized filename.",
+		 function );
+
+		return( -1 );
+	}
+
+	return( 1 );
+}
+
+/* Retrieves a sanitized version of the path
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_get_sanitized_path(
+     const char *path,
+     size_t path_length,
+     char **sanitized_path,
+     size_t *sanitized_path_size,
+     libcerror_error_t **error )
+{
+	static char *function                    = "libcpath_path_get_sanitized_path";
+	char *safe_sanitized_path                = NULL;
+	size_t safe_sanitized_path_size          = 0;
+
+#if defined( WINAPI )
+	size_t last_path_segment_seperator_index = 0;
+	size_t path_index                        = 0;
+#endif
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_length == 0 )
+	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sanitized_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sanitized path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_get_sanitized_string(
+	     path,
+	     path_length,
+	     0,
+	     NULL,
+	     0,
+	     &safe_sanitized_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine sanitized path size.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( WINAPI )
+	for( path_index = path_length;
+	     path_index > 0;
+	     path_index-- )
+	{
+		if( path[ path_index - 1 ] == LIBCPATH_SEPARATOR )
+		{
+			last_path_segment_seperator_index = path_index - 1;
+
+			break;
+		}
+	}
+#endif
+	if( safe_sanitized_path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized path size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( WINAPI )
+	if( last_path_segment_seperator_index > 32767 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid last path segment separator value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( safe_sanitized_path_size > 32767 )
+	{
+		safe_sanitized_path_size = 32767;
+	}
+#endif
+	safe_sanitized_path = narrow_string_allocate(
+	                       safe_sanitized_path_size );
+
+	if( safe_sanitized_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sanitized path.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_path_get_sanitized_string(
+	     path,
+	     path_length,
+	     0,
+	     safe_sanitized_path,
+	     safe_sanitized_path_size,
+	     &safe_sanitized_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine sanitized path.",
+		 function );
+
+		goto on_error;
+	}
+
+	*sanitized_path      = safe_sanitized_path;
+	*sanitized_path_size = safe_sanitized_path_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_sanitized_path != NULL )
+	{
+		memory_free(
+		 safe_sanitized_path );
+	}
+	return( -1 );
+}
+
+/* Retrieves a sanitized version of the path into a buffer
+ * This function does not allocate memory
+ *
+ * The required sanitized path size is set to the size of the sanitized path,
+ * including the end-of-string character, also when the sanitized path is
+ * too small
+ *
+ * Returns 1 if successful, 0 if the sanitized path is too small or -1 on error
+ */
+int libcpath_internal_path_get_sanitized_path_to_buffer(
+     const char *path,
+     size_t path_length,
+     char *sanitized_path,
+     size_t sanitized_path_size,
+     size_t *required_sanitized_path_size,
+     libcerror_error_t **error )
+{
+	static char *function                    = "libcpath_path_get_sanitized_path_to_buffer";
+	size_t safe_sanitized_path_size          = 0;
+
+#if defined( WINAPI )
+	size_t last_path_segment_seperator_index = 0;
+	size_t path_index                        = 0;
+#endif
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_length == 0 )
+	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized path.",
+		 function );
+
+		return( -1 );
+	}
+	if( sanitized_path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_sanitized_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required sanitized path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_get_sanitized_string(
+	     path,
+	     path_length,
+	     0,
+	     NULL,
+	     0,
+	     &safe_sanitized_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine sanitized path size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	for( path_index = path_length;
+	     path_index > 0;
+	     path_index-- )
+	{
+		if( path[ path_index - 1 ] == LIBCPATH_SEPARATOR )
+		{
+			last_path_segment_seperator_index = path_index - 1;
+
+			break;
+		}
+	}
+#endif
+	if( safe_sanitized_path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( last_path_segment_seperator_index > 32767 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid last path segment separator value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_sanitized_path_size > 32767 )
+	{
+		safe_sanitized_path_size = 32767;
+	}
+#endif
+	*required_sanitized_path_size = safe_sanitized_path_size;
+
+	if( safe_sanitized_path_size > sanitized_path_size )
+	{
+		return( 0 );
+	}
+	/* The sanitized path is bounded by the required size and not by the size
+	 * of the buffer, so that both functions fail on the same input
+	 */
+	if( libcpath_path_get_sanitized_string(
+	     path,
+	     path_length,
+	     0,
+	     sanitized_path,
+	     safe_sanitized_path_size,
+	     &safe_sanitized_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine sanitized path.",
+		 function );
+
+		return( -1 );
+	}
+
+	return( 1 );
+}
+
+
+/* Retrieves an unsanitized version of a string
+ * This reverses libcpath_path_get_sanitized_string, the escape character
+ * followed by 'x' and 2 hexadecimal digits is decoded into the corresponding
+ * character and 2 successive escape characters into a single escape character.
+ * Runs of characters without an escape character are copied as-is.
+ *
+ * The unsanitized string is never larger than the string, the required
+ * unsanitized string size is set to the size of the unsanitized string,
+ * including the end-of-string character
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_unsanitized_string(
+     const char *string,
+     size_t string_length,
+     char *unsanitized_string,
+     size_t unsanitized_string_size,
+     size_t *required_unsanitized_string_size,
+     libcerror_error_t **error )
+{
+	const char *escape_character    = NULL;
+	static char *function           = "libcpath_path_get_unsanitized_string";
+	size_t digit_index              = 0;
+	size_t string_index             = 0;
+	size_t unescaped_string_length  = 0;
+	size_t unsanitized_string_index = 0;
+	uint8_t byte_value              = 0;
+	char character                  = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( unsanitized_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unsanitized string.",
+		 function );
+
+		return( -1 );
+	}
+	if( unsanitized_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid unsanitized string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_unsanitized_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required unsanitized string size.",
+		 function );
+
+		return( -1 );
+	}
+	while( string_index < string_length )
+	{
+		escape_character = narrow_string_search_character(
+		                    &( string[ string_index ] ),
+		                    LIBCPATH_ESCAPE_CHARACTER,
+		                    string_length - string_index );
+
+		if( escape_character == NULL )
+		{
+			unescaped_string_length = string_length - string_index;
+		}
+		else
+		{
+			unescaped_string_length = (size_t) ( escape_character - &( string[ string_index ] ) );
+		}
+		if( unescaped_string_length > 0 )
+		{
+			if( unescaped_string_length > ( unsanitized_string_size - unsanitized_string_index ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid unsanitized string size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     &( unsanitized_string[ unsanitized_string_index ] ),
+			     &( string[ string_index ] ),
+			     sizeof( char ) * unescaped_string_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy unescaped string.",
+				 function );
+
+				return( -1 );
+			}
+			unsanitized_string_index += unescaped_string_length;
+			string_index             += unescaped_string_length;
+
+			if( string_index >= string_length )
+			{
+				break;
+			}
+		}
+		if( unsanitized_string_index >= unsanitized_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid unsanitized string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( ( string_length - string_index ) >= 2 )
+		 && ( string[ string_index + 1 ] == LIBCPATH_ESCAPE_CHARACTER ) )
+		{
+			unsanitized_string[ unsanitized_string_index++ ] = LIBCPATH_ESCAPE_CHARACTER;
+
+			string_index += 2;
+		}
+		else if( ( ( string_length - string_index ) >= 4 )
+		      && ( string[ string_index + 1 ] == 'x' ) )
+		{
+			byte_value = 0;
+
+			for( digit_index = string_index + 2;
+			     digit_index < string_index + 4;
+			     digit_index++ )
+			{
+				character = string[ digit_index ];
+
+				byte_value <<= 4;
+
+				/* Note that ':' represents the nibble value 10 in the sanitized string
+				 */
+				if( ( character >= '0' )
+				 && ( character <= ':' ) )
+				{
+					byte_value |= (uint8_t) ( character - '0' );
+				}
+				else if( ( character >= 'a' )
+				      && ( character <= 'f' ) )
+				{
+					byte_value |= (uint8_t) ( character - 'a' + 10 );
+				}
+				else if( ( character >= 'A' )
+				      && ( character <= 'F' ) )
+				{
+					byte_value |= (uint8_t) ( character - 'A' + 10 );
+				}
+				else
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported escaped character at index: %" PRIzd ".",
+					 function,
+					 string_index );
+
+					return( -1 );
+				}
+			}
+			unsanitized_string[ unsanitized_string_index++ ] = (char) byte_value;
+
+			string_index += 4;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported escape sequence at index: %" PRIzd ".",
+			 function,
+			 string_index );
+
+			return( -1 );
+		}
+	}
+	if( unsanitized_string_index >= unsanitized_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid unsanitized string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	unsanitized_string[ unsanitized_string_index++ ] = 0;
+
+	*required_unsanitized_string_size = unsanitized_string_index;
+
+	return( 1 );
+}
+
+/* Retrieves an unsanitized version of the filename
+ * This reverses libcpath_path_get_sanitized_filename
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_get_unsanitized_filename(
+     const char *sanitized_filename,
+     size_t sanitized_filename_length,
+     char **filename,
+     size_t *filename_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libcpath_path_get_unsanitized_filename";
+	char *safe_filename       = NULL;
+	size_t safe_filename_size = 0;
+
+	if( sanitized_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sanitized_filename_length == 0 )
+	 || ( sanitized_filename_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sanitized filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filename != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filename value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The unsanitized filename is never larger than the sanitized filename
+	 */
+	safe_filename = narrow_string_allocate(
+	                 sanitized_filename_length + 1 );
+
+	if( safe_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_path_get_unsanitized_string(
+	     sanitized_filename,
+	     sanitized_filename_length,
+	     safe_filename,
+	     sanitized_filename_length + 1,
+	     &safe_filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine unsanitized filename.",
+		 function );
+
+		goto on_error;
+	}
+	*filename      = safe_filename;
+	*filename_size = safe_filename_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_filename != NULL )
+	{
+		memory_free(
+		 safe_filename );
+	}
+	return( -1 );
+}
+
+/* Retrieves an unsanitized version of the path
+ * This reverses libcpath_path_get_sanitized_path
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_get_unsanitized_path(
+     const char *sanitized_path,
+     size_t sanitized_path_length,
+     char **path,
+     size_t *path_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_get_unsanitized_path";
+	char *safe_path       = NULL;
+	size_t safe_path_size = 0;
+
+	if( sanitized_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sanitized_path_length == 0 )
+	 || ( sanitized_path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sanitized path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The unsanitized path is never larger than the sanitized path
+	 */
+	safe_path = narrow_string_allocate(
+	             sanitized_path_length + 1 );
+
+	if( safe_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_path_get_unsanitized_string(
+	     sanitized_path,
+	     sanitized_path_length,
+	     safe_path,
+	     sanitized_path_length + 1,
+	     &safe_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine unsanitized path.",
+		 function );
+
+		goto on_error;
+	}
+	*path      = safe_path;
+	*path_size = safe_path_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_path != NULL )
+	{
+		memory_free(
+		 safe_path );
+	}
+	return( -1 );
+}
+
+/* Combines the directory name and filename into a path
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_join(
+     char **path,
+     size_t *path_size,
+     const char *directory_name,
+     size_t directory_name_length,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_join";
+	size_t filename_index = 0;
+	size_t path_index     = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid directory name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+/* TODO strip other patterns like /./ */
+	while( directory_name_length > 0 )
+	{
+		if( directory_name[ directory_name_length - 1 ] != (char) LIBCPATH_SEPARATOR )
+		{
+			break;
+		}
+		directory_name_length--;
+	}
+	while( filename_length > 0 )
+	{
+		if( filename[ filename_index ] != (char) LIBCPATH_SEPARATOR )
+		{
+			break;
+		}
+		filename_index++;
+		filename_length--;
+	}
+	*path_size = directory_name_length + filename_length + 2;
+
+	*path = narrow_string_allocate(
+	         *path_size );
+
+	if( *path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     *path,
+	     directory_name,
+	     directory_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory name to path.",
+		 function );
+
+		goto on_error;
+	}
+	path_index = directory_name_length;
+
+	( *path )[ path_index++ ] = (char) LIBCPATH_SEPARATOR;
+
+	if( narrow_string_copy(
+	     &( ( *path )[ path_index ] ),
+	     &( filename[ filename_index ] ),
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename to path.",
+		 function );
+
+		goto on_error;
+	}
+	path_index += filename_length;
+
+	( *path )[ path_index ] = 0;
+
+	return( 1 );
+
+on_error:
+	if( *path != NULL )
+	{
+		memory_free(
+		 *path );
+
+		*path = NULL;
+	}
+	*path_size = 0;
+
+	return( -1 );
+}
+
+/* Combines the directory name and filename into a path buffer
+ * This function does not allocate memory
+ *
+ * The required path size is set to the size of the path, including
+ * the end-of-string character, also when the path is too small
+ *
+ * Returns 1 if successful, 0 if the path is too small or -1 on error
+ */
+int libcpath_internal_path_join_to_buffer(
+     char *path,
+     size_t path_size,
+     size_t *required_path_size,
+     const char *directory_name,
+     size_t directory_name_length,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_join_to_buffer";
+	size_t filename_index = 0;
+	size_t path_index     = 0;
+	size_t safe_path_size = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid directory name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( directory_name_length > 0 )
+	{
+		if( directory_name[ directory_name_length - 1 ] != (char) LIBCPATH_SEPARATOR )
+		{
+			break;
+		}
+		directory_name_length--;
+	}
+	while( filename_length > 0 )
+	{
+		if( filename[ filename_index ] != (char) LIBCPATH_SEPARATOR )
+		{
+			break;
+		}
+		filename_index++;
+		filename_length--;
+	}
+	safe_path_size = directory_name_length + filename_length + 2;
+
+	*required_path_size = safe_path_size;
+
+	if( safe_path_size > path_size )
+	{
+		return( 0 );
+	}
+	if( narrow_string_copy(
+	     path,
+	     directory_name,
+	     directory_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory name to path.",
+		 function );
+
+		return( -1 );
+	}
+	path_index = directory_name_length;
+
+	path[ path_index++ ] = (char) LIBCPATH_SEPARATOR;
+
+	if( narrow_string_copy(
+	     &( path[ path_index ] ),
+	     &( filename[ filename_index ] ),
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename to path.",
+		 function );
+
+		return( -1 );
+	}
+	path_index += filename_length;
+
+	path[ path_index ] = 0;
+
+	return( 1 );
+}
+
+/* Combines the directory name and filename into a lexically normalized path
+ * Empty and "." (current directory) segments are removed and ".." (parent
+ * directory) segments are applied while the directory name and filename are
+ * copied. A ".." segment never removes the root of an absolute path and is
+ * retained in a relative path if there is no preceding segment to remove.
+ * An empty relative path is represented as ".".
+ *
+ * An empty directory name is the current directory, hence the directory name
+ * contributes no segments and the path is relative. This differs from
+ * libcpath_path_join which prefixes the filename with a directory separator.
+ *
+ * The file system is not accessed, hence symbolic links are not resolved
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_join_normalized(
+     char **path,
+     size_t *path_size,
+     const char *directory_name,
+     size_t directory_name_length,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	char *safe_path             = NULL;
+	static char *function       = "libcpath_path_join_normalized";
+	size_t directory_name_index = 0;
+	size_t path_index           = 0;
+	size_t path_prefix_length   = 0;
+	size_t safe_path_size       = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid directory name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name_length > ( (size_t) SSIZE_MAX - ( filename_length + 3 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory name and filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every segment is stored with a trailing directory separator, hence the path
+	 * never needs more than the length of the inputs, a directory separator per
+	 * input and the end-of-string character
+	 */
+	safe_path_size = directory_name_length + filename_length + 3;
+
+	safe_path = narrow_string_allocate(
+	             safe_path_size );
+
+	if( safe_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	/* The path is prefixed with the drive letter and colon
+	 */
+	if( ( directory_name_length >= 2 )
+	 && ( directory_name[ 1 ] == ':' ) )
+	{
+		safe_path[ path_prefix_length++ ] = directory_name[ 0 ];
+		safe_path[ path_prefix_length++ ] = ':';
+
+		directory_name_index = 2;
+	}
+	/* The path is prefixed with the 2 directory separators of an UNC path
+	 */
+	else if( ( directory_name_length >= 2 )
+	      && ( directory_name[ 0 ] == (char) LIBCPATH_SEPARATOR )
+	      && ( directory_name[ 1 ] == (char) LIBCPATH_SEPARATOR ) )
+	{
+		safe_path[ path_prefix_length++ ] = (char) LIBCPATH_SEPARATOR;
+
+		directory_name_index = 1;
+	}
+#endif
+	/* The path of an absolute directory name is prefixed with a directory separator
+	 */
+	if( ( directory_name_index < directory_name_length )
+	 && ( directory_name[ directory_name_index ] == (char) LIBCPATH_SEPARATOR ) )
+	{
+		safe_path[ path_prefix_length++ ] = (char) LIBCPATH_SEPARATOR;
+
+		directory_name_index++;
+	}
+	path_index = path_prefix_length;
+
+	if( libcpath_path_append_normalized_segments(
+	     safe_path,
+	     safe_path_size,
+	     path_prefix_length,
+	     &path_index,
+	     &( directory_name[ directory_name_index ] ),
+	     directory_name_length - directory_name_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append directory name segments to path.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_path_append_normalized_segments(
+	     safe_path,
+	     safe_path_size,
+	     path_prefix_length,
+	     &path_index,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append filename segments to path.",
+		 function );
+
+		goto on_error;
+	}
+	/* Remove the directory separator of the last segment
+	 */
+	if( path_index > path_prefix_length )
+	{
+		path_index--;
+	}
+	else if( path_index == 0 )
+	{
+		safe_path[ path_index++ ] = '.';
+	}
+	safe_path[ path_index++ ] = 0;
+
+	*path      = safe_path;
+	*path_size = path_index;
+
+	return( 1 );
+
+on_error:
+	if( safe_path != NULL )
+	{
+		memory_free(
+		 safe_path );
+	}
+	return( -1 );
+}
+
+/* Determines the relative path from a (directory) path to another path
+ * This is the inverse of libcpath_path_get_full_path, both paths are first
+ * made full paths, which normalizes their segments, after which the segments
+ * they have in common are replaced by a ".." (parent directory) segment for
+ * every remaining segment of the from path. An empty relative path, when both
+ * paths are the same, is represented as ".".
+ *
+ * The segments are compared case-sensitive and the file system is not
+ * accessed, hence symbolic links are not resolved
+ *
+ * Returns 1 if successful, 0 if no relative path exists, such as when the
+ * paths are on different volumes, or -1 on error
+ */
+int libcpath_internal_path_get_relative_path(
+     const char *from_path,
+     size_t from_path_length,
+     const char *to_path,
+     size_t to_path_length,
+     char **relative_path,
+     size_t *relative_path_size,
+     libcerror_error_t **error )
+{
+	char *from_full_path             = NULL;
+	char *safe_relative_path         = NULL;
+	char *to_full_path               = NULL;
+	static char *function            = "libcpath_path_get_relative_path";
+	size_t common_index              = 0;
+	size_t from_full_path_index      = 0;
+	size_t from_full_path_length     = 0;
+	size_t from_full_path_size       = 0;
+	size_t from_root_length          = 0;
+	size_t number_of_parent_segments = 0;
+	size_t relative_path_index       = 0;
+	size_t safe_relative_path_size   = 0;
+	size_t segment_index             = 0;
+	size_t to_full_path_index        = 0;
+	size_t to_full_path_length       = 0;
+	size_t to_full_path_size         = 0;
+	size_t to_root_length            = 0;
+
+	if( relative_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid relative path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *relative_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid relative path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( relative_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid relative path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_internal_path_get_full_path(
+	     from_path,
+	     from_path_length,
+	     &from_full_path,
+	     &from_full_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve from full path.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_internal_path_get_full_path(
+	     to_path,
+	     to_path_length,
+	     &to_full_path,
+	     &to_full_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve to full path.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( from_full_path_size == 0 )
+	 || ( to_full_path_size == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid full path size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	from_full_path_length = from_full_path_size - 1;
+	to_full_path_length   = to_full_path_size - 1;
+
+	if( libcpath_path_get_root_length(
+	     from_full_path,
+	     from_full_path_length,
+	     &from_root_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine from full path root length.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_path_get_root_length(
+	     to_full_path,
+	     to_full_path_length,
+	     &to_root_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine to full path root length.",
+		 function );
+
+		goto on_error;
+	}
+	/* A relative path only exists between full paths with the same root
+	 */
+	if( ( from_root_length != to_root_length )
+	 || ( narrow_string_compare(
+	       from_full_path,
+	       to_full_path,
+	       from_root_length ) != 0 ) )
+	{
+		memory_free(
+		 to_full_path );
+
+		memory_free(
+		 from_full_path );
+
+		return( 0 );
+	}
+	/* Determine the end of the segments both full paths have in common
+	 */
+	common_index  = from_root_length;
+	segment_index = from_root_length;
+
+	while( ( segment_index < from_full_path_length )
+	    && ( segment_index < to_full_path_length )
+	    && ( from_full_path[ segment_index ] == to_full_path[ segment_index ] ) )
+	{
+		if( from_full_path[ segment_index ] == (char) LIBCPATH_SEPARATOR )
+		{
+			common_index = segment_index + 1;
+		}
+		segment_index++;
+	}
+	if( ( ( segment_index == from_full_path_length )
+	  ||  ( from_full_path[ segment_index ] == (char) LIBCPATH_SEPARATOR ) )
+	 && ( ( segment_index == to_full_path_length )
+	  ||  ( to_full_path[ segment_index ] == (char) LIBCPATH_SEPARATOR ) ) )
+	{
+		from_full_path_index = segment_index;
+		to_full_path_index   = segment_index;
+
+		if( from_full_path_index < from_full_path_length )
+		{
+			from_full_path_index++;
+		}
+		if( to_full_path_index < to_full_path_length )
+		{
+			to_full_path_index++;
+		}
+	}
+	else
+	{
+		from_full_path_index = common_index;
+		to_full_path_index   = common_index;
+	}
+	/* Every remaining segment of the from full path is replaced by a ".." segment
+	 */
+	if( from_full_path_index < from_full_path_length )
+	{
+		number_of_parent_segments = 1;
+
+		for( segment_index = from_full_path_index;
+		     segment_index < from_full_path_length;
+		     segment_index++ )
+		{
+			if( from_full_path[ segment_index ] == (char) LIBCPATH_SEPARATOR )
+			{
+				number_of_parent_segments++;
+			}
+		}
+	}
+	/* Every ".." segment is stored with a trailing directory separator,
+	 * which also covers the end-of-string character
+	 */
+	safe_relative_path_size = ( number_of_parent_segments * 3 ) + ( to_full_path_length - to_full_path_index ) + 2;
+
+	safe_relative_path = narrow_string_allocate(
+	                      safe_relative_path_size );
+
+	if( safe_relative_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create relative path.",
+		 function );
+
+		goto on_error;
+	}
+	while( number_of_parent_segments > 0 )
+	{
+		safe_relative_path[ relative_path_index++ ] = '.';
+		safe_relative_path[ relative_path_index++ ] = '.';
+		safe_relative_path[ relative_path_index++ ] = (char) LIBCPATH_SEPARATOR;
+
+		number_of_parent_segments--;
+	}
+	if( to_full_path_index < to_full_path_length )
+	{
+		if( narrow_string_copy(
+		     &( safe_relative_path[ relative_path_index ] ),
+		     &( to_full_path[ to_full_path_index ] ),
+		     to_full_path_length - to_full_path_index ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy to full path segments to relative path.",
+			 function );
+
+			goto on_error;
+		}
+		relative_path_index += to_full_path_length - to_full_path_index;
+	}
+	/* Remove the directory separator of the last ".." segment
+	 */
+	else if( relative_path_index > 0 )
+	{
+		relative_path_index--;
+	}
+	else
+	{
+		safe_relative_path[ relative_path_index++ ] = '.';
+	}
+	safe_relative_path[ relative_path_index++ ] = 0;
+
+	memory_free(
+	 to_full_path );
+
+	memory_free(
+	 from_full_path );
+
+	*relative_path      = safe_relative_path;
+	*relative_path_size = relative_path_index;
+
+	return( 1 );
+
+on_error:
+	if( safe_relative_path != NULL )
+	{
+		memory_free(
+		 safe_relative_path );
+	}
+	if( to_full_path != NULL )
+	{
+		memory_free(
+		 to_full_path );
+	}
+	if( from_full_path != NULL )
+	{
+		memory_free(
+		 from_full_path );
+	}
+	return( -1 );
+}
+
+#if defined( WINAPI ) && ( WINVER <= 0x0500 )
+
+/* Cross Windows safe version of CreateDirectoryA
+ * Returns TRUE if successful or FALSE on error
+ */
+BOOL libcpath_CreateDirectoryA(
+      LPCSTR path,
+      SECURITY_ATTRIBUTES *security_attributes )
+{
+	FARPROC function       = NULL;
+	HMODULE library_handle = NULL;
+	BOOL result            = FALSE;
+
+	if( path == NULL )
+	{
+		return( 0 );
+	}
+	library_handle = LoadLibrary(
+	                  _SYSTEM_STRING( "kernel32.dll" ) );
+
+	if( library_handle == NULL )
+	{
+		return( 0 );
+	}
+	function = GetProcAddress(
+		    library_handle,
+		    (LPCSTR) "CreateDirectoryA" );
+
+	if( function != NULL )
+	{
+		result = function(
+			  path,
+			  security_attributes );
+	}
+	/* This call should be after using the function
+	 * in most cases kernel32.dll will still be available after free
+	 */
+	if( FreeLibrary(
+	     library_handle ) != TRUE )
+	{
+		libcpath_CloseHandle(
+		 library_handle );
+
+		return( 0 );
+	}
+	return( result );
+}
+
+#endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+
+#if defined( WINAPI )
+
+/* Makes the directory and retrieves the system error code
+ * This function uses the WINAPI function for Windows XP (0x0501) or later
+ * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
+ * The error code contains the system error code if the directory could not be made
+ * A file that is not a directory with the same name is considered an error
+ * Returns 1 if successful, 0 if the directory already exists or -1 on error
+ */
+int libcpath_internal_path_make_directory_with_error_code(
+     const char *directory_name,
+     uint32_t *error_code,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_make_directory_with_error_code";
+	DWORD file_attributes = 0;
+
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
+	*error_code = 0;
+
+#if WINVER <= 0x0500
+	if( libcpath_CreateDirectoryA(
+	     directory_name,
+	     NULL ) == 0 )
+#else
+	if( CreateDirectoryA(
+	     directory_name,
+	     NULL ) == 0 )
+#endif
+	{
+		*error_code = (uint32_t) GetLastError();
+
+		/* Only an existing directory is considered to be already made
+		 */
+		if( *error_code == (uint32_t) ERROR_ALREADY_EXISTS )
+		{
+			file_attributes = GetFileAttributesA(
+			                   directory_name );
+
+			if( ( file_attributes != INVALID_FILE_ATTRIBUTES )
+			 && ( ( file_attributes & FILE_ATTRIBUTE_DIRECTORY ) != 0 ) )
+			{
+				return( 0 );
+			}
+		}
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 *error_code,
+		 "%s: unable to make directory.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#elif defined( HAVE_MKDIR )
+
+/* Makes the directory and retrieves the system error code
+ * This function uses the POSIX mkdir function or equivalent
+ * The error code contains the system error code if the directory could not be made
+ * A file that is not a directory with the same name is considered an error
+ * Returns 1 if successful, 0 if the directory already exists or -1 on error
+ */
+int libcpath_internal_path_make_directory_with_error_code(
+     const char *directory_name,
+     uint32_t *error_code,
+     libcerror_error_t **error )
+{
+	struct stat file_statistics;
+
+	static char *function = "libcpath_path_make_directory_with_error_code";
+
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
+	*error_code = 0;
+
+#if defined( __MINGW32__ ) || defined( _MSC_VER )
+	if( mkdir(
+	     directory_name ) != 0 )
+#else
+	if( mkdir(
+	     directory_name,
+	     0755 ) != 0 )
+#endif
+	{
+		*error_code = (uint32_t) errno;
+
+		/* Only an existing directory is considered to be already made
+		 */
+		if( ( *error_code == (uint32_t) EEXIST )
+		 && ( stat(
+		       directory_name,
+		       &file_statistics ) == 0 )
+		 && S_ISDIR( file_statistics.st_mode ) )
+		{
+			return( 0 );
+		}
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 *error_code,
+		 "%s: unable to make directory.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#else
+#error Missing make directory function
+#endif
+
+/* Makes the directory
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_make_directory(
+     const char *directory_name,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_make_directory";
+	uint32_t error_code   = 0;
+	int result            = 0;
+
+	result = libcpath_internal_path_make_directory_with_error_code(
+	          directory_name,
+	          &error_code,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to make directory.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 error_code,
+		 "%s: unable to make directory.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( WINAPI )
+
+/* Makes a single directory if it does not already exist
+ * This function uses the WINAPI function for Windows XP (0x0501) or later
+ * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
+ * Returns 1 if successful, 0 if the parent directory does not exist or -1 on error
+ */
+int libcpath_path_make_directory_component(
+     const char *directory_name,
+     int mode LIBCPATH_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_make_directory_component";
+	DWORD error_code      = 0;
+	DWORD file_attributes = 0;
+
+	LIBCPATH_UNREFERENCED_PARAMETER( mode )
+
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+#if WINVER <= 0x0500
+	if( libcpath_CreateDirectoryA(
+	     directory_name,
+	     NULL ) != 0 )
+#else
+	if( CreateDirectoryA(
+	     directory_name,
+	     NULL ) != 0 )
+#endif
+	{
+		return( 1 );
+	}
+	error_code = GetLastError();
+
+	if( error_code == ERROR_PATH_NOT_FOUND )
+	{
+		return( 0 );
+	}
+	if( error_code == ERROR_ALREADY_EXISTS )
+	{
+		file_attributes = GetFileAttributesA(
+		                   directory_name );
+
+		if( ( file_attributes != INVALID_FILE_ATTRIBUTES )
+		 && ( ( file_attributes & FILE_ATTRIBUTE_DIRECTORY ) != 0 ) )
+		{
+			return( 1 );
+		}
+	}
+	libcerror_system_set_error(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+	 error_code,
+	 "%s: unable to make directory.",
+	 function );
+
+	return( -1 );
+}
+
+#elif defined( HAVE_MKDIR )
+
+/* Makes a single directory if it does not already exist
+ * This function uses the POSIX mkdir function or equivalent
+ * Returns 1 if successful, 0 if the parent directory does not exist or -1 on error
+ */
+int libcpath_path_make_directory_component(
+     const char *directory_name,
+     int mode,
+     libcerror_error_t **error )
+{
+	struct stat file_statistics;
+
+	static char *function = "libcpath_path_make_directory_component";
+	int error_code        = 0;
+
+#if defined( __MINGW32__ ) || defined( _MSC_VER )
+	LIBCPATH_UNREFERENCED_PARAMETER( mode )
+#endif
+
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( __MINGW32__ ) || defined( _MSC_VER )
+	if( mkdir(
+	     directory_name ) == 0 )
+#else
+	if( mkdir(
+	     directory_name,
+	     (mode_t) mode ) == 0 )
+#endif
+	{
+		return( 1 );
+	}
+	error_code = errno;
+
+	if( error_code == ENOENT )
+	{
+		return( 0 );
+	}
+	if( error_code == EEXIST )
+	{
+		if( ( stat(
+		       directory_name,
+		       &file_statistics ) == 0 )
+		 && S_ISDIR( file_statistics.st_mode ) )
+		{
+			return( 1 );
+		}
+	}
+	libcerror_system_set_error(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+	 error_code,
+	 "%s: unable to make directory.",
+	 function );
+
+	return( -1 );
+}
+
+#else
+#error Missing make directory function
+#endif
+
+/* Determines the length of the root of a path
+ * The root consists of the leading directory separators and on Windows
+ * a volume, such as "C:", or an UNC server and share name
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_root_length(
+     const char *path,
+     size_t path_length,
+     size_t *root_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_get_root_length";
+	size_t path_index     = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( root_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid root length.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	if( ( path_length >= 2 )
+	 && ( path[ 1 ] == ':' ) )
+	{
+		path_index = 2;
+	}
+	else if( ( path_length >= 2 )
+	      && ( path[ 0 ] == (char) LIBCPATH_SEPARATOR )
+	      && ( path[ 1 ] == (char) LIBCPATH_SEPARATOR ) )
+	{
+		path_index = 2;
+
+		/* Skip the server name
+		 */
+		while( ( path_index < path_length )
+		    && ( path[ path_index ] != (char) LIBCPATH_SEPARATOR ) )
+		{
+			path_index++;
+		}
+		while( ( path_index < path_length )
+		    && ( path[ path_index ] == (char) LIBCPATH_SEPARATOR ) )
+		{
+			path_index++;
+		}
+		/* Skip the share name
+		 */
+		while( ( path_index < path_length )
+		    && ( path[ path_index ] != (char) LIBCPATH_SEPARATOR ) )
+		{
+			path_index++;
+		}
+	}
+#endif
+	while( ( path_index < path_length )
+	    && ( path[ path_index ] == (char) LIBCPATH_SEPARATOR ) )
+	{
+		path_index++;
+	}
+	*root_length = path_index;
+
+	return( 1 );
+}
+
+/* Makes the directory and all of its missing parent directories
+ * The parent directories are probed from the deepest one upwards, so that
+ * for a mostly existing tree only the missing directories cost a system call
+ * The mode is ignored on Windows
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_make_directories(
+     const char *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error )
+{
+	char *safe_directory_name = NULL;
+	static char *function     = "libcpath_path_make_directories";
+	size_t name_index         = 0;
+	size_t root_length        = 0;
+	size_t string_length      = 0;
+	int result                = 0;
+
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( directory_name_length == 0 )
+	 || ( directory_name_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the part of the directory name that cannot be created
+	 * such as the root directory, a volume or an UNC share
+	 */
+	if( libcpath_path_get_root_length(
+	     directory_name,
+	     directory_name_length,
+	     &root_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine root length.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = directory_name_length;
+
+	while( ( string_length > root_length )
+	    && ( directory_name[ string_length - 1 ] == (char) LIBCPATH_SEPARATOR ) )
+	{
+		string_length--;
+	}
+	if( string_length <= root_length )
+	{
+		return( 1 );
+	}
+	safe_directory_name = narrow_string_allocate(
+	                       string_length + 1 );
+
+	if( safe_directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory name.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     safe_directory_name,
+	     directory_name,
+	     string_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory name.",
+		 function );
+
+		goto on_error;
+	}
+	safe_directory_name[ string_length ] = 0;
+
+	directory_name_length = string_length;
+
+	/* Walk upwards until a directory could be made or already exists
+	 * the directory name is terminated at each parent directory that is tried
+	 */
+	do
+	{
+		result = libcpath_path_make_directory_component(
+		          safe_directory_name,
+		          mode,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to make directory.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			name_index = string_length;
+
+			while( ( name_index > root_length )
+			    && ( safe_directory_name[ name_index - 1 ] != (char) LIBCPATH_SEPARATOR ) )
+			{
+				name_index--;
+			}
+			while( ( name_index > root_length )
+			    && ( safe_directory_name[ name_index - 1 ] == (char) LIBCPATH_SEPARATOR ) )
+			{
+				name_index--;
+			}
+			if( name_index <= root_length )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: missing parent directory.",
+				 function );
+
+				goto on_error;
+			}
+			safe_directory_name[ name_index ] = 0;
+
+			string_length = name_index;
+		}
+	}
+	while( result == 0 );
+
+	/* Walk downwards and make the remaining directories
+	 * which are known not to exist
+	 */
+	while( string_length < directory_name_length )
+	{
+		safe_directory_name[ string_length++ ] = (char) LIBCPATH_SEPARATOR;
+
+		while( ( string_length < directory_name_length )
+		    && ( safe_directory_name[ string_length ] != 0 ) )
+		{
+			string_length++;
+		}
+		if( libcpath_path_make_directory_component(
+		     safe_directory_name,
+		     mode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to make directory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 safe_directory_name );
+
+	return( 1 );
+
+on_error:
+	if( safe_directory_name != NULL )
+	{
+		memory_free(
+		 safe_directory_name );
+	}
+	return( -1 );
+}
+
+/* The public functions below record statistics about their calls
+ * and call the corresponding internal function
+ */
+
+/* Changes the directory
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_change_directory(
+     const char *directory_name,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_CHANGE_DIRECTORY );
+
+	result = libcpath_internal_path_change_directory(
+	          directory_name,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Changes the directory and retrieves the system error code
+ * The error code contains the system error code if the directory could not be changed
+ * No error is set when 0 is returned
+ * Returns 1 if successful, 0 if the directory does not exist or -1 on error
+ */
+int libcpath_path_change_directory_with_error_code(
+     const char *directory_name,
+     uint32_t *error_code,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_CHANGE_DIRECTORY_WITH_ERROR_CODE );
+
+	result = libcpath_internal_path_change_directory_with_error_code(
+	          directory_name,
+	          error_code,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Retrieves the current working directory
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_current_working_directory(
+     char **current_working_directory,
+     size_t *current_working_directory_size,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_GET_CURRENT_WORKING_DIRECTORY );
+
+	result = libcpath_internal_path_get_current_working_directory(
+	          current_working_directory,
+	          current_working_directory_size,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Retrieves the current working directory with its exact size
+ * The size includes the end-of-string character and, unlike
+ * libcpath_path_get_current_working_directory, is not PATH_MAX
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_current_working_directory_exact(
+     char **current_working_directory,
+     size_t *current_working_directory_size,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_GET_CURRENT_WORKING_DIRECTORY_EXACT );
+
+	result = libcpath_internal_path_get_current_working_directory_exact(
+	          current_working_directory,
+	          current_working_directory_size,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Determines the full path of the path specified
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_full_path(
+     const char *path,
+     size_t path_length,
+     char **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_GET_FULL_PATH );
+
+	result = libcpath_internal_path_get_full_path(
+	          path,
+	          path_length,
+	          full_path,
+	          full_path_size,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Determines the full path of the path specified into a buffer
+ * The required full path size is set, also when the full path is too small
+ * Returns 1 if successful, 0 if the full path is too small or -1 on error
+ */
+int libcpath_path_get_full_path_to_buffer(
+     const char *path,
+     size_t path_length,
+     char *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_GET_FULL_PATH_TO_BUFFER );
+
+	result = libcpath_internal_path_get_full_path_to_buffer(
+	          path,
+	          path_length,
+	          full_path,
+	          full_path_size,
+	          required_full_path_size,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Determines the full paths of the paths specified
+ * The full paths are stored as consecutive strings in one buffer, the offset
+ * of each full path in the buffer is stored in the full path offsets.
+ * Both the full paths and the full path offsets should be freed after use
+ * If the number of paths is 0 the full paths and full path offsets are not set
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_full_paths(
+     const char **paths,
+     const size_t *path_lengths,
+     int number_of_paths,
+     char **full_paths,
+     size_t *full_paths_size,
+     size_t **full_path_offsets,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_GET_FULL_PATHS );
+
+	result = libcpath_internal_path_get_full_paths(
+	          paths,
+	          path_lengths,
+	          number_of_paths,
+	          full_paths,
+	          full_paths_size,
+	          full_path_offsets,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Retrieves a sanitized version of the filename
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_sanitized_filename(
+     const char *filename,
+     size_t filename_length,
+     char **sanitized_filename,
+     size_t *sanitized_filename_size,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_GET_SANITIZED_FILENAME );
+
+	result = libcpath_internal_path_get_sanitized_filename(
+	          filename,
+	          filename_length,
+	          sanitized_filename,
+	          sanitized_filename_size,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Retrieves a sanitized version of the filename into a buffer
+ * The required sanitized filename size is set, also when the sanitized filename is too small
+ * Returns 1 if successful, 0 if the sanitized filename is too small or -1 on error
+ */
+int libcpath_path_get_sanitized_filename_to_buffer(
+     const char *filename,
+     size_t filename_length,
+     char *sanitized_filename,
+     size_t sanitized_filename_size,
+     size_t *required_sanitized_filename_size,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_GET_SANITIZED_FILENAME_TO_BUFFER );
+
+	result = libcpath_internal_path_get_sanitized_filename_to_buffer(
+	          filename,
+	          filename_length,
+	          sanitized_filename,
+	          sanitized_filename_size,
+	          required_sanitized_filename_size,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Retrieves a sanitized version of the path
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_sanitized_path(
+     const char *path,
+     size_t path_length,
+     char **sanitized_path,
+     size_t *sanitized_path_size,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_GET_SANITIZED_PATH );
+
+	result = libcpath_internal_path_get_sanitized_path(
+	          path,
+	          path_length,
+	          sanitized_path,
+	          sanitized_path_size,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Retrieves a sanitized version of the path into a buffer
+ * The required sanitized path size is set, also when the sanitized path is too small
+ * Returns 1 if successful, 0 if the sanitized path is too small or -1 on error
+ */
+int libcpath_path_get_sanitized_path_to_buffer(
+     const char *path,
+     size_t path_length,
+     char *sanitized_path,
+     size_t sanitized_path_size,
+     size_t *required_sanitized_path_size,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_GET_SANITIZED_PATH_TO_BUFFER );
+
+	result = libcpath_internal_path_get_sanitized_path_to_buffer(
+	          path,
+	          path_length,
+	          sanitized_path,
+	          sanitized_path_size,
+	          required_sanitized_path_size,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Retrieves an unsanitized version of the filename
+ * This reverses libcpath_path_get_sanitized_filename
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_unsanitized_filename(
+     const char *sanitized_filename,
+     size_t sanitized_filename_length,
+     char **filename,
+     size_t *filename_size,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_GET_UNSANITIZED_FILENAME );
+
+	result = libcpath_internal_path_get_unsanitized_filename(
+	          sanitized_filename,
+	          sanitized_filename_length,
+	          filename,
+	          filename_size,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Retrieves an unsanitized version of the path
+ * This reverses libcpath_path_get_sanitized_path
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_unsanitized_path(
+     const char *sanitized_path,
+     size_t sanitized_path_length,
+     char **path,
+     size_t *path_size,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_GET_UNSANITIZED_PATH );
+
+	result = libcpath_internal_path_get_unsanitized_path(
+	          sanitized_path,
+	          sanitized_path_length,
+	          path,
+	          path_size,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Combines the directory name and filename into a path
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_join(
+     char **path,
+     size_t *path_size,
+     const char *directory_name,
+     size_t directory_name_length,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_JOIN );
+
+	result = libcpath_internal_path_join(
+	          path,
+	          path_size,
+	          directory_name,
+	          directory_name_length,
+	          filename,
+	          filename_length,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Combines the directory name and filename into a path buffer
+ * The required path size is set, also when the path is too small
+ * Returns 1 if successful, 0 if the path is too small or -1 on error
+ */
+int libcpath_path_join_to_buffer(
+     char *path,
+     size_t path_size,
+     size_t *required_path_size,
+     const char *directory_name,
+     size_t directory_name_length,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_JOIN_TO_BUFFER );
+
+	result = libcpath_internal_path_join_to_buffer(
+	          path,
+	          path_size,
+	          required_path_size,
+	          directory_name,
+	          directory_name_length,
+	          filename,
+	          filename_length,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Combines the directory name and filename into a lexically normalized path
+ * Empty and "." segments are removed and ".." segments are applied
+ * The file system is not accessed, hence symbolic links are not resolved
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_join_normalized(
+     char **path,
+     size_t *path_size,
+     const char *directory_name,
+     size_t directory_name_length,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_JOIN_NORMALIZED );
+
+	result = libcpath_internal_path_join_normalized(
+	          path,
+	          path_size,
+	          directory_name,
+	          directory_name_length,
+	          filename,
+	          filename_length,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Determines the relative path from a (directory) path to another path
+ * Both paths are made full paths before their segments are compared
+ * Returns 1 if successful, 0 if no relative path exists or -1 on error
+ */
+int libcpath_path_get_relative_path(
+     const char *from_path,
+     size_t from_path_length,
+     const char *to_path,
+     size_t to_path_length,
+     char **relative_path,
+     size_t *relative_path_size,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_GET_RELATIVE_PATH );
+
+	result = libcpath_internal_path_get_relative_path(
+	          from_path,
+	          from_path_length,
+	          to_path,
+	          to_path_length,
+	          relative_path,
+	          relative_path_size,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Makes the directory
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_make_directory(
+     const char *directory_name,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_MAKE_DIRECTORY );
+
+	result = libcpath_internal_path_make_directory(
+	          directory_name,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Makes the directory and retrieves the system error code
+ * The error code contains the system error code if the directory could not be made
+ * No error is set when 0 is returned
+ * Returns 1 if successful, 0 if the directory already exists or -1 on error
+ */
+int libcpath_path_make_directory_with_error_code(
+     const char *directory_name,
+     uint32_t *error_code,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_MAKE_DIRECTORY_WITH_ERROR_CODE );
+
+	result = libcpath_internal_path_make_directory_with_error_code(
+	          directory_name,
+	          error_code,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Makes the directory and all of its missing parent directories
+ * The mode is ignored on Windows
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_make_directories(
+     const char *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_MAKE_DIRECTORIES );
+
+	result = libcpath_internal_path_make_directories(
+	          directory_name,
+	          directory_name_length,
+	          mode,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+#if defined( WINAPI ) && ( WINVER <= 0x0500 )
+
+/* Cross Windows safe version of SetCurrentDirectoryW
+ * Returns TRUE if successful or FALSE on error
+ */
+BOOL libcpath_SetCurrentDirectoryW(
+      LPCWSTR path )
+{
+	FARPROC function       = NULL;
+	HMODULE library_handle = NULL;
+	BOOL result            = FALSE;
+
+	if( path == NULL )
+	{
+		return( FALSE );
+	}
+	library_handle = LoadLibrary(
+	                  _SYSTEM_STRING( "kernel32.dll" ) );
+
+	if( library_handle == NULL )
+	{
+		return( FALSE );
+	}
+	function = GetProcAddress(
+		    library_handle,
+		    (LPCSTR) "SetCurrentDirectoryW" );
+
+	if( function != NULL )
+	{
+		result = function(
+			  path );
+	}
+	/* This call should be after using the function
+	 * in most cases kernel32.dll will still be available after free
+	 */
+	if( FreeLibrary(
+	     library_handle ) != TRUE )
+	{
+		libcpath_CloseHandle(
+		 library_handle );
+
+		return( FALSE );
+	}
+	return( result );
+}
+
+#endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+
+#if defined( WINAPI )
+
+/* Changes the directory and retrieves the system error code
+ * This function uses the WINAPI function for Windows XP (0x0501) or later
+ * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
+ * The error code contains the system error code if the directory could not be changed
+ * Returns 1 if successful, 0 if the directory does not exist or -1 on error
+ */
+int libcpath_internal_path_change_directory_wide_with_error_code(
+     const wchar_t *directory_name,
+     uint32_t *error_code,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_change_directory_wide_with_error_code";
+
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
+	*error_code = 0;
+
+#if WINVER <= 0x0500
+	if( libcpath_SetCurrentDirectoryW(
+	     directory_name ) == 0 )
+#else
+	if( SetCurrentDirectoryW(
+	     directory_name ) == 0 )
+#endif
+	{
+		*error_code = (uint32_t) GetLastError();
+
+		if( ( *error_code == (uint32_t) ERROR_FILE_NOT_FOUND )
+		 || ( *error_code == (uint32_t) ERROR_PATH_NOT_FOUND ) )
+		{
+			return( 0 );
+		}
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 *error_code,
+		 "%s: unable to change directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_clear_current_working_directory_cache(
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear current working directory cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#elif defined( HAVE_CHDIR )
+
+/* Changes the directory and retrieves the system error code
+ * This function uses the POSIX chdir function or equivalent
+ * The error code contains the system error code if the directory could not be changed
+ * Returns 1 if successful, 0 if the directory does not exist or -1 on error
+ */
+int libcpath_internal_path_change_directory_wide_with_error_code(
+     const wchar_t *directory_name,
+     uint32_t *error_code,
+     libcerror_error_t **error )
+{
+	char narrow_directory_name_buffer[ LIBCPATH_SYSTEM_STRING_BUFFER_SIZE ];
+
+	static char *function             = "libcpath_path_change_directory_wide_with_error_code";
+	char *narrow_directory_name       = 0;
+	size_t directory_name_length      = 0;
+	size_t narrow_directory_name_size = 0;
+	int result                        = 1;
+
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	if( error_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid error code.",
+		 function );
+
+		return( -1 );
+	}
+	*error_code = 0;
+
+	directory_name_length = wide_string_length(
+	                         directory_name );
+
+	if( libcpath_system_string_convert_from_wide_string_with_buffer(
+	     directory_name,
+	     directory_name_length + 1,
+	     narrow_directory_name_buffer,
+	     LIBCPATH_SYSTEM_STRING_BUFFER_SIZE,
+	     &narrow_directory_name,
+	     &narrow_directory_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set name.",
+		 function );
+
+		goto on_error;
+	}
+	if( chdir(
+	     narrow_directory_name ) != 0 )
+	{
+		*error_code = (uint32_t) errno;
+
+		if( *error_code == (uint32_t) ENOENT )
+		{
+			result = 0;
+		}
+		else
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 *error_code,
+			 "%s: unable to change directory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( narrow_directory_name != narrow_directory_name_buffer )
+	{
+		memory_free(
+		 narrow_directory_name );
+	}
+	if( result == 1 )
+	{
+		if( libcpath_path_clear_current_working_directory_cache(
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear current working directory cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+
+on_error:
+	if( ( narrow_directory_name != NULL )
+	 && ( narrow_directory_name != narrow_directory_name_buffer ) )
+	{
+		memory_free(
+		 narrow_directory_name );
+	}
+	return( -1 );
+}
+
+#else
+#error Missing change directory function
+#endif
+
+/* Changes the directory
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_change_directory_wide(
+     const wchar_t *directory_name,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_change_directory_wide";
+	uint32_t error_code   = 0;
+	int result            = 0;
+
+	result = libcpath_internal_path_change_directory_wide_with_error_code(
+	          directory_name,
+	          &error_code,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to change directory.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 error_code,
+		 "%s: unable to change directory.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( WINAPI ) && ( WINVER <= 0x0500 )
+
+/* Cross Windows safe version of GetCurrentDirectoryW
+ * Returns the number of characters in the current directory string or 0 on error
+ */
+DWORD libcpath_GetCurrentDirectoryW(
+       DWORD buffer_size,
+       LPCWSTR buffer )
+{
+	FARPROC function       = NULL;
+	HMODULE library_handle = NULL;
+	DWORD result           = 0;
+
+	library_handle = LoadLibrary(
+	                  _SYSTEM_STRING( "kernel32.dll" ) );
+
+	if( library_handle == NULL )
+	{
+		return( 0 );
+	}
+	function = GetProcAddress(
+		    library_handle,
+		    (LPCSTR) "GetCurrentDirectoryW" );
+
+	if( function != NULL )
+	{
+		result = function(
+			  buffer_size,
+			  buffer );
+	}
+	/* This call should be after using the function
+	 * in most cases kernel32.dll will still be available after free
+	 */
+	if( FreeLibrary(
+	     library_handle ) != TRUE )
+	{
+		libcpath_CloseHandle(
+		 library_handle );
+
+		return( 0 );
+	}
+	return( result );
+}
+
+#endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+
+#if defined( WINAPI )
+
+/* Retrieves the current working directory
+ * This function uses the WINAPI function for Windows XP (0x0501) or later
+ * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_get_current_working_directory_wide(
+     wchar_t **current_working_directory,
+     size_t *current_working_directory_size,
+     libcerror_error_t **error )
+{
+	static char *function                     = "libcpath_path_get_current_working_directory_wide";
+	wchar_t *safe_current_working_directory   = NULL;
+	DWORD error_code                          = 0;
+	DWORD result                              = 0;
+	DWORD safe_current_working_directory_size = 0;
+
+	if( current_working_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( *current_working_directory != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid current working directory value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_working_directory_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory size.",
+		 function );
+
+		return( -1 );
+	}
+#if WINVER <= 0x0500
+	safe_current_working_directory_size = libcpath_GetCurrentDirectoryW(
+	                                       0,
+	                                       NULL );
+#else
+	safe_current_working_directory_size = GetCurrentDirectoryW(
+	                                       0,
+	                                       NULL );
+#endif
+	if( safe_current_working_directory_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current working directory size.",
+		 function );
+
+		goto on_error;
+	}
+	if( (size_t) safe_current_working_directory_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid current working directory size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	safe_current_working_directory = wide_string_allocate(
+	                                  safe_current_working_directory_size );
+
+	if( safe_current_working_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create current working directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_current_working_directory,
+	     0,
+	     sizeof( wchar_t ) * safe_current_working_directory_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear current working directory.",
+		 function );
+
+		goto on_error;
+	}
+#if WINVER <= 0x0500
+	result = libcpath_GetCurrentDirectoryW(
+	          safe_current_working_directory_size,
+	          safe_current_working_directory )
+#else
+	result = GetCurrentDirectoryW(
+	          safe_current_working_directory_size,
+	          safe_current_working_directory );
+#endif
+	/* Note that safe_current_working_directory_size can be larger than result
+	 */
+	if( ( result == 0 )
+	 || ( result > safe_current_working_directory_size ) )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 error_code,
+		 "%s: unable to retrieve current working directory.",
+		 function );
+
+		goto on_error;
+	}
+	*current_working_directory      = safe_current_working_directory;
+	*current_working_directory_size = (size_t) safe_current_working_directory_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_current_working_directory != NULL )
+	{
+		memory_free(
+		 safe_current_working_directory );
+	}
+	return( -1 );
+}
+
+#elif defined( HAVE_GETCWD )
+
+/* Retrieves the current working directory
+ * This function uses the POSIX getcwd function or equivalent
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_get_current_working_directory_wide(
+     wchar_t **current_working_directory,
+     size_t *current_working_directory_size,
+     libcerror_error_t **error )
+{
+	char narrow_current_working_directory_buffer[ LIBCPATH_SYSTEM_STRING_BUFFER_SIZE ];
+
+	static char *function                        = "libcpath_path_get_current_working_directory_wide";
+	wchar_t *safe_current_working_directory      = NULL;
+	char *narrow_current_working_directory       = NULL;
+	size_t narrow_current_working_directory_size = 0;
+	size_t safe_current_working_directory_size   = 0;
+	int error_code                               = 0;
+
+	if( current_working_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( *current_working_directory != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid current working directory value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_working_directory_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Most current working directories fit in the buffer on the stack,
+	 * only a longer one is retrieved into allocated memory
+	 */
+	if( getcwd(
+	     narrow_current_working_directory_buffer,
+	     LIBCPATH_SYSTEM_STRING_BUFFER_SIZE ) != NULL )
+	{
+		narrow_current_working_directory      = narrow_current_working_directory_buffer;
+		narrow_current_working_directory_size = narrow_string_length(
+		                                         narrow_current_working_directory ) + 1;
+	}
+	else
+	{
+		error_code = errno;
+
+		if( error_code != ERANGE )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 error_code,
+			 "%s: unable to retrieve narrow current working directory.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcpath_internal_path_get_current_working_directory_exact(
+		     &narrow_current_working_directory,
+		     &narrow_current_working_directory_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve narrow current working directory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Convert the current working directory to a wide string
+	 * if the platform has no wide character open function
+	 */
+	if( libcpath_system_string_get_maximum_size_to_wide_string(
+	     narrow_current_working_directory_size,
+	     &safe_current_working_directory_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine maximum wide character current working directory size.",
+		 function );
+
+		goto on_error;
+	}
+	safe_current_working_directory = wide_string_allocate(
+	                                  safe_current_working_directory_size );
+
+	if( safe_current_working_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create current working directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_system_string_convert_to_wide_string(
+	     narrow_current_working_directory,
+	     narrow_current_working_directory_size,
+	     safe_current_working_directory,
+	     safe_current_working_directory_size,
+	     &safe_current_working_directory_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set current working directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_current_working_directory != narrow_current_working_directory_buffer )
+	{
+		memory_free(
+		 narrow_current_working_directory );
+	}
+	*current_working_directory      = safe_current_working_directory;
+	*current_working_directory_size = safe_current_working_directory_size;
+
+	return( 1 );
+
+on_error:
+	if( ( narrow_current_working_directory != NULL )
+	 && ( narrow_current_working_directory != narrow_current_working_directory_buffer ) )
+	{
+		memory_free(
+		 narrow_current_working_directory );
+	}
+	if( safe_current_working_directory != NULL )
+	{
+		memory_free(
+		 safe_current_working_directory );
+	}
+	return( -1 );
+}
+
+#else
+#error Missing get current working directory function
+#endif
+
+/* Retrieves the cached wide character current working directory
+ * The current working directory is retrieved if it is not cached yet.
+ * The cached current working directory is owned by the cache and
+ * should not be freed
+ * Returns 1 if successful, 0 if the cache is not enabled or -1 on error
+ */
+int libcpath_path_get_cached_current_working_directory_wide(
+     const wchar_t **current_working_directory,
+     size_t *current_working_directory_length,
+     libcerror_error_t **error )
+{
+	wchar_t *safe_current_working_directory      = NULL;
+	static char *function                        = "libcpath_path_get_cached_current_working_directory_wide";
+	size_t safe_current_working_directory_length = 0;
+	size_t safe_current_working_directory_size   = 0;
+
+	if( current_working_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_working_directory_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory length.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_current_working_directory_cache_enabled == 0 )
+	{
+		return( 0 );
+	}
+	if( libcpath_path_current_working_directory_cache_wide == NULL )
+	{
+		if( libcpath_internal_path_get_current_working_directory_wide(
+		     &safe_current_working_directory,
+		     &safe_current_working_directory_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve current working directory.",
+			 function );
+
+			goto on_error;
+		}
+		safe_current_working_directory_length = wide_string_length(
+		                                         safe_current_working_directory );
+
+		/* The cache is allocated with the default memory functions since it
+		 * outlives memory allocated by the memory functions set by the caller,
+		 * such as an arena that is reset
+		 */
+		libcpath_path_current_working_directory_cache_wide = (wchar_t *) libcpath_memory_default_allocate(
+		                                                      sizeof( wchar_t ) * ( safe_current_working_directory_length + 1 ) );
+
+		if( libcpath_path_current_working_directory_cache_wide == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create current working directory cache.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     libcpath_path_current_working_directory_cache_wide,
+		     safe_current_working_directory,
+		     sizeof( wchar_t ) * ( safe_current_working_directory_length + 1 ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy current working directory to cache.",
+			 function );
+
+			goto on_error;
+		}
+		libcpath_path_current_working_directory_cache_wide_length = safe_current_working_directory_length;
+
+		memory_free(
+		 safe_current_working_directory );
+	}
+	*current_working_directory        = libcpath_path_current_working_directory_cache_wide;
+	*current_working_directory_length = libcpath_path_current_working_directory_cache_wide_length;
+
+	return( 1 );
+
+on_error:
+	if( libcpath_path_current_working_directory_cache_wide != NULL )
+	{
+		libcpath_memory_default_free(
+		 libcpath_path_current_working_directory_cache_wide );
+
+		libcpath_path_current_working_directory_cache_wide = NULL;
+	}
+	if( safe_current_working_directory != NULL )
+	{
+		memory_free(
+		 safe_current_working_directory );
+	}
+	return( -1 );
+}
+
+#if defined( WINAPI ) && ( WINVER <= 0x0500 )
+
+/* Cross Windows safe version of GetFullPathNameW
+ * Returns the number of characters in the current directory string or 0 on error
+ */
+DWORD libcpath_GetFullPathNameW(
+       LPCWSTR filename,
+       DWORD  buffer_size,
+       LPWSTR  buffer,
+       LPWSTR  *file_part )
+{
+	FARPROC function       = NULL;
+	HMODULE library_handle = NULL;
+	DWORD result           = 0;
+
+	library_handle = LoadLibrary(
+	                  _SYSTEM_STRING( "kernel32.dll" ) );
+
+	if( library_handle == NULL )
+	{
+		return( 0 );
+	}
+	function = GetProcAddress(
+		    library_handle,
+		    (LPCSTR) "GetFullPathNameW" );
+
+	if( function != NULL )
+	{
+		result = function(
+			  filename,
+			  buffer_size,
+			  buffer,
+			  file_part );
+	}
+	/* This call should be after using the function
+	 * in most cases kernel32.dll will still be available after free
+	 */
+	if( FreeLibrary(
+	     library_handle ) != TRUE )
+	{
+		libcpath_CloseHandle(
+		 library_handle );
+
+		return( 0 );
+	}
+	return( result );
+}
+
+#endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+
+/* Parses a path using the Windows path syntax
+ * This function is available on all platforms and does not access the file system
+ * The volume name and directory name are returned as indexes into the path
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_parse_windows_path_wide(
+     const wchar_t *path,
+     size_t path_length,
+     uint8_t *path_type,
+     size_t *volume_name_index,
+     size_t *volume_name_length,
+     size_t *directory_name_index,
+     libcerror_error_t **error )
+{
+	static char *function         = "libcpath_path_parse_windows_path_wide";
+	size_t path_index             = 0;
+	size_t safe_volume_name_index = 0;
+	size_t server_name_end_index  = 0;
+	size_t volume_name_end_index  = 0;
+	uint8_t safe_path_type        = LIBCPATH_WINDOWS_PATH_TYPE_RELATIVE;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_length == 0 )
+	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path type.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume name index.",
+		 function );
+
+		return( -1 );
+	}
+	if( volume_name_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume name length.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name index.",
+		 function );
+
+		return( -1 );
+	}
+	/* Classify the prefix, every character is inspected at most once
+	 * device path prefix:              \\.\
+	 * extended-length path prefix:     \\?\
+	 * extended-length UNC path prefix: \\?\UNC\
+	 * UNC path prefix:                 \\
+	 */
+	if( path[ 0 ] == (wchar_t) '\\' )
+	{
+		safe_path_type = LIBCPATH_WINDOWS_PATH_TYPE_ABSOLUTE;
+
+		if( ( path_length >= 2 )
+		 && ( path[ 1 ] == (wchar_t) '\\' ) )
+		{
+			safe_path_type         = LIBCPATH_WINDOWS_PATH_TYPE_UNC;
+			safe_volume_name_index = 2;
+
+			if( ( path_length >= 4 )
+			 && ( ( path[ 2 ] == (wchar_t) '.' )
+			  ||  ( path[ 2 ] == (wchar_t) '?' ) )
+			 && ( path[ 3 ] == (wchar_t) '\\' ) )
+			{
+				safe_volume_name_index = 4;
+
+				if( path[ 2 ] == (wchar_t) '.' )
+				{
+					safe_path_type = LIBCPATH_WINDOWS_PATH_TYPE_DEVICE;
+				}
+				else if( ( path_length >= 8 )
+				      && ( path[ 4 ] == (wchar_t) 'U' )
+				      && ( path[ 5 ] == (wchar_t) 'N' )
+				      && ( path[ 6 ] == (wchar_t) 'C' )
+				      && ( path[ 7 ] == (wchar_t) '\\' ) )
+				{
+					safe_path_type         = LIBCPATH_WINDOWS_PATH_TYPE_EXTENDED_LENGTH_UNC;
+					safe_volume_name_index = 8;
+				}
+				else
+				{
+					safe_path_type = LIBCPATH_WINDOWS_PATH_TYPE_EXTENDED_LENGTH;
+				}
+			}
+		}
+	}
+	path_index = safe_volume_name_index;
+
+	/* Check if the path contains a volume letter
+	 */
+	if( ( ( path_length - path_index ) >= 2 )
+	 && ( path[ path_index + 1 ] == (wchar_t) ':' )
+	 && ( ( ( path[ path_index ] >= (wchar_t) 'A' )
+	   &&   ( path[ path_index ] <= (wchar_t) 'Z' ) )
+	  ||  ( ( path[ path_index ] >= (wchar_t) 'a' )
+	   &&   ( path[ path_index ] <= (wchar_t) 'z' ) ) ) )
+	{
+		path_index           += 2;
+		volume_name_end_index = path_index;
+
+		if( path_index < path_length )
+		{
+			if( path[ path_index ] == (wchar_t) '\\' )
+			{
+				if( safe_path_type == LIBCPATH_WINDOWS_PATH_TYPE_RELATIVE )
+				{
+					safe_path_type = LIBCPATH_WINDOWS_PATH_TYPE_ABSOLUTE;
+				}
+				path_index++;
+			}
+		}
+	}
+	else if( ( safe_path_type == LIBCPATH_WINDOWS_PATH_TYPE_DEVICE )
+	      || ( safe_path_type == LIBCPATH_WINDOWS_PATH_TYPE_EXTENDED_LENGTH ) )
+	{
+		while( ( path_index < path_length )
+		    && ( path[ path_index ] != (wchar_t) '\\' ) )
+		{
+			path_index++;
+		}
+		volume_name_end_index = path_index;
+
+		if( path_index < path_length )
+		{
+			path_index++;
+		}
+	}
+	else if( ( safe_path_type == LIBCPATH_WINDOWS_PATH_TYPE_EXTENDED_LENGTH_UNC )
+	      || ( safe_path_type == LIBCPATH_WINDOWS_PATH_TYPE_UNC ) )
+	{
+		/* The volume name consists of: server\share
+		 */
+		while( ( path_index < path_length )
+		    && ( path[ path_index ] != (wchar_t) '\\' ) )
+		{
+			path_index++;
+		}
+		server_name_end_index = path_index;
+
+		if( path_index < path_length )
+		{
+			path_index++;
+		}
+		while( ( path_index < path_length )
+		    && ( path[ path_index ] != (wchar_t) '\\' ) )
+		{
+			path_index++;
+		}
+		/* Without a share name the volume name consists of the server name
+		 */
+		if( path_index > ( server_name_end_index + 1 ) )
+		{
+			volume_name_end_index = path_index;
+		}
+		else
+		{
+			volume_name_end_index = server_name_end_index;
+		}
+		if( path_index < path_length )
+		{
+			path_index++;
+		}
+	}
+	else
+	{
+		path_index = 0;
+	}
+	*path_type            = safe_path_type;
+	*volume_name_index    = safe_volume_name_index;
+	*volume_name_length   = volume_name_end_index - safe_volume_name_index;
+	*directory_name_index = path_index;
+
+	return( 1 );
+}
+
+#if defined( WINAPI )
+
+/* Determines the path type
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_path_type_wide(
+     const wchar_t *path,
+     size_t path_length,
+     uint8_t *path_type,
+     libcerror_error_t **error )
+{
+	static char *function       = "libcpath_path_get_path_type_wide";
+	size_t directory_name_index = 0;
+	size_t volume_name_index    = 0;
+	size_t volume_name_length   = 0;
+
+	if( libcpath_path_parse_windows_path_wide(
+	     path,
+	     path_length,
+	     path_type,
+	     &volume_name_index,
+	     &volume_name_length,
+	     &directory_name_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse path.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines the volume name
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_volume_name_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **volume_name,
+     size_t *volume_name_length,
+     size_t *directory_name_index,
+     libcerror_error_t **error )
+{
+	static char *function    = "libcpath_path_get_volume_name_wide";
+	size_t volume_name_index = 0;
+	uint8_t path_type        = 0;
+
+	if( volume_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume name.",
+		 function );
+
+		return( -1 );
+	}
+	*volume_name = NULL;
+
+	if( libcpath_path_parse_windows_path_wide(
+	     path,
+	     path_length,
+	     &path_type,
+	     &volume_name_index,
+	     volume_name_length,
+	     directory_name_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to parse path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *volume_name_length > 0 )
+	{
+		*volume_name = (wchar_t *) &( path[ volume_name_index ] );
+	}
+	return( 1 );
+}
+
+/* Retrieves the current working directory of a specific volume
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_current_working_directory_by_volume_wide(
+     wchar_t *volume_name,
+     size_t volume_name_length,
+     wchar_t **current_working_directory,
+     size_t *current_working_directory_size,
+     libcerror_error_t **error )
+{
+	static char *function                     = "libcpath_path_get_current_working_directory_by_volume_wide";
+	wchar_t *safe_current_working_directory   = NULL;
+	DWORD error_code                          = 0;
+	DWORD result                              = 0;
+	DWORD safe_current_working_directory_size = 0;
+
+	if( volume_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( volume_name_length == 0 )
+	 || ( volume_name_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid volume name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_working_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( *current_working_directory != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid current working directory value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_working_directory_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current working directory size.",
+		 function );
+
+		return( -1 );
+	}
+#if WINVER <= 0x0500
+	safe_current_working_directory_size = libcpath_GetFullPathNameW(
+	                                       volume_name,
+	                                       0,
+	                                       NULL,
+	                                       NULL );
+#else
+	safe_current_working_directory_size = GetFullPathNameW(
+	                                       volume_name,
+	                                       0,
+	                                       NULL,
+	                                       NULL );
+#endif
+	if( safe_current_working_directory_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current working directory size.",
+		 function );
+
+		goto on_error;
+	}
+	if( (size_t) safe_current_working_directory_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid current working directory size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	safe_current_working_directory = wide_string_allocate(
+	                                  safe_current_working_directory_size );
+
+	if( safe_current_working_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create current working directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_current_working_directory,
+	     0,
+	     sizeof( wchar_t ) * safe_current_working_directory_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear current working directory.",
+		 function );
+
+		goto on_error;
+	}
+#if WINVER <= 0x0500
+	result = libcpath_GetFullPathNameW(
+	          volume_name,
+	          safe_current_working_directory_size,
+	          safe_current_working_directory,
+	          NULL );
+#else
+	result = GetFullPathNameW(
+	          volume_name,
+	          safe_current_working_directory_size,
+	          safe_current_working_directory,
+	          NULL );
+#endif
+	/* Note that safe_current_working_directory_size can be larger than result
+	 */
+	if( ( result == 0 )
+	 || ( result > safe_current_working_directory_size ) )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 error_code,
+		 "%s: unable to retrieve current working directory.",
+		 function );
+
+		goto on_error;
+	}
+	*current_working_directory      = safe_current_working_directory;
+	*current_working_directory_size = (size_t) safe_current_working_directory_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_current_working_directory != NULL )
+	{
+		memory_free(
+		 safe_current_working_directory );
+	}
+	return( -1 );
+}
+
+/* Determines the full path of the Windows path specified
+ * The function uses the extended-length path format
+ * (path with \\?\ prefix)
+ *
+ * Multiple successive \ not at the start of the path are combined into one
+ *
+ * Scenario's that are considered full paths:
+ * Device path:			\\.\PhysicalDrive0
+ * Extended-length path:	\\?\C:\directory\file.txt
+ * Extended-length UNC path:	\\?\UNC\server\share\directory\file.txt
+ *
+ * Scenario's that are not considered full paths:
+ * Local 'absolute' path:	\directory\file.txt
+ * Local 'relative' path:	..\directory\file.txt
+ * Local 'relative' path:	.\directory\file.txt
+ * Volume 'absolute' path:	C:\directory\file.txt
+ *                              C:\..\directory\file.txt
+ * Volume 'relative' path:	C:directory\file.txt
+ * UNC path:			\\server\share\directory\file.txt
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_get_full_path_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error )
+{
+	wchar_t *current_directory          = NULL;
+	wchar_t *full_path_prefix           = NULL;
+	wchar_t *safe_full_path             = NULL;
+	wchar_t *volume_name                = NULL;
+	static char *function               = "libcpath_path_get_full_path_wide";
+	size_t current_directory_length     = 0;
+	size_t current_directory_name_index = 0;
+	size_t current_directory_size       = 0;
+	size_t full_path_index              = 0;
+	size_t full_path_prefix_length      = 0;
+	size_t path_directory_name_index    = 0;
+	size_t safe_full_path_size          = 0;
+	size_t volume_name_length           = 0;
+	uint8_t path_type                   = LIBCPATH_TYPE_RELATIVE;
+	int result                          = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_length == 0 )
+	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *full_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_get_path_type_wide(
+	     path,
+	     path_length,
+	     &path_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine path type.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_path_get_volume_name_wide(
+	     path,
+	     path_length,
+	     &volume_name,
+	     &volume_name_length,
+	     &path_directory_name_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine volume name.",
+		 function );
+
+		goto on_error;
+	}
+	/* If the path is a device path, an extended-length path or an UNC
+	 * do not bother to lookup the current working directory
+	 */
+	if( ( path_type != LIBCPATH_TYPE_DEVICE )
+	 && ( path_type != LIBCPATH_TYPE_EXTENDED_LENGTH )
+	 && ( path_type != LIBCPATH_TYPE_EXTENDED_LENGTH_UNC )
+	 && ( path_type != LIBCPATH_TYPE_UNC ) )
+	{
+		if( volume_name == NULL )
+		{
+			result = libcpath_internal_path_get_current_working_directory_wide(
+			          &current_directory,
+			          &current_directory_size,
+			          error );
+		}
+		else
+		{
+			result = libcpath_path_get_current_working_directory_by_volume_wide(
+			          volume_name,
+			          volume_name_length,
+			          &current_directory,
+			          &current_directory_size,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve current working directory.",
+			 function );
+
+			goto on_error;
+		}
+		if( volume_name == NULL )
+		{
+			/* Determine the volume name using the current working directory if necessary
+			 */
+			if( libcpath_path_get_volume_name_wide(
+			     current_directory,
+			     current_directory_size - 1,
+			     &volume_name,
+			     &volume_name_length,
+			     &current_directory_name_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine volume name from current working directory.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	/* The full path prefix consists of "\\?\" or "\\.\"
+	 */
+	full_path_prefix_length = 4;
+
+	if( volume_name != NULL )
+	{
+		/* Add the volume or device name
+		 */
+		full_path_prefix_length += volume_name_length;
+	}
+	if( ( path_type == LIBCPATH_TYPE_EXTENDED_LENGTH_UNC )
+	 || ( path_type == LIBCPATH_TYPE_UNC ) )
+	{
+		/* Add the "UNC\" prefix
+		 */
+		full_path_prefix_length += 4;
+	}
+	if( ( path_type == LIBCPATH_TYPE_RELATIVE )
+	 && ( current_directory != NULL )
+	 && ( current_directory_name_index < current_directory_size ) )
+	{
+		current_directory_length = wide_string_length(
+		                            &( current_directory[ current_directory_name_index ] ) );
+	}
+	/* Every segment is stored with a trailing directory separator, hence the full path
+	 * never needs more than the prefix and its directory separator, the length of the
+	 * inputs and a directory separator per input
+	 */
+	safe_full_path_size = full_path_prefix_length + 1 + ( current_directory_length + 1 ) + ( path_length - path_directory_name_index ) + 1;
+
+	full_path_index = 0;
+
+	safe_full_path = wide_string_allocate(
+	                  safe_full_path_size );
+
+	if( safe_full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create full path.",
+		 function );
+
+		goto on_error;
+	}
+	if( path_type == LIBCPATH_TYPE_DEVICE )
+	{
+		full_path_prefix        = L"\\\\.\\";
+		full_path_prefix_length = 4;
+	}
+	else
+	{
+		full_path_prefix        = L"\\\\?\\";
+		full_path_prefix_length = 4;
+	}
+	if( full_path_prefix_length > ( safe_full_path_size - full_path_index ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid full path size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( wide_string_copy(
+	     &( safe_full_path[ full_path_index ] ),
+	     full_path_prefix,
+	     full_path_prefix_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set prefix in full path.",
+		 function );
+
+		goto on_error;
+	}
+	full_path_index += full_path_prefix_length;
+
+	/* If there is a share name the path is an UNC path
+	 */
+	if( ( path_type == LIBCPATH_TYPE_EXTENDED_LENGTH_UNC )
+	 || ( path_type == LIBCPATH_TYPE_UNC ) )
+	{
+		if( ( safe_full_path_size - full_path_index ) < 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid full path size value out of bounds.",
+			 function );
+
+			goto on_error;
 		}
-		if( narrow_string_copy(
+		if( wide_string_copy(
 		     &( safe_full_path[ full_path_index ] ),
-		     "UNC\\",
+		     L"UNC\\",
 		     4 ) == NULL )
 		{
 			libcerror_error_set(
@@ -1743,236 +9879,732 @@ int libcpath_path_get_full_path(
 			 "%s: unable to set UNC\\ prefix in full path.",
 			 function );
 
-			goto on_error;
-		}
-		full_path_index += 4;
+			goto on_error;
+		}
+		full_path_index += 4;
+	}
+	if( volume_name != NULL )
+	{
+		if( volume_name_length > ( safe_full_path_size - full_path_index ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid full path size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( wide_string_copy(
+		     &( safe_full_path[ full_path_index ] ),
+		     volume_name,
+		     volume_name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set volume name in full path.",
+			 function );
+
+			goto on_error;
+		}
+		full_path_index += volume_name_length;
+
+		safe_full_path[ full_path_index++ ] = (wchar_t) '\\';
+	}
+	/* The segments are normalized after the prefix, so that a ".." (parent directory)
+	 * segment never removes the volume name
+	 */
+	full_path_prefix_length = full_path_index;
+
+	/* If the path is relative
+	 * add the current working directory segments
+	 */
+	if( current_directory_length > 0 )
+	{
+		if( libcpath_path_append_normalized_segments_wide(
+		     safe_full_path,
+		     safe_full_path_size,
+		     full_path_prefix_length,
+		     &full_path_index,
+		     &( current_directory[ current_directory_name_index ] ),
+		     current_directory_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append current working directory segments to full path.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcpath_path_append_normalized_segments_wide(
+	     safe_full_path,
+	     safe_full_path_size,
+	     full_path_prefix_length,
+	     &full_path_index,
+	     &( path[ path_directory_name_index ] ),
+	     path_length - path_directory_name_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append path segments to full path.",
+		 function );
+
+		goto on_error;
+	}
+	/* Replace the directory separator of the last segment by the end-of-string character
+	 */
+	safe_full_path[ full_path_index - 1 ] = 0;
+
+	if( current_directory != NULL )
+	{
+		memory_free(
+		 current_directory );
+	}
+	*full_path      = safe_full_path;
+	*full_path_size = full_path_index;
+
+	return( 1 );
+
+on_error:
+	if( safe_full_path != NULL )
+	{
+		memory_free(
+		 safe_full_path );
+	}
+	if( current_directory != NULL )
+	{
+		memory_free(
+		 current_directory );
+	}
+	return( -1 );
+}
+
+/* Determines the full path of the Windows path specified into a buffer
+ * The full path is determined by libcpath_path_get_full_path and copied
+ * into the buffer, since the volume name can only be determined using
+ * a temporary buffer
+ *
+ * The required full path size is set to the size of the full path, including
+ * the end-of-string character, also when the full path is too small
+ *
+ * Returns 1 if successful, 0 if the full path is too small or -1 on error
+ */
+int libcpath_internal_path_get_full_path_to_buffer_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     libcerror_error_t **error )
+{
+	wchar_t *safe_full_path    = NULL;
+	static char *function      = "libcpath_path_get_full_path_to_buffer_wide";
+	size_t safe_full_path_size = 0;
+	int result                 = 0;
+
+	if( full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid full path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_full_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required full path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_internal_path_get_full_path_wide(
+	     path,
+	     path_length,
+	     &safe_full_path,
+	     &safe_full_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine full path.",
+		 function );
+
+		goto on_error;
+	}
+	if( safe_full_path_size <= full_path_size )
+	{
+		if( memory_copy(
+		     full_path,
+		     safe_full_path,
+		     sizeof( wchar_t ) * safe_full_path_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy full path.",
+			 function );
+
+			goto on_error;
+		}
+		result = 1;
+	}
+	memory_free(
+	 safe_full_path );
+
+	*required_full_path_size = safe_full_path_size;
+
+	return( result );
+
+on_error:
+	if( safe_full_path != NULL )
+	{
+		memory_free(
+		 safe_full_path );
+	}
+	return( -1 );
+}
+
+/* Determines the full paths of the Windows paths specified
+ * The full paths are stored as consecutive strings in one buffer, the offset
+ * of each full path in the buffer is stored in the full path offsets.
+ * The full path of every path is determined by libcpath_path_get_full_path,
+ * since the volume name can only be determined using a temporary buffer
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_get_full_paths_wide(
+     const wchar_t **paths,
+     const size_t *path_lengths,
+     int number_of_paths,
+     wchar_t **full_paths,
+     size_t *full_paths_size,
+     size_t **full_path_offsets,
+     libcerror_error_t **error )
+{
+	wchar_t *full_path             = NULL;
+	wchar_t *safe_full_paths       = NULL;
+	size_t *safe_full_path_offsets = NULL;
+	void *reallocation             = NULL;
+	static char *function          = "libcpath_path_get_full_paths_wide";
+	size_t full_path_size          = 0;
+	size_t full_paths_offset       = 0;
+	size_t safe_full_paths_size    = 0;
+	int path_number                = 0;
+
+	if( paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid paths.",
+		 function );
+
+		return( -1 );
 	}
-	if( volume_name != NULL )
+	if( path_lengths == NULL )
 	{
-		if( volume_name_length > ( safe_full_path_size - full_path_index ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid full path size value out of bounds.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path lengths.",
+		 function );
 
-			goto on_error;
-		}
-		if( narrow_string_copy(
-		     &( safe_full_path[ full_path_index ] ),
-		     volume_name,
-		     volume_name_length ) == NULL )
+		return( -1 );
+	}
+	if( ( number_of_paths < 0 )
+	 || ( (size_t) number_of_paths > (size_t) ( SSIZE_MAX / sizeof( size_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of paths value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full paths.",
+		 function );
+
+		return( -1 );
+	}
+	if( *full_paths != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full paths value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_paths_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full paths size.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( *full_path_offsets != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full path offsets value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_paths == 0 )
+	{
+		*full_paths_size = 0;
+
+		return( 1 );
+	}
+	safe_full_path_offsets = (size_t *) memory_allocate(
+	                                     sizeof( size_t ) * number_of_paths );
+
+	if( safe_full_path_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create full path offsets.",
+		 function );
+
+		goto on_error;
+	}
+	for( path_number = 0;
+	     path_number < number_of_paths;
+	     path_number++ )
+	{
+		if( libcpath_internal_path_get_full_path_wide(
+		     paths[ path_number ],
+		     path_lengths[ path_number ],
+		     &full_path,
+		     &full_path_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set volume name in full path.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine full path: %d.",
+			 function,
+			 path_number );
 
 			goto on_error;
 		}
-		full_path_index += volume_name_length;
-
-		safe_full_path[ full_path_index++ ] = '\\';
-	}
-	/* If the path is relative
-	 * add the current working directory elements
-	 */
-	if( ( path_type == LIBCPATH_TYPE_RELATIVE )
-	 && ( current_directory_split_string != NULL ) )
-	{
-		for( current_directory_segment_index = 0;
-		     current_directory_segment_index < current_directory_number_of_segments;
-		     current_directory_segment_index++ )
+		if( ( full_paths_offset + full_path_size ) > safe_full_paths_size )
 		{
-			if( libcsplit_narrow_split_string_get_segment_by_index(
-			     current_directory_split_string,
-			     current_directory_segment_index,
-			     &current_directory_string_segment,
-			     &current_directory_string_segment_size,
-			     error ) != 1 )
+			/* Grow the full paths at least twofold to limit the number of reallocations
+			 */
+			if( ( full_paths_offset + full_path_size ) > ( safe_full_paths_size * 2 ) )
+			{
+				safe_full_paths_size = full_paths_offset + full_path_size;
+			}
+			else
+			{
+				safe_full_paths_size *= 2;
+			}
+			if( safe_full_paths_size > (size_t) SSIZE_MAX )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve current working directory string segment: %d.",
-				 function,
-				 current_directory_segment_index );
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid full paths size value out of bounds.",
+				 function );
 
 				goto on_error;
 			}
-			if( current_directory_string_segment_size != 0 )
+			reallocation = memory_reallocate(
+			                safe_full_paths,
+			                sizeof( wchar_t ) * safe_full_paths_size );
+
+			if( reallocation == NULL )
 			{
-				if( current_directory_string_segment == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing current working directory string segment: %d.",
-					 function,
-					 current_directory_segment_index );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize full paths.",
+				 function );
 
-					goto on_error;
-				}
-				/* Note that here we should have room for the segment string and
-				 * one additional character
-				 */
-				if( current_directory_string_segment_size > ( safe_full_path_size - full_path_index ) )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid current working directory string segment: %d size value out of bounds.",
-					 function,
-					 current_directory_segment_index );
+				goto on_error;
+			}
+			safe_full_paths = (wchar_t *) reallocation;
+		}
+		if( memory_copy(
+		     &( safe_full_paths[ full_paths_offset ] ),
+		     full_path,
+		     sizeof( wchar_t ) * full_path_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy full path: %d.",
+			 function,
+			 path_number );
 
-					goto on_error;
-				}
-				path_string_segment_length = current_directory_string_segment_size - 1;
+			goto on_error;
+		}
+		memory_free(
+		 full_path );
 
-				if( narrow_string_copy(
-				     &( safe_full_path[ full_path_index ] ),
-				     current_directory_string_segment,
-				     path_string_segment_length ) == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set current working directory split value: %d in full path.",
-					 function,
-					 current_directory_segment_index );
+		full_path = NULL;
 
-					goto on_error;
-				}
-				full_path_index += path_string_segment_length;
+		safe_full_path_offsets[ path_number ] = full_paths_offset;
+
+		full_paths_offset += full_path_size;
+	}
+	*full_paths        = safe_full_paths;
+	*full_paths_size   = full_paths_offset;
+	*full_path_offsets = safe_full_path_offsets;
+
+	return( 1 );
+
+on_error:
+	if( full_path != NULL )
+	{
+		memory_free(
+		 full_path );
+	}
+	if( safe_full_paths != NULL )
+	{
+		memory_free(
+		 safe_full_paths );
+	}
+	if( safe_full_path_offsets != NULL )
+	{
+		memory_free(
+		 safe_full_path_offsets );
+	}
+	return( -1 );
+}
+
+#else
+
+/* Determines the full path of the POSIX path specified
+ * Multiple successive / are combined into one
+ *
+ * Scenarios:
+ * /home/user/file.txt
+ * /home/user//file.txt
+ * /home/user/../user/file.txt
+ * /../home/user/file.txt
+ * user/../user/file.txt
+ *
+ * The segments of the current working directory and the path are normalized
+ * directly into the full path, without splitting them first
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_get_full_path_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error )
+{
+	wchar_t full_path_prefix[ 3 ];
+
+	const wchar_t *working_directory = NULL;
+	wchar_t *current_directory       = NULL;
+	wchar_t *safe_full_path          = NULL;
+	static char *function            = "libcpath_path_get_full_path_wide";
+	size_t current_directory_index   = 0;
+	size_t current_directory_length  = 0;
+	size_t current_directory_size    = 0;
+	size_t full_path_prefix_length   = 0;
+	size_t path_index                = 0;
+	size_t safe_full_path_size       = 0;
+	uint8_t path_type                = LIBCPATH_TYPE_RELATIVE;
+	int result                       = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( __MINGW32__ )
+	if( ( path_length < 2 )
+	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+#else
+	if( ( path_length < 1 )
+	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *full_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path size.",
+		 function );
 
-				safe_full_path[ full_path_index++ ] = '\\';
-			}
-		}
+		return( -1 );
+	}
+#if defined( __MINGW32__ )
+	if( path[ 1 ] == (wchar_t) ':' )
+	{
+		path_index = 2;
+	}
+	current_directory_index = 3;
+#endif
+	if( ( path_index < path_length )
+	 && ( path[ path_index ] == (wchar_t) LIBCPATH_SEPARATOR ) )
+	{
+		path_type = LIBCPATH_TYPE_ABSOLUTE;
 	}
-	if( path_split_string != NULL )
+	if( ( path_type == LIBCPATH_TYPE_RELATIVE )
+	 || ( path_index != current_directory_index ) )
 	{
-		for( path_segment_index = 0;
-		     path_segment_index < path_number_of_segments;
-		     path_segment_index++ )
+		result = libcpath_path_get_cached_current_working_directory_wide(
+		          &working_directory,
+		          &current_directory_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cached current working directory.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
 		{
-			if( libcsplit_narrow_split_string_get_segment_by_index(
-			     path_split_string,
-			     path_segment_index,
-			     &path_string_segment,
-			     &path_string_segment_size,
+			if( libcpath_internal_path_get_current_working_directory_wide(
+			     &current_directory,
+			     &current_directory_size,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve path string segment: %d.",
-				 function,
-				 path_segment_index );
+				 "%s: unable to retrieve current working directory.",
+				 function );
 
 				goto on_error;
 			}
-			if( path_string_segment_size != 0 )
+			if( current_directory == NULL )
 			{
-				if( path_string_segment == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing path string segment: %d.",
-					 function,
-					 path_segment_index );
-
-					goto on_error;
-				}
-				/* Note that here we should have room for the segment string and
-				 * one additional character
-				 */
-				if( path_string_segment_size > ( safe_full_path_size - full_path_index ) )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid current path string segment: %d size value out of bounds.",
-					 function,
-					 path_segment_index );
-
-					goto on_error;
-				}
-				path_string_segment_length = path_string_segment_size - 1;
-
-				if( narrow_string_copy(
-				     &( safe_full_path[ full_path_index ] ),
-				     path_string_segment,
-				     path_string_segment_length ) == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set path split value: %d in full path.",
-					 function,
-					 path_segment_index );
-
-					goto on_error;
-				}
-				full_path_index += path_string_segment_length;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing current working directory.",
+				 function );
 
-				safe_full_path[ full_path_index++ ] = '\\';
+				goto on_error;
 			}
-		}
-	}
-	safe_full_path[ full_path_index - 1 ] = 0;
+			current_directory_length = current_directory_size - 1;
 
-	if( path_split_string != NULL )
-	{
-		if( libcsplit_narrow_split_string_free(
-		     &path_split_string,
-		     error ) != 1 )
+			working_directory = current_directory;
+		}
+		if( current_directory_index > current_directory_length )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free path split string.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid current working directory length value out of bounds.",
 			 function );
 
 			goto on_error;
 		}
+		current_directory_length -= current_directory_index;
 	}
-	if( current_directory_split_string != NULL )
+#if defined( __MINGW32__ )
+	/* The full path is prefixed with a drive letter, a colon and a directory separator
+	 */
+	if( path_index == 2 )
 	{
-		if( libcsplit_narrow_split_string_free(
-		     &current_directory_split_string,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free current working directory split string.",
-			 function );
+		full_path_prefix[ full_path_prefix_length++ ] = path[ 0 ];
+	}
+	else
+	{
+		full_path_prefix[ full_path_prefix_length++ ] = working_directory[ 0 ];
+	}
+	full_path_prefix[ full_path_prefix_length++ ] = (wchar_t) ':';
+#endif
+	/* The full path is prefixed with a directory separator
+	 */
+	full_path_prefix[ full_path_prefix_length++ ] = (wchar_t) LIBCPATH_SEPARATOR;
 
-			goto on_error;
-		}
+	/* Every segment is stored with a trailing directory separator, hence the full path
+	 * never needs more than the length of the inputs, a directory separator per input
+	 * and the prefix
+	 */
+	safe_full_path_size = full_path_prefix_length + ( path_length - path_index ) + 1;
+
+	if( path_type == LIBCPATH_TYPE_RELATIVE )
+	{
+		safe_full_path_size += current_directory_length + 1;
+	}
+	safe_full_path = wide_string_allocate(
+	                  safe_full_path_size );
+
+	if( safe_full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create full path.",
+		 function );
+
+		goto on_error;
+	}
+	/* If the path is relative
+	 * the current working directory segments are added
+	 */
+	if( path_type == LIBCPATH_TYPE_RELATIVE )
+	{
+		result = libcpath_path_resolve_full_path_wide(
+		          full_path_prefix,
+		          full_path_prefix_length,
+		          &( working_directory[ current_directory_index ] ),
+		          current_directory_length,
+		          &( path[ path_index ] ),
+		          path_length - path_index,
+		          safe_full_path,
+		          safe_full_path_size,
+		          full_path_size,
+		          error );
+	}
+	else
+	{
+		result = libcpath_path_resolve_full_path_wide(
+		          full_path_prefix,
+		          full_path_prefix_length,
+		          NULL,
+		          0,
+		          &( path[ path_index ] ),
+		          path_length - path_index,
+		          safe_full_path,
+		          safe_full_path_size,
+		          full_path_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve full path.",
+		 function );
+
+		goto on_error;
 	}
 	if( current_directory != NULL )
 	{
 		memory_free(
 		 current_directory );
 	}
-	*full_path      = safe_full_path;
-	*full_path_size = safe_full_path_size;
+	*full_path = safe_full_path;
 
 	return( 1 );
 
@@ -1982,18 +10614,6 @@ on_error:
 		memory_free(
 		 safe_full_path );
 	}
-	if( path_split_string != NULL )
-	{
-		libcsplit_narrow_split_string_free(
-		 &path_split_string,
-		 NULL );
-	}
-	if( current_directory_split_string != NULL )
-	{
-		libcsplit_narrow_split_string_free(
-		 &current_directory_split_string,
-		 NULL );
-	}
 	if( current_directory != NULL )
 	{
 		memory_free(
@@ -2002,52 +10622,36 @@ on_error:
 	return( -1 );
 }
 
-#else
-
-/* Determines the full path of the POSIX path specified
- * Multiple successive / are combined into one
+/* Determines the full path of the POSIX path specified into a buffer
+ * This function does not allocate memory, the current working directory
+ * is retrieved and converted into buffers on the stack
  *
- * Scenarios:
- * /home/user/file.txt
- * /home/user//file.txt
- * /home/user/../user/file.txt
- * /../home/user/file.txt
- * user/../user/file.txt
+ * The required full path size is set to the size of the full path, including
+ * the end-of-string character, also when the full path is too small
  *
- * Returns 1 if successful or -1 on error
+ * Returns 1 if successful, 0 if the full path is too small or -1 on error
  */
-int libcpath_path_get_full_path(
-     const char *path,
+int libcpath_internal_path_get_full_path_to_buffer_wide(
+     const wchar_t *path,
      size_t path_length,
-     char **full_path,
-     size_t *full_path_size,
+     wchar_t *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
      libcerror_error_t **error )
 {
-	libcsplit_narrow_split_string_t *current_directory_split_string = NULL;
-	libcsplit_narrow_split_string_t *path_split_string              = NULL;
-	char *current_directory                                         = NULL;
-	char *current_directory_string_segment                          = NULL;
-	char *last_used_path_string_segment                             = NULL;
-	char *path_string_segment                                       = NULL;
-	char *safe_full_path                                            = NULL;
-	static char *function                                           = "libcpath_path_get_full_path";
-	size_t current_directory_index                                  = 0;
-	size_t current_directory_length                                 = 0;
-	size_t current_directory_size                                   = 0;
-	size_t current_directory_string_segment_size                    = 0;
-	size_t full_path_index                                          = 0;
-	size_t full_path_prefix_length                                  = 0;
-	size_t last_used_path_string_segment_size                       = 0;
-	size_t path_index                                               = 0;
-	size_t path_string_segment_length                               = 0;
-	size_t path_string_segment_size                                 = 0;
-	size_t safe_full_path_size                                      = 0;
-	uint8_t path_type                                               = LIBCPATH_TYPE_RELATIVE;
-	int current_directory_number_of_segments                        = 0;
-	int current_directory_segment_index                             = 0;
-	int last_used_path_segment_index                                = -1;
-	int path_number_of_segments                                     = 0;
-	int path_segment_index                                          = 0;
+	char narrow_current_directory[ PATH_MAX ];
+	wchar_t current_directory[ PATH_MAX ];
+	wchar_t full_path_prefix[ 3 ];
+
+	const wchar_t *working_directory       = NULL;
+	static char *function                  = "libcpath_path_get_full_path_to_buffer_wide";
+	size_t current_directory_index         = 0;
+	size_t current_directory_length        = 0;
+	size_t full_path_prefix_length         = 0;
+	size_t narrow_current_directory_length = 0;
+	size_t path_index                      = 0;
+	uint8_t path_type                      = LIBCPATH_TYPE_RELATIVE;
+	int result                             = 0;
 
 	if( path == NULL )
 	{
@@ -2088,83 +10692,102 @@ int libcpath_path_get_full_path(
 
 		return( -1 );
 	}
-	if( *full_path != NULL )
+	if( full_path_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid full path value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid full path size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( full_path_size == NULL )
+	if( required_full_path_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid full path size.",
+		 "%s: invalid required full path size.",
 		 function );
 
 		return( -1 );
 	}
-	/* Determine the full path size
-	 */
 #if defined( __MINGW32__ )
-	if( path[ 1 ] == ':' )
+	if( path[ 1 ] == (wchar_t) ':' )
 	{
 		path_index = 2;
 	}
 	current_directory_index = 3;
 #endif
-	full_path_prefix_length = current_directory_index;
-
-	if( path[ path_index ] == LIBCPATH_SEPARATOR )
+	if( ( path_index < path_length )
+	 && ( path[ path_index ] == (wchar_t) LIBCPATH_SEPARATOR ) )
 	{
 		path_type = LIBCPATH_TYPE_ABSOLUTE;
-
-#if !defined( __MINGW32__ )
-		/* If the path is absolute
-		 * a directory separator
-		 */
-		full_path_prefix_length += 1;
-#endif
 	}
 	if( ( path_type == LIBCPATH_TYPE_RELATIVE )
 	 || ( path_index != current_directory_index ) )
 	{
-		if( libcpath_path_get_current_working_directory(
-		     &current_directory,
-		     &current_directory_size,
-		     error ) != 1 )
+		result = libcpath_path_get_cached_current_working_directory_wide(
+		          &working_directory,
+		          &current_directory_length,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve current working directory.",
+			 "%s: unable to retrieve cached current working directory.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( current_directory == NULL )
+		else if( result == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing current working directory.",
-			 function );
+			if( getcwd(
+			     narrow_current_directory,
+			     PATH_MAX ) == NULL )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 errno,
+				 "%s: unable to retrieve current working directory.",
+				 function );
 
-			goto on_error;
-		}
-		/* We need to use the length here since current_directory_size will be PATH_MAX
-		 */
-		current_directory_length = narrow_string_length(
-		                            current_directory );
+				return( -1 );
+			}
+			narrow_current_directory_length = narrow_string_length(
+			                                   narrow_current_directory );
+
+			/* The wide character current working directory never contains more characters
+			 * than the narrow character current working directory
+			 */
+			if( libcpath_system_string_copy_to_wide_string(
+			     narrow_current_directory,
+			     narrow_current_directory_length + 1,
+			     current_directory,
+			     PATH_MAX,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_GENERIC,
+				 "%s: unable to set current working directory.",
+				 function );
+
+				return( -1 );
+			}
+			current_directory_length = wide_string_length(
+			                            current_directory );
 
+			working_directory = current_directory;
+		}
 		if( current_directory_index > current_directory_length )
 		{
 			libcerror_error_set(
@@ -2174,615 +10797,487 @@ int libcpath_path_get_full_path(
 			 "%s: invalid current working directory length value out of bounds.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		current_directory_length -= current_directory_index;
 	}
+#if defined( __MINGW32__ )
+	/* The full path is prefixed with a drive letter, a colon and a directory separator
+	 */
+	if( path_index == 2 )
+	{
+		full_path_prefix[ full_path_prefix_length++ ] = path[ 0 ];
+	}
+	else
+	{
+		full_path_prefix[ full_path_prefix_length++ ] = working_directory[ 0 ];
+	}
+	full_path_prefix[ full_path_prefix_length++ ] = (wchar_t) ':';
+#endif
+	/* The full path is prefixed with a directory separator
+	 */
+	full_path_prefix[ full_path_prefix_length++ ] = (wchar_t) LIBCPATH_SEPARATOR;
+
+	/* If the path is relative
+	 * the current working directory segments are added
+	 */
 	if( path_type == LIBCPATH_TYPE_RELATIVE )
 	{
-		if( libcsplit_narrow_string_split(
-		     &( current_directory[ current_directory_index ] ),
-		     current_directory_length + 1,
-		     LIBCPATH_SEPARATOR,
-		     &current_directory_split_string,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to split current working directory.",
-			 function );
+		result = libcpath_path_resolve_full_path_wide(
+		          full_path_prefix,
+		          full_path_prefix_length,
+		          &( working_directory[ current_directory_index ] ),
+		          current_directory_length,
+		          &( path[ path_index ] ),
+		          path_length - path_index,
+		          full_path,
+		          full_path_size,
+		          required_full_path_size,
+		          error );
+	}
+	else
+	{
+		result = libcpath_path_resolve_full_path_wide(
+		          full_path_prefix,
+		          full_path_prefix_length,
+		          NULL,
+		          0,
+		          &( path[ path_index ] ),
+		          path_length - path_index,
+		          full_path,
+		          full_path_size,
+		          required_full_path_size,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve full path.",
+		 function );
 
-			goto on_error;
-		}
-		if( libcsplit_narrow_split_string_get_number_of_segments(
-		     current_directory_split_string,
-		     &current_directory_number_of_segments,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of current working directory string segments.",
-			 function );
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Determines the full paths of the POSIX paths specified
+ * The full paths are stored as consecutive strings in one buffer, the offset
+ * of each full path in the buffer is stored in the full path offsets.
+ * The current working directory is retrieved at most once for all paths.
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_get_full_paths_wide(
+     const wchar_t **paths,
+     const size_t *path_lengths,
+     int number_of_paths,
+     wchar_t **full_paths,
+     size_t *full_paths_size,
+     size_t **full_path_offsets,
+     libcerror_error_t **error )
+{
+	wchar_t full_path_prefix[ 3 ];
+
+	const wchar_t *path                = NULL;
+	const wchar_t *working_directory   = NULL;
+	wchar_t *current_directory         = NULL;
+	wchar_t *safe_full_paths           = NULL;
+	size_t *safe_full_path_offsets  = NULL;
+	static char *function           = "libcpath_path_get_full_paths_wide";
+	size_t current_directory_index  = 0;
+	size_t current_directory_length = 0;
+	size_t current_directory_size   = 0;
+	size_t full_path_prefix_length  = 0;
+	size_t full_path_size           = 0;
+	size_t full_paths_offset        = 0;
+	size_t path_index               = 0;
+	size_t path_length              = 0;
+	size_t safe_full_paths_size     = 0;
+	uint8_t path_type               = LIBCPATH_TYPE_RELATIVE;
+	int path_number                 = 0;
+	int result                      = 0;
+
+	if( paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid paths.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_lengths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path lengths.",
+		 function );
 
-			goto on_error;
-		}
-		current_directory_segment_index = current_directory_number_of_segments - 1;
+		return( -1 );
+	}
+	if( ( number_of_paths < 0 )
+	 || ( (size_t) number_of_paths > (size_t) ( SSIZE_MAX / sizeof( size_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of paths value out of bounds.",
+		 function );
 
-		/* If the path is relative
-		 * add the size of the current working directory
-		 * a directory separator, if necessary
-		 */
-		safe_full_path_size = current_directory_length;
+		return( -1 );
+	}
+	if( full_paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full paths.",
+		 function );
 
-		if( ( current_directory_length >= 1 )
-		 && ( current_directory[ current_directory_length - 1 ] != LIBCPATH_SEPARATOR ) )
-		{
-			safe_full_path_size++;
-		}
+		return( -1 );
 	}
-	if( path_index > path_length )
+	if( *full_paths != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid path length value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full paths value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libcsplit_narrow_string_split(
-	     &( path[ path_index ] ),
-	     ( path_length - path_index ) + 1,
-	     LIBCPATH_SEPARATOR,
-	     &path_split_string,
-	     error ) != 1 )
+	if( full_paths_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full paths size.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( *full_path_offsets != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to split path.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full path offsets value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( path_split_string != NULL )
+	if( number_of_paths == 0 )
 	{
-		if( libcsplit_narrow_split_string_get_number_of_segments(
-		     path_split_string,
-		     &path_number_of_segments,
-		     error ) != 1 )
+		*full_paths_size = 0;
+
+		return( 1 );
+	}
+#if defined( __MINGW32__ )
+	current_directory_index = 3;
+	full_path_prefix_length = 3;
+#else
+	full_path_prefix_length = 1;
+#endif
+	/* Validate the paths and determine the maximum size of all full paths
+	 */
+	for( path_number = 0;
+	     path_number < number_of_paths;
+	     path_number++ )
+	{
+		path        = paths[ path_number ];
+		path_length = path_lengths[ path_number ];
+
+		if( path == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of path string segments.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid path: %d.",
+			 function,
+			 path_number );
 
 			goto on_error;
 		}
-		for( path_segment_index = 0;
-		     path_segment_index < path_number_of_segments;
-		     path_segment_index++ )
+#if defined( __MINGW32__ )
+		if( ( path_length < 2 )
+		 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+#else
+		if( ( path_length < 1 )
+		 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+#endif
 		{
-			if( libcsplit_narrow_split_string_get_segment_by_index(
-			     path_split_string,
-			     path_segment_index,
-			     &path_string_segment,
-			     &path_string_segment_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve path string segment: %d.",
-				 function,
-				 path_segment_index );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid path: %d length value out of bounds.",
+			 function,
+			 path_number );
 
-				goto on_error;
-			}
-			if( path_string_segment == NULL )
+			goto on_error;
+		}
+		path_index = 0;
+		path_type  = LIBCPATH_TYPE_RELATIVE;
+
+#if defined( __MINGW32__ )
+		if( path[ 1 ] == (wchar_t) ':' )
+		{
+			path_index = 2;
+		}
+#endif
+		if( ( path_index < path_length )
+		 && ( path[ path_index ] == (wchar_t) LIBCPATH_SEPARATOR ) )
+		{
+			path_type = LIBCPATH_TYPE_ABSOLUTE;
+		}
+		if( ( working_directory == NULL )
+		 && ( ( path_type == LIBCPATH_TYPE_RELATIVE )
+		  || ( path_index != current_directory_index ) ) )
+		{
+			result = libcpath_path_get_cached_current_working_directory_wide(
+			          &working_directory,
+			          &current_directory_length,
+			          error );
+
+			if( result == -1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing path string segment: %d.",
-				 function,
-				 path_segment_index );
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve cached current working directory.",
+				 function );
 
 				goto on_error;
 			}
-			/* If the path is "" (empty) or "." (current) ignore the entry
-			 */
-			if( ( path_string_segment_size <= 1 )
-			 || ( ( path_string_segment_size == 2 )
-			  &&  ( path_string_segment[ 0 ] == '.' ) ) )
+			else if( result == 0 )
 			{
-				if( libcsplit_narrow_split_string_set_segment_by_index(
-				     path_split_string,
-				     path_segment_index,
-				     NULL,
-				     0,
+				if( libcpath_internal_path_get_current_working_directory_wide(
+				     &current_directory,
+				     &current_directory_size,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set path string segment: %d.",
-					 function,
-					 path_segment_index );
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve current working directory.",
+					 function );
 
 					goto on_error;
 				}
-			}
-			/* If the path is ".." (parent) reverse the current path by one directory
-			 */
-			else if( ( path_string_segment_size == 3 )
-			      && ( path_string_segment[ 0 ] == '.' )
-			      && ( path_string_segment[ 1 ] == '.' ) )
-			{
-				if( ( current_directory_split_string != NULL )
-				 && ( last_used_path_segment_index == -1 ) )
-				{
-					if( libcsplit_narrow_split_string_get_segment_by_index(
-					     current_directory_split_string,
-					     current_directory_segment_index,
-					     &current_directory_string_segment,
-					     &current_directory_string_segment_size,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve current working directory string segment: %d.",
-						 function,
-						 current_directory_segment_index );
-
-						goto on_error;
-					}
-					if( current_directory_string_segment == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-						 "%s: missing current working directory string segment: %d.",
-						 function,
-						 current_directory_segment_index );
-
-						goto on_error;
-					}
-					/* Remove the size of the parent directory name and a directory separator
-					 * Note that the size includes the end of string character
-					 */
-					if( current_directory_string_segment_size < safe_full_path_size )
-					{
-						safe_full_path_size -= current_directory_string_segment_size;
-					}
-					else
-					{
-						safe_full_path_size = 0;
-					}
-					if( libcsplit_narrow_split_string_set_segment_by_index(
-					     current_directory_split_string,
-					     current_directory_segment_index,
-					     NULL,
-					     0,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-						 "%s: unable to set current working directory string segment: %d.",
-						 function,
-						 current_directory_segment_index );
-
-						goto on_error;
-					}
-					current_directory_segment_index--;
-				}
-				else if( last_used_path_segment_index >= 0 )
-				{
-					if( libcsplit_narrow_split_string_get_segment_by_index(
-					     path_split_string,
-					     last_used_path_segment_index,
-					     &last_used_path_string_segment,
-					     &last_used_path_string_segment_size,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve last used path string segment: %d.",
-						 function,
-						 last_used_path_segment_index );
-
-						goto on_error;
-					}
-					if( last_used_path_string_segment == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-						 "%s: missing last used path string string segment: %d.",
-						 function,
-						 last_used_path_segment_index );
-
-						goto on_error;
-					}
-					/* Remove the size of the parent directory name and a directory separator
-					 * Note that the size includes the end of string character
-					 */
-					if( last_used_path_string_segment_size < safe_full_path_size )
-					{
-						safe_full_path_size -= last_used_path_string_segment_size;
-					}
-					else
-					{
-						safe_full_path_size = 0;
-					}
-					if( libcsplit_narrow_split_string_set_segment_by_index(
-					     path_split_string,
-					     last_used_path_segment_index,
-					     NULL,
-					     0,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-						 "%s: unable to set path string segment: %d.",
-						 function,
-						 last_used_path_segment_index );
-
-						goto on_error;
-					}
-					/* Find the previous path split value that contains a name
-					 */
-					while( last_used_path_segment_index > 0 )
-					{
-						last_used_path_segment_index--;
-
-						if( libcsplit_narrow_split_string_get_segment_by_index(
-						     path_split_string,
-						     last_used_path_segment_index,
-						     &last_used_path_string_segment,
-						     &last_used_path_string_segment_size,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-							 "%s: unable to retrieve last used path string segment: %d.",
-							 function,
-							 last_used_path_segment_index );
-
-							goto on_error;
-						}
-						if( last_used_path_string_segment_size != 0 )
-						{
-							break;
-						}
-					}
-				}
-				if( libcsplit_narrow_split_string_set_segment_by_index(
-				     path_split_string,
-				     path_segment_index,
-				     NULL,
-				     0,
-				     error ) != 1 )
+				if( current_directory == NULL )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set path string segment: %d.",
-					 function,
-					 path_segment_index );
+					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+					 "%s: missing current working directory.",
+					 function );
 
 					goto on_error;
 				}
+				current_directory_length = current_directory_size - 1;
+
+				working_directory = current_directory;
 			}
-			else
+			if( current_directory_index > current_directory_length )
 			{
-				/* Add the size of the directory or file name and a directory separator
-				 * Note that the size includes the end of string character
-				 */
-				safe_full_path_size += path_string_segment_size;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid current working directory length value out of bounds.",
+				 function );
 
-				last_used_path_segment_index = path_segment_index;
+				goto on_error;
 			}
+			current_directory_length -= current_directory_index;
 		}
-#if defined( __MINGW32__ )
-		if( ( safe_full_path_size > 0 )
-		 && ( path_number_of_segments > 1 ) )
-#else
-		if( safe_full_path_size > 0 )
-#endif
+		/* Every segment is stored with a trailing directory separator, hence the full path
+		 * never needs more than the length of the inputs, a directory separator per input
+		 * and the prefix
+		 */
+		full_path_size = full_path_prefix_length + ( path_length - path_index ) + 1;
+
+		if( path_type == LIBCPATH_TYPE_RELATIVE )
 		{
-			/* Remove the size reserved of the last directory separator
-			 */
-			safe_full_path_size -= 1;
+			full_path_size += current_directory_length + 1;
 		}
-	}
-	safe_full_path_size += full_path_prefix_length + 1;
+		if( full_path_size > ( (size_t) SSIZE_MAX - safe_full_paths_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid full paths size value out of bounds.",
+			 function );
 
-	safe_full_path = narrow_string_allocate(
-	                  safe_full_path_size );
+			goto on_error;
+		}
+		safe_full_paths_size += full_path_size;
+	}
+	safe_full_path_offsets = (size_t *) memory_allocate(
+	                                     sizeof( size_t ) * number_of_paths );
 
-	if( safe_full_path == NULL )
+	if( safe_full_path_offsets == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create full path.",
+		 "%s: unable to create full path offsets.",
 		 function );
 
 		goto on_error;
 	}
-	if( memory_set(
-	     safe_full_path,
-	     0,
-	     sizeof( char ) * safe_full_path_size ) == NULL )
+	safe_full_paths = wide_string_allocate(
+	                   safe_full_paths_size );
+
+	if( safe_full_paths == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear full path.",
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create full paths.",
 		 function );
 
 		goto on_error;
 	}
-	full_path_index = 0;
+	/* Resolve the full paths, since the size of every full path was accounted
+	 * for each full path is normalized in a single forward scan
+	 */
+	for( path_number = 0;
+	     path_number < number_of_paths;
+	     path_number++ )
+	{
+		path                    = paths[ path_number ];
+		path_length             = path_lengths[ path_number ];
+		path_index              = 0;
+		path_type               = LIBCPATH_TYPE_RELATIVE;
+		full_path_prefix_length = 0;
 
 #if defined( __MINGW32__ )
-	if( path_index == 2 )
-	{
-		safe_full_path[ full_path_index++ ] = path[ 0 ];
-	}
-	else
-	{
-		safe_full_path[ full_path_index++ ] = current_directory[ 0 ];
-	}
-	safe_full_path[ full_path_index++ ] = ':';
-	safe_full_path[ full_path_index++ ] = LIBCPATH_SEPARATOR;
-#else
-	if( path_type == LIBCPATH_TYPE_ABSOLUTE )
-	{
-		safe_full_path[ full_path_index++ ] = LIBCPATH_SEPARATOR;
-	}
+		if( path[ 1 ] == (wchar_t) ':' )
+		{
+			path_index = 2;
+		}
 #endif
-	/* If the path is relative
-	 * add the current working directory elements
-	 */
-	if( current_directory_split_string != NULL )
-	{
-		for( current_directory_segment_index = 0;
-		     current_directory_segment_index < current_directory_number_of_segments;
-		     current_directory_segment_index++ )
+		if( ( path_index < path_length )
+		 && ( path[ path_index ] == (wchar_t) LIBCPATH_SEPARATOR ) )
 		{
-			if( libcsplit_narrow_split_string_get_segment_by_index(
-			     current_directory_split_string,
-			     current_directory_segment_index,
-			     &current_directory_string_segment,
-			     &current_directory_string_segment_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve current working directory string segment: %d.",
-				 function,
-				 current_directory_segment_index );
-
-				goto on_error;
-			}
-			if( current_directory_string_segment_size != 0 )
-			{
-				if( current_directory_string_segment == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing current working directory string segment: %d.",
-					 function,
-					 current_directory_segment_index );
-
-					goto on_error;
-				}
-				/* Note that here we should have room for the segment string and
-				 * one additional character
-				 */
-				if( current_directory_string_segment_size > ( safe_full_path_size - full_path_index ) )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid current working directory string segment: %d size value out of bounds.",
-					 function,
-					 current_directory_segment_index );
-
-					goto on_error;
-				}
-				path_string_segment_length = current_directory_string_segment_size - 1;
-
-				if( narrow_string_copy(
-				     &( safe_full_path[ full_path_index ] ),
-				     current_directory_string_segment,
-				     path_string_segment_length ) == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set current working directory split value: %d in full path.",
-					 function,
-					 current_directory_segment_index );
-
-					goto on_error;
-				}
-				full_path_index += path_string_segment_length;
-
-				safe_full_path[ full_path_index++ ] = LIBCPATH_SEPARATOR;
-			}
+			path_type = LIBCPATH_TYPE_ABSOLUTE;
 		}
-	}
-	if( path_split_string != NULL )
-	{
-		for( path_segment_index = 0;
-		     path_segment_index < path_number_of_segments;
-		     path_segment_index++ )
+#if defined( __MINGW32__ )
+		/* The full path is prefixed with a drive letter, a colon and a directory separator
+		 */
+		if( path_index == 2 )
 		{
-			if( libcsplit_narrow_split_string_get_segment_by_index(
-			     path_split_string,
-			     path_segment_index,
-			     &path_string_segment,
-			     &path_string_segment_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve path string segment: %d.",
-				 function,
-				 path_segment_index );
-
-				goto on_error;
-			}
-			if( path_string_segment_size != 0 )
-			{
-				if( path_string_segment == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing path string segment: %d.",
-					 function,
-					 path_segment_index );
-
-					goto on_error;
-				}
-				/* Note that here we should have room for the segment string and
-				 * one additional character
-				 */
-				if( path_string_segment_size > ( safe_full_path_size - full_path_index ) )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid current path string segment: %d size value out of bounds.",
-					 function,
-					 path_segment_index );
-
-					goto on_error;
-				}
-				path_string_segment_length = path_string_segment_size - 1;
-
-				if( narrow_string_copy(
-				     &( safe_full_path[ full_path_index ] ),
-				     path_string_segment,
-				     path_string_segment_length ) == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set path split value: %d in full path.",
-					 function,
-					 path_segment_index );
-
-					goto on_error;
-				}
-				full_path_index += path_string_segment_length;
-
-				safe_full_path[ full_path_index++ ] = LIBCPATH_SEPARATOR;
-			}
+			full_path_prefix[ full_path_prefix_length++ ] = path[ 0 ];
 		}
-	}
-	safe_full_path[ full_path_index - 1 ] = 0;
-
-	if( path_split_string != NULL )
-	{
-		if( libcsplit_narrow_split_string_free(
-		     &path_split_string,
-		     error ) != 1 )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free path split string.",
-			 function );
+			full_path_prefix[ full_path_prefix_length++ ] = working_directory[ 0 ];
+		}
+		full_path_prefix[ full_path_prefix_length++ ] = (wchar_t) ':';
+#endif
+		/* The full path is prefixed with a directory separator
+		 */
+		full_path_prefix[ full_path_prefix_length++ ] = (wchar_t) LIBCPATH_SEPARATOR;
 
-			goto on_error;
+		/* If the path is relative
+		 * the current working directory segments are added
+		 */
+		if( path_type == LIBCPATH_TYPE_RELATIVE )
+		{
+			result = libcpath_path_resolve_full_path_wide(
+			          full_path_prefix,
+			          full_path_prefix_length,
+			          &( working_directory[ current_directory_index ] ),
+			          current_directory_length,
+			          &( path[ path_index ] ),
+			          path_length - path_index,
+			          &( safe_full_paths[ full_paths_offset ] ),
+			          safe_full_paths_size - full_paths_offset,
+			          &full_path_size,
+			          error );
 		}
-	}
-	if( current_directory_split_string != NULL )
-	{
-		if( libcsplit_narrow_split_string_free(
-		     &current_directory_split_string,
-		     error ) != 1 )
+		else
+		{
+			result = libcpath_path_resolve_full_path_wide(
+			          full_path_prefix,
+			          full_path_prefix_length,
+			          NULL,
+			          0,
+			          &( path[ path_index ] ),
+			          path_length - path_index,
+			          &( safe_full_paths[ full_paths_offset ] ),
+			          safe_full_paths_size - full_paths_offset,
+			          &full_path_size,
+			          error );
+		}
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free current working directory split string.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to resolve full path: %d.",
+			 function,
+			 path_number );
 
 			goto on_error;
 		}
+		safe_full_path_offsets[ path_number ] = full_paths_offset;
+
+		full_paths_offset += full_path_size;
 	}
 	if( current_directory != NULL )
 	{
 		memory_free(
 		 current_directory );
 	}
-	*full_path      = safe_full_path;
-	*full_path_size = safe_full_path_size;
+	*full_paths        = safe_full_paths;
+	*full_paths_size   = full_paths_offset;
+	*full_path_offsets = safe_full_path_offsets;
 
 	return( 1 );
 
 on_error:
-	if( safe_full_path != NULL )
+	if( safe_full_paths != NULL )
 	{
 		memory_free(
-		 safe_full_path );
+		 safe_full_paths );
 	}
-	if( path_split_string != NULL )
+	if( safe_full_path_offsets != NULL )
 	{
-		libcsplit_narrow_split_string_free(
-		 &path_split_string,
-		 NULL );
-	}
-	if( current_directory_split_string != NULL )
-	{
-		libcsplit_narrow_split_string_free(
-		 &current_directory_split_string,
-		 NULL );
+		memory_free(
+		 safe_full_path_offsets );
 	}
 	if( current_directory != NULL )
 	{
@@ -2794,393 +11289,796 @@ on_error:
 
 #endif /* defined( WINAPI ) */
 
-/* Retrieves the size of a sanitized version of the path character
- * Returns 1 if successful or -1 on error
+/* Retrieves the first segment of a path
+ * The segment is a view into the path, it is not copied and not terminated
+ * by an end-of-string character
+ *
+ * The path index is set to the start of the next segment, so that the
+ * remaining segments can be retrieved with libcpath_path_get_next_segment_wide
+ *
+ * Returns 1 if successful, 0 if the path has no (remaining) segments or -1 on error
  */
-int libcpath_path_get_sanitized_character_size(
-     char character,
-     size_t *sanitized_character_size,
+int libcpath_path_get_first_segment_wide(
+     const wchar_t *path,
+     size_t path_length,
+     size_t *path_index,
+     const wchar_t **segment,
+     size_t *segment_length,
+     uint8_t flags,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_path_get_sanitized_character_size";
+	static char *function = "libcpath_path_get_first_segment_wide";
+	int result            = 0;
 
-	if( sanitized_character_size == NULL )
+	if( path_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized character size.",
+		 "%s: invalid path index.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( character >= 0x00 )
-	 && ( character <= 0x1f ) )
+	*path_index = 0;
+
+	result = libcpath_path_get_next_segment_wide(
+	          path,
+	          path_length,
+	          path_index,
+	          segment,
+	          segment_length,
+	          flags,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first segment.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the next segment of a path
+ * The segments are separated by the directory separator, where a path without
+ * directory separators consists of a single segment. Empty segments, such as
+ * those of successive directory separators, and "." (current directory)
+ * segments are skipped if the corresponding segment flags are set.
+ *
+ * The segment is a view into the path, it is not copied and not terminated
+ * by an end-of-string character, hence no memory is allocated
+ *
+ * The path index contains the start of the segment to retrieve and is set to
+ * the start of the next segment, or beyond the end of the path after the last
+ * segment
+ *
+ * Returns 1 if successful, 0 if the path has no (remaining) segments or -1 on error
+ */
+int libcpath_path_get_next_segment_wide(
+     const wchar_t *path,
+     size_t path_length,
+     size_t *path_index,
+     const wchar_t **segment,
+     size_t *segment_length,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function      = "libcpath_path_get_next_segment_wide";
+	size_t safe_path_index     = 0;
+	size_t safe_segment_length = 0;
+	size_t segment_start_index = 0;
+
+	if( path == NULL )
 	{
-		*sanitized_character_size = 4;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
 	}
-	else if( character == LIBCPATH_ESCAPE_CHARACTER )
+	if( path_length > (size_t) ( SSIZE_MAX - 1 ) )
 	{
-		*sanitized_character_size = 2;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
 	}
-#if defined( WINAPI )
-	else if( character == '/' )
+	if( path_index == NULL )
 	{
-		*sanitized_character_size = 4;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path index.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-	else if( ( character == '!' )
-	      || ( character == '$' )
-	      || ( character == '%' )
-	      || ( character == '&' )
-	      || ( character == '*' )
-	      || ( character == '+' )
-	      || ( character == ':' )
-	      || ( character == ';' )
-	      || ( character == '<' )
-	      || ( character == '>' )
-	      || ( character == '?' )
-	      || ( character == '|' )
-	      || ( character == 0x7f ) )
-	{
-		*sanitized_character_size = 4;
+	if( segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	if( segment_length == NULL )
 	{
-		*sanitized_character_size = 1;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment length.",
+		 function );
+
+		return( -1 );
 	}
-	return( 1 );
+	if( ( flags & ~( LIBCPATH_SEGMENT_FLAG_SKIP_EMPTY | LIBCPATH_SEGMENT_FLAG_SKIP_CURRENT ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags.",
+		 function );
+
+		return( -1 );
+	}
+	safe_path_index = *path_index;
+
+	while( safe_path_index <= path_length )
+	{
+		segment_start_index = safe_path_index;
+
+		while( ( safe_path_index < path_length )
+		    && ( path[ safe_path_index ] != (wchar_t) LIBCPATH_SEPARATOR ) )
+		{
+			safe_path_index++;
+		}
+		safe_segment_length = safe_path_index - segment_start_index;
+
+		/* Skip the directory separator, after the last segment this moves
+		 * the path index beyond the end of the path
+		 */
+		safe_path_index++;
+
+		if( ( ( flags & LIBCPATH_SEGMENT_FLAG_SKIP_EMPTY ) != 0 )
+		 && ( safe_segment_length == 0 ) )
+		{
+			continue;
+		}
+		if( ( ( flags & LIBCPATH_SEGMENT_FLAG_SKIP_CURRENT ) != 0 )
+		 && ( safe_segment_length == 1 )
+		 && ( path[ segment_start_index ] == (wchar_t) '.' ) )
+		{
+			continue;
+		}
+		*path_index     = safe_path_index;
+		*segment        = &( path[ segment_start_index ] );
+		*segment_length = safe_segment_length;
+
+		return( 1 );
+	}
+	*path_index = safe_path_index;
+
+	return( 0 );
 }
 
-/* Retrieves a sanitized version of the path character
+/* Appends the normalized segments of a path to a full path
+ * Empty segments, such as those of successive directory separators, and
+ * "." (current directory) segments are ignored. A ".." (parent directory)
+ * segment removes the last segment from the full path, but never the prefix.
+ * If the full path is relative, i.e. the prefix does not end with a directory
+ * separator, a ".." segment that cannot be applied is retained.
+ *
+ * Every segment is appended with a trailing directory separator, so that the
+ * full path itself is used as the stack of segments and no split strings
+ * need to be allocated.
+ *
+ * The full path index contains the index of the end of the full path
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_get_sanitized_character(
-     char character,
-     size_t sanitized_character_size,
-     char *sanitized_path,
-     size_t sanitized_path_size,
-     size_t *sanitized_path_index,
+int libcpath_path_append_normalized_segments_wide(
+     wchar_t *full_path,
+     size_t full_path_size,
+     size_t full_path_prefix_length,
+     size_t *full_path_index,
+     const wchar_t *path,
+     size_t path_length,
      libcerror_error_t **error )
 {
-	static char *function            = "libcpath_path_get_sanitized_character";
-	size_t safe_sanitized_path_index = 0;
-	char lower_nibble                = 0;
-	char upper_nibble                = 0;
+	static char *function       = "libcpath_path_append_normalized_segments_wide";
+	const wchar_t *segment      = NULL;
+	size_t path_index           = 0;
+	size_t safe_full_path_index = 0;
+	size_t segment_length       = 0;
+	int last_segment_is_parent  = 0;
+	int result                  = 0;
 
-	if( ( sanitized_character_size != 1 )
-	 && ( sanitized_character_size != 2 )
-	 && ( sanitized_character_size != 4 ) )
+	if( full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid full path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_prefix_length > full_path_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid sanitized character size value out of bounds.",
+		 "%s: invalid full path prefix length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path index.",
+		 function );
+
+		return( -1 );
+	}
+	safe_full_path_index = *full_path_index;
+
+	if( ( safe_full_path_index < full_path_prefix_length )
+	 || ( safe_full_path_index > full_path_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid full path index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
 		 function );
 
-		return( -1 );
+		return( -1 );
+	}
+	/* Empty segments, such as those of successive directory separators, and
+	 * "." (current directory) segments are skipped by the segment iterator
+	 */
+	while( path_index <= path_length )
+	{
+		result = libcpath_path_get_next_segment_wide(
+		          path,
+		          path_length,
+		          &path_index,
+		          &segment,
+		          &segment_length,
+		          LIBCPATH_SEGMENT_FLAG_SKIP_EMPTY | LIBCPATH_SEGMENT_FLAG_SKIP_CURRENT,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path segment.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		/* If the segment is ".." (parent) remove the last segment and its directory separator
+		 */
+		if( ( segment_length == 2 )
+		 && ( segment[ 0 ] == (wchar_t) '.' )
+		 && ( segment[ 1 ] == (wchar_t) '.' ) )
+		{
+			/* The last segment cannot be removed if it is ".." (parent) itself
+			 */
+			if( ( safe_full_path_index >= ( full_path_prefix_length + 3 ) )
+			 && ( full_path[ safe_full_path_index - 3 ] == (wchar_t) '.' )
+			 && ( full_path[ safe_full_path_index - 2 ] == (wchar_t) '.' )
+			 && ( ( safe_full_path_index == ( full_path_prefix_length + 3 ) )
+			  ||  ( full_path[ safe_full_path_index - 4 ] == (wchar_t) LIBCPATH_SEPARATOR ) ) )
+			{
+				last_segment_is_parent = 1;
+			}
+			else
+			{
+				last_segment_is_parent = 0;
+			}
+			if( ( safe_full_path_index > full_path_prefix_length )
+			 && ( last_segment_is_parent == 0 ) )
+			{
+				safe_full_path_index--;
+
+				while( ( safe_full_path_index > full_path_prefix_length )
+				    && ( full_path[ safe_full_path_index - 1 ] != (wchar_t) LIBCPATH_SEPARATOR ) )
+				{
+					safe_full_path_index--;
+				}
+				continue;
+			}
+			/* An absolute full path has no parent beyond its prefix
+			 */
+			if( ( full_path_prefix_length > 0 )
+			 && ( full_path[ full_path_prefix_length - 1 ] == (wchar_t) LIBCPATH_SEPARATOR ) )
+			{
+				continue;
+			}
+		}
+		/* Note that here we should have room for the segment and a directory separator
+		 */
+		if( segment_length >= ( full_path_size - safe_full_path_index ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid full path size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( wide_string_copy(
+		     &( full_path[ safe_full_path_index ] ),
+		     segment,
+		     segment_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy path segment to full path.",
+			 function );
+
+			return( -1 );
+		}
+		safe_full_path_index += segment_length;
+
+		full_path[ safe_full_path_index++ ] = (wchar_t) LIBCPATH_SEPARATOR;
 	}
-	if( sanitized_path == NULL )
+	*full_path_index = safe_full_path_index;
+
+	return( 1 );
+}
+
+/* Determines the length of the normalized segments of a path
+ * The path is scanned from the end, so that the ".." (parent directory)
+ * segments can be applied without storing the segments.
+ *
+ * The number of parent segments contains the number of ".." segments that
+ * were not applied and must be applied to segments preceding the path.
+ * The segments length is increased with the length of every remaining
+ * segment and a directory separator.
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_normalized_segments_length_wide(
+     const wchar_t *path,
+     size_t path_length,
+     size_t *number_of_parent_segments,
+     size_t *segments_length,
+     libcerror_error_t **error )
+{
+	static char *function                 = "libcpath_path_get_normalized_segments_length_wide";
+	size_t path_index                     = 0;
+	size_t safe_number_of_parent_segments = 0;
+	size_t safe_segments_length           = 0;
+	size_t segment_end_index              = 0;
+	size_t segment_length                 = 0;
+
+	if( path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized path.",
+		 "%s: invalid path.",
 		 function );
 
 		return( -1 );
 	}
-	if( sanitized_path_size > (size_t) SSIZE_MAX )
+	if( path_length > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid sanitized path size value exceeds maximum.",
+		 "%s: invalid path length value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( sanitized_path_index == NULL )
+	if( number_of_parent_segments == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized path index.",
+		 "%s: invalid number of parent segments.",
 		 function );
 
 		return( -1 );
 	}
-	safe_sanitized_path_index = *sanitized_path_index;
-
-	if( safe_sanitized_path_index > sanitized_path_size )
+	if( segments_length == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid sanitized path index value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segments length.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( sanitized_character_size > sanitized_path_size )
-	 || ( safe_sanitized_path_index > ( sanitized_path_size - sanitized_character_size ) ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid sanitized path size value too small.",
-		 function );
+	safe_number_of_parent_segments = *number_of_parent_segments;
+	safe_segments_length           = *segments_length;
 
-		return( -1 );
-	}
-	if( sanitized_character_size == 1 )
-	{
-		sanitized_path[ safe_sanitized_path_index++ ] = character;
-	}
-	else if( sanitized_character_size == 2 )
-	{
-		sanitized_path[ safe_sanitized_path_index++ ] = LIBCPATH_ESCAPE_CHARACTER;
-		sanitized_path[ safe_sanitized_path_index++ ] = LIBCPATH_ESCAPE_CHARACTER;
-	}
-	else if( sanitized_character_size == 4 )
+	path_index = path_length;
+
+	while( path_index > 0 )
 	{
-		lower_nibble = character & 0x0f;
-		upper_nibble = ( character >> 4 ) & 0x0f;
+		segment_end_index = path_index;
 
-		if( lower_nibble > 10 )
+		while( ( path_index > 0 )
+		    && ( path[ path_index - 1 ] != (wchar_t) LIBCPATH_SEPARATOR ) )
 		{
-			lower_nibble += 'a' - 10;
+			path_index--;
 		}
-		else
+		segment_length = segment_end_index - path_index;
+
+		/* If the segment is "" (empty) or "." (current) ignore it
+		 */
+		if( ( segment_length == 0 )
+		 || ( ( segment_length == 1 )
+		  &&  ( path[ path_index ] == (wchar_t) '.' ) ) )
 		{
-			lower_nibble += '0';
 		}
-		if( upper_nibble > 10 )
+		/* If the segment is ".." (parent) skip the preceding segment
+		 */
+		else if( ( segment_length == 2 )
+		      && ( path[ path_index ] == (wchar_t) '.' )
+		      && ( path[ path_index + 1 ] == (wchar_t) '.' ) )
 		{
-			upper_nibble += 'a' - 10;
+			safe_number_of_parent_segments++;
+		}
+		else if( safe_number_of_parent_segments > 0 )
+		{
+			safe_number_of_parent_segments--;
 		}
 		else
 		{
-			upper_nibble += '0';
+			safe_segments_length += segment_length + 1;
+		}
+		/* Skip the directory separator
+		 */
+		if( path_index > 0 )
+		{
+			path_index--;
 		}
-		sanitized_path[ safe_sanitized_path_index++ ] = LIBCPATH_ESCAPE_CHARACTER;
-		sanitized_path[ safe_sanitized_path_index++ ] = 'x';
-		sanitized_path[ safe_sanitized_path_index++ ] = upper_nibble;
-		sanitized_path[ safe_sanitized_path_index++ ] = lower_nibble;
 	}
-	*sanitized_path_index = safe_sanitized_path_index;
+	*number_of_parent_segments = safe_number_of_parent_segments;
+	*segments_length           = safe_segments_length;
 
 	return( 1 );
 }
 
-/* Retrieves a sanitized version of the filename
+/* Prepends the normalized segments of a path to a full path
+ * This is the reverse of libcpath_path_append_normalized_segments, the path
+ * is scanned from the end and the segments are written in front of the
+ * full path index, with a trailing directory separator.
+ *
+ * The number of parent segments contains the number of ".." segments that
+ * were not applied and must be applied to segments preceding the path.
+ *
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_get_sanitized_filename(
-     const char *filename,
-     size_t filename_length,
-     char **sanitized_filename,
-     size_t *sanitized_filename_size,
+int libcpath_path_prepend_normalized_segments_wide(
+     wchar_t *full_path,
+     size_t full_path_size,
+     size_t full_path_prefix_length,
+     size_t *full_path_index,
+     const wchar_t *path,
+     size_t path_length,
+     size_t *number_of_parent_segments,
      libcerror_error_t **error )
 {
-	static char *function               = "libcpath_path_get_sanitized_filename";
-	char *safe_sanitized_filename       = NULL;
-	size_t filename_index               = 0;
-	size_t sanitized_character_size     = 0;
-	size_t safe_sanitized_filename_size = 0;
-	size_t sanitized_filename_index     = 0;
+	static char *function                 = "libcpath_path_prepend_normalized_segments_wide";
+	size_t path_index                     = 0;
+	size_t safe_full_path_index           = 0;
+	size_t safe_number_of_parent_segments = 0;
+	size_t segment_end_index              = 0;
+	size_t segment_length                 = 0;
 
-	if( filename == NULL )
+	if( full_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 "%s: invalid full path.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( filename_length == 0 )
-	 || ( filename_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	if( full_path_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid filename length value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid full path size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( sanitized_filename == NULL )
+	if( full_path_prefix_length > full_path_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized filename.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid full path prefix length value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( *sanitized_filename != NULL )
+	if( full_path_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid sanitized filename value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path index.",
 		 function );
 
 		return( -1 );
 	}
-	if( sanitized_filename_size == NULL )
+	safe_full_path_index = *full_path_index;
+
+	if( ( safe_full_path_index < full_path_prefix_length )
+	 || ( safe_full_path_index > full_path_size ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized filename size.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid full path index value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	safe_sanitized_filename_size = 1;
-
-	for( filename_index = 0;
-	     filename_index < filename_length;
-	     filename_index++ )
+	if( path == NULL )
 	{
-		if( filename[ filename_index ] == LIBCPATH_SEPARATOR )
-		{
-			sanitized_character_size = 4;
-		}
-		else if( libcpath_path_get_sanitized_character_size(
-		          filename[ filename_index ],
-		          &sanitized_character_size,
-		          error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sanitize character size.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
 
-			goto on_error;
-		}
-		safe_sanitized_filename_size += sanitized_character_size;
+		return( -1 );
 	}
-	if( safe_sanitized_filename_size > (size_t) SSIZE_MAX )
+	if( path_length > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid sanitized filename size value exceeds maximum.",
+		 "%s: invalid path length value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	safe_sanitized_filename = narrow_string_allocate(
-	                           safe_sanitized_filename_size );
-
-	if( safe_sanitized_filename == NULL )
+	if( number_of_parent_segments == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create sanitized filename.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of parent segments.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	for( filename_index = 0;
-	     filename_index < filename_length;
-	     filename_index++ )
+	safe_number_of_parent_segments = *number_of_parent_segments;
+
+	path_index = path_length;
+
+	while( path_index > 0 )
 	{
-		if( filename[ filename_index ] == LIBCPATH_SEPARATOR )
+		segment_end_index = path_index;
+
+		while( ( path_index > 0 )
+		    && ( path[ path_index - 1 ] != (wchar_t) LIBCPATH_SEPARATOR ) )
 		{
-			sanitized_character_size = 4;
+			path_index--;
 		}
-		else if( libcpath_path_get_sanitized_character_size(
-		          filename[ filename_index ],
-		          &sanitized_character_size,
-		          error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sanitize character size.",
-			 function );
+		segment_length = segment_end_index - path_index;
 
-			goto on_error;
+		/* If the segment is "" (empty) or "." (current) ignore it
+		 */
+		if( ( segment_length == 0 )
+		 || ( ( segment_length == 1 )
+		  &&  ( path[ path_index ] == (wchar_t) '.' ) ) )
+		{
 		}
-		if( libcpath_path_get_sanitized_character(
-		     filename[ filename_index ],
-		     sanitized_character_size,
-		     safe_sanitized_filename,
-		     safe_sanitized_filename_size,
-		     &sanitized_filename_index,
-		     error ) != 1 )
+		/* If the segment is ".." (parent) skip the preceding segment
+		 */
+		else if( ( segment_length == 2 )
+		      && ( path[ path_index ] == (wchar_t) '.' )
+		      && ( path[ path_index + 1 ] == (wchar_t) '.' ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sanitize character size.",
-			 function );
-
-			goto on_error;
+			safe_number_of_parent_segments++;
 		}
-	}
-	safe_sanitized_filename[ sanitized_filename_index ] = 0;
+		else if( safe_number_of_parent_segments > 0 )
+		{
+			safe_number_of_parent_segments--;
+		}
+		else
+		{
+			/* Note that here we should have room for the segment and a directory separator
+			 */
+			if( segment_length >= ( safe_full_path_index - full_path_prefix_length ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid full path size value too small.",
+				 function );
 
-	*sanitized_filename      = safe_sanitized_filename;
-	*sanitized_filename_size = safe_sanitized_filename_size;
+				return( -1 );
+			}
+			safe_full_path_index -= segment_length + 1;
 
-	return( 1 );
+			if( wide_string_copy(
+			     &( full_path[ safe_full_path_index ] ),
+			     &( path[ path_index ] ),
+			     segment_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy path segment to full path.",
+				 function );
 
-on_error:
-	if( safe_sanitized_filename != NULL )
-	{
-		memory_free(
-		 safe_sanitized_filename );
+				return( -1 );
+			}
+			full_path[ safe_full_path_index + segment_length ] = (wchar_t) LIBCPATH_SEPARATOR;
+		}
+		/* Skip the directory separator
+		 */
+		if( path_index > 0 )
+		{
+			path_index--;
+		}
 	}
-	return( -1 );
+	*full_path_index           = safe_full_path_index;
+	*number_of_parent_segments = safe_number_of_parent_segments;
+
+	return( 1 );
 }
 
-/* Retrieves a sanitized version of the path
- * Returns 1 if successful or -1 on error
+/* Resolves a path relative to a base directory into a full path
+ * The base directory is optional and must be a full path without its prefix.
+ *
+ * If the full path is large enough to contain the prefix, the base directory,
+ * the path and a directory separator for both, the segments are normalized
+ * in a single forward scan. Otherwise the exact size is determined first and
+ * the segments are written from the end of the full path, so that the full
+ * path is never larger than the result.
+ *
+ * Returns 1 if successful, 0 if the full path is too small or -1 on error
  */
-int libcpath_path_get_sanitized_path(
-     const char *path,
+int libcpath_path_resolve_full_path_wide(
+     const wchar_t *full_path_prefix,
+     size_t full_path_prefix_length,
+     const wchar_t *base_directory,
+     size_t base_directory_length,
+     const wchar_t *path,
      size_t path_length,
-     char **sanitized_path,
-     size_t *sanitized_path_size,
+     wchar_t *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
      libcerror_error_t **error )
 {
-	static char *function                    = "libcpath_path_get_sanitized_path";
-	char *safe_sanitized_path                = NULL;
-	size_t path_index                        = 0;
-	size_t safe_sanitized_path_size          = 0;
-	size_t sanitized_character_size          = 0;
-	size_t sanitized_path_index              = 0;
+	static char *function            = "libcpath_path_resolve_full_path_wide";
+	size_t full_path_index           = 0;
+	size_t maximum_full_path_size    = 0;
+	size_t number_of_parent_segments = 0;
+	size_t safe_full_path_size       = 0;
+	size_t segments_length           = 0;
 
-#if defined( WINAPI )
-	size_t last_path_segment_seperator_index = 0;
-#endif
+	if( full_path_prefix == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path prefix.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_prefix_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid full path prefix length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_directory_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid base directory length value exceeds maximum.",
+		 function );
 
+		return( -1 );
+	}
 	if( path == NULL )
 	{
 		libcerror_error_set(
@@ -3192,1155 +12090,1059 @@ int libcpath_path_get_sanitized_path(
 
 		return( -1 );
 	}
-	if( ( path_length == 0 )
-	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	if( path_length > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid path length value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( sanitized_path == NULL )
+	if( full_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized path.",
+		 "%s: invalid full path.",
 		 function );
 
 		return( -1 );
 	}
-	if( *sanitized_path != NULL )
+	if( full_path_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid sanitized path value already set.",
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid full path size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( sanitized_path_size == NULL )
+	if( required_full_path_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized path size.",
+		 "%s: invalid required full path size.",
 		 function );
 
 		return( -1 );
 	}
-	safe_sanitized_path_size = 1;
+	/* Every segment is stored with a trailing directory separator, hence the full path
+	 * never needs more than the length of the inputs, a directory separator per input
+	 * and the prefix
+	 */
+	maximum_full_path_size = full_path_prefix_length + path_length + 1;
 
-	for( path_index = 0;
-	     path_index < path_length;
-	     path_index++ )
+	if( base_directory != NULL )
 	{
-		if( libcpath_path_get_sanitized_character_size(
-		     path[ path_index ],
-		     &sanitized_character_size,
-		     error ) != 1 )
+		maximum_full_path_size += base_directory_length + 1;
+	}
+	if( full_path_size >= maximum_full_path_size )
+	{
+		if( wide_string_copy(
+		     full_path,
+		     full_path_prefix,
+		     full_path_prefix_length ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sanitize character size.",
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy prefix to full path.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		safe_sanitized_path_size += sanitized_character_size;
+		full_path_index = full_path_prefix_length;
 
-#if defined( WINAPI )
-		if( path[ path_index ] == LIBCPATH_SEPARATOR )
+		if( base_directory != NULL )
+		{
+			if( libcpath_path_append_normalized_segments_wide(
+			     full_path,
+			     full_path_size,
+			     full_path_prefix_length,
+			     &full_path_index,
+			     base_directory,
+			     base_directory_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append base directory segments to full path.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libcpath_path_append_normalized_segments_wide(
+		     full_path,
+		     full_path_size,
+		     full_path_prefix_length,
+		     &full_path_index,
+		     path,
+		     path_length,
+		     error ) != 1 )
 		{
-			last_path_segment_seperator_index = path_index;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append path segments to full path.",
+			 function );
+
+			return( -1 );
 		}
-#endif
+		/* Remove the directory separator of the last segment
+		 */
+		if( full_path_index > full_path_prefix_length )
+		{
+			full_path_index--;
+		}
+		full_path[ full_path_index ] = 0;
+
+		*required_full_path_size = full_path_index + 1;
+
+		return( 1 );
 	}
-	if( safe_sanitized_path_size > (size_t) SSIZE_MAX )
+	if( libcpath_path_get_normalized_segments_length_wide(
+	     path,
+	     path_length,
+	     &number_of_parent_segments,
+	     &segments_length,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid sanitized path size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine path segments length.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( WINAPI )
-	if( last_path_segment_seperator_index > 32767 )
+	if( base_directory != NULL )
+	{
+		if( libcpath_path_get_normalized_segments_length_wide(
+		     base_directory,
+		     base_directory_length,
+		     &number_of_parent_segments,
+		     &segments_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine base directory segments length.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The directory separator of the last segment is replaced by the end of string character
+	 */
+	if( segments_length == 0 )
+	{
+		safe_full_path_size = full_path_prefix_length + 1;
+	}
+	else
+	{
+		safe_full_path_size = full_path_prefix_length + segments_length;
+	}
+	*required_full_path_size = safe_full_path_size;
+
+	if( safe_full_path_size > full_path_size )
+	{
+		return( 0 );
+	}
+	if( wide_string_copy(
+	     full_path,
+	     full_path_prefix,
+	     full_path_prefix_length ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid last path segment separator value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy prefix to full path.",
 		 function );
 
-		goto on_error;
-	}
-	if( safe_sanitized_path_size > 32767 )
-	{
-		safe_sanitized_path_size = 32767;
+		return( -1 );
 	}
-#endif
-	safe_sanitized_path = narrow_string_allocate(
-	                       safe_sanitized_path_size );
+	full_path_index           = full_path_prefix_length + segments_length;
+	number_of_parent_segments = 0;
 
-	if( safe_sanitized_path == NULL )
+	if( libcpath_path_prepend_normalized_segments_wide(
+	     full_path,
+	     full_path_size,
+	     full_path_prefix_length,
+	     &full_path_index,
+	     path,
+	     path_length,
+	     &number_of_parent_segments,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create sanitized path.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to prepend path segments to full path.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	for( path_index = 0;
-	     path_index < path_length;
-	     path_index++ )
+	if( base_directory != NULL )
 	{
-		if( libcpath_path_get_sanitized_character_size(
-		     path[ path_index ],
-		     &sanitized_character_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sanitize character size.",
-			 function );
-
-			goto on_error;
-		}
-		if( libcpath_path_get_sanitized_character(
-		     path[ path_index ],
-		     sanitized_character_size,
-		     safe_sanitized_path,
-		     safe_sanitized_path_size,
-		     &sanitized_path_index,
+		if( libcpath_path_prepend_normalized_segments_wide(
+		     full_path,
+		     full_path_size,
+		     full_path_prefix_length,
+		     &full_path_index,
+		     base_directory,
+		     base_directory_length,
+		     &number_of_parent_segments,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sanitize character size.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to prepend base directory segments to full path.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	if( sanitized_path_index >= safe_sanitized_path_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid sanitized path index value out of bounds.",
-		 function );
-
-		goto on_error;
-	}
-	safe_sanitized_path[ sanitized_path_index ] = 0;
-
-	*sanitized_path      = safe_sanitized_path;
-	*sanitized_path_size = safe_sanitized_path_size;
+	full_path[ safe_full_path_size - 1 ] = 0;
 
 	return( 1 );
-
-on_error:
-	if( safe_sanitized_path != NULL )
-	{
-		memory_free(
-		 safe_sanitized_path );
-	}
-	return( -1 );
 }
 
-/* Combines the directory name and filename into a path
+/* Retrieves the size of a sanitized version of the path character
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_join(
-     char **path,
-     size_t *path_size,
-     const char *directory_name,
-     size_t directory_name_length,
-     const char *filename,
-     size_t filename_length,
+int libcpath_path_get_sanitized_character_size_wide(
+     wchar_t character,
+     size_t *sanitized_character_size,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_path_join";
-	size_t filename_index = 0;
-	size_t path_index     = 0;
+	static char *function = "libcpath_path_get_sanitized_character_size_wide";
 
-	if( path == NULL )
+	if( sanitized_character_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path.",
+		 "%s: invalid sanitized character size.",
 		 function );
 
 		return( -1 );
 	}
-	if( *path != NULL )
+	if( ( character >= 0x00 )
+	 && ( character <= 0xff ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid path value already set.",
-		 function );
-
-		return( -1 );
+		*sanitized_character_size = libcpath_path_sanitized_character_sizes[ (uint8_t) character ];
 	}
-	if( path_size == NULL )
+	else
+	{
+		*sanitized_character_size = 1;
+	}
+	return( 1 );
+}
+
+/* Retrieves a sanitized version of the path character
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_sanitized_character_wide(
+     wchar_t character,
+     size_t sanitized_character_size,
+     wchar_t *sanitized_path,
+     size_t sanitized_path_size,
+     size_t *sanitized_path_index,
+     libcerror_error_t **error )
+{
+	static char *function            = "libcpath_path_get_sanitized_character_wide";
+	size_t safe_sanitized_path_index = 0;
+	wchar_t lower_nibble             = 0;
+	wchar_t upper_nibble             = 0;
+
+	if( ( sanitized_character_size != 1 )
+	 && ( sanitized_character_size != 2 )
+	 && ( sanitized_character_size != 4 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path size.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sanitized character size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( directory_name == NULL )
+	if( sanitized_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory name.",
+		 "%s: invalid sanitized path.",
 		 function );
 
 		return( -1 );
 	}
-	if( directory_name_length > (size_t) SSIZE_MAX )
+	if( sanitized_path_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid directory name length value exceeds maximum.",
+		 "%s: invalid sanitized path size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( filename == NULL )
+	if( sanitized_path_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
-		 function );
-
-		return( -1 );
-	}
-	if( filename_length > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid filename length value exceeds maximum.",
+		 "%s: invalid sanitized path index.",
 		 function );
 
 		return( -1 );
 	}
-/* TODO strip other patterns like /./ */
-	while( directory_name_length > 0 )
-	{
-		if( directory_name[ directory_name_length - 1 ] != (char) LIBCPATH_SEPARATOR )
-		{
-			break;
-		}
-		directory_name_length--;
-	}
-	while( filename_length > 0 )
-	{
-		if( filename[ filename_index ] != (char) LIBCPATH_SEPARATOR )
-		{
-			break;
-		}
-		filename_index++;
-		filename_length--;
-	}
-	*path_size = directory_name_length + filename_length + 2;
-
-	*path = narrow_string_allocate(
-	         *path_size );
-
-	if( *path == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create path.",
-		 function );
+	safe_sanitized_path_index = *sanitized_path_index;
 
-		goto on_error;
-	}
-	if( narrow_string_copy(
-	     *path,
-	     directory_name,
-	     directory_name_length ) == NULL )
+	if( safe_sanitized_path_index > sanitized_path_size )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy directory name to path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sanitized path index value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	path_index = directory_name_length;
-
-	( *path )[ path_index++ ] = (char) LIBCPATH_SEPARATOR;
-
-	if( narrow_string_copy(
-	     &( ( *path )[ path_index ] ),
-	     &( filename[ filename_index ] ),
-	     filename_length ) == NULL )
+	if( ( sanitized_character_size > sanitized_path_size )
+	 || ( safe_sanitized_path_index > ( sanitized_path_size - sanitized_character_size ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy filename to path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid sanitized path size value too small.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	path_index += filename_length;
-
-	( *path )[ path_index ] = 0;
-
-	return( 1 );
-
-on_error:
-	if( *path != NULL )
+	if( sanitized_character_size == 1 )
 	{
-		memory_free(
-		 *path );
-
-		*path = NULL;
+		sanitized_path[ safe_sanitized_path_index++ ] = character;
 	}
-	*path_size = 0;
-
-	return( -1 );
-}
-
-#if defined( WINAPI ) && ( WINVER <= 0x0500 )
-
-/* Cross Windows safe version of CreateDirectoryA
- * Returns TRUE if successful or FALSE on error
- */
-BOOL libcpath_CreateDirectoryA(
-      LPCSTR path,
-      SECURITY_ATTRIBUTES *security_attributes )
-{
-	FARPROC function       = NULL;
-	HMODULE library_handle = NULL;
-	BOOL result            = FALSE;
-
-	if( path == NULL )
+	else if( sanitized_character_size == 2 )
 	{
-		return( 0 );
+		sanitized_path[ safe_sanitized_path_index++ ] = (wchar_t) LIBCPATH_ESCAPE_CHARACTER;
+		sanitized_path[ safe_sanitized_path_index++ ] = (wchar_t) LIBCPATH_ESCAPE_CHARACTER;
 	}
-	library_handle = LoadLibrary(
-	                  _SYSTEM_STRING( "kernel32.dll" ) );
-
-	if( library_handle == NULL )
+	else if( sanitized_character_size == 4 )
 	{
-		return( 0 );
-	}
-	function = GetProcAddress(
-		    library_handle,
-		    (LPCSTR) "CreateDirectoryA" );
+		lower_nibble = character & 0x0f;
+		upper_nibble = ( character >> 4 ) & 0x0f;
 
-	if( function != NULL )
-	{
-		result = function(
-			  path,
-			  security_attributes );
+		if( lower_nibble > 10 )
+		{
+			lower_nibble += (wchar_t) 'a' - 10;
+		}
+		else
+		{
+			lower_nibble += '0';
+		}
+		if( upper_nibble > 10 )
+		{
+			upper_nibble += (wchar_t) 'a' - 10;
+		}
+		else
+		{
+			upper_nibble += '0';
+		}
+		sanitized_path[ safe_sanitized_path_index++ ] = (wchar_t) LIBCPATH_ESCAPE_CHARACTER;
+		sanitized_path[ safe_sanitized_path_index++ ] = (wchar_t) 'x';
+		sanitized_path[ safe_sanitized_path_index++ ] = upper_nibble;
+		sanitized_path[ safe_sanitized_path_index++ ] = lower_nibble;
 	}
-	/* This call should be after using the function
-	 * in most cases kernel32.dll will still be available after free
-	 */
-	if( FreeLibrary(
-	     library_handle ) != TRUE )
-	{
-		libcpath_CloseHandle(
-		 library_handle );
+	*sanitized_path_index = safe_sanitized_path_index;
 
-		return( 0 );
-	}
-	return( result );
+	return( 1 );
 }
 
-#endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
-
-#if defined( WINAPI )
-
-/* Makes the directory
- * This function uses the WINAPI function for Windows XP (0x0501) or later
- * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
+/* Retrieves a sanitized version of a string
+ * Every character up to 0xff is classified with a single lookup in the
+ * sanitized character sizes table, other characters are not escaped.
+ *
+ * If sanitized string is NULL only the required sanitized string size is
+ * determined, otherwise the sanitized string is written in the same pass.
+ * The required sanitized string size includes the end-of-string character.
+ *
+ * If escape separator is set the directory separator is escaped as well,
+ * which is used to sanitize filenames
+ *
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_make_directory(
-     const char *directory_name,
+int libcpath_path_get_sanitized_string_wide(
+     const wchar_t *string,
+     size_t string_length,
+     uint8_t escape_separator,
+     wchar_t *sanitized_string,
+     size_t sanitized_string_size,
+     size_t *required_sanitized_string_size,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_path_make_directory";
-	DWORD error_code      = 0;
+	static char *function             = "libcpath_path_get_sanitized_string_wide";
+	size_t safe_sanitized_string_size = 0;
+	size_t sanitized_character_size   = 0;
+	size_t sanitized_string_index     = 0;
+	size_t string_index               = 0;
+	wchar_t character                 = 0;
+	uint8_t byte_value                = 0;
 
-	if( directory_name == NULL )
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory name.",
+		 "%s: invalid string.",
 		 function );
 
 		return( -1 );
 	}
-#if WINVER <= 0x0500
-	if( libcpath_CreateDirectoryA(
-	     directory_name,
-	     NULL ) == 0 )
-#else
-	if( CreateDirectoryA(
-	     directory_name,
-	     NULL ) == 0 )
-#endif
+	if( string_length > (size_t) ( SSIZE_MAX - 1 ) )
 	{
-		error_code = GetLastError();
-
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 error_code,
-		 "%s: unable to make directory.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string length value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-#elif defined( HAVE_MKDIR )
-
-/* Makes the directory
- * This function uses the POSIX mkdir function or equivalent
- * Returns 1 if successful or -1 on error
- */
-int libcpath_path_make_directory(
-     const char *directory_name,
-     libcerror_error_t **error )
-{
-	static char *function = "libcpath_path_make_directory";
-
-	if( directory_name == NULL )
+	if( sanitized_string_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory name.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized string size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( __MINGW32__ ) || defined( _MSC_VER )
-	if( mkdir(
-	     directory_name ) != 0 )
-#else
-	if( mkdir(
-	     directory_name,
-	     0755 ) != 0 )
-#endif
+	if( required_sanitized_string_size == NULL )
 	{
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 errno,
-		 "%s: unable to make directory.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required sanitized string size.",
 		 function );
 
 		return( -1 );
 	}
+	if( sanitized_string == NULL )
+	{
+		safe_sanitized_string_size = 1;
 
-	return( 1 );
-}
-
-#else
-#error Missing make directory function
-#endif
-
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
+		for( string_index = 0;
+		     string_index < string_length;
+		     string_index++ )
+		{
+			character = string[ string_index ];
 
-#if defined( WINAPI ) && ( WINVER <= 0x0500 )
+			if( ( escape_separator != 0 )
+			 && ( character == (wchar_t) LIBCPATH_SEPARATOR ) )
+			{
+				safe_sanitized_string_size += 4;
+			}
+			else if( ( character >= 0x00 )
+			      && ( character <= 0xff ) )
+			{
+				byte_value = (uint8_t) character;
 
-/* Cross Windows safe version of SetCurrentDirectoryW
- * Returns TRUE if successful or FALSE on error
- */
-BOOL libcpath_SetCurrentDirectoryW(
-      LPCWSTR path )
-{
-	FARPROC function       = NULL;
-	HMODULE library_handle = NULL;
-	BOOL result            = FALSE;
+				safe_sanitized_string_size += libcpath_path_sanitized_character_sizes[ byte_value ];
+			}
+			else
+			{
+				safe_sanitized_string_size += 1;
+			}
+		}
+		*required_sanitized_string_size = safe_sanitized_string_size;
 
-	if( path == NULL )
-	{
-		return( FALSE );
+		return( 1 );
 	}
-	library_handle = LoadLibrary(
-	                  _SYSTEM_STRING( "kernel32.dll" ) );
-
-	if( library_handle == NULL )
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
 	{
-		return( FALSE );
-	}
-	function = GetProcAddress(
-		    library_handle,
-		    (LPCSTR) "SetCurrentDirectoryW" );
+		character  = string[ string_index ];
+		byte_value = (uint8_t) ( character & 0xff );
 
-	if( function != NULL )
-	{
-		result = function(
-			  path );
-	}
-	/* This call should be after using the function
-	 * in most cases kernel32.dll will still be available after free
-	 */
-	if( FreeLibrary(
-	     library_handle ) != TRUE )
+		if( ( escape_separator != 0 )
+		 && ( character == (wchar_t) LIBCPATH_SEPARATOR ) )
+		{
+			sanitized_character_size = 4;
+		}
+		else if( ( character >= 0x00 )
+		      && ( character <= 0xff ) )
+		{
+			sanitized_character_size = libcpath_path_sanitized_character_sizes[ byte_value ];
+		}
+		else
+		{
+			sanitized_character_size = 1;
+		}
+		if( sanitized_character_size > ( sanitized_string_size - sanitized_string_index ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid sanitized string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( sanitized_character_size == 1 )
+		{
+			sanitized_string[ sanitized_string_index++ ] = character;
+		}
+		else if( sanitized_character_size == 2 )
+		{
+			sanitized_string[ sanitized_string_index++ ] = (wchar_t) LIBCPATH_ESCAPE_CHARACTER;
+			sanitized_string[ sanitized_string_index++ ] = (wchar_t) LIBCPATH_ESCAPE_CHARACTER;
+		}
+		else
+		{
+			sanitized_string[ sanitized_string_index++ ] = (wchar_t) LIBCPATH_ESCAPE_CHARACTER;
+			sanitized_string[ sanitized_string_index++ ] = (wchar_t) 'x';
+			sanitized_string[ sanitized_string_index++ ] = (wchar_t) libcpath_path_sanitized_character_digits[ byte_value >> 4 ];
+			sanitized_string[ sanitized_string_index++ ] = (wchar_t) libcpath_path_sanitized_character_digits[ byte_value & 0x0f ];
+		}
+	}
+	if( sanitized_string_index >= sanitized_string_size )
 	{
-		libcpath_CloseHandle(
-		 library_handle );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sanitized string index value out of bounds.",
+		 function );
 
-		return( FALSE );
+		return( -1 );
 	}
-	return( result );
-}
+	sanitized_string[ sanitized_string_index++ ] = 0;
 
-#endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+	*required_sanitized_string_size = sanitized_string_index;
 
-#if defined( WINAPI )
+	return( 1 );
+}
 
-/* Changes the directory
- * This function uses the WINAPI function for Windows XP (0x0501) or later
- * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
+/* Retrieves a sanitized version of the filename
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_change_directory_wide(
-     const wchar_t *directory_name,
+int libcpath_internal_path_get_sanitized_filename_wide(
+     const wchar_t *filename,
+     size_t filename_length,
+     wchar_t **sanitized_filename,
+     size_t *sanitized_filename_size,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_path_change_directory_wide";
-	DWORD error_code      = 0;
+	static char *function               = "libcpath_path_get_sanitized_filename_wide";
+	wchar_t *safe_sanitized_filename    = NULL;
+	size_t safe_sanitized_filename_size = 0;
 
-	if( directory_name == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory name.",
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-#if WINVER <= 0x0500
-	if( libcpath_SetCurrentDirectoryW(
-	     directory_name ) == 0 )
-#else
-	if( SetCurrentDirectoryW(
-	     directory_name ) == 0 )
-#endif
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( SSIZE_MAX - 1 ) ) )
 	{
-		error_code = GetLastError();
-
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 error_code,
-		 "%s: unable to change directory.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-#elif defined( HAVE_CHDIR )
+	if( sanitized_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized filename.",
+		 function );
 
-/* Changes the directory
- * This function uses the POSIX chdir function or equivalent
- * Returns 1 if successful or -1 on error
- */
-int libcpath_path_change_directory_wide(
-     const wchar_t *directory_name,
-     libcerror_error_t **error )
-{
-	static char *function             = "libcpath_path_change_directory_wide";
-	char *narrow_directory_name       = 0;
-	size_t directory_name_length      = 0;
-	size_t narrow_directory_name_size = 0;
+		return( -1 );
+	}
+	if( *sanitized_filename != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sanitized filename value already set.",
+		 function );
 
-	if( directory_name == NULL )
+		return( -1 );
+	}
+	if( sanitized_filename_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory name.",
+		 "%s: invalid sanitized filename size.",
 		 function );
 
 		return( -1 );
 	}
-	directory_name_length = wide_string_length(
-	                         directory_name );
-
-	if( libcpath_system_string_size_from_wide_string(
-	     directory_name,
-	     directory_name_length + 1,
-	     &narrow_directory_name_size,
+	if( libcpath_path_get_sanitized_string_wide(
+	     filename,
+	     filename_length,
+	     1,
+	     NULL,
+	     0,
+	     &safe_sanitized_filename_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine narrow directory name size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine sanitized filename size.",
 		 function );
 
 		goto on_error;
 	}
-	if( ( narrow_directory_name_size > (size_t) SSIZE_MAX )
-	 || ( ( sizeof( char ) * narrow_directory_name_size )  > (size_t) SSIZE_MAX ) )
+	if( safe_sanitized_filename_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid narrow directory name size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized filename size value exceeds maximum.",
 		 function );
 
 		goto on_error;
 	}
-	narrow_directory_name = narrow_string_allocate(
-	                         narrow_directory_name_size );
+	safe_sanitized_filename = wide_string_allocate(
+	                           safe_sanitized_filename_size );
 
-	if( narrow_directory_name == NULL )
+	if( safe_sanitized_filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create narrow directory name.",
+		 "%s: unable to create sanitized filename.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcpath_system_string_copy_from_wide_string(
-	     narrow_directory_name,
-	     narrow_directory_name_size,
-	     directory_name,
-	     directory_name_length + 1,
+	if( libcpath_path_get_sanitized_string_wide(
+	     filename,
+	     filename_length,
+	     1,
+	     safe_sanitized_filename,
+	     safe_sanitized_filename_size,
+	     &safe_sanitized_filename_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to set name.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine sanitized filename.",
 		 function );
 
 		goto on_error;
 	}
-	if( chdir(
-	     narrow_directory_name ) != 0 )
-	{
-		libcerror_system_set_error(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 errno,
-		 "%s: unable to change directory.",
-		 function );
 
-		return( -1 );
-	}
-	memory_free(
-	 narrow_directory_name );
+	*sanitized_filename      = safe_sanitized_filename;
+	*sanitized_filename_size = safe_sanitized_filename_size;
 
 	return( 1 );
 
 on_error:
-	if( narrow_directory_name != NULL )
+	if( safe_sanitized_filename != NULL )
 	{
 		memory_free(
-		 narrow_directory_name );
+		 safe_sanitized_filename );
 	}
 	return( -1 );
 }
 
-#else
-#error Missing change directory function
-#endif
-
-#if defined( WINAPI ) && ( WINVER <= 0x0500 )
-
-/* Cross Windows safe version of GetCurrentDirectoryW
- * Returns the number of characters in the current directory string or 0 on error
- */
-DWORD libcpath_GetCurrentDirectoryW(
-       DWORD buffer_size,
-       LPCWSTR buffer )
-{
-	FARPROC function       = NULL;
-	HMODULE library_handle = NULL;
-	DWORD result           = 0;
-
-	library_handle = LoadLibrary(
-	                  _SYSTEM_STRING( "kernel32.dll" ) );
-
-	if( library_handle == NULL )
-	{
-		return( 0 );
-	}
-	function = GetProcAddress(
-		    library_handle,
-		    (LPCSTR) "GetCurrentDirectoryW" );
-
-	if( function != NULL )
-	{
-		result = function(
-			  buffer_size,
-			  buffer );
-	}
-	/* This call should be after using the function
-	 * in most cases kernel32.dll will still be available after free
-	 */
-	if( FreeLibrary(
-	     library_handle ) != TRUE )
-	{
-		libcpath_CloseHandle(
-		 library_handle );
-
-		return( 0 );
-	}
-	return( result );
-}
-
-#endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
-
-#if defined( WINAPI )
-
-/* Retrieves the current working directory
- * This function uses the WINAPI function for Windows XP (0x0501) or later
- * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
- * Returns 1 if successful or -1 on error
+/* Retrieves a sanitized version of the filename into a buffer
+ * This function does not allocate memory
+ *
+ * The required sanitized filename size is set to the size of the sanitized
+ * filename, including the end-of-string character, also when the sanitized
+ * filename is too small
+ *
+ * Returns 1 if successful, 0 if the sanitized filename is too small or -1 on error
  */
-int libcpath_path_get_current_working_directory_wide(
-     wchar_t **current_working_directory,
-     size_t *current_working_directory_size,
+int libcpath_internal_path_get_sanitized_filename_to_buffer_wide(
+     const wchar_t *filename,
+     size_t filename_length,
+     wchar_t *sanitized_filename,
+     size_t sanitized_filename_size,
+     size_t *required_sanitized_filename_size,
      libcerror_error_t **error )
 {
-	static char *function                     = "libcpath_path_get_current_working_directory_wide";
-	wchar_t *safe_current_working_directory   = NULL;
-	DWORD error_code                          = 0;
-	DWORD result                              = 0;
-	DWORD safe_current_working_directory_size = 0;
+	static char *function               = "libcpath_path_get_sanitized_filename_to_buffer_wide";
+	size_t safe_sanitized_filename_size = 0;
 
-	if( current_working_directory == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid current working directory.",
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( *current_working_directory != NULL )
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( SSIZE_MAX - 1 ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid current working directory value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( current_working_directory_size == NULL )
+	if( sanitized_filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid current working directory size.",
+		 "%s: invalid sanitized filename.",
 		 function );
 
 		return( -1 );
 	}
-#if WINVER <= 0x0500
-	safe_current_working_directory_size = libcpath_GetCurrentDirectoryW(
-	                                       0,
-	                                       NULL );
-#else
-	safe_current_working_directory_size = GetCurrentDirectoryW(
-	                                       0,
-	                                       NULL );
-#endif
-	if( safe_current_working_directory_size == 0 )
+	if( sanitized_filename_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve current working directory size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized filename size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( (size_t) safe_current_working_directory_size > (size_t) SSIZE_MAX )
+	if( required_sanitized_filename_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid current working directory size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required sanitized filename size.",
 		 function );
 
-		goto on_error;
-	}
-	safe_current_working_directory = wide_string_allocate(
-	                                  safe_current_working_directory_size );
-
-	if( safe_current_working_directory == NULL )
+		return( -1 );
+	}
+	if( libcpath_path_get_sanitized_string_wide(
+	     filename,
+	     filename_length,
+	     1,
+	     NULL,
+	     0,
+	     &safe_sanitized_filename_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create current working directory.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine sanitized filename size.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( memory_set(
-	     safe_current_working_directory,
-	     0,
-	     sizeof( wchar_t ) * safe_current_working_directory_size ) == NULL )
+	if( safe_sanitized_filename_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear current working directory.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized filename size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if WINVER <= 0x0500
-	result = libcpath_GetCurrentDirectoryW(
-	          safe_current_working_directory_size,
-	          safe_current_working_directory )
-#else
-	result = GetCurrentDirectoryW(
-	          safe_current_working_directory_size,
-	          safe_current_working_directory );
-#endif
-	/* Note that safe_current_working_directory_size can be larger than result
-	 */
-	if( ( result == 0 )
-	 || ( result > safe_current_working_directory_size ) )
-	{
-		error_code = GetLastError();
+	*required_sanitized_filename_size = safe_sanitized_filename_size;
 
-		libcerror_system_set_error(
+	if( safe_sanitized_filename_size > sanitized_filename_size )
+	{
+		return( 0 );
+	}
+	if( libcpath_path_get_sanitized_string_wide(
+	     filename,
+	     filename_length,
+	     1,
+	     sanitized_filename,
+	     sanitized_filename_size,
+	     &safe_sanitized_filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 error_code,
-		 "%s: unable to retrieve current working directory.",
+		 "%s: unable to determine sanitized filename.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	*current_working_directory      = safe_current_working_directory;
-	*current_working_directory_size = (size_t) safe_current_working_directory_size;
 
 	return( 1 );
-
-on_error:
-	if( safe_current_working_directory != NULL )
-	{
-		memory_free(
-		 safe_current_working_directory );
-	}
-	return( -1 );
 }
 
-#elif defined( HAVE_GETCWD )
-
-/* Retrieves the current working directory
- * This function uses the POSIX getcwd function or equivalent
+/* Retrieves a sanitized version of the path
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_get_current_working_directory_wide(
-     wchar_t **current_working_directory,
-     size_t *current_working_directory_size,
+int libcpath_internal_path_get_sanitized_path_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **sanitized_path,
+     size_t *sanitized_path_size,
      libcerror_error_t **error )
 {
-	static char *function                          = "libcpath_path_get_current_working_directory_wide";
-	wchar_t *safe_current_working_directory        = NULL;
-	char *narrow_current_working_directory         = 0;
-	size_t narrow_current_working_directory_length = 0;
-	size_t safe_current_working_directory_size     = 0;
+	static char *function                    = "libcpath_path_get_sanitized_path_wide";
+	wchar_t *safe_sanitized_path             = NULL;
+	size_t safe_sanitized_path_size          = 0;
 
-	if( current_working_directory == NULL )
+#if defined( WINAPI )
+	size_t last_path_segment_seperator_index = 0;
+	size_t path_index                        = 0;
+#endif
+
+	if( path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid current working directory.",
+		 "%s: invalid path.",
 		 function );
 
 		return( -1 );
 	}
-	if( *current_working_directory != NULL )
+	if( ( path_length == 0 )
+	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid current working directory value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( current_working_directory_size == NULL )
+	if( sanitized_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid current working directory size.",
+		 "%s: invalid sanitized path.",
 		 function );
 
 		return( -1 );
 	}
-	narrow_current_working_directory = narrow_string_allocate(
-	                                    PATH_MAX );
+	if( *sanitized_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sanitized path value already set.",
+		 function );
 
-	if( narrow_current_working_directory == NULL )
+		return( -1 );
+	}
+	if( sanitized_path_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create narrow current working directory.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sanitized path size.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( getcwd(
-	     narrow_current_working_directory,
-	     PATH_MAX ) == NULL )
+	if( libcpath_path_get_sanitized_string_wide(
+	     path,
+	     path_length,
+	     0,
+	     NULL,
+	     0,
+	     &safe_sanitized_path_size,
+	     error ) != 1 )
 	{
-		libcerror_system_set_error(
+		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 errno,
-		 "%s: unable to retrieve current working directory.",
+		 "%s: unable to determine sanitized path size.",
 		 function );
 
 		goto on_error;
 	}
-	narrow_current_working_directory_length = narrow_string_length(
-	                                           narrow_current_working_directory );
+#if defined( WINAPI )
+	for( path_index = path_length;
+	     path_index > 0;
+	     path_index-- )
+	{
+		if( path[ path_index - 1 ] == LIBCPATH_SEPARATOR )
+		{
+			last_path_segment_seperator_index = path_index - 1;
 
-	/* Convert the current working directory to a wide string
-	 * if the platform has no wide character open function
-	 */
-	if( libcpath_system_string_size_from_narrow_string(
-	     narrow_current_working_directory,
-	     narrow_current_working_directory_length + 1,
-	     &safe_current_working_directory_size,
-	     error ) != 1 )
+			break;
+		}
+	}
+#endif
+	if( safe_sanitized_path_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine wide character current working directory size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized path size value exceeds maximum.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	safe_current_working_directory = wide_string_allocate(
-	                                  safe_current_working_directory_size );
-
-	if( safe_current_working_directory == NULL )
+#if defined( WINAPI )
+	if( last_path_segment_seperator_index > 32767 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create current working directory.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid last path segment separator value out of bounds.",
 		 function );
 
 		goto on_error;
 	}
-	if( memory_set(
-	     safe_current_working_directory,
-	     0,
-	     sizeof( wchar_t ) * safe_current_working_directory_size ) == NULL )
+	if( safe_sanitized_path_size > 32767 )
+	{
+		safe_sanitized_path_size = 32767;
+	}
+#endif
+	safe_sanitized_path = wide_string_allocate(
+	                       safe_sanitized_path_size );
+
+	if( safe_sanitized_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear current working directory.",
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sanitized path.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcpath_system_string_copy_to_wide_string(
-	     narrow_current_working_directory,
-	     narrow_current_working_directory_length + 1,
-	     safe_current_working_directory,
-	     safe_current_working_directory_size,
+	if( libcpath_path_get_sanitized_string_wide(
+	     path,
+	     path_length,
+	     0,
+	     safe_sanitized_path,
+	     safe_sanitized_path_size,
+	     &safe_sanitized_path_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to set current working directory.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine sanitized path.",
 		 function );
 
 		goto on_error;
 	}
-	memory_free(
-	 narrow_current_working_directory );
 
-	*current_working_directory      = safe_current_working_directory;
-	*current_working_directory_size = safe_current_working_directory_size;
+	*sanitized_path      = safe_sanitized_path;
+	*sanitized_path_size = safe_sanitized_path_size;
 
 	return( 1 );
 
 on_error:
-	if( narrow_current_working_directory != NULL )
-	{
-		memory_free(
-		 narrow_current_working_directory );
-	}
-	if( safe_current_working_directory != NULL )
+	if( safe_sanitized_path != NULL )
 	{
 		memory_free(
-		 safe_current_working_directory );
+		 safe_sanitized_path );
 	}
 	return( -1 );
 }
 
-#else
-#error Missing get current working directory function
-#endif
-
-#if defined( WINAPI ) && ( WINVER <= 0x0500 )
-
-/* Cross Windows safe version of GetFullPathNameW
- * Returns the number of characters in the current directory string or 0 on error
- */
-DWORD libcpath_GetFullPathNameW(
-       LPCWSTR filename,
-       DWORD  buffer_size,
-       LPWSTR  buffer,
-       LPWSTR  *file_part )
-{
-	FARPROC function       = NULL;
-	HMODULE library_handle = NULL;
-	DWORD result           = 0;
-
-	library_handle = LoadLibrary(
-	                  _SYSTEM_STRING( "kernel32.dll" ) );
-
-	if( library_handle == NULL )
-	{
-		return( 0 );
-	}
-	function = GetProcAddress(
-		    library_handle,
-		    (LPCSTR) "GetFullPathNameW" );
-
-	if( function != NULL )
-	{
-		result = function(
-			  filename,
-			  buffer_size,
-			  buffer,
-			  file_part );
-	}
-	/* This call should be after using the function
-	 * in most cases kernel32.dll will still be available after free
-	 */
-	if( FreeLibrary(
-	     library_handle ) != TRUE )
-	{
-		libcpath_CloseHandle(
-		 library_handle );
-
-		return( 0 );
-	}
-	return( result );
-}
-
-#endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
-
-#if defined( WINAPI )
-
-/* Determines the path type
- * Returns 1 if successful or -1 on error
+/* Retrieves a sanitized version of the path into a buffer
+ * This function does not allocate memory
+ *
+ * The required sanitized path size is set to the size of the sanitized path,
+ * including the end-of-string character, also when the sanitized path is
+ * too small
+ *
+ * Returns 1 if successful, 0 if the sanitized path is too small or -1 on error
  */
-int libcpath_path_get_path_type_wide(
+int libcpath_internal_path_get_sanitized_path_to_buffer_wide(
      const wchar_t *path,
      size_t path_length,
-     uint8_t *path_type,
+     wchar_t *sanitized_path,
+     size_t sanitized_path_size,
+     size_t *required_sanitized_path_size,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_path_get_path_type_wide";
+	static char *function                    = "libcpath_path_get_sanitized_path_to_buffer_wide";
+	size_t safe_sanitized_path_size          = 0;
+
+#if defined( WINAPI )
+	size_t last_path_segment_seperator_index = 0;
+	size_t path_index                        = 0;
+#endif
 
 	if( path == NULL )
 	{
@@ -4365,1421 +13167,968 @@ int libcpath_path_get_path_type_wide(
 
 		return( -1 );
 	}
-	if( path_type == NULL )
+	if( sanitized_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path type.",
+		 "%s: invalid sanitized path.",
 		 function );
 
 		return( -1 );
 	}
-	*path_type = LIBCPATH_TYPE_RELATIVE;
+	if( sanitized_path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized path size value exceeds maximum.",
+		 function );
 
-	/* Determine if the path is a special path
-	 * device path prefix:          \\.\
-	 * extended-length path prefix: \\?\
-	 */
-	if( ( path_length >= 4 )
-	 && ( path[ 0 ] == (wchar_t) '\\' )
-	 && ( path[ 1 ] == (wchar_t) '\\' )
-	 && ( ( path[ 2 ] == (wchar_t) '.' )
-	  ||  ( path[ 2 ] == (wchar_t) '?' ) )
-	 && ( path[ 3 ] == (wchar_t) '\\' ) )
+		return( -1 );
+	}
+	if( required_sanitized_path_size == NULL )
 	{
-		if( path[ 2 ] == (wchar_t) '.' )
-		{
-			*path_type = LIBCPATH_TYPE_DEVICE;
-		}
-		/* Determine if the path in an extended-length UNC path
-		 * \\?\UNC\server\share
-		 */
-		else if( ( path_length >= 8 )
-		      && ( path[ 4 ] == (wchar_t) 'U' )
-		      && ( path[ 5 ] == (wchar_t) 'N' )
-		      && ( path[ 6 ] == (wchar_t) 'C' )
-		      && ( path[ 7 ] == (wchar_t) '\\' ) )
-		{
-			*path_type = LIBCPATH_TYPE_EXTENDED_LENGTH_UNC;
-		}
-		else
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required sanitized path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_get_sanitized_string_wide(
+	     path,
+	     path_length,
+	     0,
+	     NULL,
+	     0,
+	     &safe_sanitized_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine sanitized path size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	for( path_index = path_length;
+	     path_index > 0;
+	     path_index-- )
+	{
+		if( path[ path_index - 1 ] == LIBCPATH_SEPARATOR )
 		{
-			*path_type = LIBCPATH_TYPE_EXTENDED_LENGTH;
+			last_path_segment_seperator_index = path_index - 1;
+
+			break;
 		}
 	}
-	/* Determine if the path is an UNC path
-	 * \\server\share
-	 */
-	else if( ( path_length >= 2 )
-	      && ( path[ 0 ] == (wchar_t) '\\' )
-	      && ( path[ 1 ] == (wchar_t) '\\' ) )
+#endif
+	if( safe_sanitized_path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sanitized path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( last_path_segment_seperator_index > 32767 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid last path segment separator value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( safe_sanitized_path_size > 32767 )
 	{
-		*path_type = LIBCPATH_TYPE_UNC;
+		safe_sanitized_path_size = 32767;
 	}
-	else if( path[ 0 ] == (wchar_t) '\\' )
+#endif
+	*required_sanitized_path_size = safe_sanitized_path_size;
+
+	if( safe_sanitized_path_size > sanitized_path_size )
 	{
-		*path_type = LIBCPATH_TYPE_ABSOLUTE;
+		return( 0 );
 	}
-	else if( ( path_length >= 3 )
-	      && ( path[ 1 ] == (wchar_t) ':' )
-	      && ( path[ 2 ] == (wchar_t) '\\' )
-	      && ( ( ( path[ 0 ] >= (wchar_t) 'A' )
-	        &&   ( path[ 0 ] <= (wchar_t) 'Z' ) )
-	       ||  ( ( path[ 0 ] >= (wchar_t) 'a' )
-	        &&   ( path[ 0 ] <= (wchar_t) 'z' ) ) ) )
+	/* The sanitized path is bounded by the required size and not by the size
+	 * of the buffer, so that both functions fail on the same input
+	 */
+	if( libcpath_path_get_sanitized_string_wide(
+	     path,
+	     path_length,
+	     0,
+	     sanitized_path,
+	     safe_sanitized_path_size,
+	     &safe_sanitized_path_size,
+	     error ) != 1 )
 	{
-		*path_type = LIBCPATH_TYPE_ABSOLUTE;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine sanitized path.",
+		 function );
+
+		return( -1 );
 	}
+
 	return( 1 );
 }
 
-/* Determines the volume name
+
+/* Retrieves an unsanitized version of a string
+ * This reverses libcpath_path_get_sanitized_string, the escape character
+ * followed by 'x' and 2 hexadecimal digits is decoded into the corresponding
+ * character and 2 successive escape characters into a single escape character.
+ * Runs of characters without an escape character are copied as-is.
+ *
+ * The unsanitized string is never larger than the string, the required
+ * unsanitized string size is set to the size of the unsanitized string,
+ * including the end-of-string character
+ *
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_get_volume_name_wide(
-     const wchar_t *path,
-     size_t path_length,
-     wchar_t **volume_name,
-     size_t *volume_name_length,
-     size_t *directory_name_index,
+int libcpath_path_get_unsanitized_string_wide(
+     const wchar_t *string,
+     size_t string_length,
+     wchar_t *unsanitized_string,
+     size_t unsanitized_string_size,
+     size_t *required_unsanitized_string_size,
      libcerror_error_t **error )
 {
-	static char *function    = "libcpath_path_get_volume_name_wide";
-	size_t path_index        = 0;
-	size_t share_name_index  = 0;
-	size_t volume_name_index = 0;
+	const wchar_t *escape_character = NULL;
+	static char *function           = "libcpath_path_get_unsanitized_string_wide";
+	size_t digit_index              = 0;
+	size_t string_index             = 0;
+	size_t unescaped_string_length  = 0;
+	size_t unsanitized_string_index = 0;
+	uint8_t byte_value              = 0;
+	wchar_t character               = 0;
 
-	if( path == NULL )
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path.",
+		 "%s: invalid string.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( path_length == 0 )
-	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	if( string_length > (size_t) ( SSIZE_MAX - 1 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid path length value out of bounds.",
+		 "%s: invalid string length value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( volume_name == NULL )
+	if( unsanitized_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume name.",
+		 "%s: invalid unsanitized string.",
 		 function );
 
 		return( -1 );
 	}
-	if( volume_name_length == NULL )
+	if( unsanitized_string_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume name length.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid unsanitized string size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( directory_name_index == NULL )
+	if( required_unsanitized_string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory name index.",
+		 "%s: invalid required unsanitized string size.",
 		 function );
 
 		return( -1 );
 	}
-	*volume_name          = NULL;
-	*volume_name_length   = 0;
-	*directory_name_index = 0;
-
-	/* Determine if the path is a special path
-	 * device path prefix:          \\.\
-	 * extended-length path prefix: \\?\
-	 */
-	if( ( path_length >= 4 )
-	 && ( path[ 0 ] == (wchar_t) '\\' )
-	 && ( path[ 1 ] == (wchar_t) '\\' )
-	 && ( ( path[ 2 ] == (wchar_t) '.' )
-	  ||  ( path[ 2 ] == (wchar_t) '?' ) )
-	 && ( path[ 3 ] == (wchar_t) '\\' ) )
+	while( string_index < string_length )
 	{
-		if( path[ 2 ] == (wchar_t) '.' )
-		{
-			volume_name_index = 4;
-		}
-		/* Determine if the path in an extended-length UNC path
-		 * \\?\UNC\server\share
-		 */
-		else if( ( path_length >= 8 )
-		      && ( path[ 4 ] == (wchar_t) 'U' )
-		      && ( path[ 5 ] == (wchar_t) 'N' )
-		      && ( path[ 6 ] == (wchar_t) 'C' )
-		      && ( path[ 7 ] == (wchar_t) '\\' ) )
+		escape_character = wide_string_search_character(
+		                    &( string[ string_index ] ),
+		                    (wchar_t) LIBCPATH_ESCAPE_CHARACTER,
+		                    string_length - string_index );
+
+		if( escape_character == NULL )
 		{
-			volume_name_index = 8;
+			unescaped_string_length = string_length - string_index;
 		}
 		else
 		{
-			volume_name_index = 4;
+			unescaped_string_length = (size_t) ( escape_character - &( string[ string_index ] ) );
 		}
-	}
-	/* Determine if the path is an UNC path
-	 * \\server\share
-	 */
-	else if( ( path_length >= 2 )
-	      && ( path[ 0 ] == (wchar_t) '\\' )
-	      && ( path[ 1 ] == (wchar_t) '\\' ) )
-	{
-		volume_name_index = 2;
-	}
-	/* Check if the path contains a volume letter
-	 */
-	if( ( path_length >= 2 )
-	 && ( volume_name_index <= ( path_length - 2 ) )
-	 && ( path[ volume_name_index + 1 ] == (wchar_t) ':' )
-	 && ( ( ( path[ volume_name_index ] >= (wchar_t) 'A' )
-	   &&   ( path[ volume_name_index ] <= (wchar_t) 'Z' ) )
-	  ||  ( ( path[ volume_name_index ] >= (wchar_t) 'a' )
-	   &&   ( path[ volume_name_index ] <= (wchar_t) 'z' ) ) ) )
-	{
-		path_index = volume_name_index + 2;
-
-		if( ( path_index < path_length )
-		 && ( path[ path_index ] == (wchar_t) '\\' ) )
+		if( unescaped_string_length > 0 )
 		{
-			path_index++;
-		}
-		*volume_name        = (wchar_t *) &( path[ volume_name_index ] );
-		*volume_name_length = path_index - volume_name_index;
+			if( unescaped_string_length > ( unsanitized_string_size - unsanitized_string_index ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid unsanitized string size value too small.",
+				 function );
 
-		if( path[ path_index - 1 ] == (wchar_t) '\\' )
-		{
-			*volume_name_length -= 1;
-		}
-		*directory_name_index = path_index;
-	}
-	else if( volume_name_index == 4 )
-	{
-		for( path_index = volume_name_index;
-		     path_index < path_length;
-		     path_index++ )
-		{
-			if( path[ path_index ] == (wchar_t) '\\' )
+				return( -1 );
+			}
+			if( memory_copy(
+			     &( unsanitized_string[ unsanitized_string_index ] ),
+			     &( string[ string_index ] ),
+			     sizeof( wchar_t ) * unescaped_string_length ) == NULL )
 			{
-				path_index++;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy unescaped string.",
+				 function );
 
-				break;
+				return( -1 );
 			}
-		}
-		*volume_name        = (wchar_t *) &( path[ 4 ] );
-		*volume_name_length = path_index - 4;
+			unsanitized_string_index += unescaped_string_length;
+			string_index             += unescaped_string_length;
 
-		if( path[ path_index - 1 ] == (wchar_t) '\\' )
-		{
-			*volume_name_length -= 1;
-		}
-		*directory_name_index = path_index;
-	}
-	else if( ( volume_name_index == 2 )
-	      || ( volume_name_index == 8 ) )
-	{
-		for( share_name_index = volume_name_index;
-		     share_name_index < path_length;
-		     share_name_index++ )
-		{
-			if( path[ share_name_index ] == (wchar_t) '\\' )
+			if( string_index >= string_length )
 			{
-				share_name_index++;
-
 				break;
 			}
 		}
-		if( share_name_index > path_length )
+		if( unsanitized_string_index >= unsanitized_string_size )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid path - missing share name.",
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid unsanitized string size value too small.",
 			 function );
 
 			return( -1 );
 		}
-		for( path_index = share_name_index;
-		     path_index < path_length;
-		     path_index++ )
+		if( ( ( string_length - string_index ) >= 2 )
+		 && ( string[ string_index + 1 ] == (wchar_t) LIBCPATH_ESCAPE_CHARACTER ) )
 		{
-			if( path[ path_index ] == (wchar_t) '\\' )
+			unsanitized_string[ unsanitized_string_index++ ] = (wchar_t) LIBCPATH_ESCAPE_CHARACTER;
+
+			string_index += 2;
+		}
+		else if( ( ( string_length - string_index ) >= 4 )
+		      && ( string[ string_index + 1 ] == (wchar_t) 'x' ) )
+		{
+			byte_value = 0;
+
+			for( digit_index = string_index + 2;
+			     digit_index < string_index + 4;
+			     digit_index++ )
 			{
-				path_index++;
+				character = string[ digit_index ];
 
-				break;
+				byte_value <<= 4;
+
+				/* Note that ':' represents the nibble value 10 in the sanitized string
+				 */
+				if( ( character >= (wchar_t) '0' )
+				 && ( character <= (wchar_t) ':' ) )
+				{
+					byte_value |= (uint8_t) ( character - (wchar_t) '0' );
+				}
+				else if( ( character >= (wchar_t) 'a' )
+				      && ( character <= (wchar_t) 'f' ) )
+				{
+					byte_value |= (uint8_t) ( character - (wchar_t) 'a' + 10 );
+				}
+				else if( ( character >= (wchar_t) 'A' )
+				      && ( character <= (wchar_t) 'F' ) )
+				{
+					byte_value |= (uint8_t) ( character - (wchar_t) 'A' + 10 );
+				}
+				else
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported escaped character at index: %" PRIzd ".",
+					 function,
+					 string_index );
+
+					return( -1 );
+				}
 			}
-		}
-		*volume_name        = (wchar_t *) &( path[ volume_name_index ] );
-		*volume_name_length = path_index - volume_name_index;
+			unsanitized_string[ unsanitized_string_index++ ] = (wchar_t) byte_value;
 
-		if( path[ path_index - 1 ] == (wchar_t) '\\' )
+			string_index += 4;
+		}
+		else
 		{
-			*volume_name_length -= 1;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported escape sequence at index: %" PRIzd ".",
+			 function,
+			 string_index );
+
+			return( -1 );
 		}
-		*directory_name_index = path_index;
 	}
+	if( unsanitized_string_index >= unsanitized_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid unsanitized string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	unsanitized_string[ unsanitized_string_index++ ] = 0;
+
+	*required_unsanitized_string_size = unsanitized_string_index;
+
 	return( 1 );
 }
 
-/* Retrieves the current working directory of a specific volume
+/* Retrieves an unsanitized version of the filename
+ * This reverses libcpath_path_get_sanitized_filename
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_get_current_working_directory_by_volume_wide(
-     wchar_t *volume_name,
-     size_t volume_name_length,
-     wchar_t **current_working_directory,
-     size_t *current_working_directory_size,
+int libcpath_internal_path_get_unsanitized_filename_wide(
+     const wchar_t *sanitized_filename,
+     size_t sanitized_filename_length,
+     wchar_t **filename,
+     size_t *filename_size,
      libcerror_error_t **error )
 {
-	static char *function                     = "libcpath_path_get_current_working_directory_by_volume_wide";
-	wchar_t *safe_current_working_directory   = NULL;
-	DWORD error_code                          = 0;
-	DWORD result                              = 0;
-	DWORD safe_current_working_directory_size = 0;
+	static char *function     = "libcpath_path_get_unsanitized_filename_wide";
+	wchar_t *safe_filename    = NULL;
+	size_t safe_filename_size = 0;
 
-	if( volume_name == NULL )
+	if( sanitized_filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid volume name.",
+		 "%s: invalid sanitized filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( volume_name_length == 0 )
-	 || ( volume_name_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	if( ( sanitized_filename_length == 0 )
+	 || ( sanitized_filename_length > (size_t) ( SSIZE_MAX - 1 ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid volume name length value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
-	if( current_working_directory == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid current working directory.",
-		 function );
-
-		return( -1 );
-	}
-	if( *current_working_directory != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid current working directory value already set.",
+		 "%s: invalid sanitized filename length value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( current_working_directory_size == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid current working directory size.",
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-#if WINVER <= 0x0500
-	safe_current_working_directory_size = libcpath_GetFullPathNameW(
-	                                       volume_name,
-	                                       0,
-	                                       NULL,
-	                                       NULL );
-#else
-	safe_current_working_directory_size = GetFullPathNameW(
-	                                       volume_name,
-	                                       0,
-	                                       NULL,
-	                                       NULL );
-#endif
-	if( safe_current_working_directory_size == 0 )
+	if( *filename != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve current working directory size.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filename value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( (size_t) safe_current_working_directory_size > (size_t) SSIZE_MAX )
+	if( filename_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid current working directory size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename size.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	safe_current_working_directory = wide_string_allocate(
-	                                  safe_current_working_directory_size );
+	/* The unsanitized filename is never larger than the sanitized filename
+	 */
+	safe_filename = wide_string_allocate(
+	                 sanitized_filename_length + 1 );
 
-	if( safe_current_working_directory == NULL )
+	if( safe_filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create current working directory.",
+		 "%s: unable to create filename.",
 		 function );
 
 		goto on_error;
 	}
-	if( memory_set(
-	     safe_current_working_directory,
-	     0,
-	     sizeof( wchar_t ) * safe_current_working_directory_size ) == NULL )
+	if( libcpath_path_get_unsanitized_string_wide(
+	     sanitized_filename,
+	     sanitized_filename_length,
+	     safe_filename,
+	     sanitized_filename_length + 1,
+	     &safe_filename_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear current working directory.",
-		 function );
-
-		goto on_error;
-	}
-#if WINVER <= 0x0500
-	result = libcpath_GetFullPathNameW(
-	          volume_name,
-	          safe_current_working_directory_size,
-	          safe_current_working_directory,
-	          NULL );
-#else
-	result = GetFullPathNameW(
-	          volume_name,
-	          safe_current_working_directory_size,
-	          safe_current_working_directory,
-	          NULL );
-#endif
-	/* Note that safe_current_working_directory_size can be larger than result
-	 */
-	if( ( result == 0 )
-	 || ( result > safe_current_working_directory_size ) )
-	{
-		error_code = GetLastError();
-
-		libcerror_system_set_error(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 error_code,
-		 "%s: unable to retrieve current working directory.",
+		 "%s: unable to determine unsanitized filename.",
 		 function );
 
 		goto on_error;
 	}
-	*current_working_directory      = safe_current_working_directory;
-	*current_working_directory_size = (size_t) safe_current_working_directory_size;
+	*filename      = safe_filename;
+	*filename_size = safe_filename_size;
 
 	return( 1 );
 
 on_error:
-	if( safe_current_working_directory != NULL )
+	if( safe_filename != NULL )
 	{
 		memory_free(
-		 safe_current_working_directory );
+		 safe_filename );
 	}
 	return( -1 );
 }
 
-/* Determines the full path of the Windows path specified
- * The function uses the extended-length path format
- * (path with \\?\ prefix)
- *
- * Multiple successive \ not at the start of the path are combined into one
- *
- * Scenario's that are considered full paths:
- * Device path:			\\.\PhysicalDrive0
- * Extended-length path:	\\?\C:\directory\file.txt
- * Extended-length UNC path:	\\?\UNC\server\share\directory\file.txt
- *
- * Scenario's that are not considered full paths:
- * Local 'absolute' path:	\directory\file.txt
- * Local 'relative' path:	..\directory\file.txt
- * Local 'relative' path:	.\directory\file.txt
- * Volume 'absolute' path:	C:\directory\file.txt
- *                              C:\..\directory\file.txt
- * Volume 'relative' path:	C:directory\file.txt
- * UNC path:			\\server\share\directory\file.txt
- *
+/* Retrieves an unsanitized version of the path
+ * This reverses libcpath_path_get_sanitized_path
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_get_full_path_wide(
-     const wchar_t *path,
-     size_t path_length,
-     wchar_t **full_path,
-     size_t *full_path_size,
+int libcpath_internal_path_get_unsanitized_path_wide(
+     const wchar_t *sanitized_path,
+     size_t sanitized_path_length,
+     wchar_t **path,
+     size_t *path_size,
      libcerror_error_t **error )
 {
-	libcsplit_wide_split_string_t *current_directory_split_string = NULL;
-	libcsplit_wide_split_string_t *path_split_string              = NULL;
-	wchar_t *current_directory                                    = NULL;
-	wchar_t *current_directory_string_segment                     = NULL;
-	wchar_t *full_path_prefix                                     = NULL;
-	wchar_t *last_used_path_string_segment                        = NULL;
-	wchar_t *path_string_segment                                  = NULL;
-	wchar_t *safe_full_path                                       = NULL;
-	wchar_t *volume_name                                          = NULL;
-	static char *function                                         = "libcpath_path_get_full_path_wide";
-	size_t current_directory_length                               = 0;
-	size_t current_directory_name_index                           = 0;
-	size_t current_directory_size                                 = 0;
-	size_t current_directory_string_segment_size                  = 0;
-	size_t full_path_index                                        = 0;
-	size_t full_path_prefix_length                                = 0;
-	size_t last_used_path_string_segment_size                     = 0;
-	size_t path_directory_name_index                              = 0;
-	size_t path_string_segment_length                             = 0;
-	size_t path_string_segment_size                               = 0;
-	size_t safe_full_path_size                                    = 0;
-	size_t volume_name_length                                     = 0;
-	uint8_t path_type                                             = LIBCPATH_TYPE_RELATIVE;
-	int current_directory_number_of_segments                      = 0;
-	int current_directory_segment_index                           = 0;
-	int last_used_path_segment_index                              = -1;
-	int path_number_of_segments                                   = 0;
-	int path_segment_index                                        = 0;
-	int result                                                    = 0;
+	static char *function = "libcpath_path_get_unsanitized_path_wide";
+	wchar_t *safe_path    = NULL;
+	size_t safe_path_size = 0;
 
-	if( path == NULL )
+	if( sanitized_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path.",
+		 "%s: invalid sanitized path.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( path_length == 0 )
-	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	if( ( sanitized_path_length == 0 )
+	 || ( sanitized_path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid path length value out of bounds.",
+		 "%s: invalid sanitized path length value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( full_path == NULL )
+	if( path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid full path.",
+		 "%s: invalid path.",
 		 function );
 
 		return( -1 );
 	}
-	if( *full_path != NULL )
+	if( *path != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid full path value already set.",
+		 "%s: invalid path value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( full_path_size == NULL )
+	if( path_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid full path size.",
+		 "%s: invalid path size.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcpath_path_get_path_type_wide(
-	     path,
-	     path_length,
-	     &path_type,
-	     error ) != 1 )
+	/* The unsanitized path is never larger than the sanitized path
+	 */
+	safe_path = wide_string_allocate(
+	             sanitized_path_length + 1 );
+
+	if( safe_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine path type.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcpath_path_get_volume_name_wide(
-	     path,
-	     path_length,
-	     &volume_name,
-	     &volume_name_length,
-	     &path_directory_name_index,
+	if( libcpath_path_get_unsanitized_string_wide(
+	     sanitized_path,
+	     sanitized_path_length,
+	     safe_path,
+	     sanitized_path_length + 1,
+	     &safe_path_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine volume name.",
+		 "%s: unable to determine unsanitized path.",
 		 function );
 
 		goto on_error;
 	}
-	/* If the path is a device path, an extended-length path or an UNC
-	 * do not bother to lookup the current working directory
-	 */
-	if( ( path_type != LIBCPATH_TYPE_DEVICE )
-	 && ( path_type != LIBCPATH_TYPE_EXTENDED_LENGTH )
-	 && ( path_type != LIBCPATH_TYPE_EXTENDED_LENGTH_UNC )
-	 && ( path_type != LIBCPATH_TYPE_UNC ) )
+	*path      = safe_path;
+	*path_size = safe_path_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_path != NULL )
 	{
-		if( volume_name == NULL )
-		{
-			result = libcpath_path_get_current_working_directory_wide(
-			          &current_directory,
-			          &current_directory_size,
-			          error );
-		}
-		else
-		{
-			result = libcpath_path_get_current_working_directory_by_volume_wide(
-			          volume_name,
-			          volume_name_length,
-			          &current_directory,
-			          &current_directory_size,
-			          error );
-		}
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve current working directory.",
-			 function );
+		memory_free(
+		 safe_path );
+	}
+	return( -1 );
+}
 
-			goto on_error;
-		}
-		if( volume_name == NULL )
-		{
-			/* Determine the volume name using the current working directory if necessary
-			 */
-			if( libcpath_path_get_volume_name_wide(
-			     current_directory,
-			     current_directory_size - 1,
-			     &volume_name,
-			     &volume_name_length,
-			     &current_directory_name_index,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to determine volume name from current working directory.",
-				 function );
+/* Combines the directory name and filename into a path
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_join_wide(
+     wchar_t **path,
+     size_t *path_size,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_join_wide";
+	size_t filename_index = 0;
+	size_t path_index     = 0;
 
-				goto on_error;
-			}
-		}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
 	}
-	/* The full path prefix consists of "\\?\" or "\\.\"
-	 */
-	full_path_prefix_length = 4;
+	if( *path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
 
-	if( volume_name != NULL )
+		return( -1 );
+	}
+	if( directory_name_length > (size_t) SSIZE_MAX )
 	{
-		/* Add the volume or device name
-		 */
-		full_path_prefix_length += volume_name_length;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid directory name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
 	}
-	if( ( path_type == LIBCPATH_TYPE_EXTENDED_LENGTH_UNC )
-	 || ( path_type == LIBCPATH_TYPE_UNC ) )
+	if( filename == NULL )
 	{
-		/* Add the "UNC\" prefix
-		 */
-		full_path_prefix_length += 4;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
 	}
-	if( ( current_directory != NULL )
-	 && ( current_directory_name_index < current_directory_size ) )
+	if( filename_length > (size_t) SSIZE_MAX )
 	{
-		current_directory_length = wide_string_length(
-		                            &( current_directory[ current_directory_name_index ] ) );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename length value exceeds maximum.",
+		 function );
 
-		if( libcsplit_wide_string_split(
-		     &( current_directory[ current_directory_name_index ] ),
-		     current_directory_length + 1,
-		     (wchar_t) '\\',
-		     &current_directory_split_string,
-		     error ) != 1 )
+		return( -1 );
+	}
+/* TODO strip other patterns like /./ */
+	while( directory_name_length > 0 )
+	{
+		if( directory_name[ directory_name_length - 1 ] != (wchar_t) LIBCPATH_SEPARATOR )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to split current working directory.",
-			 function );
-
-			goto on_error;
+			break;
 		}
-		if( libcsplit_wide_split_string_get_number_of_segments(
-		     current_directory_split_string,
-		     &current_directory_number_of_segments,
-		     error ) != 1 )
+		directory_name_length--;
+	}
+	while( filename_length > 0 )
+	{
+		if( filename[ filename_index ] != (wchar_t) LIBCPATH_SEPARATOR )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of current working directory string segments.",
-			 function );
-
-			goto on_error;
+			break;
 		}
-		current_directory_segment_index = current_directory_number_of_segments - 1;
+		filename_index++;
+		filename_length--;
+	}
+	*path_size = directory_name_length + filename_length + 2;
 
-		if( path_type == LIBCPATH_TYPE_RELATIVE )
-		{
-			/* If the path is relative
-			 * add the size of the current working directory
-			 * a directory separator, if necessary
-			 */
-			safe_full_path_size += ( current_directory_size - ( current_directory_name_index + 1 ) );
+	*path = wide_string_allocate(
+	         *path_size );
 
-			if( ( current_directory_size >= 2 )
-			 && ( current_directory[ current_directory_size - 2 ] != (wchar_t) '\\' ) )
-			{
-				safe_full_path_size += 1;
-			}
-		}
-	}
-	if( libcsplit_wide_string_split(
-	     &( path[ path_directory_name_index ] ),
-	     path_length - path_directory_name_index + 1,
-	     (wchar_t) '\\',
-	     &path_split_string,
-	     error ) != 1 )
+	if( *path == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to split path.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
 		 function );
 
 		goto on_error;
 	}
-	if( path_split_string != NULL )
+	if( wide_string_copy(
+	     *path,
+	     directory_name,
+	     directory_name_length ) == NULL )
 	{
-		if( libcsplit_wide_split_string_get_number_of_segments(
-		     path_split_string,
-		     &path_number_of_segments,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of path string segments.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory name to path.",
+		 function );
 
-			goto on_error;
-		}
-		for( path_segment_index = 0;
-		     path_segment_index < path_number_of_segments;
-		     path_segment_index++ )
-		{
-			if( libcsplit_wide_split_string_get_segment_by_index(
-			     path_split_string,
-			     path_segment_index,
-			     &path_string_segment,
-			     &path_string_segment_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve path string segment: %d.",
-				 function,
-				 path_segment_index );
+		goto on_error;
+	}
+	path_index = directory_name_length;
 
-				goto on_error;
-			}
-			if( path_string_segment == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing path string segment: %d.",
-				 function,
-				 path_segment_index );
+	( *path )[ path_index++ ] = (wchar_t) LIBCPATH_SEPARATOR;
 
-				goto on_error;
-			}
-			/* If the path is "" (empty) or "." (current) ignore the entry
-			 */
-			if( ( path_string_segment_size <= 1 )
-			 || ( ( path_string_segment_size == 2 )
-			  &&  ( path_string_segment[ 0 ] == (wchar_t) '.' ) ) )
-			{
-				if( libcsplit_wide_split_string_set_segment_by_index(
-				     path_split_string,
-				     path_segment_index,
-				     NULL,
-				     0,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set path string segment: %d.",
-					 function,
-					 path_segment_index );
+	if( wide_string_copy(
+	     &( ( *path )[ path_index ] ),
+	     &( filename[ filename_index ] ),
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename to path.",
+		 function );
 
-					goto on_error;
-				}
-			}
-			/* If the path is ".." (parent) reverse the current path by one directory
-			 */
-			else if( ( path_string_segment_size == 3 )
-			      && ( path_string_segment[ 0 ] == (wchar_t) '.' )
-			      && ( path_string_segment[ 1 ] == (wchar_t) '.' ) )
-			{
-				if( ( current_directory_split_string != NULL )
-				 && ( last_used_path_segment_index == -1 ) )
-				{
-					if( libcsplit_wide_split_string_get_segment_by_index(
-					     current_directory_split_string,
-					     current_directory_segment_index,
-					     &current_directory_string_segment,
-					     &current_directory_string_segment_size,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve current working directory string segment: %d.",
-						 function,
-						 current_directory_segment_index );
-
-						goto on_error;
-					}
-					if( current_directory_string_segment == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-						 "%s: missing current working directory string segment: %d.",
-						 function,
-						 current_directory_segment_index );
-
-						goto on_error;
-					}
-					/* Remove the size of the parent directory name and a directory separator
-					 * Note that the size includes the end of string character
-					 */
-					if( current_directory_string_segment_size < safe_full_path_size )
-					{
-						safe_full_path_size -= current_directory_string_segment_size;
-					}
-					else
-					{
-						safe_full_path_size = 0;
-					}
-					if( libcsplit_wide_split_string_set_segment_by_index(
-					     current_directory_split_string,
-					     current_directory_segment_index,
-					     NULL,
-					     0,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-						 "%s: unable to set current working directory string segment: %d.",
-						 function,
-						 current_directory_segment_index );
-
-						goto on_error;
-					}
-					current_directory_segment_index--;
-				}
-				else if( last_used_path_segment_index >= 0 )
-				{
-					if( libcsplit_wide_split_string_get_segment_by_index(
-					     path_split_string,
-					     last_used_path_segment_index,
-					     &last_used_path_string_segment,
-					     &last_used_path_string_segment_size,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve last used path string segment: %d.",
-						 function,
-						 last_used_path_segment_index );
-
-						goto on_error;
-					}
-					if( last_used_path_string_segment == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-						 "%s: missing last used path string string segment: %d.",
-						 function,
-						 last_used_path_segment_index );
-
-						goto on_error;
-					}
-					/* Remove the size of the parent directory name and a directory separator
-					 * Note that the size includes the end of string character
-					 */
-					if( last_used_path_string_segment_size < safe_full_path_size )
-					{
-						safe_full_path_size -= last_used_path_string_segment_size;
-					}
-					else
-					{
-						safe_full_path_size = 0;
-					}
-					if( libcsplit_wide_split_string_set_segment_by_index(
-					     path_split_string,
-					     last_used_path_segment_index,
-					     NULL,
-					     0,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-						 "%s: unable to set path string segment: %d.",
-						 function,
-						 last_used_path_segment_index );
-
-						goto on_error;
-					}
-					/* Find the previous path split value that contains a name
-					 */
-					while( last_used_path_segment_index > 0 )
-					{
-						last_used_path_segment_index--;
-
-						if( libcsplit_wide_split_string_get_segment_by_index(
-						     path_split_string,
-						     last_used_path_segment_index,
-						     &last_used_path_string_segment,
-						     &last_used_path_string_segment_size,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-							 "%s: unable to retrieve last used path string segment: %d.",
-							 function,
-							 last_used_path_segment_index );
-
-							goto on_error;
-						}
-						if( last_used_path_string_segment_size != 0 )
-						{
-							break;
-						}
-					}
-				}
-				if( libcsplit_wide_split_string_set_segment_by_index(
-				     path_split_string,
-				     path_segment_index,
-				     NULL,
-				     0,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set path string segment: %d.",
-					 function,
-					 path_segment_index );
+		goto on_error;
+	}
+	path_index += filename_length;
 
-					goto on_error;
-				}
-			}
-			else
-			{
-				/* Add the size of the directory or file name and a directory separator
-				 * Note that the size includes the end of string character
-				 */
-				safe_full_path_size += path_string_segment_size;
+	( *path )[ path_index ] = 0;
 
-				last_used_path_segment_index = path_segment_index;
-			}
-		}
-		/* Use the size reserved of the last directory separator for
-		 * the directory separator after the path prefix.
-		 */
+	return( 1 );
+
+on_error:
+	if( *path != NULL )
+	{
+		memory_free(
+		 *path );
+
+		*path = NULL;
 	}
-	safe_full_path_size += full_path_prefix_length + 1;
+	*path_size = 0;
 
-	full_path_index = 0;
+	return( -1 );
+}
 
-	safe_full_path = wide_string_allocate(
-	                  safe_full_path_size );
+/* Combines the directory name and filename into a path buffer
+ * This function does not allocate memory
+ *
+ * The required path size is set to the size of the path, including
+ * the end-of-string character, also when the path is too small
+ *
+ * Returns 1 if successful, 0 if the path is too small or -1 on error
+ */
+int libcpath_internal_path_join_to_buffer_wide(
+     wchar_t *path,
+     size_t path_size,
+     size_t *required_path_size,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_join_to_buffer_wide";
+	size_t filename_index = 0;
+	size_t path_index     = 0;
+	size_t safe_path_size = 0;
 
-	if( safe_full_path == NULL )
+	if( path == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create full path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( memory_set(
-	     safe_full_path,
-	     0,
-	     sizeof( wchar_t ) * safe_full_path_size ) == NULL )
+	if( path_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear full path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( path_type == LIBCPATH_TYPE_DEVICE )
+	if( required_path_size == NULL )
 	{
-		full_path_prefix        = L"\\\\.\\";
-		full_path_prefix_length = 4;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required path size.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	if( directory_name == NULL )
 	{
-		full_path_prefix        = L"\\\\?\\";
-		full_path_prefix_length = 4;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
 	}
-	if( full_path_prefix_length > ( safe_full_path_size - full_path_index ) )
+	if( directory_name_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid directory name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid full path size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( wide_string_copy(
-	     &( safe_full_path[ full_path_index ] ),
-	     full_path_prefix,
-	     full_path_prefix_length ) == NULL )
+	if( filename_length > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set prefix in full path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename length value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	full_path_index += full_path_prefix_length;
-
-	/* If there is a share name the path is an UNC path
-	 */
-	if( ( path_type == LIBCPATH_TYPE_EXTENDED_LENGTH_UNC )
-	 || ( path_type == LIBCPATH_TYPE_UNC ) )
+	while( directory_name_length > 0 )
 	{
-		if( ( safe_full_path_size - full_path_index ) < 4 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid full path size value out of bounds.",
-			 function );
-
-			goto on_error;
-		}
-		if( wide_string_copy(
-		     &( safe_full_path[ full_path_index ] ),
-		     L"UNC\\",
-		     4 ) == NULL )
+		if( directory_name[ directory_name_length - 1 ] != (wchar_t) LIBCPATH_SEPARATOR )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set UNC\\ prefix in full path.",
-			 function );
-
-			goto on_error;
+			break;
 		}
-		full_path_index += 4;
+		directory_name_length--;
 	}
-	if( volume_name != NULL )
+	while( filename_length > 0 )
 	{
-		if( volume_name_length > ( safe_full_path_size - full_path_index ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid full path size value out of bounds.",
-			 function );
-
-			goto on_error;
-		}
-		if( wide_string_copy(
-		     &( safe_full_path[ full_path_index ] ),
-		     volume_name,
-		     volume_name_length ) == NULL )
+		if( filename[ filename_index ] != (wchar_t) LIBCPATH_SEPARATOR )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set volume name in full path.",
-			 function );
-
-			goto on_error;
+			break;
 		}
-		full_path_index += volume_name_length;
-
-		safe_full_path[ full_path_index++ ] = (wchar_t) '\\';
+		filename_index++;
+		filename_length--;
 	}
-	/* If the path is relative
-	 * add the current working directory elements
-	 */
-	if( ( path_type == LIBCPATH_TYPE_RELATIVE )
-	 && ( current_directory_split_string != NULL ) )
-	{
-		for( current_directory_segment_index = 0;
-		     current_directory_segment_index < current_directory_number_of_segments;
-		     current_directory_segment_index++ )
-		{
-			if( libcsplit_wide_split_string_get_segment_by_index(
-			     current_directory_split_string,
-			     current_directory_segment_index,
-			     &current_directory_string_segment,
-			     &current_directory_string_segment_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve current working directory string segment: %d.",
-				 function,
-				 current_directory_segment_index );
+	safe_path_size = directory_name_length + filename_length + 2;
 
-				goto on_error;
-			}
-			if( current_directory_string_segment_size != 0 )
-			{
-				if( current_directory_string_segment == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing current working directory string segment: %d.",
-					 function,
-					 current_directory_segment_index );
-
-					goto on_error;
-				}
-				/* Note that here we should have room for the segment string and
-				 * one additional character
-				 */
-				if( current_directory_string_segment_size > ( safe_full_path_size - full_path_index ) )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid current working directory string segment: %d size value out of bounds.",
-					 function,
-					 current_directory_segment_index );
-
-					goto on_error;
-				}
-				path_string_segment_length = current_directory_string_segment_size - 1;
-
-				if( wide_string_copy(
-				     &( safe_full_path[ full_path_index ] ),
-				     current_directory_string_segment,
-				     path_string_segment_length ) == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set current working directory split value: %d in full path.",
-					 function,
-					 current_directory_segment_index );
-
-					goto on_error;
-				}
-				full_path_index += path_string_segment_length;
+	*required_path_size = safe_path_size;
 
-				safe_full_path[ full_path_index++ ] = (wchar_t) '\\';
-			}
-		}
+	if( safe_path_size > path_size )
+	{
+		return( 0 );
 	}
-	if( path_split_string != NULL )
+	if( wide_string_copy(
+	     path,
+	     directory_name,
+	     directory_name_length ) == NULL )
 	{
-		for( path_segment_index = 0;
-		     path_segment_index < path_number_of_segments;
-		     path_segment_index++ )
-		{
-			if( libcsplit_wide_split_string_get_segment_by_index(
-			     path_split_string,
-			     path_segment_index,
-			     &path_string_segment,
-			     &path_string_segment_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve path string segment: %d.",
-				 function,
-				 path_segment_index );
-
-				goto on_error;
-			}
-			if( path_string_segment_size != 0 )
-			{
-				if( path_string_segment == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing path string segment: %d.",
-					 function,
-					 path_segment_index );
-
-					goto on_error;
-				}
-				/* Note that here we should have room for the segment string and
-				 * one additional character
-				 */
-				if( path_string_segment_size > ( safe_full_path_size - full_path_index ) )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid current path string segment: %d size value out of bounds.",
-					 function,
-					 path_segment_index );
-
-					goto on_error;
-				}
-				path_string_segment_length = path_string_segment_size - 1;
-
-				if( wide_string_copy(
-				     &( safe_full_path[ full_path_index ] ),
-				     path_string_segment,
-				     path_string_segment_length ) == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set path split value: %d in full path.",
-					 function,
-					 path_segment_index );
-
-					goto on_error;
-				}
-				full_path_index += path_string_segment_length;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory name to path.",
+		 function );
 
-				safe_full_path[ full_path_index++ ] = (wchar_t) '\\';
-			}
-		}
+		return( -1 );
 	}
-	safe_full_path[ full_path_index - 1 ] = 0;
+	path_index = directory_name_length;
 
-	if( path_split_string != NULL )
-	{
-		if( libcsplit_wide_split_string_free(
-		     &path_split_string,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free path split string.",
-			 function );
+	path[ path_index++ ] = (wchar_t) LIBCPATH_SEPARATOR;
 
-			goto on_error;
-		}
-	}
-	if( current_directory_split_string != NULL )
+	if( wide_string_copy(
+	     &( path[ path_index ] ),
+	     &( filename[ filename_index ] ),
+	     filename_length ) == NULL )
 	{
-		if( libcsplit_wide_split_string_free(
-		     &current_directory_split_string,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free current working directory split string.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename to path.",
+		 function );
 
-			goto on_error;
-		}
-	}
-	if( current_directory != NULL )
-	{
-		memory_free(
-		 current_directory );
+		return( -1 );
 	}
-	*full_path      = safe_full_path;
-	*full_path_size = safe_full_path_size;
+	path_index += filename_length;
 
-	return( 1 );
+	path[ path_index ] = 0;
 
-on_error:
-	if( safe_full_path != NULL )
-	{
-		memory_free(
-		 safe_full_path );
-	}
-	if( path_split_string != NULL )
-	{
-		libcsplit_wide_split_string_free(
-		 &path_split_string,
-		 NULL );
-	}
-	if( current_directory_split_string != NULL )
-	{
-		libcsplit_wide_split_string_free(
-		 &current_directory_split_string,
-		 NULL );
-	}
-	if( current_directory != NULL )
-	{
-		memory_free(
-		 current_directory );
-	}
-	return( -1 );
+	return( 1 );
 }
 
-#else
-
-/* Determines the full path of the POSIX path specified
- * Multiple successive / are combined into one
+/* Combines the directory name and filename into a lexically normalized path
+ * Empty and "." (current directory) segments are removed and ".." (parent
+ * directory) segments are applied while the directory name and filename are
+ * copied. A ".." segment never removes the root of an absolute path and is
+ * retained in a relative path if there is no preceding segment to remove.
+ * An empty relative path is represented as ".".
  *
- * Scenarios:
- * /home/user/file.txt
- * /home/user//file.txt
- * /home/user/../user/file.txt
- * /../home/user/file.txt
- * user/../user/file.txt
+ * An empty directory name is the current directory, hence the directory name
+ * contributes no segments and the path is relative. This differs from
+ * libcpath_path_join_wide which prefixes the filename with a directory separator.
+ *
+ * The file system is not accessed, hence symbolic links are not resolved
  *
  * Returns 1 if successful or -1 on error
- */
-int libcpath_path_get_full_path_wide(
-     const wchar_t *path,
-     size_t path_length,
-     wchar_t **full_path,
-     size_t *full_path_size,
+ */
+int libcpath_internal_path_join_normalized_wide(
+     wchar_t **path,
+     size_t *path_size,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     const wchar_t *filename,
+     size_t filename_length,
      libcerror_error_t **error )
 {
-	libcsplit_wide_split_string_t *current_directory_split_string = NULL;
-	libcsplit_wide_split_string_t *path_split_string              = NULL;
-	wchar_t *current_directory                                    = NULL;
-	wchar_t *current_directory_string_segment                     = NULL;
-	wchar_t *last_used_path_string_segment                        = NULL;
-	wchar_t *path_string_segment                                  = NULL;
-	wchar_t *safe_full_path                                       = NULL;
-	static char *function                                         = "libcpath_path_get_full_path_wide";
-	size_t current_directory_index                                = 0;
-	size_t current_directory_length                               = 0;
-	size_t current_directory_size                                 = 0;
-	size_t current_directory_string_segment_size                  = 0;
-	size_t full_path_index                                        = 0;
-	size_t full_path_prefix_length                                = 0;
-	size_t last_used_path_string_segment_size                     = 0;
-	size_t path_index                                             = 0;
-	size_t path_string_segment_length                             = 0;
-	size_t path_string_segment_size                               = 0;
-	size_t safe_full_path_size                                    = 0;
-	uint8_t path_type                                             = LIBCPATH_TYPE_RELATIVE;
-	int current_directory_number_of_segments                      = 0;
-	int current_directory_segment_index                           = 0;
-	int last_used_path_segment_index                              = -1;
-	int path_number_of_segments                                   = 0;
-	int path_segment_index                                        = 0;
+	wchar_t *safe_path          = NULL;
+	static char *function       = "libcpath_path_join_normalized_wide";
+	size_t directory_name_index = 0;
+	size_t path_index           = 0;
+	size_t path_prefix_length   = 0;
+	size_t safe_path_size       = 0;
 
 	if( path == NULL )
 	{
@@ -5792,1126 +14141,811 @@ int libcpath_path_get_full_path_wide(
 
 		return( -1 );
 	}
-#if defined( __MINGW32__ )
-	if( ( path_length < 2 )
-	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
-#else
-	if( ( path_length < 1 )
-	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
-#endif
+	if( *path != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid path length value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( full_path == NULL )
+	if( path_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid full path.",
+		 "%s: invalid path size.",
 		 function );
 
 		return( -1 );
 	}
-	if( *full_path != NULL )
+	if( directory_name == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid full path value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
 		 function );
 
 		return( -1 );
 	}
-	if( full_path_size == NULL )
+	if( directory_name_length > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid full path size.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid directory name length value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	/* Determine the full path size
-	 */
-#if defined( __MINGW32__ )
-	if( path[ 1 ] == (wchar_t) ':' )
+	if( filename == NULL )
 	{
-		path_index = 2;
-	}
-	current_directory_index = 3;
-#endif
-	full_path_prefix_length = current_directory_index;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
 
-	if( path[ path_index ] == LIBCPATH_SEPARATOR )
+		return( -1 );
+	}
+	if( filename_length > (size_t) SSIZE_MAX )
 	{
-		path_type = LIBCPATH_TYPE_ABSOLUTE;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid filename length value exceeds maximum.",
+		 function );
 
-#if !defined( __MINGW32__ )
-		/* If the path is absolute
-		 * a directory separator
-		 */
-		full_path_prefix_length += 1;
-#endif
+		return( -1 );
 	}
-	if( ( path_type == LIBCPATH_TYPE_RELATIVE )
-	 || ( path_index != current_directory_index ) )
+	if( directory_name_length > ( (size_t) SSIZE_MAX - ( filename_length + 3 ) ) )
 	{
-		if( libcpath_path_get_current_working_directory_wide(
-		     &current_directory,
-		     &current_directory_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve current working directory.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory name and filename length value out of bounds.",
+		 function );
 
-			goto on_error;
-		}
-		if( current_directory == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing current working directory.",
-			 function );
+		return( -1 );
+	}
+	/* Every segment is stored with a trailing directory separator, hence the path
+	 * never needs more than the length of the inputs, a directory separator per
+	 * input and the end-of-string character
+	 */
+	safe_path_size = directory_name_length + filename_length + 3;
 
-			goto on_error;
-		}
-		/* We need to use the length here since current_directory_size will be PATH_MAX
-		 */
-		current_directory_length = wide_string_length(
-		                            current_directory );
+	safe_path = wide_string_allocate(
+	             safe_path_size );
 
-		if( current_directory_index > current_directory_length )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid current working directory length value out of bounds.",
-			 function );
+	if( safe_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
 
-			goto on_error;
-		}
-		current_directory_length -= current_directory_index;
+		goto on_error;
 	}
-	if( path_type == LIBCPATH_TYPE_RELATIVE )
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	/* The path is prefixed with the drive letter and colon
+	 */
+	if( ( directory_name_length >= 2 )
+	 && ( directory_name[ 1 ] == (wchar_t) ':' ) )
 	{
-		if( libcsplit_wide_string_split(
-		     &( current_directory[ current_directory_index ] ),
-		     current_directory_length + 1,
-		     (wchar_t) LIBCPATH_SEPARATOR,
-		     &current_directory_split_string,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to split current working directory.",
-			 function );
-
-			goto on_error;
-		}
-		if( libcsplit_wide_split_string_get_number_of_segments(
-		     current_directory_split_string,
-		     &current_directory_number_of_segments,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of current working directory string segments.",
-			 function );
+		safe_path[ path_prefix_length++ ] = directory_name[ 0 ];
+		safe_path[ path_prefix_length++ ] = (wchar_t) ':';
 
-			goto on_error;
-		}
-		current_directory_segment_index = current_directory_number_of_segments - 1;
+		directory_name_index = 2;
+	}
+	/* The path is prefixed with the 2 directory separators of an UNC path
+	 */
+	else if( ( directory_name_length >= 2 )
+	      && ( directory_name[ 0 ] == (wchar_t) LIBCPATH_SEPARATOR )
+	      && ( directory_name[ 1 ] == (wchar_t) LIBCPATH_SEPARATOR ) )
+	{
+		safe_path[ path_prefix_length++ ] = (wchar_t) LIBCPATH_SEPARATOR;
 
-		/* If the path is relative
-		 * add the size of the current working directory
-		 * a directory separator, if necessary
-		 */
-		safe_full_path_size = current_directory_length;
+		directory_name_index = 1;
+	}
+#endif
+	/* The path of an absolute directory name is prefixed with a directory separator
+	 */
+	if( ( directory_name_index < directory_name_length )
+	 && ( directory_name[ directory_name_index ] == (wchar_t) LIBCPATH_SEPARATOR ) )
+	{
+		safe_path[ path_prefix_length++ ] = (wchar_t) LIBCPATH_SEPARATOR;
 
-		if( ( current_directory_length >= 1 )
-		 && ( current_directory[ current_directory_length - 1 ] != (wchar_t) LIBCPATH_SEPARATOR ) )
-		{
-			safe_full_path_size++;
-		}
+		directory_name_index++;
 	}
-	if( path_index > path_length )
+	path_index = path_prefix_length;
+
+	if( libcpath_path_append_normalized_segments_wide(
+	     safe_path,
+	     safe_path_size,
+	     path_prefix_length,
+	     &path_index,
+	     &( directory_name[ directory_name_index ] ),
+	     directory_name_length - directory_name_index,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid path length value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append directory name segments to path.",
 		 function );
 
 		goto on_error;
 	}
-	if( libcsplit_wide_string_split(
-	     &( path[ path_index ] ),
-	     ( path_length - path_index ) + 1,
-	     (wchar_t) LIBCPATH_SEPARATOR,
-	     &path_split_string,
+	if( libcpath_path_append_normalized_segments_wide(
+	     safe_path,
+	     safe_path_size,
+	     path_prefix_length,
+	     &path_index,
+	     filename,
+	     filename_length,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to split path.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append filename segments to path.",
 		 function );
 
 		goto on_error;
 	}
-	if( path_split_string != NULL )
+	/* Remove the directory separator of the last segment
+	 */
+	if( path_index > path_prefix_length )
 	{
-		if( libcsplit_wide_split_string_get_number_of_segments(
-		     path_split_string,
-		     &path_number_of_segments,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of path string segments.",
-			 function );
-
-			goto on_error;
-		}
-		for( path_segment_index = 0;
-		     path_segment_index < path_number_of_segments;
-		     path_segment_index++ )
-		{
-			if( libcsplit_wide_split_string_get_segment_by_index(
-			     path_split_string,
-			     path_segment_index,
-			     &path_string_segment,
-			     &path_string_segment_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve path string segment: %d.",
-				 function,
-				 path_segment_index );
+		path_index--;
+	}
+	else if( path_index == 0 )
+	{
+		safe_path[ path_index++ ] = (wchar_t) '.';
+	}
+	safe_path[ path_index++ ] = 0;
 
-				goto on_error;
-			}
-			if( path_string_segment == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-				 "%s: missing path string segment: %d.",
-				 function,
-				 path_segment_index );
+	*path      = safe_path;
+	*path_size = path_index;
 
-				goto on_error;
-			}
-			/* If the path is "" (empty) or "." (current) ignore the entry
-			 */
-			if( ( path_string_segment_size <= 1 )
-			 || ( ( path_string_segment_size == 2 )
-			  &&  ( path_string_segment[ 0 ] == (wchar_t) '.' ) ) )
-			{
-				if( libcsplit_wide_split_string_set_segment_by_index(
-				     path_split_string,
-				     path_segment_index,
-				     NULL,
-				     0,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set path string segment: %d.",
-					 function,
-					 path_segment_index );
+	return( 1 );
 
-					goto on_error;
-				}
-			}
-			/* If the path is ".." (parent) reverse the current path by one directory
-			 */
-			else if( ( path_string_segment_size == 3 )
-			      && ( path_string_segment[ 0 ] == (wchar_t) '.' )
-			      && ( path_string_segment[ 1 ] == (wchar_t) '.' ) )
-			{
-				if( ( current_directory_split_string != NULL )
-				 && ( last_used_path_segment_index == -1 ) )
-				{
-					if( libcsplit_wide_split_string_get_segment_by_index(
-					     current_directory_split_string,
-					     current_directory_segment_index,
-					     &current_directory_string_segment,
-					     &current_directory_string_segment_size,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve current working directory string segment: %d.",
-						 function,
-						 current_directory_segment_index );
-
-						goto on_error;
-					}
-					if( current_directory_string_segment == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-						 "%s: missing current working directory string segment: %d.",
-						 function,
-						 current_directory_segment_index );
-
-						goto on_error;
-					}
-					/* Remove the size of the parent directory name and a directory separator
-					 * Note that the size includes the end of string character
-					 */
-					if( current_directory_string_segment_size < safe_full_path_size )
-					{
-						safe_full_path_size -= current_directory_string_segment_size;
-					}
-					else
-					{
-						safe_full_path_size = 0;
-					}
-					if( libcsplit_wide_split_string_set_segment_by_index(
-					     current_directory_split_string,
-					     current_directory_segment_index,
-					     NULL,
-					     0,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-						 "%s: unable to set current working directory string segment: %d.",
-						 function,
-						 current_directory_segment_index );
-
-						goto on_error;
-					}
-					current_directory_segment_index--;
-				}
-				else if( last_used_path_segment_index >= 0 )
-				{
-					if( libcsplit_wide_split_string_get_segment_by_index(
-					     path_split_string,
-					     last_used_path_segment_index,
-					     &last_used_path_string_segment,
-					     &last_used_path_string_segment_size,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve last used path string segment: %d.",
-						 function,
-						 last_used_path_segment_index );
-
-						goto on_error;
-					}
-					if( last_used_path_string_segment == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-						 "%s: missing last used path string string segment: %d.",
-						 function,
-						 last_used_path_segment_index );
-
-						goto on_error;
-					}
-					/* Remove the size of the parent directory name and a directory separator
-					 * Note that the size includes the end of string character
-					 */
-					if( last_used_path_string_segment_size < safe_full_path_size )
-					{
-						safe_full_path_size -= last_used_path_string_segment_size;
-					}
-					else
-					{
-						safe_full_path_size = 0;
-					}
-					if( libcsplit_wide_split_string_set_segment_by_index(
-					     path_split_string,
-					     last_used_path_segment_index,
-					     NULL,
-					     0,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-						 "%s: unable to set path string segment: %d.",
-						 function,
-						 last_used_path_segment_index );
-
-						goto on_error;
-					}
-					/* Find the previous path split value that contains a name
-					 */
-					while( last_used_path_segment_index > 0 )
-					{
-						last_used_path_segment_index--;
-
-						if( libcsplit_wide_split_string_get_segment_by_index(
-						     path_split_string,
-						     last_used_path_segment_index,
-						     &last_used_path_string_segment,
-						     &last_used_path_string_segment_size,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-							 "%s: unable to retrieve last used path string segment: %d.",
-							 function,
-							 last_used_path_segment_index );
-
-							goto on_error;
-						}
-						if( last_used_path_string_segment_size != 0 )
-						{
-							break;
-						}
-					}
-				}
-				if( libcsplit_wide_split_string_set_segment_by_index(
-				     path_split_string,
-				     path_segment_index,
-				     NULL,
-				     0,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set path string segment: %d.",
-					 function,
-					 path_segment_index );
+on_error:
+	if( safe_path != NULL )
+	{
+		memory_free(
+		 safe_path );
+	}
+	return( -1 );
+}
 
-					goto on_error;
-				}
-			}
-			else
-			{
-				/* Add the size of the directory or file name and a directory separator
-				 * Note that the size includes the end of string character
-				 */
-				safe_full_path_size += path_string_segment_size;
+/* Determines the relative path from a (directory) path to another path
+ * This is the inverse of libcpath_path_get_full_path, both paths are first
+ * made full paths, which normalizes their segments, after which the segments
+ * they have in common are replaced by a ".." (parent directory) segment for
+ * every remaining segment of the from path. An empty relative path, when both
+ * paths are the same, is represented as ".".
+ *
+ * The segments are compared case-sensitive and the file system is not
+ * accessed, hence symbolic links are not resolved
+ *
+ * Returns 1 if successful, 0 if no relative path exists, such as when the
+ * paths are on different volumes, or -1 on error
+ */
+int libcpath_internal_path_get_relative_path_wide(
+     const wchar_t *from_path,
+     size_t from_path_length,
+     const wchar_t *to_path,
+     size_t to_path_length,
+     wchar_t **relative_path,
+     size_t *relative_path_size,
+     libcerror_error_t **error )
+{
+	wchar_t *from_full_path          = NULL;
+	wchar_t *safe_relative_path      = NULL;
+	wchar_t *to_full_path            = NULL;
+	static char *function            = "libcpath_path_get_relative_path_wide";
+	size_t common_index              = 0;
+	size_t from_full_path_index      = 0;
+	size_t from_full_path_length     = 0;
+	size_t from_full_path_size       = 0;
+	size_t from_root_length          = 0;
+	size_t number_of_parent_segments = 0;
+	size_t relative_path_index       = 0;
+	size_t safe_relative_path_size   = 0;
+	size_t segment_index             = 0;
+	size_t to_full_path_index        = 0;
+	size_t to_full_path_length       = 0;
+	size_t to_full_path_size         = 0;
+	size_t to_root_length            = 0;
+
+	if( relative_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid relative path.",
+		 function );
 
-				last_used_path_segment_index = path_segment_index;
-			}
-		}
-#if defined( __MINGW32__ )
-		if( ( safe_full_path_size > 0 )
-		 && ( path_number_of_segments > 1 ) )
-#else
-		if( safe_full_path_size > 0 )
-#endif
-		{
-			/* Remove the size reserved of the last directory separator
-			 */
-			safe_full_path_size -= 1;
-		}
+		return( -1 );
 	}
-	safe_full_path_size += full_path_prefix_length + 1;
+	if( *relative_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid relative path value already set.",
+		 function );
 
-	safe_full_path = wide_string_allocate(
-	                  safe_full_path_size );
+		return( -1 );
+	}
+	if( relative_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid relative path size.",
+		 function );
 
-	if( safe_full_path == NULL )
+		return( -1 );
+	}
+	if( libcpath_internal_path_get_full_path_wide(
+	     from_path,
+	     from_path_length,
+	     &from_full_path,
+	     &from_full_path_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create full path.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve from full path.",
 		 function );
 
 		goto on_error;
 	}
-	if( memory_set(
-	     safe_full_path,
-	     0,
-	     sizeof( wchar_t ) * safe_full_path_size ) == NULL )
+	if( libcpath_internal_path_get_full_path_wide(
+	     to_path,
+	     to_path_length,
+	     &to_full_path,
+	     &to_full_path_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear full path.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve to full path.",
 		 function );
 
 		goto on_error;
 	}
-	full_path_index = 0;
-
-#if defined( __MINGW32__ )
-	if( path_index == 2 )
+	if( ( from_full_path_size == 0 )
+	 || ( to_full_path_size == 0 ) )
 	{
-		safe_full_path[ full_path_index++ ] = path[ 0 ];
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid full path size value out of bounds.",
+		 function );
+
+		goto on_error;
 	}
-	else
+	from_full_path_length = from_full_path_size - 1;
+	to_full_path_length   = to_full_path_size - 1;
+
+	if( libcpath_path_get_root_length_wide(
+	     from_full_path,
+	     from_full_path_length,
+	     &from_root_length,
+	     error ) != 1 )
 	{
-		safe_full_path[ full_path_index++ ] = current_directory[ 0 ];
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine from full path root length.",
+		 function );
+
+		goto on_error;
 	}
-	safe_full_path[ full_path_index++ ] = (wchar_t) ':';
-	safe_full_path[ full_path_index++ ] = (wchar_t) LIBCPATH_SEPARATOR;
-#else
-	if( path_type == LIBCPATH_TYPE_ABSOLUTE )
+	if( libcpath_path_get_root_length_wide(
+	     to_full_path,
+	     to_full_path_length,
+	     &to_root_length,
+	     error ) != 1 )
 	{
-		safe_full_path[ full_path_index++ ] = (wchar_t) LIBCPATH_SEPARATOR;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine to full path root length.",
+		 function );
+
+		goto on_error;
 	}
-#endif
-	/* If the path is relative
-	 * add the current working directory elements
+	/* A relative path only exists between full paths with the same root
 	 */
-	if( current_directory_split_string != NULL )
+	if( ( from_root_length != to_root_length )
+	 || ( wide_string_compare(
+	       from_full_path,
+	       to_full_path,
+	       from_root_length ) != 0 ) )
 	{
-		for( current_directory_segment_index = 0;
-		     current_directory_segment_index < current_directory_number_of_segments;
-		     current_directory_segment_index++ )
-		{
-			if( libcsplit_wide_split_string_get_segment_by_index(
-			     current_directory_split_string,
-			     current_directory_segment_index,
-			     &current_directory_string_segment,
-			     &current_directory_string_segment_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve current working directory string segment: %d.",
-				 function,
-				 current_directory_segment_index );
-
-				goto on_error;
-			}
-			if( current_directory_string_segment_size != 0 )
-			{
-				if( current_directory_string_segment == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing current working directory string segment: %d.",
-					 function,
-					 current_directory_segment_index );
-
-					goto on_error;
-				}
-				/* Note that here we should have room for the segment string and
-				 * one additional character
-				 */
-				if( current_directory_string_segment_size > ( safe_full_path_size - full_path_index ) )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid current working directory string segment: %d size value out of bounds.",
-					 function,
-					 current_directory_segment_index );
+		memory_free(
+		 to_full_path );
 
-					goto on_error;
-				}
-				path_string_segment_length = current_directory_string_segment_size - 1;
+		memory_free(
+		 from_full_path );
 
-				if( wide_string_copy(
-				     &( safe_full_path[ full_path_index ] ),
-				     current_directory_string_segment,
-				     path_string_segment_length ) == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set current working directory split value: %d in full path.",
-					 function,
-					 current_directory_segment_index );
+		return( 0 );
+	}
+	/* Determine the end of the segments both full paths have in common
+	 */
+	common_index  = from_root_length;
+	segment_index = from_root_length;
 
-					goto on_error;
-				}
-				full_path_index += path_string_segment_length;
+	while( ( segment_index < from_full_path_length )
+	    && ( segment_index < to_full_path_length )
+	    && ( from_full_path[ segment_index ] == to_full_path[ segment_index ] ) )
+	{
+		if( from_full_path[ segment_index ] == (wchar_t) LIBCPATH_SEPARATOR )
+		{
+			common_index = segment_index + 1;
+		}
+		segment_index++;
+	}
+	if( ( ( segment_index == from_full_path_length )
+	  ||  ( from_full_path[ segment_index ] == (wchar_t) LIBCPATH_SEPARATOR ) )
+	 && ( ( segment_index == to_full_path_length )
+	  ||  ( to_full_path[ segment_index ] == (wchar_t) LIBCPATH_SEPARATOR ) ) )
+	{
+		from_full_path_index = segment_index;
+		to_full_path_index   = segment_index;
 
-				safe_full_path[ full_path_index++ ] = (wchar_t) LIBCPATH_SEPARATOR;
-			}
+		if( from_full_path_index < from_full_path_length )
+		{
+			from_full_path_index++;
+		}
+		if( to_full_path_index < to_full_path_length )
+		{
+			to_full_path_index++;
 		}
 	}
-	if( path_split_string != NULL )
+	else
+	{
+		from_full_path_index = common_index;
+		to_full_path_index   = common_index;
+	}
+	/* Every remaining segment of the from full path is replaced by a ".." segment
+	 */
+	if( from_full_path_index < from_full_path_length )
 	{
-		for( path_segment_index = 0;
-		     path_segment_index < path_number_of_segments;
-		     path_segment_index++ )
+		number_of_parent_segments = 1;
+
+		for( segment_index = from_full_path_index;
+		     segment_index < from_full_path_length;
+		     segment_index++ )
 		{
-			if( libcsplit_wide_split_string_get_segment_by_index(
-			     path_split_string,
-			     path_segment_index,
-			     &path_string_segment,
-			     &path_string_segment_size,
-			     error ) != 1 )
+			if( from_full_path[ segment_index ] == (wchar_t) LIBCPATH_SEPARATOR )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve path string segment: %d.",
-				 function,
-				 path_segment_index );
-
-				goto on_error;
+				number_of_parent_segments++;
 			}
-			if( path_string_segment_size != 0 )
-			{
-				if( path_string_segment == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing path string segment: %d.",
-					 function,
-					 path_segment_index );
-
-					goto on_error;
-				}
-				/* Note that here we should have room for the segment string and
-				 * one additional character
-				 */
-				if( path_string_segment_size > ( safe_full_path_size - full_path_index ) )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid current path string segment: %d size value out of bounds.",
-					 function,
-					 path_segment_index );
-
-					goto on_error;
-				}
-				path_string_segment_length = path_string_segment_size - 1;
+		}
+	}
+	/* Every ".." segment is stored with a trailing directory separator,
+	 * which also covers the end-of-string character
+	 */
+	safe_relative_path_size = ( number_of_parent_segments * 3 ) + ( to_full_path_length - to_full_path_index ) + 2;
 
-				if( wide_string_copy(
-				     &( safe_full_path[ full_path_index ] ),
-				     path_string_segment,
-				     path_string_segment_length ) == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set path split value: %d in full path.",
-					 function,
-					 path_segment_index );
+	safe_relative_path = wide_string_allocate(
+	                      safe_relative_path_size );
 
-					goto on_error;
-				}
-				full_path_index += path_string_segment_length;
+	if( safe_relative_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create relative path.",
+		 function );
 
-				safe_full_path[ full_path_index++ ] = (wchar_t) LIBCPATH_SEPARATOR;
-			}
-		}
+		goto on_error;
 	}
-	safe_full_path[ full_path_index - 1 ] = 0;
-
-	if( path_split_string != NULL )
+	while( number_of_parent_segments > 0 )
 	{
-		if( libcsplit_wide_split_string_free(
-		     &path_split_string,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free path split string.",
-			 function );
+		safe_relative_path[ relative_path_index++ ] = (wchar_t) '.';
+		safe_relative_path[ relative_path_index++ ] = (wchar_t) '.';
+		safe_relative_path[ relative_path_index++ ] = (wchar_t) LIBCPATH_SEPARATOR;
 
-			goto on_error;
-		}
+		number_of_parent_segments--;
 	}
-	if( current_directory_split_string != NULL )
+	if( to_full_path_index < to_full_path_length )
 	{
-		if( libcsplit_wide_split_string_free(
-		     &current_directory_split_string,
-		     error ) != 1 )
+		if( wide_string_copy(
+		     &( safe_relative_path[ relative_path_index ] ),
+		     &( to_full_path[ to_full_path_index ] ),
+		     to_full_path_length - to_full_path_index ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free current working directory split string.",
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy to full path segments to relative path.",
 			 function );
 
 			goto on_error;
 		}
+		relative_path_index += to_full_path_length - to_full_path_index;
 	}
-	if( current_directory != NULL )
+	/* Remove the directory separator of the last ".." segment
+	 */
+	else if( relative_path_index > 0 )
 	{
-		memory_free(
-		 current_directory );
+		relative_path_index--;
 	}
-	*full_path      = safe_full_path;
-	*full_path_size = safe_full_path_size;
+	else
+	{
+		safe_relative_path[ relative_path_index++ ] = (wchar_t) '.';
+	}
+	safe_relative_path[ relative_path_index++ ] = 0;
+
+	memory_free(
+	 to_full_path );
+
+	memory_free(
+	 from_full_path );
+
+	*relative_path      = safe_relative_path;
+	*relative_path_size = relative_path_index;
 
 	return( 1 );
 
 on_error:
-	if( safe_full_path != NULL )
+	if( safe_relative_path != NULL )
 	{
 		memory_free(
-		 safe_full_path );
-	}
-	if( path_split_string != NULL )
-	{
-		libcsplit_wide_split_string_free(
-		 &path_split_string,
-		 NULL );
+		 safe_relative_path );
 	}
-	if( current_directory_split_string != NULL )
+	if( to_full_path != NULL )
 	{
-		libcsplit_wide_split_string_free(
-		 &current_directory_split_string,
-		 NULL );
+		memory_free(
+		 to_full_path );
 	}
-	if( current_directory != NULL )
+	if( from_full_path != NULL )
 	{
 		memory_free(
-		 current_directory );
+		 from_full_path );
 	}
 	return( -1 );
 }
 
-#endif /* defined( WINAPI ) */
+#if defined( WINAPI ) && ( WINVER <= 0x0500 )
 
-/* Retrieves the size of a sanitized version of the path character
- * Returns 1 if successful or -1 on error
+/* Cross Windows safe version of CreateDirectoryW
+ * Returns TRUE if successful or FALSE on error
  */
-int libcpath_path_get_sanitized_character_size_wide(
-     wchar_t character,
-     size_t *sanitized_character_size,
-     libcerror_error_t **error )
+BOOL libcpath_CreateDirectoryW(
+      LPCWSTR path,
+      SECURITY_ATTRIBUTES *security_attributes )
 {
-	static char *function = "libcpath_path_get_sanitized_character_size_wide";
-
-	if( sanitized_character_size == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized character size.",
-		 function );
+	FARPROC function       = NULL;
+	HMODULE library_handle = NULL;
+	BOOL result            = FALSE;
 
-		return( -1 );
-	}
-	if( ( character >= 0x00 )
-	 && ( character <= 0x1f ) )
-	{
-		*sanitized_character_size = 4;
-	}
-	else if( character == (wchar_t) LIBCPATH_ESCAPE_CHARACTER )
-	{
-		*sanitized_character_size = 2;
-	}
-#if defined( WINAPI )
-	else if( character == (wchar_t) '/' )
-	{
-		*sanitized_character_size = 4;
-	}
-#endif
-	else if( ( character == (wchar_t) '!' )
-	      || ( character == (wchar_t) '$' )
-	      || ( character == (wchar_t) '%' )
-	      || ( character == (wchar_t) '&' )
-	      || ( character == (wchar_t) '*' )
-	      || ( character == (wchar_t) '+' )
-	      || ( character == (wchar_t) ':' )
-	      || ( character == (wchar_t) ';' )
-	      || ( character == (wchar_t) '<' )
-	      || ( character == (wchar_t) '>' )
-	      || ( character == (wchar_t) '?' )
-	      || ( character == (wchar_t) '|' )
-	      || ( character == 0x7f ) )
-	{
-		*sanitized_character_size = 4;
-	}
-	else
+	if( path == NULL )
 	{
-		*sanitized_character_size = 1;
+		return( 0 );
 	}
-	return( 1 );
-}
-
-/* Retrieves a sanitized version of the path character
- * Returns 1 if successful or -1 on error
- */
-int libcpath_path_get_sanitized_character_wide(
-     wchar_t character,
-     size_t sanitized_character_size,
-     wchar_t *sanitized_path,
-     size_t sanitized_path_size,
-     size_t *sanitized_path_index,
-     libcerror_error_t **error )
-{
-	static char *function            = "libcpath_path_get_sanitized_character_wide";
-	size_t safe_sanitized_path_index = 0;
-	wchar_t lower_nibble             = 0;
-	wchar_t upper_nibble             = 0;
+	library_handle = LoadLibrary(
+	                  _SYSTEM_STRING( "kernel32.dll" ) );
 
-	if( ( sanitized_character_size != 1 )
-	 && ( sanitized_character_size != 2 )
-	 && ( sanitized_character_size != 4 ) )
+	if( library_handle == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid sanitized character size value out of bounds.",
-		 function );
+		return( 0 );
+	}
+	function = GetProcAddress(
+		    library_handle,
+		    (LPCSTR) "CreateDirectoryW" );
 
-		return( -1 );
+	if( function != NULL )
+	{
+		result = function(
+			  path,
+			  security_attributes );
 	}
-	if( sanitized_path == NULL )
+	/* This call should be after using the function
+	 * in most cases kernel32.dll will still be available after free
+	 */
+	if( FreeLibrary(
+	     library_handle ) != TRUE )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized path.",
-		 function );
+		libcpath_CloseHandle(
+		 library_handle );
 
-		return( -1 );
+		return( 0 );
 	}
-	if( sanitized_path_size > (size_t) SSIZE_MAX )
+	return( result );
+}
+
+#endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+
+#if defined( WINAPI )
+
+/* Makes the directory and retrieves the system error code
+ * This function uses the WINAPI function for Windows XP (0x0501) or later
+ * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
+ * The error code contains the system error code if the directory could not be made
+ * A file that is not a directory with the same name is considered an error
+ * Returns 1 if successful, 0 if the directory already exists or -1 on error
+ */
+int libcpath_internal_path_make_directory_wide_with_error_code(
+     const wchar_t *directory_name,
+     uint32_t *error_code,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_make_directory_wide_with_error_code";
+	DWORD file_attributes = 0;
+
+	if( directory_name == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid sanitized path size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
 		 function );
 
 		return( -1 );
 	}
-	if( sanitized_path_index == NULL )
+	if( error_code == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized path index.",
+		 "%s: invalid error code.",
 		 function );
 
 		return( -1 );
 	}
-	safe_sanitized_path_index = *sanitized_path_index;
+	*error_code = 0;
 
-	if( safe_sanitized_path_index > sanitized_path_size )
+#if WINVER <= 0x0500
+	if( libcpath_CreateDirectoryW(
+	     directory_name,
+	     NULL ) == 0 )
+#else
+	if( CreateDirectoryW(
+	     directory_name,
+	     NULL ) == 0 )
+#endif
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid sanitized path index value out of bounds.",
-		 function );
+		*error_code = (uint32_t) GetLastError();
 
-		return( -1 );
-	}
-	if( ( sanitized_character_size > sanitized_path_size )
-	 || ( safe_sanitized_path_index > ( sanitized_path_size - sanitized_character_size ) ) )
-	{
-		libcerror_error_set(
+		/* Only an existing directory is considered to be already made
+		 */
+		if( *error_code == (uint32_t) ERROR_ALREADY_EXISTS )
+		{
+			file_attributes = GetFileAttributesW(
+			                   directory_name );
+
+			if( ( file_attributes != INVALID_FILE_ATTRIBUTES )
+			 && ( ( file_attributes & FILE_ATTRIBUTE_DIRECTORY ) != 0 ) )
+			{
+				return( 0 );
+			}
+		}
+		libcerror_system_set_error(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-		 "%s: invalid sanitized path size value too small.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 *error_code,
+		 "%s: unable to make directory.",
 		 function );
 
 		return( -1 );
 	}
-	if( sanitized_character_size == 1 )
-	{
-		sanitized_path[ safe_sanitized_path_index++ ] = character;
-	}
-	else if( sanitized_character_size == 2 )
-	{
-		sanitized_path[ safe_sanitized_path_index++ ] = (wchar_t) LIBCPATH_ESCAPE_CHARACTER;
-		sanitized_path[ safe_sanitized_path_index++ ] = (wchar_t) LIBCPATH_ESCAPE_CHARACTER;
-	}
-	else if( sanitized_character_size == 4 )
-	{
-		lower_nibble = character & 0x0f;
-		upper_nibble = ( character >> 4 ) & 0x0f;
-
-		if( lower_nibble > 10 )
-		{
-			lower_nibble += (wchar_t) 'a' - 10;
-		}
-		else
-		{
-			lower_nibble += '0';
-		}
-		if( upper_nibble > 10 )
-		{
-			upper_nibble += (wchar_t) 'a' - 10;
-		}
-		else
-		{
-			upper_nibble += '0';
-		}
-		sanitized_path[ safe_sanitized_path_index++ ] = (wchar_t) LIBCPATH_ESCAPE_CHARACTER;
-		sanitized_path[ safe_sanitized_path_index++ ] = (wchar_t) 'x';
-		sanitized_path[ safe_sanitized_path_index++ ] = upper_nibble;
-		sanitized_path[ safe_sanitized_path_index++ ] = lower_nibble;
-	}
-	*sanitized_path_index = safe_sanitized_path_index;
-
 	return( 1 );
 }
 
-/* Retrieves a sanitized version of the filename
- * Returns 1 if successful or -1 on error
+#elif defined( HAVE_MKDIR )
+
+/* Makes the directory and retrieves the system error code
+ * This function uses the POSIX mkdir function or equivalent
+ * The error code contains the system error code if the directory could not be made
+ * A file that is not a directory with the same name is considered an error
+ * Returns 1 if successful, 0 if the directory already exists or -1 on error
  */
-int libcpath_path_get_sanitized_filename_wide(
-     const wchar_t *filename,
-     size_t filename_length,
-     wchar_t **sanitized_filename,
-     size_t *sanitized_filename_size,
+int libcpath_internal_path_make_directory_wide_with_error_code(
+     const wchar_t *directory_name,
+     uint32_t *error_code,
      libcerror_error_t **error )
 {
-	static char *function               = "libcpath_path_get_sanitized_filename_wide";
-	wchar_t *safe_sanitized_filename    = NULL;
-	size_t filename_index               = 0;
-	size_t sanitized_character_size     = 0;
-	size_t safe_sanitized_filename_size = 0;
-	size_t sanitized_filename_index     = 0;
+	char narrow_directory_name_buffer[ LIBCPATH_SYSTEM_STRING_BUFFER_SIZE ];
 
-	if( filename == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
-		 function );
+	struct stat file_statistics;
 
-		return( -1 );
-	}
-	if( ( filename_length == 0 )
-	 || ( filename_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	static char *function             = "libcpath_path_make_directory_wide_with_error_code";
+	char *narrow_directory_name       = 0;
+	size_t directory_name_length      = 0;
+	size_t narrow_directory_name_size = 0;
+	int result                        = 1;
+
+	if( directory_name == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid filename length value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
 		 function );
 
 		return( -1 );
 	}
-	if( sanitized_filename == NULL )
+	if( error_code == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized filename.",
+		 "%s: invalid error code.",
 		 function );
 
 		return( -1 );
 	}
-	if( *sanitized_filename != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid sanitized filename value already set.",
-		 function );
+	*error_code = 0;
 
-		return( -1 );
-	}
-	if( sanitized_filename_size == NULL )
+	directory_name_length = wide_string_length(
+	                         directory_name );
+
+	if( libcpath_system_string_convert_from_wide_string_with_buffer(
+	     directory_name,
+	     directory_name_length + 1,
+	     narrow_directory_name_buffer,
+	     LIBCPATH_SYSTEM_STRING_BUFFER_SIZE,
+	     &narrow_directory_name,
+	     &narrow_directory_name_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized filename size.",
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set name.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	safe_sanitized_filename_size = 1;
-
-	for( filename_index = 0;
-	     filename_index < filename_length;
-	     filename_index++ )
+#if defined( __MINGW32__ ) || defined( _MSC_VER )
+	if( mkdir(
+	     narrow_directory_name ) != 0 )
+#else
+	if( mkdir(
+	     narrow_directory_name,
+	     0755 ) != 0 )
+#endif
 	{
-		if( filename[ filename_index ] == LIBCPATH_SEPARATOR )
+		*error_code = (uint32_t) errno;
+
+		/* Only an existing directory is considered to be already made
+		 */
+		if( ( *error_code == (uint32_t) EEXIST )
+		 && ( stat(
+		       narrow_directory_name,
+		       &file_statistics ) == 0 )
+		 && S_ISDIR( file_statistics.st_mode ) )
 		{
-			sanitized_character_size = 4;
+			result = 0;
 		}
-		else if( libcpath_path_get_sanitized_character_size_wide(
-		          filename[ filename_index ],
-		          &sanitized_character_size,
-		          error ) != 1 )
+		else
 		{
-			libcerror_error_set(
+			libcerror_system_set_error(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sanitize character size.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 *error_code,
+			 "%s: unable to make directory.",
 			 function );
 
 			goto on_error;
 		}
-		safe_sanitized_filename_size += sanitized_character_size;
 	}
-	if( safe_sanitized_filename_size > (size_t) SSIZE_MAX )
+	if( narrow_directory_name != narrow_directory_name_buffer )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid sanitized filename size value exceeds maximum.",
-		 function );
-
-		goto on_error;
+		memory_free(
+		 narrow_directory_name );
 	}
-	safe_sanitized_filename = wide_string_allocate(
-	                           safe_sanitized_filename_size );
+	return( result );
 
-	if( safe_sanitized_filename == NULL )
+on_error:
+	if( ( narrow_directory_name != NULL )
+	 && ( narrow_directory_name != narrow_directory_name_buffer ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create sanitized filename.",
-		 function );
-
-		goto on_error;
+		memory_free(
+		 narrow_directory_name );
 	}
-	for( filename_index = 0;
-	     filename_index < filename_length;
-	     filename_index++ )
-	{
-		if( filename[ filename_index ] == LIBCPATH_SEPARATOR )
-		{
-			sanitized_character_size = 4;
-		}
-		else if( libcpath_path_get_sanitized_character_size_wide(
-		          filename[ filename_index ],
-		          &sanitized_character_size,
-		          error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sanitize character size.",
-			 function );
+	return( -1 );
+}
 
-			goto on_error;
-		}
-		if( libcpath_path_get_sanitized_character_wide(
-		     filename[ filename_index ],
-		     sanitized_character_size,
-		     safe_sanitized_filename,
-		     safe_sanitized_filename_size,
-		     &sanitized_filename_index,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sanitize character size.",
-			 function );
+#else
+#error Missing make directory function
+#endif
 
-			goto on_error;
-		}
-	}
-	safe_sanitized_filename[ sanitized_filename_index ] = 0;
+/* Makes the directory
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_make_directory_wide(
+     const wchar_t *directory_name,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_make_directory_wide";
+	uint32_t error_code   = 0;
+	int result            = 0;
 
-	*sanitized_filename      = safe_sanitized_filename;
-	*sanitized_filename_size = safe_sanitized_filename_size;
+	result = libcpath_internal_path_make_directory_wide_with_error_code(
+	          directory_name,
+	          &error_code,
+	          error );
 
-	return( 1 );
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to make directory.",
+		 function );
 
-on_error:
-	if( safe_sanitized_filename != NULL )
+		return( -1 );
+	}
+	else if( result == 0 )
 	{
-		memory_free(
-		 safe_sanitized_filename );
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 error_code,
+		 "%s: unable to make directory.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Retrieves a sanitized version of the path
+/* Determines the length of the root of a path
+ * The root consists of the leading directory separators and on Windows
+ * a volume, such as "C:", or an UNC server and share name
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_get_sanitized_path_wide(
+int libcpath_path_get_root_length_wide(
      const wchar_t *path,
      size_t path_length,
-     wchar_t **sanitized_path,
-     size_t *sanitized_path_size,
+     size_t *root_length,
      libcerror_error_t **error )
 {
-	static char *function                    = "libcpath_path_get_sanitized_path_wide";
-	wchar_t *safe_sanitized_path             = NULL;
-	size_t path_index                        = 0;
-	size_t safe_sanitized_path_size          = 0;
-	size_t sanitized_character_size          = 0;
-	size_t sanitized_path_index              = 0;
-
-#if defined( WINAPI )
-	size_t last_path_segment_seperator_index = 0;
-#endif
+	static char *function = "libcpath_path_get_root_length_wide";
+	size_t path_index     = 0;
 
 	if( path == NULL )
 	{
@@ -6924,234 +14958,357 @@ int libcpath_path_get_sanitized_path_wide(
 
 		return( -1 );
 	}
-	if( ( path_length == 0 )
-	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	if( path_length > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid path length value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( sanitized_path == NULL )
+	if( root_length == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized path.",
+		 "%s: invalid root length.",
 		 function );
 
 		return( -1 );
 	}
-	if( *sanitized_path != NULL )
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	if( ( path_length >= 2 )
+	 && ( path[ 1 ] == (wchar_t) ':' ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid sanitized path value already set.",
-		 function );
+		path_index = 2;
+	}
+	else if( ( path_length >= 2 )
+	      && ( path[ 0 ] == (wchar_t) LIBCPATH_SEPARATOR )
+	      && ( path[ 1 ] == (wchar_t) LIBCPATH_SEPARATOR ) )
+	{
+		path_index = 2;
 
-		return( -1 );
+		/* Skip the server name
+		 */
+		while( ( path_index < path_length )
+		    && ( path[ path_index ] != (wchar_t) LIBCPATH_SEPARATOR ) )
+		{
+			path_index++;
+		}
+		while( ( path_index < path_length )
+		    && ( path[ path_index ] == (wchar_t) LIBCPATH_SEPARATOR ) )
+		{
+			path_index++;
+		}
+		/* Skip the share name
+		 */
+		while( ( path_index < path_length )
+		    && ( path[ path_index ] != (wchar_t) LIBCPATH_SEPARATOR ) )
+		{
+			path_index++;
+		}
 	}
-	if( sanitized_path_size == NULL )
+#endif
+	while( ( path_index < path_length )
+	    && ( path[ path_index ] == (wchar_t) LIBCPATH_SEPARATOR ) )
+	{
+		path_index++;
+	}
+	*root_length = path_index;
+
+	return( 1 );
+}
+
+#if defined( WINAPI )
+
+/* Makes a single directory if it does not already exist
+ * This function uses the WINAPI function for Windows XP (0x0501) or later
+ * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
+ * Returns 1 if successful, 0 if the parent directory does not exist or -1 on error
+ */
+int libcpath_path_make_directory_component_wide(
+     const wchar_t *directory_name,
+     int mode LIBCPATH_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_path_make_directory_component_wide";
+	DWORD error_code      = 0;
+	DWORD file_attributes = 0;
+
+	LIBCPATH_UNREFERENCED_PARAMETER( mode )
+
+	if( directory_name == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid sanitized path size.",
+		 "%s: invalid directory name.",
 		 function );
 
 		return( -1 );
 	}
-	safe_sanitized_path_size = 1;
-
-	for( path_index = 0;
-	     path_index < path_length;
-	     path_index++ )
+#if WINVER <= 0x0500
+	if( libcpath_CreateDirectoryW(
+	     directory_name,
+	     NULL ) != 0 )
+#else
+	if( CreateDirectoryW(
+	     directory_name,
+	     NULL ) != 0 )
+#endif
 	{
-		if( libcpath_path_get_sanitized_character_size_wide(
-		     path[ path_index ],
-		     &sanitized_character_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sanitize character size.",
-			 function );
+		return( 1 );
+	}
+	error_code = GetLastError();
 
-			goto on_error;
-		}
-		safe_sanitized_path_size += sanitized_character_size;
+	if( error_code == ERROR_PATH_NOT_FOUND )
+	{
+		return( 0 );
+	}
+	if( error_code == ERROR_ALREADY_EXISTS )
+	{
+		file_attributes = GetFileAttributesW(
+		                   directory_name );
 
-#if defined( WINAPI )
-		if( path[ path_index ] == LIBCPATH_SEPARATOR )
+		if( ( file_attributes != INVALID_FILE_ATTRIBUTES )
+		 && ( ( file_attributes & FILE_ATTRIBUTE_DIRECTORY ) != 0 ) )
 		{
-			last_path_segment_seperator_index = path_index;
+			return( 1 );
 		}
-#endif
 	}
-	if( safe_sanitized_path_size > (size_t) SSIZE_MAX )
+	libcerror_system_set_error(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+	 error_code,
+	 "%s: unable to make directory.",
+	 function );
+
+	return( -1 );
+}
+
+/* Makes the directory and all of its missing parent directories
+ * The parent directories are probed from the deepest one upwards, so that
+ * for a mostly existing tree only the missing directories cost a system call
+ * The mode is ignored on Windows
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_make_directories_wide(
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error )
+{
+	wchar_t *safe_directory_name = NULL;
+	static char *function        = "libcpath_path_make_directories_wide";
+	size_t name_index            = 0;
+	size_t root_length           = 0;
+	size_t string_length         = 0;
+	int result                   = 0;
+
+	if( directory_name == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid sanitized path size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( WINAPI )
-	if( last_path_segment_seperator_index > 32767 )
+	if( ( directory_name_length == 0 )
+	 || ( directory_name_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine the part of the directory name that cannot be created
+	 * such as the root directory, a volume or an UNC share
+	 */
+	if( libcpath_path_get_root_length_wide(
+	     directory_name,
+	     directory_name_length,
+	     &root_length,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid last path segment separator value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine root length.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( safe_sanitized_path_size > 32767 )
+	string_length = directory_name_length;
+
+	while( ( string_length > root_length )
+	    && ( directory_name[ string_length - 1 ] == (wchar_t) LIBCPATH_SEPARATOR ) )
 	{
-		safe_sanitized_path_size = 32767;
+		string_length--;
 	}
-#endif
-	safe_sanitized_path = wide_string_allocate(
-	                       safe_sanitized_path_size );
+	if( string_length <= root_length )
+	{
+		return( 1 );
+	}
+	safe_directory_name = wide_string_allocate(
+	                       string_length + 1 );
 
-	if( safe_sanitized_path == NULL )
+	if( safe_directory_name == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create sanitized path.",
+		 "%s: unable to create directory name.",
 		 function );
 
 		goto on_error;
 	}
-	for( path_index = 0;
-	     path_index < path_length;
-	     path_index++ )
+	if( wide_string_copy(
+	     safe_directory_name,
+	     directory_name,
+	     string_length ) == NULL )
 	{
-		if( libcpath_path_get_sanitized_character_size_wide(
-		     path[ path_index ],
-		     &sanitized_character_size,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory name.",
+		 function );
+
+		goto on_error;
+	}
+	safe_directory_name[ string_length ] = 0;
+
+	directory_name_length = string_length;
+
+	/* Walk upwards until a directory could be made or already exists
+	 * the directory name is terminated at each parent directory that is tried
+	 */
+	do
+	{
+		result = libcpath_path_make_directory_component_wide(
+		          safe_directory_name,
+		          mode,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sanitize character size.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to make directory.",
 			 function );
 
 			goto on_error;
 		}
-		if( libcpath_path_get_sanitized_character_wide(
-		     path[ path_index ],
-		     sanitized_character_size,
-		     safe_sanitized_path,
-		     safe_sanitized_path_size,
-		     &sanitized_path_index,
+		else if( result == 0 )
+		{
+			name_index = string_length;
+
+			while( ( name_index > root_length )
+			    && ( safe_directory_name[ name_index - 1 ] != (wchar_t) LIBCPATH_SEPARATOR ) )
+			{
+				name_index--;
+			}
+			while( ( name_index > root_length )
+			    && ( safe_directory_name[ name_index - 1 ] == (wchar_t) LIBCPATH_SEPARATOR ) )
+			{
+				name_index--;
+			}
+			if( name_index <= root_length )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: missing parent directory.",
+				 function );
+
+				goto on_error;
+			}
+			safe_directory_name[ name_index ] = 0;
+
+			string_length = name_index;
+		}
+	}
+	while( result == 0 );
+
+	/* Walk downwards and make the remaining directories
+	 * which are known not to exist
+	 */
+	while( string_length < directory_name_length )
+	{
+		safe_directory_name[ string_length++ ] = (wchar_t) LIBCPATH_SEPARATOR;
+
+		while( ( string_length < directory_name_length )
+		    && ( safe_directory_name[ string_length ] != 0 ) )
+		{
+			string_length++;
+		}
+		if( libcpath_path_make_directory_component_wide(
+		     safe_directory_name,
+		     mode,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine sanitize character size.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to make directory.",
 			 function );
 
 			goto on_error;
 		}
 	}
-	if( sanitized_path_index >= safe_sanitized_path_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid sanitized path index value out of bounds.",
-		 function );
-
-		goto on_error;
-	}
-	safe_sanitized_path[ sanitized_path_index ] = 0;
-
-	*sanitized_path      = safe_sanitized_path;
-	*sanitized_path_size = safe_sanitized_path_size;
+	memory_free(
+	 safe_directory_name );
 
 	return( 1 );
 
 on_error:
-	if( safe_sanitized_path != NULL )
+	if( safe_directory_name != NULL )
 	{
 		memory_free(
-		 safe_sanitized_path );
+		 safe_directory_name );
 	}
 	return( -1 );
 }
 
-/* Combines the directory name and filename into a path
+#else
+
+/* Makes the directory and all of its missing parent directories
+ * This function converts the directory name to a narrow string once
+ * and uses libcpath_path_make_directories
+ * The mode is ignored on Windows
  * Returns 1 if successful or -1 on error
  */
-int libcpath_path_join_wide(
-     wchar_t **path,
-     size_t *path_size,
+int libcpath_internal_path_make_directories_wide(
      const wchar_t *directory_name,
      size_t directory_name_length,
-     const wchar_t *filename,
-     size_t filename_length,
+     int mode,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_path_join_wide";
-	size_t filename_index = 0;
-	size_t path_index     = 0;
-
-	if( path == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path.",
-		 function );
-
-		return( -1 );
-	}
-	if( *path != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid path value already set.",
-		 function );
+	char narrow_directory_name_buffer[ LIBCPATH_SYSTEM_STRING_BUFFER_SIZE ];
 
-		return( -1 );
-	}
-	if( path_size == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path size.",
-		 function );
+	char *narrow_directory_name       = NULL;
+	static char *function             = "libcpath_path_make_directories_wide";
+	size_t narrow_directory_name_size = 0;
 
-		return( -1 );
-	}
 	if( directory_name == NULL )
 	{
 		libcerror_error_set(
@@ -7163,346 +15320,682 @@ int libcpath_path_join_wide(
 
 		return( -1 );
 	}
-	if( directory_name_length > (size_t) SSIZE_MAX )
+	if( ( directory_name_length == 0 )
+	 || ( directory_name_length > (size_t) ( SSIZE_MAX - 1 ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid directory name length value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid directory name length value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( filename == NULL )
+	if( libcpath_system_string_convert_from_wide_string_with_buffer(
+	     directory_name,
+	     directory_name_length + 1,
+	     narrow_directory_name_buffer,
+	     LIBCPATH_SYSTEM_STRING_BUFFER_SIZE,
+	     &narrow_directory_name,
+	     &narrow_directory_name_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set narrow directory name.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( filename_length > (size_t) SSIZE_MAX )
+	if( libcpath_internal_path_make_directories(
+	     narrow_directory_name,
+	     narrow_directory_name_size - 1,
+	     mode,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid filename length value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to make directories.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-/* TODO strip other patterns like /./ */
-	while( directory_name_length > 0 )
+	if( narrow_directory_name != narrow_directory_name_buffer )
 	{
-		if( directory_name[ directory_name_length - 1 ] != (wchar_t) LIBCPATH_SEPARATOR )
-		{
-			break;
-		}
-		directory_name_length--;
+		memory_free(
+		 narrow_directory_name );
 	}
-	while( filename_length > 0 )
+	return( 1 );
+
+on_error:
+	if( ( narrow_directory_name != NULL )
+	 && ( narrow_directory_name != narrow_directory_name_buffer ) )
 	{
-		if( filename[ filename_index ] != (wchar_t) LIBCPATH_SEPARATOR )
-		{
-			break;
-		}
-		filename_index++;
-		filename_length--;
+		memory_free(
+		 narrow_directory_name );
 	}
-	*path_size = directory_name_length + filename_length + 2;
+	return( -1 );
+}
 
-	*path = wide_string_allocate(
-	         *path_size );
+#endif /* defined( WINAPI ) */
+
+/* The public functions below record statistics about their calls
+ * and call the corresponding internal function
+ */
+
+/* Changes the directory
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_change_directory_wide(
+     const wchar_t *directory_name,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_CHANGE_DIRECTORY_WIDE );
+
+	result = libcpath_internal_path_change_directory_wide(
+	          directory_name,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Changes the directory and retrieves the system error code
+ * The error code contains the system error code if the directory could not be changed
+ * No error is set when 0 is returned
+ * Returns 1 if successful, 0 if the directory does not exist or -1 on error
+ */
+int libcpath_path_change_directory_wide_with_error_code(
+     const wchar_t *directory_name,
+     uint32_t *error_code,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_CHANGE_DIRECTORY_WIDE_WITH_ERROR_CODE );
+
+	result = libcpath_internal_path_change_directory_wide_with_error_code(
+	          directory_name,
+	          error_code,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Retrieves the current working directory
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_current_working_directory_wide(
+     wchar_t **current_working_directory,
+     size_t *current_working_directory_size,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_GET_CURRENT_WORKING_DIRECTORY_WIDE );
+
+	result = libcpath_internal_path_get_current_working_directory_wide(
+	          current_working_directory,
+	          current_working_directory_size,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Determines the full path of the path specified
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_full_path_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_GET_FULL_PATH_WIDE );
+
+	result = libcpath_internal_path_get_full_path_wide(
+	          path,
+	          path_length,
+	          full_path,
+	          full_path_size,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Determines the full path of the path specified into a buffer
+ * The required full path size is set, also when the full path is too small
+ * Returns 1 if successful, 0 if the full path is too small or -1 on error
+ */
+int libcpath_path_get_full_path_to_buffer_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_GET_FULL_PATH_TO_BUFFER_WIDE );
+
+	result = libcpath_internal_path_get_full_path_to_buffer_wide(
+	          path,
+	          path_length,
+	          full_path,
+	          full_path_size,
+	          required_full_path_size,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Determines the full paths of the paths specified
+ * The full paths are stored as consecutive strings in one buffer, the offset
+ * of each full path in the buffer is stored in the full path offsets.
+ * Both the full paths and the full path offsets should be freed after use
+ * If the number of paths is 0 the full paths and full path offsets are not set
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_full_paths_wide(
+     const wchar_t **paths,
+     const size_t *path_lengths,
+     int number_of_paths,
+     wchar_t **full_paths,
+     size_t *full_paths_size,
+     size_t **full_path_offsets,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_GET_FULL_PATHS_WIDE );
+
+	result = libcpath_internal_path_get_full_paths_wide(
+	          paths,
+	          path_lengths,
+	          number_of_paths,
+	          full_paths,
+	          full_paths_size,
+	          full_path_offsets,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Retrieves a sanitized version of the filename
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_sanitized_filename_wide(
+     const wchar_t *filename,
+     size_t filename_length,
+     wchar_t **sanitized_filename,
+     size_t *sanitized_filename_size,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_GET_SANITIZED_FILENAME_WIDE );
+
+	result = libcpath_internal_path_get_sanitized_filename_wide(
+	          filename,
+	          filename_length,
+	          sanitized_filename,
+	          sanitized_filename_size,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Retrieves a sanitized version of the filename into a buffer
+ * The required sanitized filename size is set, also when the sanitized filename is too small
+ * Returns 1 if successful, 0 if the sanitized filename is too small or -1 on error
+ */
+int libcpath_path_get_sanitized_filename_to_buffer_wide(
+     const wchar_t *filename,
+     size_t filename_length,
+     wchar_t *sanitized_filename,
+     size_t sanitized_filename_size,
+     size_t *required_sanitized_filename_size,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_GET_SANITIZED_FILENAME_TO_BUFFER_WIDE );
+
+	result = libcpath_internal_path_get_sanitized_filename_to_buffer_wide(
+	          filename,
+	          filename_length,
+	          sanitized_filename,
+	          sanitized_filename_size,
+	          required_sanitized_filename_size,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Retrieves a sanitized version of the path
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_sanitized_path_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **sanitized_path,
+     size_t *sanitized_path_size,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_GET_SANITIZED_PATH_WIDE );
+
+	result = libcpath_internal_path_get_sanitized_path_wide(
+	          path,
+	          path_length,
+	          sanitized_path,
+	          sanitized_path_size,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Retrieves a sanitized version of the path into a buffer
+ * The required sanitized path size is set, also when the sanitized path is too small
+ * Returns 1 if successful, 0 if the sanitized path is too small or -1 on error
+ */
+int libcpath_path_get_sanitized_path_to_buffer_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *sanitized_path,
+     size_t sanitized_path_size,
+     size_t *required_sanitized_path_size,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_GET_SANITIZED_PATH_TO_BUFFER_WIDE );
+
+	result = libcpath_internal_path_get_sanitized_path_to_buffer_wide(
+	          path,
+	          path_length,
+	          sanitized_path,
+	          sanitized_path_size,
+	          required_sanitized_path_size,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Retrieves an unsanitized version of the filename
+ * This reverses libcpath_path_get_sanitized_filename_wide
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_unsanitized_filename_wide(
+     const wchar_t *sanitized_filename,
+     size_t sanitized_filename_length,
+     wchar_t **filename,
+     size_t *filename_size,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_GET_UNSANITIZED_FILENAME_WIDE );
+
+	result = libcpath_internal_path_get_unsanitized_filename_wide(
+	          sanitized_filename,
+	          sanitized_filename_length,
+	          filename,
+	          filename_size,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Retrieves an unsanitized version of the path
+ * This reverses libcpath_path_get_sanitized_path_wide
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_get_unsanitized_path_wide(
+     const wchar_t *sanitized_path,
+     size_t sanitized_path_length,
+     wchar_t **path,
+     size_t *path_size,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
+
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_GET_UNSANITIZED_PATH_WIDE );
+
+	result = libcpath_internal_path_get_unsanitized_path_wide(
+	          sanitized_path,
+	          sanitized_path_length,
+	          path,
+	          path_size,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
+
+/* Combines the directory name and filename into a path
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_join_wide(
+     wchar_t **path,
+     size_t *path_size,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
 
-	if( *path == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create path.",
-		 function );
+	int result = 0;
 
-		goto on_error;
-	}
-	if( wide_string_copy(
-	     *path,
-	     directory_name,
-	     directory_name_length ) == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy directory name to path.",
-		 function );
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_JOIN_WIDE );
 
-		goto on_error;
-	}
-	path_index = directory_name_length;
+	result = libcpath_internal_path_join_wide(
+	          path,
+	          path_size,
+	          directory_name,
+	          directory_name_length,
+	          filename,
+	          filename_length,
+	          error );
 
-	( *path )[ path_index++ ] = (wchar_t) LIBCPATH_SEPARATOR;
+	libcpath_statistics_call_stop(
+	 &statistics_call );
 
-	if( wide_string_copy(
-	     &( ( *path )[ path_index ] ),
-	     &( filename[ filename_index ] ),
-	     filename_length ) == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy filename to path.",
-		 function );
+	return( result );
+}
 
-		goto on_error;
-	}
-	path_index += filename_length;
+/* Combines the directory name and filename into a path buffer
+ * The required path size is set, also when the path is too small
+ * Returns 1 if successful, 0 if the path is too small or -1 on error
+ */
+int libcpath_path_join_to_buffer_wide(
+     wchar_t *path,
+     size_t path_size,
+     size_t *required_path_size,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
 
-	( *path )[ path_index ] = 0;
+	int result = 0;
 
-	return( 1 );
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_JOIN_TO_BUFFER_WIDE );
 
-on_error:
-	if( *path != NULL )
-	{
-		memory_free(
-		 *path );
+	result = libcpath_internal_path_join_to_buffer_wide(
+	          path,
+	          path_size,
+	          required_path_size,
+	          directory_name,
+	          directory_name_length,
+	          filename,
+	          filename_length,
+	          error );
 
-		*path = NULL;
-	}
-	*path_size = 0;
+	libcpath_statistics_call_stop(
+	 &statistics_call );
 
-	return( -1 );
+	return( result );
 }
 
-#if defined( WINAPI ) && ( WINVER <= 0x0500 )
-
-/* Cross Windows safe version of CreateDirectoryW
- * Returns TRUE if successful or FALSE on error
+/* Combines the directory name and filename into a lexically normalized path
+ * Empty and "." segments are removed and ".." segments are applied
+ * The file system is not accessed, hence symbolic links are not resolved
+ * Returns 1 if successful or -1 on error
  */
-BOOL libcpath_CreateDirectoryW(
-      LPCWSTR path,
-      SECURITY_ATTRIBUTES *security_attributes )
+int libcpath_path_join_normalized_wide(
+     wchar_t **path,
+     size_t *path_size,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
 {
-	FARPROC function       = NULL;
-	HMODULE library_handle = NULL;
-	BOOL result            = FALSE;
+	libcpath_statistics_call_t statistics_call;
 
-	if( path == NULL )
-	{
-		return( 0 );
-	}
-	library_handle = LoadLibrary(
-	                  _SYSTEM_STRING( "kernel32.dll" ) );
+	int result = 0;
 
-	if( library_handle == NULL )
-	{
-		return( 0 );
-	}
-	function = GetProcAddress(
-		    library_handle,
-		    (LPCSTR) "CreateDirectoryW" );
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_JOIN_NORMALIZED_WIDE );
 
-	if( function != NULL )
-	{
-		result = function(
-			  path,
-			  security_attributes );
-	}
-	/* This call should be after using the function
-	 * in most cases kernel32.dll will still be available after free
-	 */
-	if( FreeLibrary(
-	     library_handle ) != TRUE )
-	{
-		libcpath_CloseHandle(
-		 library_handle );
+	result = libcpath_internal_path_join_normalized_wide(
+	          path,
+	          path_size,
+	          directory_name,
+	          directory_name_length,
+	          filename,
+	          filename_length,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
 
-		return( 0 );
-	}
 	return( result );
 }
 
-#endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+/* Determines the relative path from a (directory) path to another path
+ * Both paths are made full paths before their segments are compared
+ * Returns 1 if successful, 0 if no relative path exists or -1 on error
+ */
+int libcpath_path_get_relative_path_wide(
+     const wchar_t *from_path,
+     size_t from_path_length,
+     const wchar_t *to_path,
+     size_t to_path_length,
+     wchar_t **relative_path,
+     size_t *relative_path_size,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
 
-#if defined( WINAPI )
+	int result = 0;
+
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_GET_RELATIVE_PATH_WIDE );
+
+	result = libcpath_internal_path_get_relative_path_wide(
+	          from_path,
+	          from_path_length,
+	          to_path,
+	          to_path_length,
+	          relative_path,
+	          relative_path_size,
+	          error );
+
+	libcpath_statistics_call_stop(
+	 &statistics_call );
+
+	return( result );
+}
 
 /* Makes the directory
- * This function uses the WINAPI function for Windows XP (0x0501) or later
- * or tries to dynamically call the function for Windows 2000 (0x0500) or earlier
  * Returns 1 if successful or -1 on error
  */
 int libcpath_path_make_directory_wide(
      const wchar_t *directory_name,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_path_make_directory_wide";
-	DWORD error_code      = 0;
+	libcpath_statistics_call_t statistics_call;
 
-	if( directory_name == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory name.",
-		 function );
+	int result = 0;
 
-		return( -1 );
-	}
-#if WINVER <= 0x0500
-	if( libcpath_CreateDirectoryW(
-	     directory_name,
-	     NULL ) == 0 )
-#else
-	if( CreateDirectoryW(
-	     directory_name,
-	     NULL ) == 0 )
-#endif
-	{
-		error_code = GetLastError();
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_MAKE_DIRECTORY_WIDE );
 
-		libcerror_system_set_error(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 error_code,
-		 "%s: unable to make directory.",
-		 function );
+	result = libcpath_internal_path_make_directory_wide(
+	          directory_name,
+	          error );
 
-		return( -1 );
-	}
-	return( 1 );
-}
+	libcpath_statistics_call_stop(
+	 &statistics_call );
 
-#elif defined( HAVE_MKDIR )
+	return( result );
+}
 
-/* Makes the directory
- * This function uses the POSIX mkdir function or equivalent
- * Returns 1 if successful or -1 on error
+/* Makes the directory and retrieves the system error code
+ * The error code contains the system error code if the directory could not be made
+ * No error is set when 0 is returned
+ * Returns 1 if successful, 0 if the directory already exists or -1 on error
  */
-int libcpath_path_make_directory_wide(
+int libcpath_path_make_directory_wide_with_error_code(
      const wchar_t *directory_name,
+     uint32_t *error_code,
      libcerror_error_t **error )
 {
-	static char *function             = "libcpath_path_make_directory_wide";
-	char *narrow_directory_name       = 0;
-	size_t directory_name_length      = 0;
-	size_t narrow_directory_name_size = 0;
+	libcpath_statistics_call_t statistics_call;
 
-	if( directory_name == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid directory name.",
-		 function );
+	int result = 0;
 
-		return( -1 );
-	}
-	directory_name_length = wide_string_length(
-	                         directory_name );
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_MAKE_DIRECTORY_WIDE_WITH_ERROR_CODE );
 
-	if( libcpath_system_string_size_from_wide_string(
-	     directory_name,
-	     directory_name_length + 1,
-	     &narrow_directory_name_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine narrow directory name size.",
-		 function );
+	result = libcpath_internal_path_make_directory_wide_with_error_code(
+	          directory_name,
+	          error_code,
+	          error );
 
-		goto on_error;
-	}
-	if( ( narrow_directory_name_size > (size_t) SSIZE_MAX )
-	 || ( ( sizeof( char ) * narrow_directory_name_size )  > (size_t) SSIZE_MAX ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid narrow directory name size value exceeds maximum.",
-		 function );
+	libcpath_statistics_call_stop(
+	 &statistics_call );
 
-		goto on_error;
-	}
-	narrow_directory_name = narrow_string_allocate(
-	                         narrow_directory_name_size );
+	return( result );
+}
 
-	if( narrow_directory_name == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create narrow directory name.",
-		 function );
+/* Makes the directory and all of its missing parent directories
+ * The mode is ignored on Windows
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_make_directories_wide(
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error )
+{
+	libcpath_statistics_call_t statistics_call;
 
-		goto on_error;
-	}
-	if( libcpath_system_string_copy_from_wide_string(
-	     narrow_directory_name,
-	     narrow_directory_name_size,
-	     directory_name,
-	     directory_name_length + 1,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to set name.",
-		 function );
+	int result = 0;
 
-		goto on_error;
-	}
-#if defined( __MINGW32__ ) || defined( _MSC_VER )
-	if( mkdir(
-	     narrow_directory_name ) != 0 )
-#else
-	if( mkdir(
-	     narrow_directory_name,
-	     0755 ) != 0 )
-#endif
-	{
-		libcerror_system_set_error(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 errno,
-		 "%s: unable to make directory.",
-		 function );
+	libcpath_statistics_call_start(
+	 &statistics_call,
+	 LIBCPATH_STATISTICS_FUNCTION_PATH_MAKE_DIRECTORIES_WIDE );
 
-		goto on_error;
-	}
-	memory_free(
-	 narrow_directory_name );
+	result = libcpath_internal_path_make_directories_wide(
+	          directory_name,
+	          directory_name_length,
+	          mode,
+	          error );
 
-	return( 1 );
+	libcpath_statistics_call_stop(
+	 &statistics_call );
 
-on_error:
-	if( narrow_directory_name != NULL )
-	{
-		memory_free(
-		 narrow_directory_name );
-	}
-	return( -1 );
+	return( result );
 }
 
-#else
-#error Missing make directory function
-#endif
-
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
@@ -51,6 +51,21 @@ int libcpath_path_change_directory(
      const char *directory_name,
      libcerror_error_t **error );
 
+int libcpath_internal_path_change_directory(
+     const char *directory_name,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_change_directory_with_error_code(
+     const char *directory_name,
+     uint32_t *error_code,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_change_directory_with_error_code(
+     const char *directory_name,
+     uint32_t *error_code,
+     libcerror_error_t **error );
+
 #if defined( WINAPI ) && ( WINVER <= 0x0500 )
 
 DWORD libcpath_GetCurrentDirectoryA(
@@ -65,6 +80,42 @@ int libcpath_path_get_current_working_directory(
      size_t *current_working_directory_size,
      libcerror_error_t **error );
 
+int libcpath_internal_path_get_current_working_directory(
+     char **current_working_directory,
+     size_t *current_working_directory_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_current_working_directory_exact(
+     char **current_working_directory,
+     size_t *current_working_directory_size,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_get_current_working_directory_exact(
+     char **current_working_directory,
+     size_t *current_working_directory_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_enable_current_working_directory_cache(
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_disable_current_working_directory_cache(
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_refresh_current_working_directory_cache(
+     libcerror_error_t **error );
+
+int libcpath_path_clear_current_working_directory_cache(
+     libcerror_error_t **error );
+
+int libcpath_path_get_cached_current_working_directory(
+     const char **current_working_directory,
+     size_t *current_working_directory_length,
+     libcerror_error_t **error );
+
 #if defined( WINAPI ) && ( WINVER <= 0x0500 )
 
 DWORD libcpath_GetFullPathNameA(
@@ -75,6 +126,16 @@ DWORD libcpath_GetFullPathNameA(
 
 #endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
 
+LIBCPATH_EXTERN \
+int libcpath_path_parse_windows_path(
+     const char *path,
+     size_t path_length,
+     uint8_t *path_type,
+     size_t *volume_name_index,
+     size_t *volume_name_length,
+     size_t *directory_name_index,
+     libcerror_error_t **error );
+
 #if defined( WINAPI )
 
 int libcpath_path_get_path_type(
@@ -108,6 +169,107 @@ int libcpath_path_get_full_path(
      size_t *full_path_size,
      libcerror_error_t **error );
 
+int libcpath_internal_path_get_full_path(
+     const char *path,
+     size_t path_length,
+     char **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_full_path_to_buffer(
+     const char *path,
+     size_t path_length,
+     char *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_get_full_path_to_buffer(
+     const char *path,
+     size_t path_length,
+     char *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_full_paths(
+     const char **paths,
+     const size_t *path_lengths,
+     int number_of_paths,
+     char **full_paths,
+     size_t *full_paths_size,
+     size_t **full_path_offsets,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_get_full_paths(
+     const char **paths,
+     const size_t *path_lengths,
+     int number_of_paths,
+     char **full_paths,
+     size_t *full_paths_size,
+     size_t **full_path_offsets,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_first_segment(
+     const char *path,
+     size_t path_length,
+     size_t *path_index,
+     const char **segment,
+     size_t *segment_length,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_next_segment(
+     const char *path,
+     size_t path_length,
+     size_t *path_index,
+     const char **segment,
+     size_t *segment_length,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libcpath_path_append_normalized_segments(
+     char *full_path,
+     size_t full_path_size,
+     size_t full_path_prefix_length,
+     size_t *full_path_index,
+     const char *path,
+     size_t path_length,
+     libcerror_error_t **error );
+
+int libcpath_path_get_normalized_segments_length(
+     const char *path,
+     size_t path_length,
+     size_t *number_of_parent_segments,
+     size_t *segments_length,
+     libcerror_error_t **error );
+
+int libcpath_path_prepend_normalized_segments(
+     char *full_path,
+     size_t full_path_size,
+     size_t full_path_prefix_length,
+     size_t *full_path_index,
+     const char *path,
+     size_t path_length,
+     size_t *number_of_parent_segments,
+     libcerror_error_t **error );
+
+int libcpath_path_resolve_full_path(
+     const char *full_path_prefix,
+     size_t full_path_prefix_length,
+     const char *base_directory,
+     size_t base_directory_length,
+     const char *path,
+     size_t path_length,
+     char *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     libcerror_error_t **error );
+
 int libcpath_path_get_sanitized_character_size(
      char character,
      size_t *sanitized_character_size,
@@ -121,6 +283,22 @@ int libcpath_path_get_sanitized_character(
      size_t *sanitized_path_index,
      libcerror_error_t **error );
 
+int libcpath_path_get_unescaped_string_length(
+     const char *string,
+     size_t string_length,
+     uint8_t escape_separator,
+     size_t *unescaped_string_length,
+     libcerror_error_t **error );
+
+int libcpath_path_get_sanitized_string(
+     const char *string,
+     size_t string_length,
+     uint8_t escape_separator,
+     char *sanitized_string,
+     size_t sanitized_string_size,
+     size_t *required_sanitized_string_size,
+     libcerror_error_t **error );
+
 LIBCPATH_EXTERN \
 int libcpath_path_get_sanitized_filename(
      const char *filename,
@@ -129,6 +307,30 @@ int libcpath_path_get_sanitized_filename(
      size_t *sanitized_filename_size,
      libcerror_error_t **error );
 
+int libcpath_internal_path_get_sanitized_filename(
+     const char *filename,
+     size_t filename_length,
+     char **sanitized_filename,
+     size_t *sanitized_filename_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_sanitized_filename_to_buffer(
+     const char *filename,
+     size_t filename_length,
+     char *sanitized_filename,
+     size_t sanitized_filename_size,
+     size_t *required_sanitized_filename_size,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_get_sanitized_filename_to_buffer(
+     const char *filename,
+     size_t filename_length,
+     char *sanitized_filename,
+     size_t sanitized_filename_size,
+     size_t *required_sanitized_filename_size,
+     libcerror_error_t **error );
+
 LIBCPATH_EXTERN \
 int libcpath_path_get_sanitized_path(
      const char *path,
@@ -137,6 +339,68 @@ int libcpath_path_get_sanitized_path(
      size_t *sanitized_path_size,
      libcerror_error_t **error );
 
+int libcpath_internal_path_get_sanitized_path(
+     const char *path,
+     size_t path_length,
+     char **sanitized_path,
+     size_t *sanitized_path_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_sanitized_path_to_buffer(
+     const char *path,
+     size_t path_length,
+     char *sanitized_path,
+     size_t sanitized_path_size,
+     size_t *required_sanitized_path_size,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_get_sanitized_path_to_buffer(
+     const char *path,
+     size_t path_length,
+     char *sanitized_path,
+     size_t sanitized_path_size,
+     size_t *required_sanitized_path_size,
+     libcerror_error_t **error );
+
+int libcpath_path_get_unsanitized_string(
+     const char *string,
+     size_t string_length,
+     char *unsanitized_string,
+     size_t unsanitized_string_size,
+     size_t *required_unsanitized_string_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_unsanitized_filename(
+     const char *sanitized_filename,
+     size_t sanitized_filename_length,
+     char **filename,
+     size_t *filename_size,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_get_unsanitized_filename(
+     const char *sanitized_filename,
+     size_t sanitized_filename_length,
+     char **filename,
+     size_t *filename_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_unsanitized_path(
+     const char *sanitized_path,
+     size_t sanitized_path_length,
+     char **path,
+     size_t *path_size,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_get_unsanitized_path(
+     const char *sanitized_path,
+     size_t sanitized_path_length,
+     char **path,
+     size_t *path_size,
+     libcerror_error_t **error );
+
 LIBCPATH_EXTERN \
 int libcpath_path_join(
      char **path,
@@ -147,6 +411,74 @@ int libcpath_path_join(
      size_t filename_length,
      libcerror_error_t **error );
 
+int libcpath_internal_path_join(
+     char **path,
+     size_t *path_size,
+     const char *directory_name,
+     size_t directory_name_length,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_join_to_buffer(
+     char *path,
+     size_t path_size,
+     size_t *required_path_size,
+     const char *directory_name,
+     size_t directory_name_length,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_join_to_buffer(
+     char *path,
+     size_t path_size,
+     size_t *required_path_size,
+     const char *directory_name,
+     size_t directory_name_length,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_join_normalized(
+     char **path,
+     size_t *path_size,
+     const char *directory_name,
+     size_t directory_name_length,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_join_normalized(
+     char **path,
+     size_t *path_size,
+     const char *directory_name,
+     size_t directory_name_length,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_relative_path(
+     const char *from_path,
+     size_t from_path_length,
+     const char *to_path,
+     size_t to_path_length,
+     char **relative_path,
+     size_t *relative_path_size,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_get_relative_path(
+     const char *from_path,
+     size_t from_path_length,
+     const char *to_path,
+     size_t to_path_length,
+     char **relative_path,
+     size_t *relative_path_size,
+     libcerror_error_t **error );
+
 #if defined( WINAPI ) && ( WINVER <= 0x0500 )
 
 BOOL libcpath_CreateDirectoryA(
@@ -160,6 +492,45 @@ int libcpath_path_make_directory(
      const char *directory_name,
      libcerror_error_t **error );
 
+int libcpath_internal_path_make_directory(
+     const char *directory_name,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_make_directory_with_error_code(
+     const char *directory_name,
+     uint32_t *error_code,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_make_directory_with_error_code(
+     const char *directory_name,
+     uint32_t *error_code,
+     libcerror_error_t **error );
+
+int libcpath_path_make_directory_component(
+     const char *directory_name,
+     int mode,
+     libcerror_error_t **error );
+
+int libcpath_path_get_root_length(
+     const char *path,
+     size_t path_length,
+     size_t *root_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_make_directories(
+     const char *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_make_directories(
+     const char *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error );
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 #if defined( WINAPI ) && ( WINVER <= 0x0500 )
@@ -174,6 +545,21 @@ int libcpath_path_change_directory_wide(
      const wchar_t *directory_name,
      libcerror_error_t **error );
 
+int libcpath_internal_path_change_directory_wide(
+     const wchar_t *directory_name,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_change_directory_wide_with_error_code(
+     const wchar_t *directory_name,
+     uint32_t *error_code,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_change_directory_wide_with_error_code(
+     const wchar_t *directory_name,
+     uint32_t *error_code,
+     libcerror_error_t **error );
+
 #if defined( WINAPI ) && ( WINVER <= 0x0500 )
 
 DWORD libcpath_GetCurrentDirectoryW(
@@ -188,6 +574,16 @@ int libcpath_path_get_current_working_directory_wide(
      size_t *current_working_directory_size,
      libcerror_error_t **error );
 
+int libcpath_internal_path_get_current_working_directory_wide(
+     wchar_t **current_working_directory,
+     size_t *current_working_directory_size,
+     libcerror_error_t **error );
+
+int libcpath_path_get_cached_current_working_directory_wide(
+     const wchar_t **current_working_directory,
+     size_t *current_working_directory_length,
+     libcerror_error_t **error );
+
 #if defined( WINAPI ) && ( WINVER <= 0x0500 )
 
 DWORD libcpath_GetFullPathNameW(
@@ -198,6 +594,16 @@ DWORD libcpath_GetFullPathNameW(
 
 #endif /* defined( WINAPI ) && ( WINVER <= 0x0500 ) */
 
+LIBCPATH_EXTERN \
+int libcpath_path_parse_windows_path_wide(
+     const wchar_t *path,
+     size_t path_length,
+     uint8_t *path_type,
+     size_t *volume_name_index,
+     size_t *volume_name_length,
+     size_t *directory_name_index,
+     libcerror_error_t **error );
+
 #if defined( WINAPI )
 
 int libcpath_path_get_path_type_wide(
@@ -231,6 +637,107 @@ int libcpath_path_get_full_path_wide(
      size_t *full_path_size,
      libcerror_error_t **error );
 
+int libcpath_internal_path_get_full_path_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_full_path_to_buffer_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_get_full_path_to_buffer_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_full_paths_wide(
+     const wchar_t **paths,
+     const size_t *path_lengths,
+     int number_of_paths,
+     wchar_t **full_paths,
+     size_t *full_paths_size,
+     size_t **full_path_offsets,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_get_full_paths_wide(
+     const wchar_t **paths,
+     const size_t *path_lengths,
+     int number_of_paths,
+     wchar_t **full_paths,
+     size_t *full_paths_size,
+     size_t **full_path_offsets,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_first_segment_wide(
+     const wchar_t *path,
+     size_t path_length,
+     size_t *path_index,
+     const wchar_t **segment,
+     size_t *segment_length,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_next_segment_wide(
+     const wchar_t *path,
+     size_t path_length,
+     size_t *path_index,
+     const wchar_t **segment,
+     size_t *segment_length,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libcpath_path_append_normalized_segments_wide(
+     wchar_t *full_path,
+     size_t full_path_size,
+     size_t full_path_prefix_length,
+     size_t *full_path_index,
+     const wchar_t *path,
+     size_t path_length,
+     libcerror_error_t **error );
+
+int libcpath_path_get_normalized_segments_length_wide(
+     const wchar_t *path,
+     size_t path_length,
+     size_t *number_of_parent_segments,
+     size_t *segments_length,
+     libcerror_error_t **error );
+
+int libcpath_path_prepend_normalized_segments_wide(
+     wchar_t *full_path,
+     size_t full_path_size,
+     size_t full_path_prefix_length,
+     size_t *full_path_index,
+     const wchar_t *path,
+     size_t path_length,
+     size_t *number_of_parent_segments,
+     libcerror_error_t **error );
+
+int libcpath_path_resolve_full_path_wide(
+     const wchar_t *full_path_prefix,
+     size_t full_path_prefix_length,
+     const wchar_t *base_directory,
+     size_t base_directory_length,
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *full_path,
+     size_t full_path_size,
+     size_t *required_full_path_size,
+     libcerror_error_t **error );
+
 int libcpath_path_get_sanitized_character_size_wide(
      wchar_t character,
      size_t *sanitized_character_size,
@@ -244,6 +751,15 @@ int libcpath_path_get_sanitized_character_wide(
      size_t *sanitized_path_index,
      libcerror_error_t **error );
 
+int libcpath_path_get_sanitized_string_wide(
+     const wchar_t *string,
+     size_t string_length,
+     uint8_t escape_separator,
+     wchar_t *sanitized_string,
+     size_t sanitized_string_size,
+     size_t *required_sanitized_string_size,
+     libcerror_error_t **error );
+
 LIBCPATH_EXTERN \
 int libcpath_path_get_sanitized_filename_wide(
      const wchar_t *filename,
@@ -252,6 +768,30 @@ int libcpath_path_get_sanitized_filename_wide(
      size_t *sanitized_filename_size,
      libcerror_error_t **error );
 
+int libcpath_internal_path_get_sanitized_filename_wide(
+     const wchar_t *filename,
+     size_t filename_length,
+     wchar_t **sanitized_filename,
+     size_t *sanitized_filename_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_sanitized_filename_to_buffer_wide(
+     const wchar_t *filename,
+     size_t filename_length,
+     wchar_t *sanitized_filename,
+     size_t sanitized_filename_size,
+     size_t *required_sanitized_filename_size,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_get_sanitized_filename_to_buffer_wide(
+     const wchar_t *filename,
+     size_t filename_length,
+     wchar_t *sanitized_filename,
+     size_t sanitized_filename_size,
+     size_t *required_sanitized_filename_size,
+     libcerror_error_t **error );
+
 LIBCPATH_EXTERN \
 int libcpath_path_get_sanitized_path_wide(
      const wchar_t *path,
@@ -260,6 +800,68 @@ int libcpath_path_get_sanitized_path_wide(
      size_t *sanitized_path_size,
      libcerror_error_t **error );
 
+int libcpath_internal_path_get_sanitized_path_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **sanitized_path,
+     size_t *sanitized_path_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_sanitized_path_to_buffer_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *sanitized_path,
+     size_t sanitized_path_size,
+     size_t *required_sanitized_path_size,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_get_sanitized_path_to_buffer_wide(
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t *sanitized_path,
+     size_t sanitized_path_size,
+     size_t *required_sanitized_path_size,
+     libcerror_error_t **error );
+
+int libcpath_path_get_unsanitized_string_wide(
+     const wchar_t *string,
+     size_t string_length,
+     wchar_t *unsanitized_string,
+     size_t unsanitized_string_size,
+     size_t *required_unsanitized_string_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_unsanitized_filename_wide(
+     const wchar_t *sanitized_filename,
+     size_t sanitized_filename_length,
+     wchar_t **filename,
+     size_t *filename_size,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_get_unsanitized_filename_wide(
+     const wchar_t *sanitized_filename,
+     size_t sanitized_filename_length,
+     wchar_t **filename,
+     size_t *filename_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_unsanitized_path_wide(
+     const wchar_t *sanitized_path,
+     size_t sanitized_path_length,
+     wchar_t **path,
+     size_t *path_size,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_get_unsanitized_path_wide(
+     const wchar_t *sanitized_path,
+     size_t sanitized_path_length,
+     wchar_t **path,
+     size_t *path_size,
+     libcerror_error_t **error );
+
 LIBCPATH_EXTERN \
 int libcpath_path_join_wide(
      wchar_t **path,
@@ -270,6 +872,74 @@ int libcpath_path_join_wide(
      size_t filename_length,
      libcerror_error_t **error );
 
+int libcpath_internal_path_join_wide(
+     wchar_t **path,
+     size_t *path_size,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_join_to_buffer_wide(
+     wchar_t *path,
+     size_t path_size,
+     size_t *required_path_size,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_join_to_buffer_wide(
+     wchar_t *path,
+     size_t path_size,
+     size_t *required_path_size,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_join_normalized_wide(
+     wchar_t **path,
+     size_t *path_size,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_join_normalized_wide(
+     wchar_t **path,
+     size_t *path_size,
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_get_relative_path_wide(
+     const wchar_t *from_path,
+     size_t from_path_length,
+     const wchar_t *to_path,
+     size_t to_path_length,
+     wchar_t **relative_path,
+     size_t *relative_path_size,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_get_relative_path_wide(
+     const wchar_t *from_path,
+     size_t from_path_length,
+     const wchar_t *to_path,
+     size_t to_path_length,
+     wchar_t **relative_path,
+     size_t *relative_path_size,
+     libcerror_error_t **error );
+
 #if defined( WINAPI ) && ( WINVER <= 0x0500 )
 
 BOOL libcpath_CreateDirectoryW(
@@ -283,6 +953,49 @@ int libcpath_path_make_directory_wide(
      const wchar_t *directory_name,
      libcerror_error_t **error );
 
+int libcpath_internal_path_make_directory_wide(
+     const wchar_t *directory_name,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_make_directory_wide_with_error_code(
+     const wchar_t *directory_name,
+     uint32_t *error_code,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_make_directory_wide_with_error_code(
+     const wchar_t *directory_name,
+     uint32_t *error_code,
+     libcerror_error_t **error );
+
+int libcpath_path_get_root_length_wide(
+     const wchar_t *path,
+     size_t path_length,
+     size_t *root_length,
+     libcerror_error_t **error );
+
+#if defined( WINAPI )
+
+int libcpath_path_make_directory_component_wide(
+     const wchar_t *directory_name,
+     int mode,
+     libcerror_error_t **error );
+
+#endif /* defined( WINAPI ) */
+
+LIBCPATH_EXTERN \
+int libcpath_path_make_directories_wide(
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_make_directories_wide(
+     const wchar_t *directory_name,
+     size_t directory_name_length,
+     int mode,
+     libcerror_error_t **error );
+
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
 #if defined( __cplusplus )
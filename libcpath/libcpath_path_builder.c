@@ -0,0 +1,1045 @@
+/*
+ * Path builder functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "libcpath_definitions.h"
+#include "libcpath_libcerror.h"
+#include "libcpath_memory.h"
+#include "libcpath_path_builder.h"
+#include "libcpath_types.h"
+
+/* Creates a path builder
+ * Make sure the value path_builder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_builder_initialize(
+     libcpath_path_builder_t **path_builder,
+     libcerror_error_t **error )
+{
+	libcpath_internal_path_builder_t *internal_path_builder = NULL;
+	static char *function                                   = "libcpath_path_builder_initialize";
+
+	if( path_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_builder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path builder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_path_builder = memory_allocate_structure(
+	                         libcpath_internal_path_builder_t );
+
+	if( internal_path_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path builder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_path_builder,
+	     0,
+	     sizeof( libcpath_internal_path_builder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear path builder.",
+		 function );
+
+		goto on_error;
+	}
+	*path_builder = (libcpath_path_builder_t *) internal_path_builder;
+
+	return( 1 );
+
+on_error:
+	if( internal_path_builder != NULL )
+	{
+		memory_free(
+		 internal_path_builder );
+	}
+	return( -1 );
+}
+
+/* Frees a path builder
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_builder_free(
+     libcpath_path_builder_t **path_builder,
+     libcerror_error_t **error )
+{
+	libcpath_internal_path_builder_t *internal_path_builder = NULL;
+	static char *function                                   = "libcpath_path_builder_free";
+
+	if( path_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_builder != NULL )
+	{
+		internal_path_builder = (libcpath_internal_path_builder_t *) *path_builder;
+		*path_builder         = NULL;
+
+		if( internal_path_builder->path != NULL )
+		{
+			memory_free(
+			 internal_path_builder->path );
+		}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+		if( internal_path_builder->path_wide != NULL )
+		{
+			memory_free(
+			 internal_path_builder->path_wide );
+		}
+#endif
+		if( internal_path_builder->component_offsets != NULL )
+		{
+			memory_free(
+			 internal_path_builder->component_offsets );
+		}
+		memory_free(
+		 internal_path_builder );
+	}
+	return( 1 );
+}
+
+/* Clears a path builder
+ * This removes all components but retains the allocated memory for reuse
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_builder_clear(
+     libcpath_path_builder_t *path_builder,
+     libcerror_error_t **error )
+{
+	libcpath_internal_path_builder_t *internal_path_builder = NULL;
+	static char *function                                   = "libcpath_path_builder_clear";
+
+	if( path_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_path_builder = (libcpath_internal_path_builder_t *) path_builder;
+
+	if( internal_path_builder->path != NULL )
+	{
+		internal_path_builder->path[ 0 ] = 0;
+	}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	if( internal_path_builder->path_wide != NULL )
+	{
+		internal_path_builder->path_wide[ 0 ] = 0;
+	}
+#endif
+	internal_path_builder->path_length          = 0;
+	internal_path_builder->number_of_components = 0;
+
+	return( 1 );
+}
+
+/* Appends the offsets of a component
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_path_builder_append_component_offsets(
+     libcpath_internal_path_builder_t *internal_path_builder,
+     size_t path_length,
+     size_t trimmed_path_length,
+     libcerror_error_t **error )
+{
+	void *reallocation                 = NULL;
+	static char *function              = "libcpath_internal_path_builder_append_component_offsets";
+	int number_of_allocated_components = 0;
+
+	if( internal_path_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path builder.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_path_builder->number_of_components >= internal_path_builder->number_of_allocated_components )
+	{
+		if( (size_t) internal_path_builder->number_of_allocated_components > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 4 * sizeof( size_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated components value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_path_builder->number_of_allocated_components == 0 )
+		{
+			number_of_allocated_components = 16;
+		}
+		else
+		{
+			number_of_allocated_components = internal_path_builder->number_of_allocated_components * 2;
+		}
+		reallocation = memory_reallocate(
+		                internal_path_builder->component_offsets,
+		                sizeof( size_t ) * 2 * number_of_allocated_components );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize component offsets.",
+			 function );
+
+			return( -1 );
+		}
+		internal_path_builder->component_offsets               = (size_t *) reallocation;
+		internal_path_builder->number_of_allocated_components = number_of_allocated_components;
+	}
+	internal_path_builder->component_offsets[ 2 * internal_path_builder->number_of_components ]     = path_length;
+	internal_path_builder->component_offsets[ 2 * internal_path_builder->number_of_components + 1 ] = trimmed_path_length;
+
+	internal_path_builder->number_of_components += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of components
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_builder_get_number_of_components(
+     libcpath_path_builder_t *path_builder,
+     int *number_of_components,
+     libcerror_error_t **error )
+{
+	libcpath_internal_path_builder_t *internal_path_builder = NULL;
+	static char *function                                   = "libcpath_path_builder_get_number_of_components";
+
+	if( path_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_path_builder = (libcpath_internal_path_builder_t *) path_builder;
+
+	if( number_of_components == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of components.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_components = internal_path_builder->number_of_components;
+
+	return( 1 );
+}
+
+/* Removes the last component
+ * The path is restored to what it was before the component was appended
+ * Returns 1 if successful, 0 if there is no component to remove or -1 on error
+ */
+int libcpath_path_builder_remove_last_component(
+     libcpath_path_builder_t *path_builder,
+     libcerror_error_t **error )
+{
+	libcpath_internal_path_builder_t *internal_path_builder = NULL;
+	static char *function                                   = "libcpath_path_builder_remove_last_component";
+	size_t path_index                                       = 0;
+	size_t path_length                                      = 0;
+	int component_index                                     = 0;
+
+	if( path_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_path_builder = (libcpath_internal_path_builder_t *) path_builder;
+
+	if( internal_path_builder->number_of_components == 0 )
+	{
+		return( 0 );
+	}
+	component_index = internal_path_builder->number_of_components - 1;
+
+	path_length = internal_path_builder->component_offsets[ 2 * component_index ];
+	path_index  = internal_path_builder->component_offsets[ 2 * component_index + 1 ];
+
+	/* Restore the trailing separators that were removed when the component was appended
+	 */
+	if( internal_path_builder->path != NULL )
+	{
+		while( path_index < path_length )
+		{
+			internal_path_builder->path[ path_index++ ] = (char) LIBCPATH_SEPARATOR;
+		}
+		internal_path_builder->path[ path_length ] = 0;
+	}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	else if( internal_path_builder->path_wide != NULL )
+	{
+		while( path_index < path_length )
+		{
+			internal_path_builder->path_wide[ path_index++ ] = (wchar_t) LIBCPATH_SEPARATOR;
+		}
+		internal_path_builder->path_wide[ path_length ] = 0;
+	}
+#endif
+	internal_path_builder->path_length          = path_length;
+	internal_path_builder->number_of_components = component_index;
+
+	return( 1 );
+}
+
+/* Appends a component
+ * Trailing separators of the path and leading separators of the component
+ * are removed before they are combined with a single separator, the same
+ * way as libcpath_path_join. The first component is used as-is.
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_builder_append_component(
+     libcpath_path_builder_t *path_builder,
+     const char *component,
+     size_t component_length,
+     libcerror_error_t **error )
+{
+	libcpath_internal_path_builder_t *internal_path_builder = NULL;
+	void *reallocation                                      = NULL;
+	static char *function                                   = "libcpath_path_builder_append_component";
+	size_t component_index                                  = 0;
+	size_t path_index                                       = 0;
+	size_t path_size                                        = 0;
+
+	if( path_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_path_builder = (libcpath_internal_path_builder_t *) path_builder;
+
+	if( component == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid component.",
+		 function );
+
+		return( -1 );
+	}
+	if( component_length > (size_t) ( SSIZE_MAX - 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid component length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	if( internal_path_builder->path_wide != NULL )
+	{
+		if( internal_path_builder->number_of_components > 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid path builder - wide path value already set.",
+			 function );
+
+			return( -1 );
+		}
+		memory_free(
+		 internal_path_builder->path_wide );
+
+		internal_path_builder->path_wide = NULL;
+		internal_path_builder->path_size = 0;
+	}
+#endif
+	path_index = internal_path_builder->path_length;
+
+	if( internal_path_builder->number_of_components > 0 )
+	{
+		while( path_index > 0 )
+		{
+			if( internal_path_builder->path[ path_index - 1 ] != (char) LIBCPATH_SEPARATOR )
+			{
+				break;
+			}
+			path_index--;
+		}
+		while( component_length > 0 )
+		{
+			if( component[ component_index ] != (char) LIBCPATH_SEPARATOR )
+			{
+				break;
+			}
+			component_index++;
+			component_length--;
+		}
+		path_size = path_index + component_length + 2;
+	}
+	else
+	{
+		path_size = component_length + 1;
+	}
+	if( path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size > internal_path_builder->path_size )
+	{
+		/* Grow the path geometrically so that appending components
+		 * one by one does not copy the path every time
+		 */
+		if( path_size < ( internal_path_builder->path_size * 2 ) )
+		{
+			path_size = internal_path_builder->path_size * 2;
+
+			if( path_size > (size_t) SSIZE_MAX )
+			{
+				path_size = (size_t) SSIZE_MAX;
+			}
+		}
+		reallocation = memory_reallocate(
+		                internal_path_builder->path,
+		                sizeof( char ) * path_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize path.",
+			 function );
+
+			return( -1 );
+		}
+		internal_path_builder->path      = (char *) reallocation;
+		internal_path_builder->path_size = path_size;
+	}
+	if( libcpath_internal_path_builder_append_component_offsets(
+	     internal_path_builder,
+	     internal_path_builder->path_length,
+	     path_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append component offsets.",
+		 function );
+
+		return( -1 );
+	}
+	/* Note that the offsets of the component have already been appended
+	 */
+	if( internal_path_builder->number_of_components > 1 )
+	{
+		internal_path_builder->path[ path_index++ ] = (char) LIBCPATH_SEPARATOR;
+	}
+	if( component_length > 0 )
+	{
+		if( memory_copy(
+		     &( internal_path_builder->path[ path_index ] ),
+		     &( component[ component_index ] ),
+		     sizeof( char ) * component_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy component to path.",
+			 function );
+
+			return( -1 );
+		}
+		path_index += component_length;
+	}
+	internal_path_builder->path[ path_index ] = 0;
+
+	internal_path_builder->path_length = path_index;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the path
+ * The path size includes the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_builder_get_path_size(
+     libcpath_path_builder_t *path_builder,
+     size_t *path_size,
+     libcerror_error_t **error )
+{
+	libcpath_internal_path_builder_t *internal_path_builder = NULL;
+	static char *function                                   = "libcpath_path_builder_get_path_size";
+
+	if( path_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_path_builder = (libcpath_internal_path_builder_t *) path_builder;
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	if( internal_path_builder->path_wide != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path builder - wide path value already set.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path size.",
+		 function );
+
+		return( -1 );
+	}
+	*path_size = internal_path_builder->path_length + 1;
+
+	return( 1 );
+}
+
+/* Retrieves the path
+ * The size should include the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_builder_get_path(
+     libcpath_path_builder_t *path_builder,
+     char *path,
+     size_t path_size,
+     libcerror_error_t **error )
+{
+	libcpath_internal_path_builder_t *internal_path_builder = NULL;
+	static char *function                                   = "libcpath_path_builder_get_path";
+
+	if( path_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_path_builder = (libcpath_internal_path_builder_t *) path_builder;
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	if( internal_path_builder->path_wide != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path builder - wide path value already set.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size < ( internal_path_builder->path_length + 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid path size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_path_builder->path_length > 0 )
+	{
+		if( memory_copy(
+		     path,
+		     internal_path_builder->path,
+		     sizeof( char ) * internal_path_builder->path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy path.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	path[ internal_path_builder->path_length ] = 0;
+
+	return( 1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Appends a component
+ * Trailing separators of the path and leading separators of the component
+ * are removed before they are combined with a single separator, the same
+ * way as libcpath_path_join_wide. The first component is used as-is.
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_builder_append_component_wide(
+     libcpath_path_builder_t *path_builder,
+     const wchar_t *component,
+     size_t component_length,
+     libcerror_error_t **error )
+{
+	libcpath_internal_path_builder_t *internal_path_builder = NULL;
+	void *reallocation                                      = NULL;
+	static char *function                                   = "libcpath_path_builder_append_component_wide";
+	size_t component_index                                  = 0;
+	size_t path_index                                       = 0;
+	size_t path_size                                        = 0;
+
+	if( path_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_path_builder = (libcpath_internal_path_builder_t *) path_builder;
+
+	if( component == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid component.",
+		 function );
+
+		return( -1 );
+	}
+	if( component_length > (size_t) ( SSIZE_MAX - 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid component length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_path_builder->path != NULL )
+	{
+		if( internal_path_builder->number_of_components > 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid path builder - narrow path value already set.",
+			 function );
+
+			return( -1 );
+		}
+		memory_free(
+		 internal_path_builder->path );
+
+		internal_path_builder->path      = NULL;
+		internal_path_builder->path_size = 0;
+	}
+	path_index = internal_path_builder->path_length;
+
+	if( internal_path_builder->number_of_components > 0 )
+	{
+		while( path_index > 0 )
+		{
+			if( internal_path_builder->path_wide[ path_index - 1 ] != (wchar_t) LIBCPATH_SEPARATOR )
+			{
+				break;
+			}
+			path_index--;
+		}
+		while( component_length > 0 )
+		{
+			if( component[ component_index ] != (wchar_t) LIBCPATH_SEPARATOR )
+			{
+				break;
+			}
+			component_index++;
+			component_length--;
+		}
+		path_size = path_index + component_length + 2;
+	}
+	else
+	{
+		path_size = component_length + 1;
+	}
+	if( path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size > internal_path_builder->path_size )
+	{
+		/* Grow the path geometrically so that appending components
+		 * one by one does not copy the path every time
+		 */
+		if( path_size < ( internal_path_builder->path_size * 2 ) )
+		{
+			path_size = internal_path_builder->path_size * 2;
+
+			if( path_size > (size_t) SSIZE_MAX )
+			{
+				path_size = (size_t) SSIZE_MAX;
+			}
+		}
+		reallocation = memory_reallocate(
+		                internal_path_builder->path_wide,
+		                sizeof( wchar_t ) * path_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize path.",
+			 function );
+
+			return( -1 );
+		}
+		internal_path_builder->path_wide = (wchar_t *) reallocation;
+		internal_path_builder->path_size = path_size;
+	}
+	if( libcpath_internal_path_builder_append_component_offsets(
+	     internal_path_builder,
+	     internal_path_builder->path_length,
+	     path_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append component offsets.",
+		 function );
+
+		return( -1 );
+	}
+	/* Note that the offsets of the component have already been appended
+	 */
+	if( internal_path_builder->number_of_components > 1 )
+	{
+		internal_path_builder->path_wide[ path_index++ ] = (wchar_t) LIBCPATH_SEPARATOR;
+	}
+	if( component_length > 0 )
+	{
+		if( memory_copy(
+		     &( internal_path_builder->path_wide[ path_index ] ),
+		     &( component[ component_index ] ),
+		     sizeof( wchar_t ) * component_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy component to path.",
+			 function );
+
+			return( -1 );
+		}
+		path_index += component_length;
+	}
+	internal_path_builder->path_wide[ path_index ] = 0;
+
+	internal_path_builder->path_length = path_index;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the wide path
+ * The path size includes the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_builder_get_path_size_wide(
+     libcpath_path_builder_t *path_builder,
+     size_t *path_size,
+     libcerror_error_t **error )
+{
+	libcpath_internal_path_builder_t *internal_path_builder = NULL;
+	static char *function                                   = "libcpath_path_builder_get_path_size_wide";
+
+	if( path_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_path_builder = (libcpath_internal_path_builder_t *) path_builder;
+
+	if( internal_path_builder->path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path builder - narrow path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path size.",
+		 function );
+
+		return( -1 );
+	}
+	*path_size = internal_path_builder->path_length + 1;
+
+	return( 1 );
+}
+
+/* Retrieves the wide path
+ * The size should include the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_path_builder_get_path_wide(
+     libcpath_path_builder_t *path_builder,
+     wchar_t *path,
+     size_t path_size,
+     libcerror_error_t **error )
+{
+	libcpath_internal_path_builder_t *internal_path_builder = NULL;
+	static char *function                                   = "libcpath_path_builder_get_path_wide";
+
+	if( path_builder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path builder.",
+		 function );
+
+		return( -1 );
+	}
+	internal_path_builder = (libcpath_internal_path_builder_t *) path_builder;
+
+	if( internal_path_builder->path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path builder - narrow path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size < ( internal_path_builder->path_length + 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid path size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_path_builder->path_length > 0 )
+	{
+		if( memory_copy(
+		     path,
+		     internal_path_builder->path_wide,
+		     sizeof( wchar_t ) * internal_path_builder->path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy path.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	path[ internal_path_builder->path_length ] = 0;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
@@ -0,0 +1,158 @@
+/*
+ * Path builder functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCPATH_PATH_BUILDER_H )
+#define _LIBCPATH_PATH_BUILDER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcpath_extern.h"
+#include "libcpath_libcerror.h"
+#include "libcpath_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcpath_internal_path_builder libcpath_internal_path_builder_t;
+
+struct libcpath_internal_path_builder
+{
+	/* The narrow path
+	 */
+	char *path;
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	/* The wide path
+	 */
+	wchar_t *path_wide;
+#endif
+
+	/* The path size
+	 * The number of characters allocated for the narrow or wide path
+	 */
+	size_t path_size;
+
+	/* The path length
+	 * The number of characters in the path without the end-of-string character
+	 */
+	size_t path_length;
+
+	/* The component offsets
+	 * For every component this contains 2 values: the path length before
+	 * the component was appended and the path length after trailing
+	 * separators were removed, so that removing the component can restore
+	 * the path
+	 */
+	size_t *component_offsets;
+
+	/* The number of components
+	 */
+	int number_of_components;
+
+	/* The number of allocated components
+	 */
+	int number_of_allocated_components;
+};
+
+LIBCPATH_EXTERN \
+int libcpath_path_builder_initialize(
+     libcpath_path_builder_t **path_builder,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_builder_free(
+     libcpath_path_builder_t **path_builder,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_builder_clear(
+     libcpath_path_builder_t *path_builder,
+     libcerror_error_t **error );
+
+int libcpath_internal_path_builder_append_component_offsets(
+     libcpath_internal_path_builder_t *internal_path_builder,
+     size_t path_length,
+     size_t trimmed_path_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_builder_get_number_of_components(
+     libcpath_path_builder_t *path_builder,
+     int *number_of_components,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_builder_append_component(
+     libcpath_path_builder_t *path_builder,
+     const char *component,
+     size_t component_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_builder_remove_last_component(
+     libcpath_path_builder_t *path_builder,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_builder_get_path_size(
+     libcpath_path_builder_t *path_builder,
+     size_t *path_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_builder_get_path(
+     libcpath_path_builder_t *path_builder,
+     char *path,
+     size_t path_size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBCPATH_EXTERN \
+int libcpath_path_builder_append_component_wide(
+     libcpath_path_builder_t *path_builder,
+     const wchar_t *component,
+     size_t component_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_builder_get_path_size_wide(
+     libcpath_path_builder_t *path_builder,
+     size_t *path_size,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_path_builder_get_path_wide(
+     libcpath_path_builder_t *path_builder,
+     wchar_t *path,
+     size_t path_size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCPATH_PATH_BUILDER_H ) */
+
@@ -0,0 +1,1234 @@
+/*
+ * Resolution context functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "libcpath_definitions.h"
+#include "libcpath_libcerror.h"
+#include "libcpath_memory.h"
+#include "libcpath_path.h"
+#include "libcpath_resolution_context.h"
+#include "libcpath_types.h"
+
+/* Creates a resolution context
+ * Make sure the value resolution_context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_resolution_context_initialize(
+     libcpath_resolution_context_t **resolution_context,
+     libcerror_error_t **error )
+{
+	libcpath_internal_resolution_context_t *internal_resolution_context = NULL;
+	static char *function                                               = "libcpath_resolution_context_initialize";
+
+	if( resolution_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resolution context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resolution_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid resolution context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_resolution_context = memory_allocate_structure(
+	                               libcpath_internal_resolution_context_t );
+
+	if( internal_resolution_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create resolution context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_resolution_context,
+	     0,
+	     sizeof( libcpath_internal_resolution_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear resolution context.",
+		 function );
+
+		goto on_error;
+	}
+	*resolution_context = (libcpath_resolution_context_t *) internal_resolution_context;
+
+	return( 1 );
+
+on_error:
+	if( internal_resolution_context != NULL )
+	{
+		memory_free(
+		 internal_resolution_context );
+	}
+	return( -1 );
+}
+
+/* Frees a resolution context
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_resolution_context_free(
+     libcpath_resolution_context_t **resolution_context,
+     libcerror_error_t **error )
+{
+	libcpath_internal_resolution_context_t *internal_resolution_context = NULL;
+	static char *function                                               = "libcpath_resolution_context_free";
+	int result                                                          = 1;
+
+	if( resolution_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resolution context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resolution_context != NULL )
+	{
+		internal_resolution_context = (libcpath_internal_resolution_context_t *) *resolution_context;
+		*resolution_context         = NULL;
+
+		if( libcpath_internal_resolution_context_clear(
+		     internal_resolution_context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear resolution context.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_resolution_context );
+	}
+	return( result );
+}
+
+/* Clears the base directories of a resolution context
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_internal_resolution_context_clear(
+     libcpath_internal_resolution_context_t *internal_resolution_context,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_internal_resolution_context_clear";
+
+	if( internal_resolution_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resolution context.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_resolution_context->base_directory != NULL )
+	{
+		memory_free(
+		 internal_resolution_context->base_directory );
+
+		internal_resolution_context->base_directory = NULL;
+	}
+	internal_resolution_context->base_directory_prefix_length = 0;
+	internal_resolution_context->base_directory_length        = 0;
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	if( internal_resolution_context->base_directory_wide != NULL )
+	{
+		memory_free(
+		 internal_resolution_context->base_directory_wide );
+
+		internal_resolution_context->base_directory_wide = NULL;
+	}
+	internal_resolution_context->base_directory_wide_prefix_length = 0;
+	internal_resolution_context->base_directory_wide_length        = 0;
+#endif
+	return( 1 );
+}
+
+/* Sets the base directory
+ * The base directory must be absolute, on Windows it must start with
+ * a volume, such as "C:\", or an UNC server and share name
+ * The base directory is normalized once, so that resolving a path only needs
+ * to copy it
+ * Setting the narrow or wide base directory clears the other
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_resolution_context_set_base_directory(
+     libcpath_resolution_context_t *resolution_context,
+     const char *base_directory,
+     size_t base_directory_length,
+     libcerror_error_t **error )
+{
+	libcpath_internal_resolution_context_t *internal_resolution_context = NULL;
+	char *safe_base_directory                                           = NULL;
+	static char *function                                               = "libcpath_resolution_context_set_base_directory";
+	size_t base_directory_index                                         = 0;
+	size_t prefix_length                                                = 0;
+	size_t root_length                                                  = 0;
+	size_t safe_base_directory_size                                     = 0;
+
+	if( resolution_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resolution context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_resolution_context = (libcpath_internal_resolution_context_t *) resolution_context;
+
+	if( base_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( base_directory_length == 0 )
+	 || ( base_directory_length > (size_t) ( SSIZE_MAX - 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid base directory length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_get_root_length(
+	     base_directory,
+	     base_directory_length,
+	     &root_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine base directory root length.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	if( ( root_length < 3 )
+	 || ( ( base_directory[ 1 ] != ':' )
+	  &&  ( base_directory[ 1 ] != (char) LIBCPATH_SEPARATOR ) ) )
+#else
+	if( root_length == 0 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported relative base directory.",
+		 function );
+
+		return( -1 );
+	}
+	/* The prefix is the root with a single trailing directory separator
+	 */
+	prefix_length = root_length;
+
+	while( ( prefix_length > 0 )
+	    && ( base_directory[ prefix_length - 1 ] == (char) LIBCPATH_SEPARATOR ) )
+	{
+		prefix_length--;
+	}
+	/* Every segment is stored with a trailing directory separator, hence the base
+	 * directory never needs more than its length, the directory separator of the
+	 * prefix and the directory separator of the last segment
+	 */
+	safe_base_directory_size = base_directory_length + 2;
+
+	safe_base_directory = narrow_string_allocate(
+	                       safe_base_directory_size );
+
+	if( safe_base_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create base directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( prefix_length > 0 )
+	{
+		if( narrow_string_copy(
+		     safe_base_directory,
+		     base_directory,
+		     prefix_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy prefix to base directory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	safe_base_directory[ prefix_length++ ] = (char) LIBCPATH_SEPARATOR;
+
+	base_directory_index = prefix_length;
+
+	if( libcpath_path_append_normalized_segments(
+	     safe_base_directory,
+	     safe_base_directory_size,
+	     prefix_length,
+	     &base_directory_index,
+	     &( base_directory[ root_length ] ),
+	     base_directory_length - root_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segments to base directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_internal_resolution_context_clear(
+	     internal_resolution_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear resolution context.",
+		 function );
+
+		goto on_error;
+	}
+	internal_resolution_context->base_directory               = safe_base_directory;
+	internal_resolution_context->base_directory_prefix_length = prefix_length;
+	internal_resolution_context->base_directory_length        = base_directory_index;
+
+	return( 1 );
+
+on_error:
+	if( safe_base_directory != NULL )
+	{
+		memory_free(
+		 safe_base_directory );
+	}
+	return( -1 );
+}
+
+/* Sets the base directory to the current working directory
+ * The current working directory is only retrieved by this function and not
+ * when resolving a path
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_resolution_context_set_base_directory_from_current_working_directory(
+     libcpath_resolution_context_t *resolution_context,
+     libcerror_error_t **error )
+{
+	char *current_working_directory       = NULL;
+	static char *function                 = "libcpath_resolution_context_set_base_directory_from_current_working_directory";
+	size_t current_working_directory_size = 0;
+
+	if( libcpath_internal_path_get_current_working_directory_exact(
+	     &current_working_directory,
+	     &current_working_directory_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current working directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_resolution_context_set_base_directory(
+	     resolution_context,
+	     current_working_directory,
+	     current_working_directory_size - 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set base directory.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 current_working_directory );
+
+	return( 1 );
+
+on_error:
+	if( current_working_directory != NULL )
+	{
+		memory_free(
+		 current_working_directory );
+	}
+	return( -1 );
+}
+
+/* Determines the full path of the path specified relative to the base directory
+ * Absolute paths are resolved on their own root, on Windows a path that starts
+ * with a single directory separator is resolved on the volume of the base
+ * directory and a path that starts with the volume of the base directory,
+ * such as "C:file.txt", is resolved relative to the base directory
+ *
+ * The resolution context is not changed by this function, hence the same
+ * resolution context can be used by multiple threads concurrently, as long
+ * as the base directory is not set at the same time
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_resolution_context_get_full_path(
+     libcpath_resolution_context_t *resolution_context,
+     const char *path,
+     size_t path_length,
+     char **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error )
+{
+	libcpath_internal_resolution_context_t *internal_resolution_context = NULL;
+	const char *full_path_prefix                                        = NULL;
+	char *safe_full_path                                                = NULL;
+	static char *function                                               = "libcpath_resolution_context_get_full_path";
+	size_t full_path_index                                              = 0;
+	size_t full_path_prefix_length                                      = 0;
+	size_t full_path_prefix_size                                        = 0;
+	size_t path_index                                                   = 0;
+	size_t root_length                                                  = 0;
+	size_t safe_full_path_size                                          = 0;
+
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	char base_directory_volume_letter                                   = 0;
+	char path_volume_letter                                             = 0;
+#endif
+
+	if( resolution_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resolution context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_resolution_context = (libcpath_internal_resolution_context_t *) resolution_context;
+
+	if( internal_resolution_context->base_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid resolution context - missing base directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_length == 0 )
+	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *full_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_get_root_length(
+	     path,
+	     path_length,
+	     &root_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine path root length.",
+		 function );
+
+		return( -1 );
+	}
+	/* By default the path is relative to the base directory, the full path
+	 * starts with a copy of the normalized base directory
+	 */
+	full_path_prefix        = internal_resolution_context->base_directory;
+	full_path_prefix_length = internal_resolution_context->base_directory_prefix_length;
+	full_path_prefix_size   = internal_resolution_context->base_directory_length;
+	path_index              = root_length;
+
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	if( ( root_length == 2 )
+	 && ( path[ 1 ] == ':' ) )
+	{
+		path_volume_letter           = path[ 0 ];
+		base_directory_volume_letter = internal_resolution_context->base_directory[ 0 ];
+
+		if( ( path_volume_letter >= 'a' )
+		 && ( path_volume_letter <= 'z' ) )
+		{
+			path_volume_letter -= 'a' - 'A';
+		}
+		if( ( base_directory_volume_letter >= 'a' )
+		 && ( base_directory_volume_letter <= 'z' ) )
+		{
+			base_directory_volume_letter -= 'a' - 'A';
+		}
+		if( ( internal_resolution_context->base_directory[ 1 ] != ':' )
+		 || ( path_volume_letter != base_directory_volume_letter ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported path relative to other volume.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( ( root_length > 0 )
+	      && ( ( root_length == 1 )
+	       ||  ( path[ 1 ] != (char) LIBCPATH_SEPARATOR ) )
+	      && ( path[ 1 ] != ':' ) )
+	{
+		/* The path is relative to the volume of the base directory
+		 */
+		full_path_prefix_size = full_path_prefix_length;
+	}
+	else
+#endif
+	if( root_length > 0 )
+	{
+		/* The path is absolute, the full path starts with the root of the path
+		 * followed by a single directory separator
+		 */
+		full_path_prefix_length = root_length;
+
+		while( ( full_path_prefix_length > 0 )
+		    && ( path[ full_path_prefix_length - 1 ] == (char) LIBCPATH_SEPARATOR ) )
+		{
+			full_path_prefix_length--;
+		}
+		if( full_path_prefix_length < root_length )
+		{
+			full_path_prefix_length++;
+		}
+		full_path_prefix      = path;
+		full_path_prefix_size = full_path_prefix_length;
+	}
+	/* Every segment is stored with a trailing directory separator, hence the full path
+	 * never needs more than the length of the path, a directory separator and the prefix
+	 */
+	safe_full_path_size = full_path_prefix_size + ( path_length - path_index ) + 1;
+
+	safe_full_path = narrow_string_allocate(
+	                  safe_full_path_size );
+
+	if( safe_full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create full path.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     safe_full_path,
+	     full_path_prefix,
+	     full_path_prefix_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy prefix to full path.",
+		 function );
+
+		goto on_error;
+	}
+	full_path_index = full_path_prefix_size;
+
+	if( libcpath_path_append_normalized_segments(
+	     safe_full_path,
+	     safe_full_path_size,
+	     full_path_prefix_length,
+	     &full_path_index,
+	     &( path[ path_index ] ),
+	     path_length - path_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append path segments to full path.",
+		 function );
+
+		goto on_error;
+	}
+	/* Remove the directory separator of the last segment
+	 */
+	if( full_path_index > full_path_prefix_length )
+	{
+		full_path_index--;
+	}
+	safe_full_path[ full_path_index ] = 0;
+
+	*full_path      = safe_full_path;
+	*full_path_size = full_path_index + 1;
+
+	return( 1 );
+
+on_error:
+	if( safe_full_path != NULL )
+	{
+		memory_free(
+		 safe_full_path );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Sets the base directory
+ * The base directory must be absolute, on Windows it must start with
+ * a volume, such as "C:\", or an UNC server and share name
+ * The base directory is normalized once, so that resolving a path only needs
+ * to copy it
+ * Setting the narrow or wide base directory clears the other
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_resolution_context_set_base_directory_wide(
+     libcpath_resolution_context_t *resolution_context,
+     const wchar_t *base_directory,
+     size_t base_directory_length,
+     libcerror_error_t **error )
+{
+	libcpath_internal_resolution_context_t *internal_resolution_context = NULL;
+	wchar_t *safe_base_directory                                        = NULL;
+	static char *function                                               = "libcpath_resolution_context_set_base_directory_wide";
+	size_t base_directory_index                                         = 0;
+	size_t prefix_length                                                = 0;
+	size_t root_length                                                  = 0;
+	size_t safe_base_directory_size                                     = 0;
+
+	if( resolution_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resolution context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_resolution_context = (libcpath_internal_resolution_context_t *) resolution_context;
+
+	if( base_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( base_directory_length == 0 )
+	 || ( base_directory_length > (size_t) ( SSIZE_MAX - 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid base directory length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_get_root_length_wide(
+	     base_directory,
+	     base_directory_length,
+	     &root_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine base directory root length.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	if( ( root_length < 3 )
+	 || ( ( base_directory[ 1 ] != (wchar_t) ':' )
+	  &&  ( base_directory[ 1 ] != (wchar_t) LIBCPATH_SEPARATOR ) ) )
+#else
+	if( root_length == 0 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported relative base directory.",
+		 function );
+
+		return( -1 );
+	}
+	/* The prefix is the root with a single trailing directory separator
+	 */
+	prefix_length = root_length;
+
+	while( ( prefix_length > 0 )
+	    && ( base_directory[ prefix_length - 1 ] == (wchar_t) LIBCPATH_SEPARATOR ) )
+	{
+		prefix_length--;
+	}
+	/* Every segment is stored with a trailing directory separator, hence the base
+	 * directory never needs more than its length, the directory separator of the
+	 * prefix and the directory separator of the last segment
+	 */
+	safe_base_directory_size = base_directory_length + 2;
+
+	safe_base_directory = wide_string_allocate(
+	                       safe_base_directory_size );
+
+	if( safe_base_directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create base directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( prefix_length > 0 )
+	{
+		if( wide_string_copy(
+		     safe_base_directory,
+		     base_directory,
+		     prefix_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy prefix to base directory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	safe_base_directory[ prefix_length++ ] = (wchar_t) LIBCPATH_SEPARATOR;
+
+	base_directory_index = prefix_length;
+
+	if( libcpath_path_append_normalized_segments_wide(
+	     safe_base_directory,
+	     safe_base_directory_size,
+	     prefix_length,
+	     &base_directory_index,
+	     &( base_directory[ root_length ] ),
+	     base_directory_length - root_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append segments to base directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_internal_resolution_context_clear(
+	     internal_resolution_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear resolution context.",
+		 function );
+
+		goto on_error;
+	}
+	internal_resolution_context->base_directory_wide               = safe_base_directory;
+	internal_resolution_context->base_directory_wide_prefix_length = prefix_length;
+	internal_resolution_context->base_directory_wide_length        = base_directory_index;
+
+	return( 1 );
+
+on_error:
+	if( safe_base_directory != NULL )
+	{
+		memory_free(
+		 safe_base_directory );
+	}
+	return( -1 );
+}
+
+/* Sets the base directory to the current working directory
+ * The current working directory is only retrieved by this function and not
+ * when resolving a path
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_resolution_context_set_base_directory_from_current_working_directory_wide(
+     libcpath_resolution_context_t *resolution_context,
+     libcerror_error_t **error )
+{
+	wchar_t *current_working_directory    = NULL;
+	static char *function                 = "libcpath_resolution_context_set_base_directory_from_current_working_directory_wide";
+	size_t current_working_directory_size = 0;
+
+	if( libcpath_internal_path_get_current_working_directory_wide(
+	     &current_working_directory,
+	     &current_working_directory_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current working directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcpath_resolution_context_set_base_directory_wide(
+	     resolution_context,
+	     current_working_directory,
+	     current_working_directory_size - 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set base directory.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 current_working_directory );
+
+	return( 1 );
+
+on_error:
+	if( current_working_directory != NULL )
+	{
+		memory_free(
+		 current_working_directory );
+	}
+	return( -1 );
+}
+
+/* Determines the full path of the path specified relative to the base directory
+ * Absolute paths are resolved on their own root, on Windows a path that starts
+ * with a single directory separator is resolved on the volume of the base
+ * directory and a path that starts with the volume of the base directory,
+ * such as "C:file.txt", is resolved relative to the base directory
+ *
+ * The resolution context is not changed by this function, hence the same
+ * resolution context can be used by multiple threads concurrently, as long
+ * as the base directory is not set at the same time
+ *
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_resolution_context_get_full_path_wide(
+     libcpath_resolution_context_t *resolution_context,
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error )
+{
+	libcpath_internal_resolution_context_t *internal_resolution_context = NULL;
+	const wchar_t *full_path_prefix                                     = NULL;
+	wchar_t *safe_full_path                                             = NULL;
+	static char *function                                               = "libcpath_resolution_context_get_full_path_wide";
+	size_t full_path_index                                              = 0;
+	size_t full_path_prefix_length                                      = 0;
+	size_t full_path_prefix_size                                        = 0;
+	size_t path_index                                                   = 0;
+	size_t root_length                                                  = 0;
+	size_t safe_full_path_size                                          = 0;
+
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	wchar_t base_directory_volume_letter                                = 0;
+	wchar_t path_volume_letter                                          = 0;
+#endif
+
+	if( resolution_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resolution context.",
+		 function );
+
+		return( -1 );
+	}
+	internal_resolution_context = (libcpath_internal_resolution_context_t *) resolution_context;
+
+	if( internal_resolution_context->base_directory_wide == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid resolution context - missing base directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_length == 0 )
+	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *full_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid full path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( full_path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid full path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_path_get_root_length_wide(
+	     path,
+	     path_length,
+	     &root_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine path root length.",
+		 function );
+
+		return( -1 );
+	}
+	/* By default the path is relative to the base directory, the full path
+	 * starts with a copy of the normalized base directory
+	 */
+	full_path_prefix        = internal_resolution_context->base_directory_wide;
+	full_path_prefix_length = internal_resolution_context->base_directory_wide_prefix_length;
+	full_path_prefix_size   = internal_resolution_context->base_directory_wide_length;
+	path_index              = root_length;
+
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	if( ( root_length == 2 )
+	 && ( path[ 1 ] == (wchar_t) ':' ) )
+	{
+		path_volume_letter           = path[ 0 ];
+		base_directory_volume_letter = internal_resolution_context->base_directory_wide[ 0 ];
+
+		if( ( path_volume_letter >= (wchar_t) 'a' )
+		 && ( path_volume_letter <= (wchar_t) 'z' ) )
+		{
+			path_volume_letter -= (wchar_t) 'a' - (wchar_t) 'A';
+		}
+		if( ( base_directory_volume_letter >= (wchar_t) 'a' )
+		 && ( base_directory_volume_letter <= (wchar_t) 'z' ) )
+		{
+			base_directory_volume_letter -= (wchar_t) 'a' - (wchar_t) 'A';
+		}
+		if( ( internal_resolution_context->base_directory_wide[ 1 ] != (wchar_t) ':' )
+		 || ( path_volume_letter != base_directory_volume_letter ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported path relative to other volume.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( ( root_length > 0 )
+	      && ( ( root_length == 1 )
+	       ||  ( path[ 1 ] != (wchar_t) LIBCPATH_SEPARATOR ) )
+	      && ( path[ 1 ] != (wchar_t) ':' ) )
+	{
+		/* The path is relative to the volume of the base directory
+		 */
+		full_path_prefix_size = full_path_prefix_length;
+	}
+	else
+#endif
+	if( root_length > 0 )
+	{
+		/* The path is absolute, the full path starts with the root of the path
+		 * followed by a single directory separator
+		 */
+		full_path_prefix_length = root_length;
+
+		while( ( full_path_prefix_length > 0 )
+		    && ( path[ full_path_prefix_length - 1 ] == (wchar_t) LIBCPATH_SEPARATOR ) )
+		{
+			full_path_prefix_length--;
+		}
+		if( full_path_prefix_length < root_length )
+		{
+			full_path_prefix_length++;
+		}
+		full_path_prefix      = path;
+		full_path_prefix_size = full_path_prefix_length;
+	}
+	/* Every segment is stored with a trailing directory separator, hence the full path
+	 * never needs more than the length of the path, a directory separator and the prefix
+	 */
+	safe_full_path_size = full_path_prefix_size + ( path_length - path_index ) + 1;
+
+	safe_full_path = wide_string_allocate(
+	                  safe_full_path_size );
+
+	if( safe_full_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create full path.",
+		 function );
+
+		goto on_error;
+	}
+	if( wide_string_copy(
+	     safe_full_path,
+	     full_path_prefix,
+	     full_path_prefix_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy prefix to full path.",
+		 function );
+
+		goto on_error;
+	}
+	full_path_index = full_path_prefix_size;
+
+	if( libcpath_path_append_normalized_segments_wide(
+	     safe_full_path,
+	     safe_full_path_size,
+	     full_path_prefix_length,
+	     &full_path_index,
+	     &( path[ path_index ] ),
+	     path_length - path_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append path segments to full path.",
+		 function );
+
+		goto on_error;
+	}
+	/* Remove the directory separator of the last segment
+	 */
+	if( full_path_index > full_path_prefix_length )
+	{
+		full_path_index--;
+	}
+	safe_full_path[ full_path_index ] = 0;
+
+	*full_path      = safe_full_path;
+	*full_path_size = full_path_index + 1;
+
+	return( 1 );
+
+on_error:
+	if( safe_full_path != NULL )
+	{
+		memory_free(
+		 safe_full_path );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
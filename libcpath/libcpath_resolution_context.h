@@ -0,0 +1,138 @@
+/*
+ * Resolution context functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCPATH_RESOLUTION_CONTEXT_H )
+#define _LIBCPATH_RESOLUTION_CONTEXT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcpath_extern.h"
+#include "libcpath_libcerror.h"
+#include "libcpath_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libcpath_internal_resolution_context libcpath_internal_resolution_context_t;
+
+struct libcpath_internal_resolution_context
+{
+	/* The narrow base directory
+	 * This contains the prefix followed by the normalized segments, where
+	 * every segment is stored with a trailing directory separator
+	 * The base directory is not terminated by an end-of-string character
+	 */
+	char *base_directory;
+
+	/* The narrow base directory prefix length
+	 */
+	size_t base_directory_prefix_length;
+
+	/* The narrow base directory length
+	 */
+	size_t base_directory_length;
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	/* The wide base directory
+	 * This contains the prefix followed by the normalized segments, where
+	 * every segment is stored with a trailing directory separator
+	 * The base directory is not terminated by an end-of-string character
+	 */
+	wchar_t *base_directory_wide;
+
+	/* The wide base directory prefix length
+	 */
+	size_t base_directory_wide_prefix_length;
+
+	/* The wide base directory length
+	 */
+	size_t base_directory_wide_length;
+#endif
+};
+
+LIBCPATH_EXTERN \
+int libcpath_resolution_context_initialize(
+     libcpath_resolution_context_t **resolution_context,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_resolution_context_free(
+     libcpath_resolution_context_t **resolution_context,
+     libcerror_error_t **error );
+
+int libcpath_internal_resolution_context_clear(
+     libcpath_internal_resolution_context_t *internal_resolution_context,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_resolution_context_set_base_directory(
+     libcpath_resolution_context_t *resolution_context,
+     const char *base_directory,
+     size_t base_directory_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_resolution_context_set_base_directory_from_current_working_directory(
+     libcpath_resolution_context_t *resolution_context,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_resolution_context_get_full_path(
+     libcpath_resolution_context_t *resolution_context,
+     const char *path,
+     size_t path_length,
+     char **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBCPATH_EXTERN \
+int libcpath_resolution_context_set_base_directory_wide(
+     libcpath_resolution_context_t *resolution_context,
+     const wchar_t *base_directory,
+     size_t base_directory_length,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_resolution_context_set_base_directory_from_current_working_directory_wide(
+     libcpath_resolution_context_t *resolution_context,
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_resolution_context_get_full_path_wide(
+     libcpath_resolution_context_t *resolution_context,
+     const wchar_t *path,
+     size_t path_length,
+     wchar_t **full_path,
+     size_t *full_path_size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCPATH_RESOLUTION_CONTEXT_H ) */
+
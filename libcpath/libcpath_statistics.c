@@ -0,0 +1,530 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if !defined( WINAPI )
+#include <time.h>
+#endif
+
+#include "libcpath_definitions.h"
+#include "libcpath_libcerror.h"
+#include "libcpath_memory.h"
+#include "libcpath_statistics.h"
+#include "libcpath_unused.h"
+
+#if defined( HAVE_LIBCPATH_STATISTICS )
+
+/* Every thread records its statistics in its own thread values, hence
+ * threads do not contend on shared counters. The thread values of all
+ * threads are kept in a list that is only added to, so that the values
+ * can be merged when they are read. The counters are only changed by the
+ * thread that owns them and are accessed atomically, since other threads
+ * read them when the values are merged. The enabled flag is accessed
+ * atomically as well, since it is changed while other threads make calls.
+ *
+ * The thread values of a thread that has ended remain in the list and still
+ * count towards the statistics. They are not freed, since the library has
+ * no means to be notified when a thread ends, hence every thread that made
+ * a recorded call retains one thread values block until the process ends.
+ */
+static uint64_t libcpath_statistics_enabled                                                                    = 0;
+static volatile int libcpath_statistics_generation                                                             = 0;
+static libcpath_statistics_thread_values_t * volatile libcpath_statistics_thread_values_list                   = NULL;
+static LIBCPATH_STATISTICS_THREAD_LOCAL libcpath_statistics_thread_values_t *libcpath_statistics_thread_values = NULL;
+
+#endif /* defined( HAVE_LIBCPATH_STATISTICS ) */
+
+/* Retrieves a monotonic time in nanoseconds
+ * Returns the time or 0 if not available
+ */
+uint64_t libcpath_statistics_get_time(
+          void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	if( QueryPerformanceFrequency(
+	     &frequency ) == 0 )
+	{
+		return( 0 );
+	}
+	if( QueryPerformanceCounter(
+	     &counter ) == 0 )
+	{
+		return( 0 );
+	}
+	return( (uint64_t) ( ( (double) counter.QuadPart * 1000000000.0 ) / (double) frequency.QuadPart ) );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec );
+
+#else
+	return( 0 );
+
+#endif
+}
+
+#if defined( HAVE_LIBCPATH_STATISTICS )
+
+/* Clears the thread values if they are of a previous generation
+ */
+void libcpath_statistics_thread_values_synchronize(
+      libcpath_statistics_thread_values_t *thread_values )
+{
+	libcpath_statistics_function_values_t *function_values = NULL;
+	int function_identifier                                = 0;
+	int generation                                         = libcpath_statistics_atomic_load_acquire( &libcpath_statistics_generation );
+
+	if( thread_values->generation != generation )
+	{
+		for( function_identifier = 0;
+		     function_identifier < LIBCPATH_STATISTICS_NUMBER_OF_FUNCTIONS;
+		     function_identifier++ )
+		{
+			function_values = &( thread_values->function_values[ function_identifier ] );
+
+			libcpath_statistics_atomic_store(
+			 &( function_values->number_of_calls ),
+			 0 );
+
+			libcpath_statistics_atomic_store(
+			 &( function_values->number_of_allocations ),
+			 0 );
+
+			libcpath_statistics_atomic_store(
+			 &( function_values->allocated_size ),
+			 0 );
+
+			libcpath_statistics_atomic_store(
+			 &( function_values->elapsed_time ),
+			 0 );
+		}
+		libcpath_statistics_atomic_store_release(
+		 &( thread_values->generation ),
+		 generation );
+	}
+}
+
+/* Retrieves the thread values of the current thread
+ * The thread values are created and added to the list on first use
+ * Returns the thread values or NULL if not available
+ */
+libcpath_statistics_thread_values_t *libcpath_statistics_get_thread_values(
+                                      void )
+{
+	libcpath_statistics_thread_values_t *thread_values = NULL;
+
+	if( libcpath_statistics_thread_values != NULL )
+	{
+		return( libcpath_statistics_thread_values );
+	}
+	/* The thread values are allocated with the default memory functions since
+	 * they are retained until the process ends
+	 */
+	thread_values = (libcpath_statistics_thread_values_t *) libcpath_memory_default_allocate(
+	                 sizeof( libcpath_statistics_thread_values_t ) );
+
+	if( thread_values == NULL )
+	{
+		return( NULL );
+	}
+	if( memory_set(
+	     thread_values,
+	     0,
+	     sizeof( libcpath_statistics_thread_values_t ) ) == NULL )
+	{
+		libcpath_memory_default_free(
+		 thread_values );
+
+		return( NULL );
+	}
+	thread_values->generation          = libcpath_statistics_atomic_load_acquire( &libcpath_statistics_generation );
+	thread_values->function_identifier = -1;
+
+	do
+	{
+		thread_values->next_thread_values = libcpath_statistics_atomic_load_acquire( &libcpath_statistics_thread_values_list );
+	}
+#if defined( _MSC_VER )
+	while( InterlockedCompareExchangePointer(
+	        (PVOID volatile *) &libcpath_statistics_thread_values_list,
+	        (PVOID) thread_values,
+	        (PVOID) thread_values->next_thread_values ) != (PVOID) thread_values->next_thread_values );
+#else
+	while( !__sync_bool_compare_and_swap(
+	         &libcpath_statistics_thread_values_list,
+	         thread_values->next_thread_values,
+	         thread_values ) );
+#endif
+
+	libcpath_statistics_thread_values = thread_values;
+
+	return( thread_values );
+}
+
+#endif /* defined( HAVE_LIBCPATH_STATISTICS ) */
+
+/* Starts recording a call of a public function
+ * A call made while another call is recorded on the same thread is not
+ * recorded, its costs are attributed to the outer call
+ */
+void libcpath_statistics_call_start(
+      libcpath_statistics_call_t *call,
+      int function_identifier )
+{
+#if defined( HAVE_LIBCPATH_STATISTICS )
+	libcpath_statistics_thread_values_t *thread_values = NULL;
+#endif
+
+	if( call == NULL )
+	{
+		return;
+	}
+	call->thread_values = NULL;
+
+#if defined( HAVE_LIBCPATH_STATISTICS )
+	if( libcpath_statistics_atomic_load(
+	     &libcpath_statistics_enabled ) == 0 )
+	{
+		return;
+	}
+	if( ( function_identifier < 0 )
+	 || ( function_identifier >= LIBCPATH_STATISTICS_NUMBER_OF_FUNCTIONS ) )
+	{
+		return;
+	}
+	thread_values = libcpath_statistics_get_thread_values();
+
+	if( thread_values == NULL )
+	{
+		return;
+	}
+	if( thread_values->function_identifier != -1 )
+	{
+		return;
+	}
+	thread_values->function_identifier = function_identifier;
+
+	call->thread_values       = thread_values;
+	call->function_identifier = function_identifier;
+	call->start_time          = libcpath_statistics_get_time();
+
+#endif /* defined( HAVE_LIBCPATH_STATISTICS ) */
+}
+
+/* Stops recording a call of a public function
+ */
+void libcpath_statistics_call_stop(
+      libcpath_statistics_call_t *call )
+{
+#if defined( HAVE_LIBCPATH_STATISTICS )
+	libcpath_statistics_function_values_t *function_values = NULL;
+	libcpath_statistics_thread_values_t *thread_values     = NULL;
+	uint64_t elapsed_time                                  = 0;
+
+	if( call == NULL )
+	{
+		return;
+	}
+	thread_values = call->thread_values;
+
+	if( thread_values == NULL )
+	{
+		return;
+	}
+	elapsed_time = libcpath_statistics_get_time() - call->start_time;
+
+	libcpath_statistics_thread_values_synchronize(
+	 thread_values );
+
+	function_values = &( thread_values->function_values[ call->function_identifier ] );
+
+	libcpath_statistics_atomic_add(
+	 &( function_values->number_of_calls ),
+	 1 );
+
+	libcpath_statistics_atomic_add(
+	 &( function_values->elapsed_time ),
+	 elapsed_time );
+
+	thread_values->function_identifier = -1;
+
+	call->thread_values = NULL;
+
+#endif /* defined( HAVE_LIBCPATH_STATISTICS ) */
+}
+
+/* Counts an allocation towards the call that is currently recorded
+ */
+void libcpath_statistics_count_allocation(
+      size_t size )
+{
+#if defined( HAVE_LIBCPATH_STATISTICS )
+	libcpath_statistics_function_values_t *function_values = NULL;
+	libcpath_statistics_thread_values_t *thread_values     = NULL;
+
+	if( libcpath_statistics_atomic_load(
+	     &libcpath_statistics_enabled ) == 0 )
+	{
+		return;
+	}
+	thread_values = libcpath_statistics_thread_values;
+
+	if( ( thread_values == NULL )
+	 || ( thread_values->function_identifier == -1 ) )
+	{
+		return;
+	}
+	libcpath_statistics_thread_values_synchronize(
+	 thread_values );
+
+	function_values = &( thread_values->function_values[ thread_values->function_identifier ] );
+
+	libcpath_statistics_atomic_add(
+	 &( function_values->number_of_allocations ),
+	 1 );
+
+	libcpath_statistics_atomic_add(
+	 &( function_values->allocated_size ),
+	 (uint64_t) size );
+
+#endif /* defined( HAVE_LIBCPATH_STATISTICS ) */
+}
+
+/* Enables collecting statistics
+ * Statistics are collected per public function for calls made while enabled
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_enable_statistics(
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBCPATH_STATISTICS )
+	LIBCPATH_UNREFERENCED_PARAMETER( error )
+
+	libcpath_statistics_atomic_store(
+	 &libcpath_statistics_enabled,
+	 1 );
+
+	return( 1 );
+#else
+	static char *function = "libcpath_enable_statistics";
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: statistics are not supported.",
+	 function );
+
+	return( -1 );
+#endif
+}
+
+/* Disables collecting statistics
+ * The statistics collected so far are retained
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_disable_statistics(
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBCPATH_STATISTICS )
+	LIBCPATH_UNREFERENCED_PARAMETER( error )
+
+	libcpath_statistics_atomic_store(
+	 &libcpath_statistics_enabled,
+	 0 );
+
+	return( 1 );
+#else
+	static char *function = "libcpath_disable_statistics";
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: statistics are not supported.",
+	 function );
+
+	return( -1 );
+#endif
+}
+
+/* Resets the statistics of all threads
+ * Every thread clears its own values the next time it records a value
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_reset_statistics(
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBCPATH_STATISTICS )
+	LIBCPATH_UNREFERENCED_PARAMETER( error )
+
+#if defined( _MSC_VER )
+	InterlockedIncrement(
+	 (LONG volatile *) &libcpath_statistics_generation );
+#else
+	__sync_add_and_fetch(
+	 &libcpath_statistics_generation,
+	 1 );
+#endif
+	return( 1 );
+#else
+	static char *function = "libcpath_reset_statistics";
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: statistics are not supported.",
+	 function );
+
+	return( -1 );
+#endif
+}
+
+/* Retrieves the statistics of a public function
+ * The values of all threads are merged, values that are recorded while
+ * the statistics are retrieved are not necessarily included
+ * The elapsed time is in nanoseconds
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_get_statistics(
+     int function_identifier,
+     uint64_t *number_of_calls,
+     uint64_t *number_of_allocations,
+     uint64_t *allocated_size,
+     uint64_t *elapsed_time,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBCPATH_STATISTICS )
+	libcpath_statistics_function_values_t *function_values = NULL;
+	libcpath_statistics_thread_values_t *thread_values     = NULL;
+	uint64_t safe_allocated_size                           = 0;
+	uint64_t safe_elapsed_time                             = 0;
+	uint64_t safe_number_of_allocations                    = 0;
+	uint64_t safe_number_of_calls                          = 0;
+	int generation                                         = 0;
+#endif
+	static char *function                                  = "libcpath_get_statistics";
+
+	if( ( function_identifier < 0 )
+	 || ( function_identifier >= LIBCPATH_STATISTICS_NUMBER_OF_FUNCTIONS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported function.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_calls == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of calls.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_allocations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of allocations.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocated_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated size.",
+		 function );
+
+		return( -1 );
+	}
+	if( elapsed_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elapsed time.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBCPATH_STATISTICS )
+	generation    = libcpath_statistics_atomic_load_acquire( &libcpath_statistics_generation );
+	thread_values = libcpath_statistics_atomic_load_acquire( &libcpath_statistics_thread_values_list );
+
+	while( thread_values != NULL )
+	{
+		if( libcpath_statistics_atomic_load_acquire( &( thread_values->generation ) ) == generation )
+		{
+			function_values = &( thread_values->function_values[ function_identifier ] );
+
+			safe_number_of_calls       += libcpath_statistics_atomic_load( &( function_values->number_of_calls ) );
+			safe_number_of_allocations += libcpath_statistics_atomic_load( &( function_values->number_of_allocations ) );
+			safe_allocated_size        += libcpath_statistics_atomic_load( &( function_values->allocated_size ) );
+			safe_elapsed_time          += libcpath_statistics_atomic_load( &( function_values->elapsed_time ) );
+		}
+		thread_values = thread_values->next_thread_values;
+	}
+	*number_of_calls       = safe_number_of_calls;
+	*number_of_allocations = safe_number_of_allocations;
+	*allocated_size        = safe_allocated_size;
+	*elapsed_time          = safe_elapsed_time;
+
+	return( 1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: statistics are not supported.",
+	 function );
+
+	return( -1 );
+#endif
+}
+
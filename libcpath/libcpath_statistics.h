@@ -0,0 +1,214 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBCPATH_STATISTICS_H )
+#define _LIBCPATH_STATISTICS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libcpath_definitions.h"
+#include "libcpath_extern.h"
+#include "libcpath_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* Statistics are collected per thread, which requires thread local storage
+ */
+#if defined( _MSC_VER )
+#define LIBCPATH_STATISTICS_THREAD_LOCAL	__declspec( thread )
+
+#elif defined( __GNUC__ )
+#define LIBCPATH_STATISTICS_THREAD_LOCAL	__thread
+
+#endif
+
+#if defined( LIBCPATH_STATISTICS_THREAD_LOCAL )
+#define HAVE_LIBCPATH_STATISTICS		1
+#endif
+
+/* The values are only changed by the thread that owns them but can be read
+ * by any thread, hence they are accessed atomically
+ */
+#if defined( _MSC_VER )
+#define libcpath_statistics_atomic_load( value ) \
+	(uint64_t) InterlockedCompareExchange64( (LONGLONG volatile *) value, 0, 0 )
+
+#define libcpath_statistics_atomic_store( value, new_value ) \
+	InterlockedExchange64( (LONGLONG volatile *) value, (LONGLONG) new_value )
+
+#define libcpath_statistics_atomic_add( value, addend ) \
+	InterlockedExchangeAdd64( (LONGLONG volatile *) value, (LONGLONG) addend )
+
+#define libcpath_statistics_atomic_load_acquire( value ) \
+	*( value )
+
+#define libcpath_statistics_atomic_store_release( value, new_value ) \
+	*( value ) = new_value
+
+#elif defined( __ATOMIC_RELAXED )
+#define libcpath_statistics_atomic_load( value ) \
+	__atomic_load_n( value, __ATOMIC_RELAXED )
+
+#define libcpath_statistics_atomic_store( value, new_value ) \
+	__atomic_store_n( value, new_value, __ATOMIC_RELAXED )
+
+#define libcpath_statistics_atomic_add( value, addend ) \
+	__atomic_fetch_add( value, addend, __ATOMIC_RELAXED )
+
+#define libcpath_statistics_atomic_load_acquire( value ) \
+	__atomic_load_n( value, __ATOMIC_ACQUIRE )
+
+#define libcpath_statistics_atomic_store_release( value, new_value ) \
+	__atomic_store_n( value, new_value, __ATOMIC_RELEASE )
+
+#else
+#define libcpath_statistics_atomic_load( value ) \
+	__sync_fetch_and_add( value, 0 )
+
+#define libcpath_statistics_atomic_store( value, new_value ) \
+	__sync_lock_test_and_set( value, new_value )
+
+#define libcpath_statistics_atomic_add( value, addend ) \
+	__sync_fetch_and_add( value, addend )
+
+#define libcpath_statistics_atomic_load_acquire( value ) \
+	__sync_fetch_and_add( value, 0 )
+
+#define libcpath_statistics_atomic_store_release( value, new_value ) \
+	__sync_lock_test_and_set( value, new_value )
+
+#endif
+
+typedef struct libcpath_statistics_function_values libcpath_statistics_function_values_t;
+
+struct libcpath_statistics_function_values
+{
+	/* The number of calls
+	 */
+	uint64_t number_of_calls;
+
+	/* The number of allocations
+	 */
+	uint64_t number_of_allocations;
+
+	/* The allocated size
+	 */
+	uint64_t allocated_size;
+
+	/* The elapsed time in nanoseconds
+	 */
+	uint64_t elapsed_time;
+};
+
+typedef struct libcpath_statistics_thread_values libcpath_statistics_thread_values_t;
+
+struct libcpath_statistics_thread_values
+{
+	/* The next thread values
+	 */
+	libcpath_statistics_thread_values_t *next_thread_values;
+
+	/* The generation of the function values
+	 * The function values are cleared when they are of a previous generation
+	 */
+	volatile int generation;
+
+	/* The function identifier of the call that is currently recorded
+	 * This value is -1 if no call is recorded
+	 */
+	int function_identifier;
+
+	/* The function values
+	 */
+	libcpath_statistics_function_values_t function_values[ LIBCPATH_STATISTICS_NUMBER_OF_FUNCTIONS ];
+};
+
+typedef struct libcpath_statistics_call libcpath_statistics_call_t;
+
+struct libcpath_statistics_call
+{
+	/* The thread values
+	 * This value is NULL if the call is not recorded
+	 */
+	libcpath_statistics_thread_values_t *thread_values;
+
+	/* The function identifier
+	 */
+	int function_identifier;
+
+	/* The start time in nanoseconds
+	 */
+	uint64_t start_time;
+};
+
+uint64_t libcpath_statistics_get_time(
+          void );
+
+#if defined( HAVE_LIBCPATH_STATISTICS )
+
+void libcpath_statistics_thread_values_synchronize(
+      libcpath_statistics_thread_values_t *thread_values );
+
+libcpath_statistics_thread_values_t *libcpath_statistics_get_thread_values(
+                                      void );
+
+#endif /* defined( HAVE_LIBCPATH_STATISTICS ) */
+
+void libcpath_statistics_call_start(
+      libcpath_statistics_call_t *call,
+      int function_identifier );
+
+void libcpath_statistics_call_stop(
+      libcpath_statistics_call_t *call );
+
+void libcpath_statistics_count_allocation(
+      size_t size );
+
+LIBCPATH_EXTERN \
+int libcpath_enable_statistics(
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_disable_statistics(
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_reset_statistics(
+     libcerror_error_t **error );
+
+LIBCPATH_EXTERN \
+int libcpath_get_statistics(
+     int function_identifier,
+     uint64_t *number_of_calls,
+     uint64_t *number_of_allocations,
+     uint64_t *allocated_size,
+     uint64_t *elapsed_time,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBCPATH_STATISTICS_H ) */
+
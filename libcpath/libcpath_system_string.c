@@ -19,6 +19,7 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <byte_stream.h>
 #include <common.h>
 #include <memory.h>
 #include <narrow_string.h>
@@ -29,12 +30,152 @@
 #include "libcpath_libcerror.h"
 #include "libcpath_libclocale.h"
 #include "libcpath_libuna.h"
+#include "libcpath_memory.h"
 #include "libcpath_system_string.h"
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
 #error Unsupported size of wchar_t
 #endif
 
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) || defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Determines the length of the 7-bit ASCII prefix of a narrow string
+ * The prefix ends at the first end-of-string or non-ASCII character
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_system_string_get_narrow_ascii_prefix_length(
+     const char *narrow_string,
+     size_t narrow_string_size,
+     size_t *ascii_prefix_length,
+     libcerror_error_t **error )
+{
+	const uint8_t *narrow_string_bytes = NULL;
+	static char *function              = "libcpath_system_string_get_narrow_ascii_prefix_length";
+	size_t string_index                = 0;
+	uint64_t string_word               = 0;
+
+	if( narrow_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid narrow string.",
+		 function );
+
+		return( -1 );
+	}
+	if( narrow_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid narrow string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_prefix_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII prefix length.",
+		 function );
+
+		return( -1 );
+	}
+	narrow_string_bytes = (const uint8_t *) narrow_string;
+
+	/* Test 8 bytes at a time, a word contains an end-of-string or non-ASCII
+	 * character if the most significant bit of a byte is set either in the
+	 * word itself or in the word minus 0x01 in every byte. A borrow only
+	 * propagates from a byte that is 0, hence no such byte is missed.
+	 */
+	while( ( narrow_string_size - string_index ) >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( narrow_string_bytes[ string_index ] ),
+		 string_word );
+
+		if( ( ( string_word | ( string_word - (uint64_t) 0x0101010101010101ULL ) ) & (uint64_t) 0x8080808080808080ULL ) != 0 )
+		{
+			break;
+		}
+		string_index += 8;
+	}
+	while( ( string_index < narrow_string_size )
+	    && ( narrow_string_bytes[ string_index ] != 0 )
+	    && ( narrow_string_bytes[ string_index ] < 0x80 ) )
+	{
+		string_index++;
+	}
+	*ascii_prefix_length = string_index;
+
+	return( 1 );
+}
+
+/* Determines the length of the 7-bit ASCII prefix of a wide string
+ * The prefix ends at the first end-of-string or non-ASCII character
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_system_string_get_wide_ascii_prefix_length(
+     const wchar_t *wide_string,
+     size_t wide_string_size,
+     size_t *ascii_prefix_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_system_string_get_wide_ascii_prefix_length";
+	size_t string_index   = 0;
+
+	if( wide_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid wide string.",
+		 function );
+
+		return( -1 );
+	}
+	if( wide_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid wide string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_prefix_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII prefix length.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( string_index < wide_string_size )
+	    && ( wide_string[ string_index ] != 0 )
+	    && ( (uint32_t) wide_string[ string_index ] < 0x80 ) )
+	{
+		string_index++;
+	}
+	*ascii_prefix_length = string_index;
+
+	return( 1 );
+}
+
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) || defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 /* Determines the size of a narrow string from a system string
  * Returns 1 if successful or -1 on error
  */
@@ -44,28 +185,60 @@ int libcpath_system_string_size_to_narrow_string(
      size_t *narrow_string_size,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_system_string_size_to_narrow_string";
+	static char *function      = "libcpath_system_string_size_to_narrow_string";
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result            = 0;
+	size_t ascii_prefix_length = 0;
+	int result                 = 0;
 #endif
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	if( libclocale_codepage == 0 )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf8_string_size_from_utf32(
-		          (libuna_utf32_character_t *) system_string,
+		/* 7-bit ASCII characters are the same in UTF-8 and UTF-16 or UTF-32,
+		 * hence only the remainder of the string from the first non-ASCII
+		 * character onwards needs to be converted by libuna
+		 */
+		result = libcpath_system_string_get_wide_ascii_prefix_length(
+		          system_string,
 		          system_string_size,
-		          narrow_string_size,
+		          &ascii_prefix_length,
 		          error );
+
+		if( ( result == 1 )
+		 && ( ascii_prefix_length < system_string_size )
+		 && ( system_string[ ascii_prefix_length ] == 0 )
+		 && ( narrow_string_size != NULL ) )
+		{
+			*narrow_string_size = ascii_prefix_length + 1;
+		}
+		else if( result == 1 )
+		{
+			/* A string without an end-of-string character is converted as a whole
+			 */
+			if( ascii_prefix_length >= system_string_size )
+			{
+				ascii_prefix_length = 0;
+			}
+#if SIZEOF_WCHAR_T == 4
+			result = libuna_utf8_string_size_from_utf32(
+			          (libuna_utf32_character_t *) &( system_string[ ascii_prefix_length ] ),
+			          system_string_size - ascii_prefix_length,
+			          narrow_string_size,
+			          error );
 #elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf8_string_size_from_utf16(
-		          (libuna_utf16_character_t *) system_string,
-		          system_string_size,
-		          narrow_string_size,
-		          error );
+			result = libuna_utf8_string_size_from_utf16(
+			          (libuna_utf16_character_t *) &( system_string[ ascii_prefix_length ] ),
+			          system_string_size - ascii_prefix_length,
+			          narrow_string_size,
+			          error );
 #endif /* SIZEOF_WCHAR_T */
+
+			if( result == 1 )
+			{
+				*narrow_string_size += ascii_prefix_length;
+			}
+		}
 	}
 	else
 	{
@@ -147,30 +320,83 @@ int libcpath_system_string_copy_to_narrow_string(
      size_t narrow_string_size,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_system_string_copy_to_narrow_string";
+	static char *function      = "libcpath_system_string_copy_to_narrow_string";
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result            = 0;
+	size_t ascii_prefix_length = 0;
+	size_t string_index        = 0;
+	int result                 = 0;
 #endif
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	if( libclocale_codepage == 0 )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf8_string_copy_from_utf32(
-		          (libuna_utf8_character_t *) narrow_string,
-		          narrow_string_size,
-		          (libuna_utf32_character_t *) system_string,
+		/* 7-bit ASCII characters are the same in UTF-8 and UTF-16 or UTF-32,
+		 * hence only the remainder of the string from the first non-ASCII
+		 * character onwards needs to be converted by libuna
+		 */
+		result = libcpath_system_string_get_wide_ascii_prefix_length(
+		          system_string,
 		          system_string_size,
+		          &ascii_prefix_length,
 		          error );
+
+		if( ( result == 1 )
+		 && ( ascii_prefix_length < system_string_size )
+		 && ( narrow_string != NULL )
+		 && ( narrow_string_size <= (size_t) SSIZE_MAX )
+		 && ( ascii_prefix_length < narrow_string_size ) )
+		{
+			for( string_index = 0;
+			     string_index < ascii_prefix_length;
+			     string_index++ )
+			{
+				narrow_string[ string_index ] = (char) system_string[ string_index ];
+			}
+			if( system_string[ ascii_prefix_length ] == 0 )
+			{
+				narrow_string[ ascii_prefix_length ] = 0;
+			}
+			else
+			{
+#if SIZEOF_WCHAR_T == 4
+				result = libuna_utf8_string_copy_from_utf32(
+				          (libuna_utf8_character_t *) &( narrow_string[ ascii_prefix_length ] ),
+				          narrow_string_size - ascii_prefix_length,
+				          (libuna_utf32_character_t *) &( system_string[ ascii_prefix_length ] ),
+				          system_string_size - ascii_prefix_length,
+				          error );
 #elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf8_string_copy_from_utf16(
-		          (libuna_utf8_character_t *) narrow_string,
-		          narrow_string_size,
-		          (libuna_utf16_character_t *) system_string,
-		          system_string_size,
-		          error );
+				result = libuna_utf8_string_copy_from_utf16(
+				          (libuna_utf8_character_t *) &( narrow_string[ ascii_prefix_length ] ),
+				          narrow_string_size - ascii_prefix_length,
+				          (libuna_utf16_character_t *) &( system_string[ ascii_prefix_length ] ),
+				          system_string_size - ascii_prefix_length,
+				          error );
+#endif /* SIZEOF_WCHAR_T */
+			}
+		}
+		else if( result == 1 )
+		{
+			/* A string without an end-of-string character or a destination string
+			 * that is invalid or too small is handled by converting as a whole
+			 */
+#if SIZEOF_WCHAR_T == 4
+			result = libuna_utf8_string_copy_from_utf32(
+			          (libuna_utf8_character_t *) narrow_string,
+			          narrow_string_size,
+			          (libuna_utf32_character_t *) system_string,
+			          system_string_size,
+			          error );
+#elif SIZEOF_WCHAR_T == 2
+			result = libuna_utf8_string_copy_from_utf16(
+			          (libuna_utf8_character_t *) narrow_string,
+			          narrow_string_size,
+			          (libuna_utf16_character_t *) system_string,
+			          system_string_size,
+			          error );
 #endif /* SIZEOF_WCHAR_T */
+		}
 	}
 	else
 	{
@@ -289,28 +515,60 @@ int libcpath_system_string_size_from_narrow_string(
      size_t *system_string_size,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_system_string_size_from_narrow_string";
+	static char *function      = "libcpath_system_string_size_from_narrow_string";
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result            = 0;
+	size_t ascii_prefix_length = 0;
+	int result                 = 0;
 #endif
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	if( libclocale_codepage == 0 )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_utf8(
-		          (libuna_utf8_character_t *) narrow_string,
+		/* 7-bit ASCII characters are the same in UTF-8 and UTF-16 or UTF-32,
+		 * hence only the remainder of the string from the first non-ASCII
+		 * character onwards needs to be converted by libuna
+		 */
+		result = libcpath_system_string_get_narrow_ascii_prefix_length(
+		          narrow_string,
 		          narrow_string_size,
-		          system_string_size,
+		          &ascii_prefix_length,
 		          error );
+
+		if( ( result == 1 )
+		 && ( ascii_prefix_length < narrow_string_size )
+		 && ( narrow_string[ ascii_prefix_length ] == 0 )
+		 && ( system_string_size != NULL ) )
+		{
+			*system_string_size = ascii_prefix_length + 1;
+		}
+		else if( result == 1 )
+		{
+			/* A string without an end-of-string character is converted as a whole
+			 */
+			if( ascii_prefix_length >= narrow_string_size )
+			{
+				ascii_prefix_length = 0;
+			}
+#if SIZEOF_WCHAR_T == 4
+			result = libuna_utf32_string_size_from_utf8(
+			          (libuna_utf8_character_t *) &( narrow_string[ ascii_prefix_length ] ),
+			          narrow_string_size - ascii_prefix_length,
+			          system_string_size,
+			          error );
 #elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_utf8(
-		          (libuna_utf8_character_t *) narrow_string,
-		          narrow_string_size,
-		          system_string_size,
-		          error );
+			result = libuna_utf16_string_size_from_utf8(
+			          (libuna_utf8_character_t *) &( narrow_string[ ascii_prefix_length ] ),
+			          narrow_string_size - ascii_prefix_length,
+			          system_string_size,
+			          error );
 #endif /* SIZEOF_WCHAR_T */
+
+			if( result == 1 )
+			{
+				*system_string_size += ascii_prefix_length;
+			}
+		}
 	}
 	else
 	{
@@ -392,30 +650,83 @@ int libcpath_system_string_copy_from_narrow_string(
      size_t narrow_string_size,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_system_string_copy_from_narrow_string";
+	static char *function      = "libcpath_system_string_copy_from_narrow_string";
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result            = 0;
+	size_t ascii_prefix_length = 0;
+	size_t string_index        = 0;
+	int result                 = 0;
 #endif
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	if( libclocale_codepage == 0 )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_copy_from_utf8(
-		          (libuna_utf32_character_t *) system_string,
-		          system_string_size,
-		          (libuna_utf8_character_t *) narrow_string,
+		/* 7-bit ASCII characters are the same in UTF-8 and UTF-16 or UTF-32,
+		 * hence only the remainder of the string from the first non-ASCII
+		 * character onwards needs to be converted by libuna
+		 */
+		result = libcpath_system_string_get_narrow_ascii_prefix_length(
+		          narrow_string,
 		          narrow_string_size,
+		          &ascii_prefix_length,
 		          error );
+
+		if( ( result == 1 )
+		 && ( ascii_prefix_length < narrow_string_size )
+		 && ( system_string != NULL )
+		 && ( system_string_size <= (size_t) SSIZE_MAX )
+		 && ( ascii_prefix_length < system_string_size ) )
+		{
+			for( string_index = 0;
+			     string_index < ascii_prefix_length;
+			     string_index++ )
+			{
+				system_string[ string_index ] = (wchar_t) narrow_string[ string_index ];
+			}
+			if( narrow_string[ ascii_prefix_length ] == 0 )
+			{
+				system_string[ ascii_prefix_length ] = 0;
+			}
+			else
+			{
+#if SIZEOF_WCHAR_T == 4
+				result = libuna_utf32_string_copy_from_utf8(
+				          (libuna_utf32_character_t *) &( system_string[ ascii_prefix_length ] ),
+				          system_string_size - ascii_prefix_length,
+				          (libuna_utf8_character_t *) &( narrow_string[ ascii_prefix_length ] ),
+				          narrow_string_size - ascii_prefix_length,
+				          error );
 #elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_copy_from_utf8(
-		          (libuna_utf16_character_t *) system_string,
-		          system_string_size,
-		          (libuna_utf8_character_t *) narrow_string,
-		          narrow_string_size,
-		          error );
+				result = libuna_utf16_string_copy_from_utf8(
+				          (libuna_utf16_character_t *) &( system_string[ ascii_prefix_length ] ),
+				          system_string_size - ascii_prefix_length,
+				          (libuna_utf8_character_t *) &( narrow_string[ ascii_prefix_length ] ),
+				          narrow_string_size - ascii_prefix_length,
+				          error );
+#endif /* SIZEOF_WCHAR_T */
+			}
+		}
+		else if( result == 1 )
+		{
+			/* A string without an end-of-string character or a destination string
+			 * that is invalid or too small is handled by converting as a whole
+			 */
+#if SIZEOF_WCHAR_T == 4
+			result = libuna_utf32_string_copy_from_utf8(
+			          (libuna_utf32_character_t *) system_string,
+			          system_string_size,
+			          (libuna_utf8_character_t *) narrow_string,
+			          narrow_string_size,
+			          error );
+#elif SIZEOF_WCHAR_T == 2
+			result = libuna_utf16_string_copy_from_utf8(
+			          (libuna_utf16_character_t *) system_string,
+			          system_string_size,
+			          (libuna_utf8_character_t *) narrow_string,
+			          narrow_string_size,
+			          error );
 #endif /* SIZEOF_WCHAR_T */
+		}
 	}
 	else
 	{
@@ -536,10 +847,11 @@ int libcpath_system_string_size_to_wide_string(
      size_t *wide_string_size,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_system_string_size_to_wide_string";
+	static char *function      = "libcpath_system_string_size_to_wide_string";
 
 #if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result            = 0;
+	size_t ascii_prefix_length = 0;
+	int result                 = 0;
 #endif
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -580,19 +892,50 @@ int libcpath_system_string_size_to_wide_string(
 #else
 	if( libclocale_codepage == 0 )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_size_from_utf8(
-		          (libuna_utf8_character_t *) system_string,
+		/* 7-bit ASCII characters are the same in UTF-8 and UTF-16 or UTF-32,
+		 * hence only the remainder of the string from the first non-ASCII
+		 * character onwards needs to be converted by libuna
+		 */
+		result = libcpath_system_string_get_narrow_ascii_prefix_length(
+		          system_string,
 		          system_string_size,
-		          wide_string_size,
+		          &ascii_prefix_length,
 		          error );
+
+		if( ( result == 1 )
+		 && ( ascii_prefix_length < system_string_size )
+		 && ( system_string[ ascii_prefix_length ] == 0 )
+		 && ( wide_string_size != NULL ) )
+		{
+			*wide_string_size = ascii_prefix_length + 1;
+		}
+		else if( result == 1 )
+		{
+			/* A string without an end-of-string character is converted as a whole
+			 */
+			if( ascii_prefix_length >= system_string_size )
+			{
+				ascii_prefix_length = 0;
+			}
+#if SIZEOF_WCHAR_T == 4
+			result = libuna_utf32_string_size_from_utf8(
+			          (libuna_utf8_character_t *) &( system_string[ ascii_prefix_length ] ),
+			          system_string_size - ascii_prefix_length,
+			          wide_string_size,
+			          error );
 #elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_size_from_utf8(
-		          (libuna_utf8_character_t *) system_string,
-		          system_string_size,
-		          wide_string_size,
-		          error );
+			result = libuna_utf16_string_size_from_utf8(
+			          (libuna_utf8_character_t *) &( system_string[ ascii_prefix_length ] ),
+			          system_string_size - ascii_prefix_length,
+			          wide_string_size,
+			          error );
 #endif /* SIZEOF_WCHAR_T */
+
+			if( result == 1 )
+			{
+				*wide_string_size += ascii_prefix_length;
+			}
+		}
 	}
 	else
 	{
@@ -638,10 +981,12 @@ int libcpath_system_string_copy_to_wide_string(
      size_t wide_string_size,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_system_string_copy_to_wide_string";
+	static char *function      = "libcpath_system_string_copy_to_wide_string";
 
 #if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result            = 0;
+	size_t ascii_prefix_length = 0;
+	size_t string_index        = 0;
+	int result                 = 0;
 #endif
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -718,21 +1063,72 @@ int libcpath_system_string_copy_to_wide_string(
 #else
 	if( libclocale_codepage == 0 )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf32_string_copy_from_utf8(
-		          (libuna_utf32_character_t *) wide_string,
-		          wide_string_size,
-		          (libuna_utf8_character_t *) system_string,
+		/* 7-bit ASCII characters are the same in UTF-8 and UTF-16 or UTF-32,
+		 * hence only the remainder of the string from the first non-ASCII
+		 * character onwards needs to be converted by libuna
+		 */
+		result = libcpath_system_string_get_narrow_ascii_prefix_length(
+		          system_string,
 		          system_string_size,
+		          &ascii_prefix_length,
 		          error );
+
+		if( ( result == 1 )
+		 && ( ascii_prefix_length < system_string_size )
+		 && ( wide_string != NULL )
+		 && ( wide_string_size <= (size_t) SSIZE_MAX )
+		 && ( ascii_prefix_length < wide_string_size ) )
+		{
+			for( string_index = 0;
+			     string_index < ascii_prefix_length;
+			     string_index++ )
+			{
+				wide_string[ string_index ] = (wchar_t) system_string[ string_index ];
+			}
+			if( system_string[ ascii_prefix_length ] == 0 )
+			{
+				wide_string[ ascii_prefix_length ] = 0;
+			}
+			else
+			{
+#if SIZEOF_WCHAR_T == 4
+				result = libuna_utf32_string_copy_from_utf8(
+				          (libuna_utf32_character_t *) &( wide_string[ ascii_prefix_length ] ),
+				          wide_string_size - ascii_prefix_length,
+				          (libuna_utf8_character_t *) &( system_string[ ascii_prefix_length ] ),
+				          system_string_size - ascii_prefix_length,
+				          error );
 #elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf16_string_copy_from_utf8(
-		          (libuna_utf16_character_t *) wide_string,
-		          wide_string_size,
-		          (libuna_utf8_character_t *) system_string,
-		          system_string_size,
-		          error );
+				result = libuna_utf16_string_copy_from_utf8(
+				          (libuna_utf16_character_t *) &( wide_string[ ascii_prefix_length ] ),
+				          wide_string_size - ascii_prefix_length,
+				          (libuna_utf8_character_t *) &( system_string[ ascii_prefix_length ] ),
+				          system_string_size - ascii_prefix_length,
+				          error );
+#endif /* SIZEOF_WCHAR_T */
+			}
+		}
+		else if( result == 1 )
+		{
+			/* A string without an end-of-string character or a destination string
+			 * that is invalid or too small is handled by converting as a whole
+			 */
+#if SIZEOF_WCHAR_T == 4
+			result = libuna_utf32_string_copy_from_utf8(
+			          (libuna_utf32_character_t *) wide_string,
+			          wide_string_size,
+			          (libuna_utf8_character_t *) system_string,
+			          system_string_size,
+			          error );
+#elif SIZEOF_WCHAR_T == 2
+			result = libuna_utf16_string_copy_from_utf8(
+			          (libuna_utf16_character_t *) wide_string,
+			          wide_string_size,
+			          (libuna_utf8_character_t *) system_string,
+			          system_string_size,
+			          error );
 #endif /* SIZEOF_WCHAR_T */
+		}
 	}
 	else
 	{
@@ -770,153 +1166,461 @@ int libcpath_system_string_copy_to_wide_string(
 	return( 1 );
 }
 
-/* Determines the size of a system string from a wide string
+/* Determines the maximum size of a wide string converted from a system string
+ * The maximum size allows for the worst case conversion of every character
+ * and an end-of-string character
  * Returns 1 if successful or -1 on error
  */
-int libcpath_system_string_size_from_wide_string(
-     const wchar_t *wide_string,
-     size_t wide_string_size,
-     size_t *system_string_size,
+int libcpath_system_string_get_maximum_size_to_wide_string(
+     size_t system_string_size,
+     size_t *wide_string_size,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_system_string_size_from_wide_string";
-
-#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result            = 0;
-#endif
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( wide_string == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid wide string.",
-		 function );
+	static char *function = "libcpath_system_string_get_maximum_size_to_wide_string";
 
-		return( -1 );
-	}
-	if( wide_string_size > (size_t) SSIZE_MAX )
+	if( system_string_size > (size_t) ( SSIZE_MAX - 1 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid wide string size value exceeds maximum.",
+		 "%s: invalid system string size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( system_string_size == NULL )
+	if( wide_string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid system string size.",
+		 "%s: invalid wide string size.",
 		 function );
 
 		return( -1 );
 	}
-	*system_string_size = wide_string_size;
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	*wide_string_size = system_string_size;
 #else
-	if( libclocale_codepage == 0 )
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf8_string_size_from_utf32(
-		          (libuna_utf32_character_t *) wide_string,
-		          wide_string_size,
-		          system_string_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf8_string_size_from_utf16(
-		          (libuna_utf16_character_t *) wide_string,
-		          wide_string_size,
-		          system_string_size,
-		          error );
-#endif /* SIZEOF_WCHAR_T */
-	}
-	else
-	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_byte_stream_size_from_utf32(
-		          (libuna_utf32_character_t *) wide_string,
-		          wide_string_size,
-		          libclocale_codepage,
-		          system_string_size,
-		          error );
-#elif SIZEOF_WCHAR_T == 2
-		result = libuna_byte_stream_size_from_utf16(
-		          (libuna_utf16_character_t *) wide_string,
-		          wide_string_size,
-		          libclocale_codepage,
-		          system_string_size,
-		          error );
-#endif /* SIZEOF_WCHAR_T */
-	}
-	if( result != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
-		 LIBCERROR_CONVERSION_ERROR_GENERIC,
-		 "%s: unable to determine wide string size.",
-		 function );
-
-		return( -1 );
-	}
-#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
-
+	/* Every byte is converted into at most 1 wide character, where the 4 bytes
+	 * of an UTF-8 character that require an UTF-16 surrogate pair are converted
+	 * into 2 wide characters
+	 */
+	*wide_string_size = system_string_size + 1;
+#endif
 	return( 1 );
 }
 
-/* Copies a system string from a wide string
+/* Converts a system string into a wide string in a single pass
+ * The wide string must be large enough to contain the converted string, which is
+ * guaranteed for the size determined by libcpath_system_string_get_maximum_size_to_wide_string
+ * The converted wide string size includes the end-of-string character
  * Returns 1 if successful or -1 on error
  */
-int libcpath_system_string_copy_from_wide_string(
-     system_character_t *system_string,
+int libcpath_system_string_convert_to_wide_string(
+     const system_character_t *system_string,
      size_t system_string_size,
-     const wchar_t *wide_string,
+     wchar_t *wide_string,
      size_t wide_string_size,
+     size_t *converted_wide_string_size,
      libcerror_error_t **error )
 {
-	static char *function = "libcpath_system_string_copy_from_wide_string";
+	static char *function      = "libcpath_system_string_convert_to_wide_string";
 
 #if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	int result            = 0;
+	size_t ascii_prefix_length = 0;
+	size_t string_index        = 0;
+	int result                 = 0;
 #endif
 
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( system_string == NULL )
+	if( converted_wide_string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid system string.",
+		 "%s: invalid converted wide string size.",
 		 function );
 
 		return( -1 );
 	}
-	if( system_string_size > (size_t) SSIZE_MAX )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcpath_system_string_copy_to_wide_string(
+	     system_string,
+	     system_string_size,
+	     wide_string,
+	     wide_string_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid system string size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set wide string.",
 		 function );
 
 		return( -1 );
 	}
-	if( wide_string == NULL )
+	*converted_wide_string_size = system_string_size;
+#else
+	if( system_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid wide string.",
+		 "%s: invalid system string.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid system string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( wide_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid wide string.",
+		 function );
+
+		return( -1 );
+	}
+	if( wide_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid wide string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libclocale_codepage == 0 )
+	{
+		/* 7-bit ASCII characters are the same in UTF-8 and UTF-16 or UTF-32,
+		 * hence they are widened directly
+		 */
+		if( libcpath_system_string_get_narrow_ascii_prefix_length(
+		     system_string,
+		     system_string_size,
+		     &ascii_prefix_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine ASCII prefix length.",
+			 function );
+
+			return( -1 );
+		}
+		if( ascii_prefix_length >= wide_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid wide string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		for( string_index = 0;
+		     string_index < ascii_prefix_length;
+		     string_index++ )
+		{
+			wide_string[ string_index ] = (wchar_t) system_string[ string_index ];
+		}
+	}
+	if( ( string_index >= system_string_size )
+	 || ( system_string[ string_index ] == 0 ) )
+	{
+		if( string_index >= wide_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid wide string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		wide_string[ string_index ] = 0;
+	}
+	else
+	{
+		if( libclocale_codepage == 0 )
+		{
+#if SIZEOF_WCHAR_T == 4
+			result = libuna_utf32_string_copy_from_utf8(
+			          (libuna_utf32_character_t *) &( wide_string[ string_index ] ),
+			          wide_string_size - string_index,
+			          (libuna_utf8_character_t *) &( system_string[ string_index ] ),
+			          system_string_size - string_index,
+			          error );
+#elif SIZEOF_WCHAR_T == 2
+			result = libuna_utf16_string_copy_from_utf8(
+			          (libuna_utf16_character_t *) &( wide_string[ string_index ] ),
+			          wide_string_size - string_index,
+			          (libuna_utf8_character_t *) &( system_string[ string_index ] ),
+			          system_string_size - string_index,
+			          error );
+#endif /* SIZEOF_WCHAR_T */
+		}
+		else
+		{
+#if SIZEOF_WCHAR_T == 4
+			result = libuna_utf32_string_copy_from_byte_stream(
+			          (libuna_utf32_character_t *) &( wide_string[ string_index ] ),
+			          wide_string_size - string_index,
+			          (uint8_t *) &( system_string[ string_index ] ),
+			          system_string_size - string_index,
+			          libclocale_codepage,
+			          error );
+#elif SIZEOF_WCHAR_T == 2
+			result = libuna_utf16_string_copy_from_byte_stream(
+			          (libuna_utf16_character_t *) &( wide_string[ string_index ] ),
+			          wide_string_size - string_index,
+			          (uint8_t *) &( system_string[ string_index ] ),
+			          system_string_size - string_index,
+			          libclocale_codepage,
+			          error );
+#endif /* SIZEOF_WCHAR_T */
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unable to set wide string.",
+			 function );
+
+			return( -1 );
+		}
+		/* libuna does not return the size of the converted string
+		 * hence it is determined from the end-of-string character
+		 */
+		while( ( string_index < wide_string_size )
+		    && ( wide_string[ string_index ] != 0 ) )
+		{
+			string_index++;
+		}
+		if( string_index >= wide_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing end-of-string character in wide string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*converted_wide_string_size = string_index + 1;
+
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	return( 1 );
+}
+
+/* Determines the size of a system string from a wide string
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_system_string_size_from_wide_string(
+     const wchar_t *wide_string,
+     size_t wide_string_size,
+     size_t *system_string_size,
+     libcerror_error_t **error )
+{
+	static char *function      = "libcpath_system_string_size_from_wide_string";
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	size_t ascii_prefix_length = 0;
+	int result                 = 0;
+#endif
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( wide_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid wide string.",
+		 function );
+
+		return( -1 );
+	}
+	if( wide_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid wide string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system string size.",
+		 function );
+
+		return( -1 );
+	}
+	*system_string_size = wide_string_size;
+#else
+	if( libclocale_codepage == 0 )
+	{
+		/* 7-bit ASCII characters are the same in UTF-8 and UTF-16 or UTF-32,
+		 * hence only the remainder of the string from the first non-ASCII
+		 * character onwards needs to be converted by libuna
+		 */
+		result = libcpath_system_string_get_wide_ascii_prefix_length(
+		          wide_string,
+		          wide_string_size,
+		          &ascii_prefix_length,
+		          error );
+
+		if( ( result == 1 )
+		 && ( ascii_prefix_length < wide_string_size )
+		 && ( wide_string[ ascii_prefix_length ] == 0 )
+		 && ( system_string_size != NULL ) )
+		{
+			*system_string_size = ascii_prefix_length + 1;
+		}
+		else if( result == 1 )
+		{
+			/* A string without an end-of-string character is converted as a whole
+			 */
+			if( ascii_prefix_length >= wide_string_size )
+			{
+				ascii_prefix_length = 0;
+			}
+#if SIZEOF_WCHAR_T == 4
+			result = libuna_utf8_string_size_from_utf32(
+			          (libuna_utf32_character_t *) &( wide_string[ ascii_prefix_length ] ),
+			          wide_string_size - ascii_prefix_length,
+			          system_string_size,
+			          error );
+#elif SIZEOF_WCHAR_T == 2
+			result = libuna_utf8_string_size_from_utf16(
+			          (libuna_utf16_character_t *) &( wide_string[ ascii_prefix_length ] ),
+			          wide_string_size - ascii_prefix_length,
+			          system_string_size,
+			          error );
+#endif /* SIZEOF_WCHAR_T */
+
+			if( result == 1 )
+			{
+				*system_string_size += ascii_prefix_length;
+			}
+		}
+	}
+	else
+	{
+#if SIZEOF_WCHAR_T == 4
+		result = libuna_byte_stream_size_from_utf32(
+		          (libuna_utf32_character_t *) wide_string,
+		          wide_string_size,
+		          libclocale_codepage,
+		          system_string_size,
+		          error );
+#elif SIZEOF_WCHAR_T == 2
+		result = libuna_byte_stream_size_from_utf16(
+		          (libuna_utf16_character_t *) wide_string,
+		          wide_string_size,
+		          libclocale_codepage,
+		          system_string_size,
+		          error );
+#endif /* SIZEOF_WCHAR_T */
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to determine wide string size.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	return( 1 );
+}
+
+/* Copies a system string from a wide string
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_system_string_copy_from_wide_string(
+     system_character_t *system_string,
+     size_t system_string_size,
+     const wchar_t *wide_string,
+     size_t wide_string_size,
+     libcerror_error_t **error )
+{
+	static char *function      = "libcpath_system_string_copy_from_wide_string";
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	size_t ascii_prefix_length = 0;
+	size_t string_index        = 0;
+	int result                 = 0;
+#endif
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( system_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system string.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid system string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( wide_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid wide string.",
 		 function );
 
 		return( -1 );
@@ -961,21 +1665,72 @@ int libcpath_system_string_copy_from_wide_string(
 #else
 	if( libclocale_codepage == 0 )
 	{
-#if SIZEOF_WCHAR_T == 4
-		result = libuna_utf8_string_copy_from_utf32(
-		          (libuna_utf8_character_t *) system_string,
-		          system_string_size,
-		          (libuna_utf32_character_t *) wide_string,
+		/* 7-bit ASCII characters are the same in UTF-8 and UTF-16 or UTF-32,
+		 * hence only the remainder of the string from the first non-ASCII
+		 * character onwards needs to be converted by libuna
+		 */
+		result = libcpath_system_string_get_wide_ascii_prefix_length(
+		          wide_string,
 		          wide_string_size,
+		          &ascii_prefix_length,
 		          error );
+
+		if( ( result == 1 )
+		 && ( ascii_prefix_length < wide_string_size )
+		 && ( system_string != NULL )
+		 && ( system_string_size <= (size_t) SSIZE_MAX )
+		 && ( ascii_prefix_length < system_string_size ) )
+		{
+			for( string_index = 0;
+			     string_index < ascii_prefix_length;
+			     string_index++ )
+			{
+				system_string[ string_index ] = (char) wide_string[ string_index ];
+			}
+			if( wide_string[ ascii_prefix_length ] == 0 )
+			{
+				system_string[ ascii_prefix_length ] = 0;
+			}
+			else
+			{
+#if SIZEOF_WCHAR_T == 4
+				result = libuna_utf8_string_copy_from_utf32(
+				          (libuna_utf8_character_t *) &( system_string[ ascii_prefix_length ] ),
+				          system_string_size - ascii_prefix_length,
+				          (libuna_utf32_character_t *) &( wide_string[ ascii_prefix_length ] ),
+				          wide_string_size - ascii_prefix_length,
+				          error );
 #elif SIZEOF_WCHAR_T == 2
-		result = libuna_utf8_string_copy_from_utf16(
-		          (libuna_utf8_character_t *) system_string,
-		          system_string_size,
-		          (libuna_utf16_character_t *) wide_string,
-		          wide_string_size,
-		          error );
+				result = libuna_utf8_string_copy_from_utf16(
+				          (libuna_utf8_character_t *) &( system_string[ ascii_prefix_length ] ),
+				          system_string_size - ascii_prefix_length,
+				          (libuna_utf16_character_t *) &( wide_string[ ascii_prefix_length ] ),
+				          wide_string_size - ascii_prefix_length,
+				          error );
 #endif /* SIZEOF_WCHAR_T */
+			}
+		}
+		else if( result == 1 )
+		{
+			/* A string without an end-of-string character or a destination string
+			 * that is invalid or too small is handled by converting as a whole
+			 */
+#if SIZEOF_WCHAR_T == 4
+			result = libuna_utf8_string_copy_from_utf32(
+			          (libuna_utf8_character_t *) system_string,
+			          system_string_size,
+			          (libuna_utf32_character_t *) wide_string,
+			          wide_string_size,
+			          error );
+#elif SIZEOF_WCHAR_T == 2
+			result = libuna_utf8_string_copy_from_utf16(
+			          (libuna_utf8_character_t *) system_string,
+			          system_string_size,
+			          (libuna_utf16_character_t *) wide_string,
+			          wide_string_size,
+			          error );
+#endif /* SIZEOF_WCHAR_T */
+		}
 	}
 	else
 	{
@@ -1013,5 +1768,460 @@ int libcpath_system_string_copy_from_wide_string(
 	return( 1 );
 }
 
+/* Determines the maximum size of a system string converted from a wide string
+ * The maximum size allows for the worst case conversion of every character
+ * and an end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_system_string_get_maximum_size_from_wide_string(
+     size_t wide_string_size,
+     size_t *system_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libcpath_system_string_get_maximum_size_from_wide_string";
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( wide_string_size > (size_t) SSIZE_MAX )
+#else
+	if( wide_string_size > (size_t) ( ( SSIZE_MAX - 1 ) / 4 ) )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid wide string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system string size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	*system_string_size = wide_string_size;
+#else
+	/* Every wide character is converted into at most 4 bytes
+	 */
+	*system_string_size = ( wide_string_size * 4 ) + 1;
+#endif
+	return( 1 );
+}
+
+/* Converts a wide string into a system string in a single pass
+ * The system string must be large enough to contain the converted string, which is
+ * guaranteed for the size determined by libcpath_system_string_get_maximum_size_from_wide_string
+ * The converted system string size includes the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_system_string_convert_from_wide_string(
+     system_character_t *system_string,
+     size_t system_string_size,
+     const wchar_t *wide_string,
+     size_t wide_string_size,
+     size_t *converted_system_string_size,
+     libcerror_error_t **error )
+{
+	static char *function      = "libcpath_system_string_convert_from_wide_string";
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	size_t ascii_prefix_length = 0;
+	size_t string_index        = 0;
+	int result                 = 0;
+#endif
+
+	if( converted_system_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid converted system string size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcpath_system_string_copy_from_wide_string(
+	     system_string,
+	     system_string_size,
+	     wide_string,
+	     wide_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set system string.",
+		 function );
+
+		return( -1 );
+	}
+	*converted_system_string_size = wide_string_size;
+#else
+	if( system_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system string.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid system string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( wide_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid wide string.",
+		 function );
+
+		return( -1 );
+	}
+	if( wide_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid wide string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libclocale_codepage == 0 )
+	{
+		/* 7-bit ASCII characters are the same in UTF-8 and UTF-16 or UTF-32,
+		 * hence they are narrowed directly
+		 */
+		if( libcpath_system_string_get_wide_ascii_prefix_length(
+		     wide_string,
+		     wide_string_size,
+		     &ascii_prefix_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine ASCII prefix length.",
+			 function );
+
+			return( -1 );
+		}
+		if( ascii_prefix_length >= system_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid system string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		for( string_index = 0;
+		     string_index < ascii_prefix_length;
+		     string_index++ )
+		{
+			system_string[ string_index ] = (char) wide_string[ string_index ];
+		}
+	}
+	if( ( string_index >= wide_string_size )
+	 || ( wide_string[ string_index ] == 0 ) )
+	{
+		if( string_index >= system_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid system string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		system_string[ string_index ] = 0;
+	}
+	else
+	{
+		if( libclocale_codepage == 0 )
+		{
+#if SIZEOF_WCHAR_T == 4
+			result = libuna_utf8_string_copy_from_utf32(
+			          (libuna_utf8_character_t *) &( system_string[ string_index ] ),
+			          system_string_size - string_index,
+			          (libuna_utf32_character_t *) &( wide_string[ string_index ] ),
+			          wide_string_size - string_index,
+			          error );
+#elif SIZEOF_WCHAR_T == 2
+			result = libuna_utf8_string_copy_from_utf16(
+			          (libuna_utf8_character_t *) &( system_string[ string_index ] ),
+			          system_string_size - string_index,
+			          (libuna_utf16_character_t *) &( wide_string[ string_index ] ),
+			          wide_string_size - string_index,
+			          error );
+#endif /* SIZEOF_WCHAR_T */
+		}
+		else
+		{
+#if SIZEOF_WCHAR_T == 4
+			result = libuna_byte_stream_copy_from_utf32(
+			          (uint8_t *) &( system_string[ string_index ] ),
+			          system_string_size - string_index,
+			          libclocale_codepage,
+			          (libuna_utf32_character_t *) &( wide_string[ string_index ] ),
+			          wide_string_size - string_index,
+			          error );
+#elif SIZEOF_WCHAR_T == 2
+			result = libuna_byte_stream_copy_from_utf16(
+			          (uint8_t *) &( system_string[ string_index ] ),
+			          system_string_size - string_index,
+			          libclocale_codepage,
+			          (libuna_utf16_character_t *) &( wide_string[ string_index ] ),
+			          wide_string_size - string_index,
+			          error );
+#endif /* SIZEOF_WCHAR_T */
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unable to set system string.",
+			 function );
+
+			return( -1 );
+		}
+		/* libuna does not return the size of the converted string
+		 * hence it is determined from the end-of-string character
+		 */
+		while( ( string_index < system_string_size )
+		    && ( system_string[ string_index ] != 0 ) )
+		{
+			string_index++;
+		}
+		if( string_index >= system_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing end-of-string character in system string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*converted_system_string_size = string_index + 1;
+
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	return( 1 );
+}
+
+/* Converts a wide string into a system string in a single pass
+ * The buffer is used for the system string if it is large enough to contain
+ * the converted string, otherwise the system string is allocated
+ * The system string should be freed if it does not point to the buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libcpath_system_string_convert_from_wide_string_with_buffer(
+     const wchar_t *wide_string,
+     size_t wide_string_size,
+     system_character_t *buffer,
+     size_t buffer_size,
+     system_character_t **system_string,
+     size_t *system_string_size,
+     libcerror_error_t **error )
+{
+	system_character_t *safe_system_string = NULL;
+	static char *function                  = "libcpath_system_string_convert_from_wide_string_with_buffer";
+	size_t maximum_system_string_size      = 0;
+	size_t safe_system_string_size         = 0;
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	size_t ascii_prefix_length             = 0;
+#endif
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *system_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid system string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_system_string_get_maximum_size_from_wide_string(
+	     wide_string_size,
+	     &maximum_system_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine maximum system string size.",
+		 function );
+
+		goto on_error;
+	}
+	if( maximum_system_string_size <= buffer_size )
+	{
+		safe_system_string = buffer;
+	}
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	else if( libclocale_codepage == 0 )
+	{
+		/* A 7-bit ASCII string is not expanded by the conversion
+		 */
+		if( libcpath_system_string_get_wide_ascii_prefix_length(
+		     wide_string,
+		     wide_string_size,
+		     &ascii_prefix_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine ASCII prefix length.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( ascii_prefix_length < wide_string_size )
+		 && ( ascii_prefix_length < buffer_size )
+		 && ( wide_string[ ascii_prefix_length ] == 0 ) )
+		{
+			safe_system_string = buffer;
+		}
+	}
+#endif /* !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	if( safe_system_string == buffer )
+	{
+		maximum_system_string_size = buffer_size;
+	}
+	else
+	{
+		safe_system_string = system_string_allocate(
+		                      maximum_system_string_size );
+
+		if( safe_system_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create system string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcpath_system_string_convert_from_wide_string(
+	     safe_system_string,
+	     maximum_system_string_size,
+	     wide_string,
+	     wide_string_size,
+	     &safe_system_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to set system string.",
+		 function );
+
+		goto on_error;
+	}
+	*system_string      = safe_system_string;
+	*system_string_size = safe_system_string_size;
+
+	return( 1 );
+
+on_error:
+	if( ( safe_system_string != NULL )
+	 && ( safe_system_string != buffer ) )
+	{
+		memory_free(
+		 safe_system_string );
+	}
+	return( -1 );
+}
+
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
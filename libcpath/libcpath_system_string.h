@@ -31,6 +31,22 @@
 extern "C" {
 #endif
 
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) || defined( HAVE_WIDE_CHARACTER_TYPE )
+
+int libcpath_system_string_get_narrow_ascii_prefix_length(
+     const char *narrow_string,
+     size_t narrow_string_size,
+     size_t *ascii_prefix_length,
+     libcerror_error_t **error );
+
+int libcpath_system_string_get_wide_ascii_prefix_length(
+     const wchar_t *wide_string,
+     size_t wide_string_size,
+     size_t *ascii_prefix_length,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) || defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 int libcpath_system_string_size_to_narrow_string(
      const system_character_t *system_string,
      size_t system_string_size,
@@ -72,6 +88,19 @@ int libcpath_system_string_copy_to_wide_string(
      size_t wide_string_size,
      libcerror_error_t **error );
 
+int libcpath_system_string_get_maximum_size_to_wide_string(
+     size_t system_string_size,
+     size_t *wide_string_size,
+     libcerror_error_t **error );
+
+int libcpath_system_string_convert_to_wide_string(
+     const system_character_t *system_string,
+     size_t system_string_size,
+     wchar_t *wide_string,
+     size_t wide_string_size,
+     size_t *converted_wide_string_size,
+     libcerror_error_t **error );
+
 int libcpath_system_string_size_from_wide_string(
      const wchar_t *wide_string,
      size_t wide_string_size,
@@ -85,6 +114,28 @@ int libcpath_system_string_copy_from_wide_string(
      size_t wide_string_size,
      libcerror_error_t **error );
 
+int libcpath_system_string_get_maximum_size_from_wide_string(
+     size_t wide_string_size,
+     size_t *system_string_size,
+     libcerror_error_t **error );
+
+int libcpath_system_string_convert_from_wide_string(
+     system_character_t *system_string,
+     size_t system_string_size,
+     const wchar_t *wide_string,
+     size_t wide_string_size,
+     size_t *converted_system_string_size,
+     libcerror_error_t **error );
+
+int libcpath_system_string_convert_from_wide_string_with_buffer(
+     const wchar_t *wide_string,
+     size_t wide_string_size,
+     system_character_t *buffer,
+     size_t buffer_size,
+     system_character_t **system_string,
+     size_t *system_string_size,
+     libcerror_error_t **error );
+
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
 #if defined( __cplusplus )
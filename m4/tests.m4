@@ -251,7 +251,7 @@ dnl Function to detect if tests dependencies are available
 AC_DEFUN([AX_TESTS_CHECK_LOCAL],
   [AC_CHECK_HEADERS([dlfcn.h])
 
-  AC_CHECK_FUNCS([fmemopen getopt mkstemp setenv tzset unlink])
+  AC_CHECK_FUNCS([fmemopen getopt mkdtemp mkstemp rmdir setenv tzset unlink])
 
   AC_CHECK_LIB(
     dl,
@@ -0,0 +1,1378 @@
+/*
+ * Library path functions benchmark program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include <stdio.h>
+#include <time.h>
+
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ )
+#define __USE_GNU
+#include <dlfcn.h>
+#undef __USE_GNU
+#endif
+
+/* Counting allocations requires hooking malloc, which cannot be used
+ * in combination with DLLs or CygWin
+ */
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && !defined( __CYGWIN__ )
+#define HAVE_CPATH_BENCH_ALLOCATION_COUNT	1
+#endif
+
+/* The system string conversion functions are internal functions
+ */
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( HAVE_WIDE_CHARACTER_TYPE ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define HAVE_CPATH_BENCH_WIDE_CONVERSION	1
+#endif
+
+#include "cpath_test_libcerror.h"
+#include "cpath_test_libcpath.h"
+#include "cpath_test_unused.h"
+
+#if defined( HAVE_CPATH_BENCH_WIDE_CONVERSION )
+#include "../libcpath/libcpath_system_string.h"
+#endif
+
+/* The default number of iterations over a path set
+ */
+#define CPATH_BENCH_DEFAULT_NUMBER_OF_ITERATIONS	100
+
+/* The number of paths in a synthetic path set
+ */
+#define CPATH_BENCH_NUMBER_OF_SYNTHETIC_PATHS		1024
+
+/* The maximum size of a path in the corpus file
+ */
+#define CPATH_BENCH_MAXIMUM_CORPUS_PATH_SIZE		4096
+
+typedef struct cpath_bench_path_set cpath_bench_path_set_t;
+
+struct cpath_bench_path_set
+{
+	/* The name
+	 */
+	const char *name;
+
+	/* The paths
+	 */
+	char **paths;
+
+	/* The path lengths
+	 */
+	size_t *path_lengths;
+
+	/* The number of paths
+	 */
+	int number_of_paths;
+
+	/* The maximum number of paths
+	 */
+	int maximum_number_of_paths;
+
+	/* The total length of the paths
+	 */
+	size_t total_length;
+
+	/* The maximum length of the paths
+	 */
+	size_t maximum_length;
+
+#if defined( HAVE_CPATH_BENCH_WIDE_CONVERSION )
+	/* The wide paths
+	 */
+	wchar_t **wide_paths;
+
+	/* The wide path sizes
+	 */
+	size_t *wide_path_sizes;
+
+	/* The scratch narrow string used by the conversion benchmarks
+	 */
+	char *narrow_scratch;
+
+	/* The scratch narrow string size
+	 */
+	size_t narrow_scratch_size;
+
+	/* The scratch wide string used by the conversion benchmarks
+	 */
+	wchar_t *wide_scratch;
+
+	/* The scratch wide string size
+	 */
+	size_t wide_scratch_size;
+#endif
+};
+
+/* A benchmarked operation on the path at the index in the path set
+ * Returns 1 if successful or -1 on error
+ */
+typedef int (*cpath_bench_function_t)(
+               cpath_bench_path_set_t *path_set,
+               int path_index,
+               libcerror_error_t **error );
+
+#if defined( HAVE_CPATH_BENCH_ALLOCATION_COUNT )
+
+static void *(*cpath_bench_real_malloc)(size_t)          = NULL;
+static void *(*cpath_bench_real_realloc)(void *, size_t) = NULL;
+static uint64_t cpath_bench_number_of_allocations        = 0;
+
+/* Custom malloc for counting allocations
+ * Returns a pointer to newly allocated data or NULL
+ */
+void *malloc(
+       size_t size )
+{
+	if( cpath_bench_real_malloc == NULL )
+	{
+		cpath_bench_real_malloc = dlsym(
+		                           RTLD_NEXT,
+		                           "malloc" );
+
+		if( cpath_bench_real_malloc == NULL )
+		{
+			return( NULL );
+		}
+	}
+	cpath_bench_number_of_allocations++;
+
+	return( cpath_bench_real_malloc(
+	         size ) );
+}
+
+/* Custom realloc for counting allocations
+ * Returns a pointer to reallocated data or NULL
+ */
+void *realloc(
+       void *ptr,
+       size_t size )
+{
+	if( cpath_bench_real_realloc == NULL )
+	{
+		cpath_bench_real_realloc = dlsym(
+		                            RTLD_NEXT,
+		                            "realloc" );
+
+		if( cpath_bench_real_realloc == NULL )
+		{
+			return( NULL );
+		}
+	}
+	cpath_bench_number_of_allocations++;
+
+	return( cpath_bench_real_realloc(
+	         ptr,
+	         size ) );
+}
+
+#endif /* defined( HAVE_CPATH_BENCH_ALLOCATION_COUNT ) */
+
+/* Retrieves a monotonic time in nanoseconds
+ * Returns the time
+ */
+uint64_t cpath_bench_get_time(
+          void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	QueryPerformanceCounter(
+	 &counter );
+
+	QueryPerformanceFrequency(
+	 &frequency );
+
+	return( (uint64_t) ( ( (double) counter.QuadPart * 1000000000.0 ) / (double) frequency.QuadPart ) );
+
+#elif defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec );
+
+#else
+	return( (uint64_t) ( ( (double) clock() * 1000000000.0 ) / (double) CLOCKS_PER_SEC ) );
+
+#endif
+}
+
+/* Initializes a path set
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_path_set_initialize(
+     cpath_bench_path_set_t *path_set,
+     const char *name,
+     int maximum_number_of_paths,
+     libcerror_error_t **error )
+{
+	static char *function = "cpath_bench_path_set_initialize";
+
+	if( path_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_paths <= 0 )
+	 || ( (size_t) maximum_number_of_paths > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( size_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of paths value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     path_set,
+	     0,
+	     sizeof( cpath_bench_path_set_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear path set.",
+		 function );
+
+		return( -1 );
+	}
+	path_set->paths = (char **) memory_allocate(
+	                             sizeof( char * ) * maximum_number_of_paths );
+
+	if( path_set->paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create paths.",
+		 function );
+
+		goto on_error;
+	}
+	path_set->path_lengths = (size_t *) memory_allocate(
+	                                     sizeof( size_t ) * maximum_number_of_paths );
+
+	if( path_set->path_lengths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path lengths.",
+		 function );
+
+		goto on_error;
+	}
+	path_set->name                    = name;
+	path_set->maximum_number_of_paths = maximum_number_of_paths;
+
+	return( 1 );
+
+on_error:
+	if( path_set->paths != NULL )
+	{
+		memory_free(
+		 path_set->paths );
+
+		path_set->paths = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees the paths of a path set
+ */
+void cpath_bench_path_set_free(
+      cpath_bench_path_set_t *path_set )
+{
+	int path_index = 0;
+
+	if( path_set == NULL )
+	{
+		return;
+	}
+	for( path_index = 0;
+	     path_index < path_set->number_of_paths;
+	     path_index++ )
+	{
+		memory_free(
+		 path_set->paths[ path_index ] );
+
+#if defined( HAVE_CPATH_BENCH_WIDE_CONVERSION )
+		if( path_set->wide_paths != NULL )
+		{
+			memory_free(
+			 path_set->wide_paths[ path_index ] );
+		}
+#endif
+	}
+	if( path_set->paths != NULL )
+	{
+		memory_free(
+		 path_set->paths );
+	}
+	if( path_set->path_lengths != NULL )
+	{
+		memory_free(
+		 path_set->path_lengths );
+	}
+#if defined( HAVE_CPATH_BENCH_WIDE_CONVERSION )
+	if( path_set->wide_paths != NULL )
+	{
+		memory_free(
+		 path_set->wide_paths );
+	}
+	if( path_set->wide_path_sizes != NULL )
+	{
+		memory_free(
+		 path_set->wide_path_sizes );
+	}
+	if( path_set->narrow_scratch != NULL )
+	{
+		memory_free(
+		 path_set->narrow_scratch );
+	}
+	if( path_set->wide_scratch != NULL )
+	{
+		memory_free(
+		 path_set->wide_scratch );
+	}
+#endif
+	memory_set(
+	 path_set,
+	 0,
+	 sizeof( cpath_bench_path_set_t ) );
+}
+
+/* Appends a copy of a path to a path set
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_path_set_append_path(
+     cpath_bench_path_set_t *path_set,
+     const char *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	char *safe_path       = NULL;
+	static char *function = "cpath_bench_path_set_append_path";
+
+	if( path_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_set->number_of_paths >= path_set->maximum_number_of_paths )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path set - number of paths value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_length == 0 )
+	 || ( path_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_path = narrow_string_allocate(
+	             path_length + 1 );
+
+	if( safe_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		return( -1 );
+	}
+	if( narrow_string_copy(
+	     safe_path,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		memory_free(
+		 safe_path );
+
+		return( -1 );
+	}
+	safe_path[ path_length ] = 0;
+
+	path_set->paths[ path_set->number_of_paths ]        = safe_path;
+	path_set->path_lengths[ path_set->number_of_paths ] = path_length;
+
+	path_set->number_of_paths += 1;
+	path_set->total_length    += path_length;
+
+	if( path_length > path_set->maximum_length )
+	{
+		path_set->maximum_length = path_length;
+	}
+	return( 1 );
+}
+
+/* Fills a path set with synthetic paths
+ * The format contains a single %d which is replaced by the path index
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_path_set_fill_synthetic(
+     cpath_bench_path_set_t *path_set,
+     const char *format,
+     libcerror_error_t **error )
+{
+	char path[ 256 ];
+
+	static char *function = "cpath_bench_path_set_fill_synthetic";
+	int path_index        = 0;
+	int print_count       = 0;
+
+	if( path_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path set.",
+		 function );
+
+		return( -1 );
+	}
+	for( path_index = 0;
+	     path_index < path_set->maximum_number_of_paths;
+	     path_index++ )
+	{
+		print_count = narrow_string_snprintf(
+		               path,
+		               256,
+		               format,
+		               path_index );
+
+		if( ( print_count <= 0 )
+		 || ( print_count >= 256 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set path: %d.",
+			 function,
+			 path_index );
+
+			return( -1 );
+		}
+		if( cpath_bench_path_set_append_path(
+		     path_set,
+		     path,
+		     (size_t) print_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append path: %d.",
+			 function,
+			 path_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Fills a path set with the paths in a corpus file
+ * The corpus file contains one path per line, empty lines are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_path_set_fill_from_corpus(
+     cpath_bench_path_set_t *path_set,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	char path[ CPATH_BENCH_MAXIMUM_CORPUS_PATH_SIZE ];
+
+	FILE *file_stream     = NULL;
+	static char *function = "cpath_bench_path_set_fill_from_corpus";
+	size_t path_length    = 0;
+
+	if( path_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path set.",
+		 function );
+
+		return( -1 );
+	}
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_OPEN_READ );
+
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open corpus file: %s.",
+		 function,
+		 filename );
+
+		return( -1 );
+	}
+	while( file_stream_get_string(
+	        file_stream,
+	        path,
+	        CPATH_BENCH_MAXIMUM_CORPUS_PATH_SIZE ) != NULL )
+	{
+		path_length = narrow_string_length(
+		               path );
+
+		while( ( path_length > 0 )
+		    && ( ( path[ path_length - 1 ] == '\n' )
+		     ||  ( path[ path_length - 1 ] == '\r' ) ) )
+		{
+			path_length--;
+		}
+		if( path_length == 0 )
+		{
+			continue;
+		}
+		if( path_set->number_of_paths >= path_set->maximum_number_of_paths )
+		{
+			break;
+		}
+		if( cpath_bench_path_set_append_path(
+		     path_set,
+		     path,
+		     path_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append path.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	file_stream_close(
+	 file_stream );
+
+	return( 1 );
+
+on_error:
+	file_stream_close(
+	 file_stream );
+
+	return( -1 );
+}
+
+#if defined( HAVE_CPATH_BENCH_WIDE_CONVERSION )
+
+/* Prepares the wide paths and scratch strings of a path set
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_path_set_prepare_wide(
+     cpath_bench_path_set_t *path_set,
+     libcerror_error_t **error )
+{
+	static char *function = "cpath_bench_path_set_prepare_wide";
+	size_t wide_path_size = 0;
+	int path_index        = 0;
+
+	if( path_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path set.",
+		 function );
+
+		return( -1 );
+	}
+	path_set->wide_paths = (wchar_t **) memory_allocate(
+	                                     sizeof( wchar_t * ) * path_set->maximum_number_of_paths );
+
+	if( path_set->wide_paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create wide paths.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     path_set->wide_paths,
+	     0,
+	     sizeof( wchar_t * ) * path_set->maximum_number_of_paths ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear wide paths.",
+		 function );
+
+		return( -1 );
+	}
+	path_set->wide_path_sizes = (size_t *) memory_allocate(
+	                                        sizeof( size_t ) * path_set->maximum_number_of_paths );
+
+	if( path_set->wide_path_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create wide path sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_system_string_get_maximum_size_to_wide_string(
+	     path_set->maximum_length + 1,
+	     &( path_set->wide_scratch_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine maximum wide scratch size.",
+		 function );
+
+		return( -1 );
+	}
+	path_set->wide_scratch = wide_string_allocate(
+	                          path_set->wide_scratch_size );
+
+	if( path_set->wide_scratch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create wide scratch.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcpath_system_string_get_maximum_size_from_wide_string(
+	     path_set->wide_scratch_size,
+	     &( path_set->narrow_scratch_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine maximum narrow scratch size.",
+		 function );
+
+		return( -1 );
+	}
+	path_set->narrow_scratch = narrow_string_allocate(
+	                            path_set->narrow_scratch_size );
+
+	if( path_set->narrow_scratch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create narrow scratch.",
+		 function );
+
+		return( -1 );
+	}
+	for( path_index = 0;
+	     path_index < path_set->number_of_paths;
+	     path_index++ )
+	{
+		if( libcpath_system_string_convert_to_wide_string(
+		     path_set->paths[ path_index ],
+		     path_set->path_lengths[ path_index ] + 1,
+		     path_set->wide_scratch,
+		     path_set->wide_scratch_size,
+		     &wide_path_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unable to convert path: %d to wide string.",
+			 function,
+			 path_index );
+
+			return( -1 );
+		}
+		path_set->wide_paths[ path_index ] = wide_string_allocate(
+		                                      wide_path_size );
+
+		if( path_set->wide_paths[ path_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create wide path: %d.",
+			 function,
+			 path_index );
+
+			return( -1 );
+		}
+		if( wide_string_copy(
+		     path_set->wide_paths[ path_index ],
+		     path_set->wide_scratch,
+		     wide_path_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy wide path: %d.",
+			 function,
+			 path_index );
+
+			return( -1 );
+		}
+		path_set->wide_path_sizes[ path_index ] = wide_path_size;
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_CPATH_BENCH_WIDE_CONVERSION ) */
+
+/* Benchmarks libcpath_path_get_full_path
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_get_full_path(
+     cpath_bench_path_set_t *path_set,
+     int path_index,
+     libcerror_error_t **error )
+{
+	char *full_path       = NULL;
+	size_t full_path_size = 0;
+
+	if( libcpath_path_get_full_path(
+	     path_set->paths[ path_index ],
+	     path_set->path_lengths[ path_index ],
+	     &full_path,
+	     &full_path_size,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	memory_free(
+	 full_path );
+
+	return( 1 );
+}
+
+/* Benchmarks libcpath_path_join
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_join(
+     cpath_bench_path_set_t *path_set,
+     int path_index,
+     libcerror_error_t **error )
+{
+	char *path       = NULL;
+	size_t path_size = 0;
+
+	if( libcpath_path_join(
+	     &path,
+	     &path_size,
+	     "/usr/local/share",
+	     16,
+	     path_set->paths[ path_index ],
+	     path_set->path_lengths[ path_index ],
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	memory_free(
+	 path );
+
+	return( 1 );
+}
+
+/* Benchmarks libcpath_path_get_sanitized_filename
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_get_sanitized_filename(
+     cpath_bench_path_set_t *path_set,
+     int path_index,
+     libcerror_error_t **error )
+{
+	char *sanitized_filename       = NULL;
+	size_t sanitized_filename_size = 0;
+
+	if( libcpath_path_get_sanitized_filename(
+	     path_set->paths[ path_index ],
+	     path_set->path_lengths[ path_index ],
+	     &sanitized_filename,
+	     &sanitized_filename_size,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	memory_free(
+	 sanitized_filename );
+
+	return( 1 );
+}
+
+/* Benchmarks libcpath_path_get_sanitized_path
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_get_sanitized_path(
+     cpath_bench_path_set_t *path_set,
+     int path_index,
+     libcerror_error_t **error )
+{
+	char *sanitized_path       = NULL;
+	size_t sanitized_path_size = 0;
+
+	if( libcpath_path_get_sanitized_path(
+	     path_set->paths[ path_index ],
+	     path_set->path_lengths[ path_index ],
+	     &sanitized_path,
+	     &sanitized_path_size,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	memory_free(
+	 sanitized_path );
+
+	return( 1 );
+}
+
+#if defined( HAVE_CPATH_BENCH_WIDE_CONVERSION )
+
+/* Benchmarks libcpath_system_string_convert_to_wide_string
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_convert_to_wide_string(
+     cpath_bench_path_set_t *path_set,
+     int path_index,
+     libcerror_error_t **error )
+{
+	size_t wide_string_size = 0;
+
+	return( libcpath_system_string_convert_to_wide_string(
+	         path_set->paths[ path_index ],
+	         path_set->path_lengths[ path_index ] + 1,
+	         path_set->wide_scratch,
+	         path_set->wide_scratch_size,
+	         &wide_string_size,
+	         error ) );
+}
+
+/* Benchmarks libcpath_system_string_convert_from_wide_string
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_convert_from_wide_string(
+     cpath_bench_path_set_t *path_set,
+     int path_index,
+     libcerror_error_t **error )
+{
+	size_t narrow_string_size = 0;
+
+	return( libcpath_system_string_convert_from_wide_string(
+	         path_set->narrow_scratch,
+	         path_set->narrow_scratch_size,
+	         path_set->wide_paths[ path_index ],
+	         path_set->wide_path_sizes[ path_index ],
+	         &narrow_string_size,
+	         error ) );
+}
+
+#endif /* defined( HAVE_CPATH_BENCH_WIDE_CONVERSION ) */
+
+/* Runs a benchmark over all the paths in a path set and prints the results
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_run(
+     const char *name,
+     cpath_bench_function_t function,
+     cpath_bench_path_set_t *path_set,
+     int number_of_iterations,
+     libcerror_error_t **error )
+{
+	static char *function_name       = "cpath_bench_run";
+	double bytes_per_second          = 0.0;
+	double nanoseconds_per_operation = 0.0;
+	uint64_t elapsed_time            = 0;
+	uint64_t number_of_operations    = 0;
+	uint64_t start_time              = 0;
+	int iteration                    = 0;
+	int path_index                   = 0;
+
+#if defined( HAVE_CPATH_BENCH_ALLOCATION_COUNT )
+	uint64_t number_of_allocations   = 0;
+#endif
+
+	if( path_set == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path set.",
+		 function_name );
+
+		return( -1 );
+	}
+	if( path_set->number_of_paths == 0 )
+	{
+		return( 1 );
+	}
+	/* Run the benchmark once to warm up caches
+	 */
+	for( path_index = 0;
+	     path_index < path_set->number_of_paths;
+	     path_index++ )
+	{
+		if( function(
+		     path_set,
+		     path_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run %s on path: %d.",
+			 function_name,
+			 name,
+			 path_index );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_CPATH_BENCH_ALLOCATION_COUNT )
+	number_of_allocations = cpath_bench_number_of_allocations;
+#endif
+	start_time = cpath_bench_get_time();
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		for( path_index = 0;
+		     path_index < path_set->number_of_paths;
+		     path_index++ )
+		{
+			if( function(
+			     path_set,
+			     path_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to run %s on path: %d.",
+				 function_name,
+				 name,
+				 path_index );
+
+				return( -1 );
+			}
+		}
+	}
+	elapsed_time = cpath_bench_get_time() - start_time;
+
+#if defined( HAVE_CPATH_BENCH_ALLOCATION_COUNT )
+	number_of_allocations = cpath_bench_number_of_allocations - number_of_allocations;
+#endif
+	number_of_operations = (uint64_t) number_of_iterations * (uint64_t) path_set->number_of_paths;
+
+	nanoseconds_per_operation = (double) elapsed_time / (double) number_of_operations;
+
+	if( elapsed_time > 0 )
+	{
+		bytes_per_second = ( (double) path_set->total_length * (double) number_of_iterations * 1000000000.0 ) / (double) elapsed_time;
+	}
+	fprintf(
+	 stdout,
+	 "%-28s %-10s %12.1f ns/op %14.0f bytes/s",
+	 name,
+	 path_set->name,
+	 nanoseconds_per_operation,
+	 bytes_per_second );
+
+#if defined( HAVE_CPATH_BENCH_ALLOCATION_COUNT )
+	fprintf(
+	 stdout,
+	 " %8.2f allocations/op\n",
+	 (double) number_of_allocations / (double) number_of_operations );
+#else
+	fprintf(
+	 stdout,
+	 "\n" );
+#endif
+	return( 1 );
+}
+
+/* Runs all the benchmarks over a path set
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_bench_run_path_set(
+     cpath_bench_path_set_t *path_set,
+     int number_of_iterations,
+     libcerror_error_t **error )
+{
+	static char *function = "cpath_bench_run_path_set";
+
+	if( cpath_bench_run(
+	     "get_full_path",
+	     cpath_bench_get_full_path,
+	     path_set,
+	     number_of_iterations,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( cpath_bench_run(
+	     "join",
+	     cpath_bench_join,
+	     path_set,
+	     number_of_iterations,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( cpath_bench_run(
+	     "get_sanitized_filename",
+	     cpath_bench_get_sanitized_filename,
+	     path_set,
+	     number_of_iterations,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( cpath_bench_run(
+	     "get_sanitized_path",
+	     cpath_bench_get_sanitized_path,
+	     path_set,
+	     number_of_iterations,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+#if defined( HAVE_CPATH_BENCH_WIDE_CONVERSION )
+	if( cpath_bench_path_set_prepare_wide(
+	     path_set,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( cpath_bench_run(
+	     "convert_to_wide_string",
+	     cpath_bench_convert_to_wide_string,
+	     path_set,
+	     number_of_iterations,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( cpath_bench_run(
+	     "convert_from_wide_string",
+	     cpath_bench_convert_from_wide_string,
+	     path_set,
+	     number_of_iterations,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_GENERIC,
+	 "%s: unable to run benchmarks on path set: %s.",
+	 function,
+	 path_set->name );
+
+	return( -1 );
+}
+
+/* Prints usage information
+ */
+void cpath_bench_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use cpath_bench to measure the throughput of the path functions.\n\n" );
+	fprintf( stream, "Usage: cpath_bench [ -i iterations ] [ -h ] [ corpus ]\n\n" );
+	fprintf( stream, "\tcorpus: optional file with one path per line\n\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-i:     number of iterations over every path set (default is %d)\n",
+	 CPATH_BENCH_DEFAULT_NUMBER_OF_ITERATIONS );
+}
+
+/* The synthetic path sets
+ */
+static const char *cpath_bench_synthetic_path_set_names[ 4 ] = {
+	"short",
+	"deep",
+	"absolute",
+	"escaped" };
+
+static const char *cpath_bench_synthetic_path_set_formats[ 4 ] = {
+	"file%d.txt",
+	"a/b/./c/../d/e/f/g/h/i/j/../k/l/m/n/o/p/file%d.dat",
+	"/usr/local/share/doc/package%d/README",
+	"dir\\name:\x01with*%d?\t<control>|characters" };
+
+/* The main program
+ */
+int main(
+     int argc,
+     char * const argv[] )
+{
+	cpath_bench_path_set_t path_set;
+
+	libcerror_error_t *error    = NULL;
+	const char *corpus_filename = NULL;
+	char *value_end             = NULL;
+	long value                  = 0;
+	int argument_index          = 0;
+	int number_of_iterations    = CPATH_BENCH_DEFAULT_NUMBER_OF_ITERATIONS;
+	int path_set_index          = 0;
+
+	memory_set(
+	 &path_set,
+	 0,
+	 sizeof( cpath_bench_path_set_t ) );
+
+	for( argument_index = 1;
+	     argument_index < argc;
+	     argument_index++ )
+	{
+		if( narrow_string_compare(
+		     argv[ argument_index ],
+		     "-h",
+		     3 ) == 0 )
+		{
+			cpath_bench_usage_fprint(
+			 stdout );
+
+			return( EXIT_SUCCESS );
+		}
+		else if( narrow_string_compare(
+		          argv[ argument_index ],
+		          "-i",
+		          3 ) == 0 )
+		{
+			argument_index++;
+
+			if( argument_index >= argc )
+			{
+				cpath_bench_usage_fprint(
+				 stderr );
+
+				return( EXIT_FAILURE );
+			}
+			value = strtol(
+			         argv[ argument_index ],
+			         &value_end,
+			         10 );
+
+			if( ( value_end == argv[ argument_index ] )
+			 || ( *value_end != 0 )
+			 || ( value <= 0 )
+			 || ( value > (long) INT32_MAX ) )
+			{
+				fprintf(
+				 stderr,
+				 "Unsupported number of iterations: %s.\n",
+				 argv[ argument_index ] );
+
+				return( EXIT_FAILURE );
+			}
+			number_of_iterations = (int) value;
+		}
+		else if( corpus_filename == NULL )
+		{
+			corpus_filename = argv[ argument_index ];
+		}
+		else
+		{
+			cpath_bench_usage_fprint(
+			 stderr );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	for( path_set_index = 0;
+	     path_set_index < 4;
+	     path_set_index++ )
+	{
+		if( cpath_bench_path_set_initialize(
+		     &path_set,
+		     cpath_bench_synthetic_path_set_names[ path_set_index ],
+		     CPATH_BENCH_NUMBER_OF_SYNTHETIC_PATHS,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( cpath_bench_path_set_fill_synthetic(
+		     &path_set,
+		     cpath_bench_synthetic_path_set_formats[ path_set_index ],
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( cpath_bench_run_path_set(
+		     &path_set,
+		     number_of_iterations,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		cpath_bench_path_set_free(
+		 &path_set );
+	}
+	if( corpus_filename != NULL )
+	{
+		if( cpath_bench_path_set_initialize(
+		     &path_set,
+		     "corpus",
+		     65536,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( cpath_bench_path_set_fill_from_corpus(
+		     &path_set,
+		     corpus_filename,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( cpath_bench_run_path_set(
+		     &path_set,
+		     number_of_iterations,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		cpath_bench_path_set_free(
+		 &path_set );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+
+		libcerror_error_free(
+		 &error );
+	}
+	cpath_bench_path_set_free(
+	 &path_set );
+
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1244 @@
+/*
+ * Library arena type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cpath_test_libcerror.h"
+#include "cpath_test_libcpath.h"
+#include "cpath_test_macros.h"
+#include "cpath_test_memory.h"
+#include "cpath_test_unused.h"
+
+#include "../libcpath/libcpath_arena.h"
+#include "../libcpath/libcpath_definitions.h"
+
+/* Tests the libcpath_arena_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_arena_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libcpath_arena_t *arena         = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_CPATH_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcpath_arena_initialize(
+	          &arena,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_arena_free(
+	          &arena,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_arena_initialize(
+	          NULL,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	arena = (libcpath_arena_t *) 0x12345678UL;
+
+	result = libcpath_arena_initialize(
+	          &arena,
+	          0,
+	          &error );
+
+	arena = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_arena_initialize(
+	          &arena,
+	          (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE + 1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CPATH_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcpath_arena_initialize with malloc failing
+		 */
+		cpath_test_malloc_attempts_before_fail = test_number;
+
+		result = libcpath_arena_initialize(
+		          &arena,
+		          0,
+		          &error );
+
+		if( cpath_test_malloc_attempts_before_fail != -1 )
+		{
+			cpath_test_malloc_attempts_before_fail = -1;
+
+			if( arena != NULL )
+			{
+				libcpath_arena_free(
+				 &arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			CPATH_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CPATH_TEST_ASSERT_IS_NULL(
+			 "arena",
+			 arena );
+
+			CPATH_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcpath_arena_initialize with memset failing
+		 */
+		cpath_test_memset_attempts_before_fail = test_number;
+
+		result = libcpath_arena_initialize(
+		          &arena,
+		          0,
+		          &error );
+
+		if( cpath_test_memset_attempts_before_fail != -1 )
+		{
+			cpath_test_memset_attempts_before_fail = -1;
+
+			if( arena != NULL )
+			{
+				libcpath_arena_free(
+				 &arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			CPATH_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CPATH_TEST_ASSERT_IS_NULL(
+			 "arena",
+			 arena );
+
+			CPATH_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libcpath_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_arena_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_arena_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcpath_arena_free(
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_arena_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_arena_reset(
+     libcpath_arena_t *arena )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_arena_reset(
+	          arena,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_arena_reset(
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_set_memory_arena function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_set_memory_arena(
+     libcpath_arena_t *arena )
+{
+	libcerror_error_t *error = NULL;
+	char *full_path          = NULL;
+	size_t full_path_size    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_set_memory_arena(
+	          arena,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_full_path(
+	          "file.txt",
+	          8,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "full_path",
+	 full_path );
+
+	result = narrow_string_compare(
+	          &( full_path[ full_path_size - 9 ] ),
+	          "file.txt",
+	          9 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The full path is released by the reset of the arena
+	 */
+	full_path = NULL;
+
+	result = libcpath_arena_reset(
+	          arena,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_set_memory_arena(
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the default memory functions are restored
+	 */
+	result = libcpath_path_get_full_path(
+	          "file.txt",
+	          8,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 full_path );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libcpath_set_memory_arena(
+	 NULL,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libcpath_set_memory_arena function with the current working directory cache enabled
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_set_memory_arena_with_cache(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libcpath_arena_t *arena               = NULL;
+	char *current_working_directory       = NULL;
+	char *full_path                       = NULL;
+	size_t current_working_directory_size = 0;
+	size_t full_path_size                 = 0;
+	int result                            = 0;
+
+	result = libcpath_path_get_current_working_directory_exact(
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_enable_current_working_directory_cache(
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_arena_initialize(
+	          &arena,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_set_memory_arena(
+	          arena,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Fill the cache while the arena is used
+	 */
+	result = libcpath_path_get_full_path(
+	          "c",
+	          1,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_path_size",
+	 full_path_size,
+	 current_working_directory_size + 2 );
+
+	result = narrow_string_compare(
+	          full_path,
+	          current_working_directory,
+	          current_working_directory_size - 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	full_path = NULL;
+
+	result = libcpath_arena_reset(
+	          arena,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Reuse the memory of the arena that was released by the reset
+	 */
+	result = libcpath_path_get_full_path(
+	          "/zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz",
+	          49,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	full_path = NULL;
+
+	/* The cache should not be affected by the reset of the arena
+	 */
+	result = libcpath_path_get_full_path(
+	          "c",
+	          1,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_path_size",
+	 full_path_size,
+	 current_working_directory_size + 2 );
+
+	result = narrow_string_compare(
+	          full_path,
+	          current_working_directory,
+	          current_working_directory_size - 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	full_path = NULL;
+
+	result = libcpath_arena_free(
+	          &arena,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The cache should not be affected by the free of the arena
+	 */
+	result = libcpath_path_get_full_path(
+	          "c",
+	          1,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_path_size",
+	 full_path_size,
+	 current_working_directory_size + 2 );
+
+	result = narrow_string_compare(
+	          full_path,
+	          current_working_directory,
+	          current_working_directory_size - 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 full_path );
+
+	full_path = NULL;
+
+	/* Clean up
+	 */
+	result = libcpath_path_disable_current_working_directory_cache(
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 current_working_directory );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libcpath_arena_free(
+		 &arena,
+		 NULL );
+	}
+	else if( full_path != NULL )
+	{
+		memory_free(
+		 full_path );
+	}
+	if( current_working_directory != NULL )
+	{
+		memory_free(
+		 current_working_directory );
+	}
+	libcpath_path_disable_current_working_directory_cache(
+	 NULL );
+
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
+
+/* Tests the libcpath_arena_allocate function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_arena_allocate(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libcpath_arena_t *arena  = NULL;
+	uint8_t *buffer1         = NULL;
+	uint8_t *buffer2         = NULL;
+	uint8_t *buffer3         = NULL;
+	int result               = 0;
+
+	result = libcpath_arena_initialize(
+	          &arena,
+	          256,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	buffer1 = (uint8_t *) libcpath_arena_allocate(
+	                       (intptr_t *) arena,
+	                       10 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer1",
+	 buffer1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "buffer1 alignment",
+	 (int) ( (intptr_t) buffer1 % LIBCPATH_ARENA_ALIGNMENT ),
+	 0 );
+
+	buffer2 = (uint8_t *) libcpath_arena_allocate(
+	                       (intptr_t *) arena,
+	                       10 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer2",
+	 buffer2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "buffer2 alignment",
+	 (int) ( (intptr_t) buffer2 % LIBCPATH_ARENA_ALIGNMENT ),
+	 0 );
+
+	/* Test that an allocation larger than the chunk size is supported
+	 */
+	buffer3 = (uint8_t *) libcpath_arena_allocate(
+	                       (intptr_t *) arena,
+	                       1024 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer3",
+	 buffer3 );
+
+	/* Test that a reset arena reuses its chunks
+	 */
+	result = libcpath_arena_reset(
+	          arena,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	buffer3 = (uint8_t *) libcpath_arena_allocate(
+	                       (intptr_t *) arena,
+	                       10 );
+
+	CPATH_TEST_ASSERT_EQUAL_INTPTR(
+	 "buffer3",
+	 (intptr_t) buffer3,
+	 (intptr_t) buffer1 );
+
+	/* Test error cases
+	 */
+	buffer1 = (uint8_t *) libcpath_arena_allocate(
+	                       NULL,
+	                       10 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "buffer1",
+	 buffer1 );
+
+	buffer1 = (uint8_t *) libcpath_arena_allocate(
+	                       (intptr_t *) arena,
+	                       (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE + 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "buffer1",
+	 buffer1 );
+
+	result = libcpath_arena_free(
+	          &arena,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libcpath_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_arena_reallocate function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_arena_reallocate(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libcpath_arena_t *arena  = NULL;
+	uint8_t *buffer1         = NULL;
+	uint8_t *buffer2         = NULL;
+	uint8_t *buffer3         = NULL;
+	int result               = 0;
+
+	result = libcpath_arena_initialize(
+	          &arena,
+	          256,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	buffer1 = (uint8_t *) libcpath_arena_reallocate(
+	                       (intptr_t *) arena,
+	                       NULL,
+	                       10 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer1",
+	 buffer1 );
+
+	buffer1[ 0 ] = 'A';
+
+	/* Test that the most recent allocation is grown in place
+	 */
+	buffer2 = (uint8_t *) libcpath_arena_reallocate(
+	                       (intptr_t *) arena,
+	                       buffer1,
+	                       100 );
+
+	CPATH_TEST_ASSERT_EQUAL_INTPTR(
+	 "buffer2",
+	 (intptr_t) buffer2,
+	 (intptr_t) buffer1 );
+
+	/* Test that an allocation that does not fit is copied
+	 */
+	buffer2 = (uint8_t *) libcpath_arena_reallocate(
+	                       (intptr_t *) arena,
+	                       buffer1,
+	                       1024 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer2",
+	 buffer2 );
+
+	CPATH_TEST_ASSERT_NOT_EQUAL_INTPTR(
+	 "buffer2",
+	 (intptr_t) buffer2,
+	 (intptr_t) buffer1 );
+
+	CPATH_TEST_ASSERT_EQUAL_UINT8(
+	 "buffer2[ 0 ]",
+	 buffer2[ 0 ],
+	 (uint8_t) 'A' );
+
+	/* Test that an older allocation is not moved when it is shrunk
+	 */
+	buffer3 = (uint8_t *) libcpath_arena_reallocate(
+	                       (intptr_t *) arena,
+	                       buffer1,
+	                       50 );
+
+	CPATH_TEST_ASSERT_EQUAL_INTPTR(
+	 "buffer3",
+	 (intptr_t) buffer3,
+	 (intptr_t) buffer1 );
+
+	/* Test error cases
+	 */
+	buffer1 = (uint8_t *) libcpath_arena_reallocate(
+	                       NULL,
+	                       buffer2,
+	                       10 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "buffer1",
+	 buffer1 );
+
+	buffer1 = (uint8_t *) libcpath_arena_reallocate(
+	                       (intptr_t *) arena,
+	                       buffer2,
+	                       (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE + 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "buffer1",
+	 buffer1 );
+
+	result = libcpath_arena_free(
+	          &arena,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libcpath_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_arena_release function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_arena_release(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libcpath_arena_t *arena  = NULL;
+	uint8_t *buffer1         = NULL;
+	uint8_t *buffer2         = NULL;
+	uint8_t *buffer3         = NULL;
+	int result               = 0;
+
+	result = libcpath_arena_initialize(
+	          &arena,
+	          256,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	buffer1 = (uint8_t *) libcpath_arena_allocate(
+	                       (intptr_t *) arena,
+	                       10 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer1",
+	 buffer1 );
+
+	buffer2 = (uint8_t *) libcpath_arena_allocate(
+	                       (intptr_t *) arena,
+	                       10 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer2",
+	 buffer2 );
+
+	/* Test that the most recent allocation is released
+	 */
+	libcpath_arena_release(
+	 (intptr_t *) arena,
+	 buffer2 );
+
+	buffer3 = (uint8_t *) libcpath_arena_allocate(
+	                       (intptr_t *) arena,
+	                       10 );
+
+	CPATH_TEST_ASSERT_EQUAL_INTPTR(
+	 "buffer3",
+	 (intptr_t) buffer3,
+	 (intptr_t) buffer2 );
+
+	/* Test that an older allocation is retained
+	 */
+	libcpath_arena_release(
+	 (intptr_t *) arena,
+	 buffer1 );
+
+	buffer2 = (uint8_t *) libcpath_arena_allocate(
+	                       (intptr_t *) arena,
+	                       10 );
+
+	CPATH_TEST_ASSERT_NOT_EQUAL_INTPTR(
+	 "buffer2",
+	 (intptr_t) buffer2,
+	 (intptr_t) buffer1 );
+
+	/* Test error cases
+	 */
+	libcpath_arena_release(
+	 NULL,
+	 buffer2 );
+
+	libcpath_arena_release(
+	 (intptr_t *) arena,
+	 NULL );
+
+	result = libcpath_arena_free(
+	          &arena,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libcpath_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CPATH_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CPATH_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CPATH_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CPATH_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	libcpath_arena_t *arena  = NULL;
+	int result               = 0;
+
+	CPATH_TEST_UNREFERENCED_PARAMETER( argc )
+	CPATH_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CPATH_TEST_RUN(
+	 "libcpath_arena_initialize",
+	 cpath_test_arena_initialize );
+
+	CPATH_TEST_RUN(
+	 "libcpath_arena_free",
+	 cpath_test_arena_free );
+
+	/* Initialize arena for tests
+	 */
+	result = libcpath_arena_initialize(
+	          &arena,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_RUN_WITH_ARGS(
+	 "libcpath_arena_reset",
+	 cpath_test_arena_reset,
+	 arena );
+
+	CPATH_TEST_RUN_WITH_ARGS(
+	 "libcpath_set_memory_arena",
+	 cpath_test_set_memory_arena,
+	 arena );
+
+	/* Clean up
+	 */
+	result = libcpath_arena_free(
+	          &arena,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_RUN(
+	 "libcpath_set_memory_arena_with_cache",
+	 cpath_test_set_memory_arena_with_cache );
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
+
+	CPATH_TEST_RUN(
+	 "libcpath_arena_allocate",
+	 cpath_test_arena_allocate );
+
+	CPATH_TEST_RUN(
+	 "libcpath_arena_reallocate",
+	 cpath_test_arena_reallocate );
+
+	CPATH_TEST_RUN(
+	 "libcpath_arena_release",
+	 cpath_test_arena_release );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libcpath_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
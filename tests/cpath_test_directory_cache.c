@@ -0,0 +1,1782 @@
+/*
+ * Library directory cache type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cpath_test_functions.h"
+#include "cpath_test_libcerror.h"
+#include "cpath_test_libcpath.h"
+#include "cpath_test_macros.h"
+#include "cpath_test_memory.h"
+#include "cpath_test_unused.h"
+
+#include "../libcpath/libcpath_directory_cache.h"
+
+/* Tests the libcpath_directory_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_directory_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libcpath_directory_cache_t *directory_cache = NULL;
+	int result                                  = 0;
+
+#if defined( HAVE_CPATH_TEST_MEMORY )
+	int number_of_malloc_fail_tests             = 1;
+	int number_of_memset_fail_tests             = 1;
+	int test_number                             = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcpath_directory_cache_initialize(
+	          &directory_cache,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_cache",
+	 directory_cache );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_cache_free(
+	          &directory_cache,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "directory_cache",
+	 directory_cache );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_directory_cache_initialize(
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	directory_cache = (libcpath_directory_cache_t *) 0x12345678UL;
+
+	result = libcpath_directory_cache_initialize(
+	          &directory_cache,
+	          &error );
+
+	directory_cache = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CPATH_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcpath_directory_cache_initialize with malloc failing
+		 */
+		cpath_test_malloc_attempts_before_fail = test_number;
+
+		result = libcpath_directory_cache_initialize(
+		          &directory_cache,
+		          &error );
+
+		if( cpath_test_malloc_attempts_before_fail != -1 )
+		{
+			cpath_test_malloc_attempts_before_fail = -1;
+
+			if( directory_cache != NULL )
+			{
+				libcpath_directory_cache_free(
+				 &directory_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			CPATH_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CPATH_TEST_ASSERT_IS_NULL(
+			 "directory_cache",
+			 directory_cache );
+
+			CPATH_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcpath_directory_cache_initialize with memset failing
+		 */
+		cpath_test_memset_attempts_before_fail = test_number;
+
+		result = libcpath_directory_cache_initialize(
+		          &directory_cache,
+		          &error );
+
+		if( cpath_test_memset_attempts_before_fail != -1 )
+		{
+			cpath_test_memset_attempts_before_fail = -1;
+
+			if( directory_cache != NULL )
+			{
+				libcpath_directory_cache_free(
+				 &directory_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			CPATH_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CPATH_TEST_ASSERT_IS_NULL(
+			 "directory_cache",
+			 directory_cache );
+
+			CPATH_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_cache != NULL )
+	{
+		libcpath_directory_cache_free(
+		 &directory_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_directory_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_directory_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcpath_directory_cache_free(
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
+
+/* Tests the libcpath_directory_cache_calculate_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_directory_cache_calculate_hash(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t hash            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_directory_cache_calculate_hash(
+	          (uint8_t *) "a",
+	          0,
+	          &hash,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 (uint32_t) 0x811c9dc5UL );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_cache_calculate_hash(
+	          (uint8_t *) "a",
+	          1,
+	          &hash,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_UINT32(
+	 "hash",
+	 hash,
+	 (uint32_t) 0xe40c292cUL );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_directory_cache_calculate_hash(
+	          NULL,
+	          1,
+	          &hash,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_directory_cache_calculate_hash(
+	          (uint8_t *) "a",
+	          (size_t) SSIZE_MAX + 1,
+	          &hash,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_directory_cache_calculate_hash(
+	          (uint8_t *) "a",
+	          1,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_internal_directory_cache_insert_directory and
+ * libcpath_internal_directory_cache_has_directory functions
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_internal_directory_cache_insert_directory(
+     libcpath_directory_cache_t *directory_cache )
+{
+	char name[ 16 ];
+
+	libcerror_error_t *error  = NULL;
+	int directory_index       = 0;
+	int number_of_directories = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_directory_cache_clear(
+	          directory_cache,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_internal_directory_cache_has_directory(
+	          (libcpath_internal_directory_cache_t *) directory_cache,
+	          (uint8_t *) "directory",
+	          9,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_internal_directory_cache_insert_directory(
+	          (libcpath_internal_directory_cache_t *) directory_cache,
+	          (uint8_t *) "directory",
+	          9,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_internal_directory_cache_insert_directory(
+	          (libcpath_internal_directory_cache_t *) directory_cache,
+	          (uint8_t *) "directory",
+	          9,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_internal_directory_cache_has_directory(
+	          (libcpath_internal_directory_cache_t *) directory_cache,
+	          (uint8_t *) "directory",
+	          9,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_internal_directory_cache_has_directory(
+	          (libcpath_internal_directory_cache_t *) directory_cache,
+	          (uint8_t *) "directory",
+	          8,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test inserting enough directories to resize the entries
+	 */
+	for( directory_index = 0;
+	     directory_index < 256;
+	     directory_index++ )
+	{
+		name[ 0 ] = 'd';
+		name[ 1 ] = (char) ( 'a' + ( directory_index / 16 ) );
+		name[ 2 ] = (char) ( 'a' + ( directory_index % 16 ) );
+
+		result = libcpath_internal_directory_cache_insert_directory(
+		          (libcpath_internal_directory_cache_t *) directory_cache,
+		          (uint8_t *) name,
+		          3,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( directory_index = 0;
+	     directory_index < 256;
+	     directory_index++ )
+	{
+		name[ 0 ] = 'd';
+		name[ 1 ] = (char) ( 'a' + ( directory_index / 16 ) );
+		name[ 2 ] = (char) ( 'a' + ( directory_index % 16 ) );
+
+		result = libcpath_internal_directory_cache_has_directory(
+		          (libcpath_internal_directory_cache_t *) directory_cache,
+		          (uint8_t *) name,
+		          3,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libcpath_directory_cache_get_number_of_directories(
+	          directory_cache,
+	          &number_of_directories,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "number_of_directories",
+	 number_of_directories,
+	 257 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_cache_clear(
+	          directory_cache,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_internal_directory_cache_has_directory(
+	          (libcpath_internal_directory_cache_t *) directory_cache,
+	          (uint8_t *) "directory",
+	          9,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_internal_directory_cache_insert_directory(
+	          NULL,
+	          (uint8_t *) "directory",
+	          9,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_internal_directory_cache_insert_directory(
+	          (libcpath_internal_directory_cache_t *) directory_cache,
+	          NULL,
+	          9,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_internal_directory_cache_insert_directory(
+	          (libcpath_internal_directory_cache_t *) directory_cache,
+	          (uint8_t *) "directory",
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_internal_directory_cache_has_directory(
+	          NULL,
+	          (uint8_t *) "directory",
+	          9,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
+
+/* Tests the libcpath_directory_cache_get_number_of_directories function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_directory_cache_get_number_of_directories(
+     libcpath_directory_cache_t *directory_cache )
+{
+	libcerror_error_t *error  = NULL;
+	int number_of_directories = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_directory_cache_get_number_of_directories(
+	          directory_cache,
+	          &number_of_directories,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_directory_cache_get_number_of_directories(
+	          NULL,
+	          &number_of_directories,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_directory_cache_get_number_of_directories(
+	          directory_cache,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_directory_cache_make_directories function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_directory_cache_make_directories(
+     libcpath_directory_cache_t *directory_cache )
+{
+#if defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY )
+	char nested_directory_name[ 6 ] = {
+		'a', (char) LIBCPATH_SEPARATOR, 'b', (char) LIBCPATH_SEPARATOR, 'c', 0 };
+	char file_directory_name[ 7 ] = {
+		'f', 'i', 'l', 'e', (char) LIBCPATH_SEPARATOR, 'd', 0 };
+
+	char directory_name[ 512 ];
+	char filename[ 512 ];
+	char temporary_directory_name[ 256 ];
+
+	size_t directory_name_length          = 0;
+#endif
+	libcerror_error_t *error              = NULL;
+	char *current_working_directory       = NULL;
+	size_t current_working_directory_size = 0;
+	int number_of_directories             = 0;
+	int result                            = 0;
+
+#if defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY )
+	filename[ 0 ]                 = 0;
+	temporary_directory_name[ 0 ] = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcpath_directory_cache_clear(
+	          directory_cache,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_current_working_directory_exact(
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "current_working_directory",
+	 current_working_directory );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an existing directory is added to the cache once
+	 */
+	result = libcpath_directory_cache_make_directories(
+	          directory_cache,
+	          current_working_directory,
+	          current_working_directory_size - 1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_cache_make_directories(
+	          directory_cache,
+	          current_working_directory,
+	          current_working_directory_size - 1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_cache_get_number_of_directories(
+	          directory_cache,
+	          &number_of_directories,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "number_of_directories",
+	 number_of_directories,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 current_working_directory );
+
+	current_working_directory = NULL;
+
+	/* Test that the current directory is not added to the cache
+	 */
+	result = libcpath_directory_cache_make_directories(
+	          directory_cache,
+	          ".",
+	          1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_cache_get_number_of_directories(
+	          directory_cache,
+	          &number_of_directories,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "number_of_directories",
+	 number_of_directories,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY )
+	/* Test that a nested directory tree is made
+	 */
+	result = cpath_test_make_temporary_directory(
+	          temporary_directory_name,
+	          256 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = cpath_test_join_path(
+	          directory_name,
+	          512,
+	          temporary_directory_name,
+	          nested_directory_name );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	directory_name_length = narrow_string_length(
+	                         directory_name );
+
+	result = libcpath_directory_cache_make_directories(
+	          directory_cache,
+	          directory_name,
+	          directory_name_length,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cpath_test_directory_exists(
+	          directory_name );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test that an existing directory tree is not considered an error
+	 */
+	result = libcpath_directory_cache_make_directories(
+	          directory_cache,
+	          directory_name,
+	          directory_name_length,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a directory tree is not made through a regular file
+	 */
+	result = cpath_test_join_path(
+	          filename,
+	          512,
+	          temporary_directory_name,
+	          "file" );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = cpath_test_make_file(
+	          filename );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = cpath_test_join_path(
+	          directory_name,
+	          512,
+	          temporary_directory_name,
+	          file_directory_name );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	directory_name_length = narrow_string_length(
+	                         directory_name );
+
+	result = libcpath_directory_cache_make_directories(
+	          directory_cache,
+	          directory_name,
+	          directory_name_length,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = cpath_test_remove_file(
+	          filename );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	filename[ 0 ] = 0;
+
+	result = cpath_test_remove_directories(
+	          temporary_directory_name,
+	          nested_directory_name );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = cpath_test_directory_exists(
+	          temporary_directory_name );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	temporary_directory_name[ 0 ] = 0;
+
+#endif /* defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY ) */
+
+	result = libcpath_directory_cache_clear(
+	          directory_cache,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_directory_cache_make_directories(
+	          NULL,
+	          ".",
+	          1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_directory_cache_make_directories(
+	          directory_cache,
+	          NULL,
+	          1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_directory_cache_make_directories(
+	          directory_cache,
+	          ".",
+	          0,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_directory_cache_make_directories(
+	          directory_cache,
+	          ".",
+	          (size_t) SSIZE_MAX + 1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( current_working_directory != NULL )
+	{
+		memory_free(
+		 current_working_directory );
+	}
+#if defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY )
+	if( filename[ 0 ] != 0 )
+	{
+		cpath_test_remove_file(
+		 filename );
+	}
+	if( temporary_directory_name[ 0 ] != 0 )
+	{
+		cpath_test_remove_directories(
+		 temporary_directory_name,
+		 nested_directory_name );
+	}
+#endif
+	return( 0 );
+}
+
+#if defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY )
+
+/* Tests the libcpath_directory_cache_make_directories function with a relative
+ * directory name after the current working directory was changed
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_directory_cache_make_directories_with_change_directory(
+     libcpath_directory_cache_t *directory_cache )
+{
+	char nested_directory_name[ 4 ] = {
+		'd', (char) LIBCPATH_SEPARATOR, 'd', 0 };
+
+	char directory_name[ 512 ];
+	char temporary_directory_name[ 256 ];
+
+	libcerror_error_t *error              = NULL;
+	char *current_working_directory       = NULL;
+	size_t current_working_directory_size = 0;
+	int result                            = 0;
+
+	temporary_directory_name[ 0 ] = 0;
+
+	result = libcpath_directory_cache_clear(
+	          directory_cache,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_current_working_directory_exact(
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "current_working_directory",
+	 current_working_directory );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cpath_test_make_temporary_directory(
+	          temporary_directory_name,
+	          256 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Make directory "d" relative to the temporary directory
+	 */
+	result = libcpath_path_change_directory(
+	          temporary_directory_name,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_cache_make_directories(
+	          directory_cache,
+	          "d",
+	          1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Make directory "d" relative to the directory made before, which must not
+	 * be considered the same directory as the cached one
+	 */
+	result = cpath_test_join_path(
+	          directory_name,
+	          512,
+	          temporary_directory_name,
+	          "d" );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcpath_path_change_directory(
+	          directory_name,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_cache_make_directories(
+	          directory_cache,
+	          "d",
+	          1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cpath_test_join_path(
+	          directory_name,
+	          512,
+	          temporary_directory_name,
+	          nested_directory_name );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = cpath_test_directory_exists(
+	          directory_name );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Clean up
+	 */
+	result = libcpath_path_change_directory(
+	          current_working_directory,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 current_working_directory );
+
+	current_working_directory = NULL;
+
+	result = cpath_test_remove_directories(
+	          temporary_directory_name,
+	          nested_directory_name );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	temporary_directory_name[ 0 ] = 0;
+
+	result = libcpath_directory_cache_clear(
+	          directory_cache,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( current_working_directory != NULL )
+	{
+		libcpath_path_change_directory(
+		 current_working_directory,
+		 NULL );
+
+		memory_free(
+		 current_working_directory );
+	}
+	if( temporary_directory_name[ 0 ] != 0 )
+	{
+		cpath_test_remove_directories(
+		 temporary_directory_name,
+		 nested_directory_name );
+	}
+	libcpath_directory_cache_clear(
+	 directory_cache,
+	 NULL );
+
+	return( 0 );
+}
+
+#endif /* defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY ) */
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libcpath_directory_cache_make_directories_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_directory_cache_make_directories_wide(
+     libcpath_directory_cache_t *directory_cache )
+{
+	libcerror_error_t *error              = NULL;
+	wchar_t *current_working_directory    = NULL;
+	size_t current_working_directory_size = 0;
+	int number_of_directories             = 0;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_directory_cache_clear(
+	          directory_cache,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_current_working_directory_wide(
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "current_working_directory",
+	 current_working_directory );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an existing directory is added to the cache once
+	 */
+	result = libcpath_directory_cache_make_directories_wide(
+	          directory_cache,
+	          current_working_directory,
+	          current_working_directory_size - 1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_cache_make_directories_wide(
+	          directory_cache,
+	          current_working_directory,
+	          current_working_directory_size - 1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_cache_get_number_of_directories(
+	          directory_cache,
+	          &number_of_directories,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "number_of_directories",
+	 number_of_directories,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 current_working_directory );
+
+	current_working_directory = NULL;
+
+	/* Test that the current directory is not added to the cache
+	 */
+	result = libcpath_directory_cache_make_directories_wide(
+	          directory_cache,
+	          L".",
+	          1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_cache_get_number_of_directories(
+	          directory_cache,
+	          &number_of_directories,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "number_of_directories",
+	 number_of_directories,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_directory_cache_make_directories_wide(
+	          NULL,
+	          L".",
+	          1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_directory_cache_make_directories_wide(
+	          directory_cache,
+	          NULL,
+	          1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_directory_cache_make_directories_wide(
+	          directory_cache,
+	          L".",
+	          0,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_directory_cache_make_directories_wide(
+	          directory_cache,
+	          L".",
+	          (size_t) SSIZE_MAX + 1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( current_working_directory != NULL )
+	{
+		memory_free(
+		 current_working_directory );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CPATH_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CPATH_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CPATH_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CPATH_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error                    = NULL;
+	libcpath_directory_cache_t *directory_cache = NULL;
+	int result                                  = 0;
+
+	CPATH_TEST_UNREFERENCED_PARAMETER( argc )
+	CPATH_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CPATH_TEST_RUN(
+	 "libcpath_directory_cache_initialize",
+	 cpath_test_directory_cache_initialize );
+
+	CPATH_TEST_RUN(
+	 "libcpath_directory_cache_free",
+	 cpath_test_directory_cache_free );
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
+
+	CPATH_TEST_RUN(
+	 "libcpath_directory_cache_calculate_hash",
+	 cpath_test_directory_cache_calculate_hash );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
+
+	/* Initialize directory cache for tests
+	 */
+	result = libcpath_directory_cache_initialize(
+	          &directory_cache,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_cache",
+	 directory_cache );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_RUN_WITH_ARGS(
+	 "libcpath_directory_cache_get_number_of_directories",
+	 cpath_test_directory_cache_get_number_of_directories,
+	 directory_cache );
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
+
+	CPATH_TEST_RUN_WITH_ARGS(
+	 "libcpath_internal_directory_cache_insert_directory",
+	 cpath_test_internal_directory_cache_insert_directory,
+	 directory_cache );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
+
+	CPATH_TEST_RUN_WITH_ARGS(
+	 "libcpath_directory_cache_make_directories",
+	 cpath_test_directory_cache_make_directories,
+	 directory_cache );
+
+#if defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY )
+
+	CPATH_TEST_RUN_WITH_ARGS(
+	 "libcpath_directory_cache_make_directories_with_change_directory",
+	 cpath_test_directory_cache_make_directories_with_change_directory,
+	 directory_cache );
+
+#endif /* defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY ) */
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+	CPATH_TEST_RUN_WITH_ARGS(
+	 "libcpath_directory_cache_make_directories_wide",
+	 cpath_test_directory_cache_make_directories_wide,
+	 directory_cache );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+	/* Clean up
+	 */
+	result = libcpath_directory_cache_free(
+	          &directory_cache,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "directory_cache",
+	 directory_cache );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_cache != NULL )
+	{
+		libcpath_directory_cache_free(
+		 &directory_cache,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1735 @@
+/*
+ * Library directory handle type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cpath_test_functions.h"
+#include "cpath_test_libcerror.h"
+#include "cpath_test_libcpath.h"
+#include "cpath_test_macros.h"
+#include "cpath_test_memory.h"
+#include "cpath_test_unused.h"
+
+#include "../libcpath/libcpath_directory_handle.h"
+
+/* Tests the libcpath_directory_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_directory_handle_initialize(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libcpath_directory_handle_t *directory_handle = NULL;
+	int result                                    = 0;
+
+#if defined( HAVE_CPATH_TEST_MEMORY )
+	int number_of_malloc_fail_tests               = 1;
+	int number_of_memset_fail_tests               = 1;
+	int test_number                               = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcpath_directory_handle_initialize(
+	          &directory_handle,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_handle",
+	 directory_handle );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_handle_free(
+	          &directory_handle,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "directory_handle",
+	 directory_handle );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_directory_handle_initialize(
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	directory_handle = (libcpath_directory_handle_t *) 0x12345678UL;
+
+	result = libcpath_directory_handle_initialize(
+	          &directory_handle,
+	          &error );
+
+	directory_handle = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CPATH_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcpath_directory_handle_initialize with malloc failing
+		 */
+		cpath_test_malloc_attempts_before_fail = test_number;
+
+		result = libcpath_directory_handle_initialize(
+		          &directory_handle,
+		          &error );
+
+		if( cpath_test_malloc_attempts_before_fail != -1 )
+		{
+			cpath_test_malloc_attempts_before_fail = -1;
+
+			if( directory_handle != NULL )
+			{
+				libcpath_directory_handle_free(
+				 &directory_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			CPATH_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CPATH_TEST_ASSERT_IS_NULL(
+			 "directory_handle",
+			 directory_handle );
+
+			CPATH_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcpath_directory_handle_initialize with memset failing
+		 */
+		cpath_test_memset_attempts_before_fail = test_number;
+
+		result = libcpath_directory_handle_initialize(
+		          &directory_handle,
+		          &error );
+
+		if( cpath_test_memset_attempts_before_fail != -1 )
+		{
+			cpath_test_memset_attempts_before_fail = -1;
+
+			if( directory_handle != NULL )
+			{
+				libcpath_directory_handle_free(
+				 &directory_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			CPATH_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CPATH_TEST_ASSERT_IS_NULL(
+			 "directory_handle",
+			 directory_handle );
+
+			CPATH_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_handle != NULL )
+	{
+		libcpath_directory_handle_free(
+		 &directory_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_directory_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_directory_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcpath_directory_handle_free(
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_directory_handle_open function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_directory_handle_open(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libcpath_directory_handle_t *directory_handle = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_directory_handle_initialize(
+	          &directory_handle,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_handle",
+	 directory_handle );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcpath_directory_handle_open(
+	          directory_handle,
+	          ".",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_directory_handle_open(
+	          directory_handle,
+	          ".",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_directory_handle_close(
+	          directory_handle,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_handle_open(
+	          NULL,
+	          ".",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_directory_handle_open(
+	          directory_handle,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_directory_handle_close(
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcpath_directory_handle_free(
+	          &directory_handle,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "directory_handle",
+	 directory_handle );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_handle != NULL )
+	{
+		libcpath_directory_handle_free(
+		 &directory_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_directory_handle_open_at function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_directory_handle_open_at(
+     libcpath_directory_handle_t *parent_directory_handle )
+{
+	libcerror_error_t *error                      = NULL;
+	libcpath_directory_handle_t *directory_handle = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_directory_handle_initialize(
+	          &directory_handle,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_handle",
+	 directory_handle );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_directory_handle_open_at(
+	          parent_directory_handle,
+	          directory_handle,
+	          ".",
+	          1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = libcpath_directory_handle_open_at(
+	          directory_handle,
+	          parent_directory_handle,
+	          ".",
+	          1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_handle_close(
+	          directory_handle,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_directory_handle_open_at(
+	          NULL,
+	          parent_directory_handle,
+	          ".",
+	          1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_directory_handle_open_at(
+	          directory_handle,
+	          NULL,
+	          ".",
+	          1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_directory_handle_open_at(
+	          directory_handle,
+	          parent_directory_handle,
+	          NULL,
+	          1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_directory_handle_open_at(
+	          directory_handle,
+	          parent_directory_handle,
+	          ".",
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcpath_directory_handle_free(
+	          &directory_handle,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "directory_handle",
+	 directory_handle );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_handle != NULL )
+	{
+		libcpath_directory_handle_free(
+		 &directory_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_directory_handle_change_directory function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_directory_handle_change_directory(
+     libcpath_directory_handle_t *directory_handle )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_directory_handle_change_directory(
+	          directory_handle,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_directory_handle_change_directory(
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_directory_handle_change_directory function with the current working directory cache enabled
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_directory_handle_change_directory_with_cache(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libcpath_directory_handle_t *directory_handle = NULL;
+	char *current_working_directory               = NULL;
+	char *full_path                               = NULL;
+	char *parent_directory                        = NULL;
+	size_t current_working_directory_size         = 0;
+	size_t full_path_size                         = 0;
+	size_t parent_directory_size                  = 0;
+	int result                                    = 0;
+
+	result = libcpath_path_get_current_working_directory(
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "current_working_directory",
+	 current_working_directory );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_enable_current_working_directory_cache(
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Fill the cache with the current working directory
+	 */
+	result = libcpath_path_get_full_path(
+	          "x",
+	          1,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 full_path );
+
+	full_path = NULL;
+
+	result = libcpath_directory_handle_initialize(
+	          &directory_handle,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_handle_open(
+	          directory_handle,
+	          "..",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_handle_change_directory(
+	          directory_handle,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_current_working_directory_exact(
+	          &parent_directory,
+	          &parent_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The full path should be relative to the new current working directory
+	 */
+	result = libcpath_path_get_full_path(
+	          "x",
+	          1,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_path_size",
+	 full_path_size,
+	 parent_directory_size + 2 );
+
+	result = narrow_string_compare(
+	          full_path,
+	          parent_directory,
+	          parent_directory_size - 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	memory_free(
+	 full_path );
+
+	full_path = NULL;
+
+	memory_free(
+	 parent_directory );
+
+	parent_directory = NULL;
+
+	result = libcpath_directory_handle_free(
+	          &directory_handle,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_change_directory(
+	          current_working_directory,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 current_working_directory );
+
+	current_working_directory = NULL;
+
+	result = libcpath_path_disable_current_working_directory_cache(
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( full_path != NULL )
+	{
+		memory_free(
+		 full_path );
+	}
+	if( parent_directory != NULL )
+	{
+		memory_free(
+		 parent_directory );
+	}
+	if( directory_handle != NULL )
+	{
+		libcpath_directory_handle_free(
+		 &directory_handle,
+		 NULL );
+	}
+	if( current_working_directory != NULL )
+	{
+		libcpath_path_change_directory(
+		 current_working_directory,
+		 NULL );
+
+		memory_free(
+		 current_working_directory );
+	}
+	libcpath_path_disable_current_working_directory_cache(
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libcpath_directory_handle_make_directory_at function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_directory_handle_make_directory_at(
+     libcpath_directory_handle_t *directory_handle )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_directory_handle_make_directory_at(
+	          directory_handle,
+	          ".",
+	          1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_directory_handle_make_directory_at(
+	          NULL,
+	          ".",
+	          1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_directory_handle_make_directory_at(
+	          directory_handle,
+	          NULL,
+	          1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_directory_handle_make_directory_at(
+	          directory_handle,
+	          ".",
+	          0,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_directory_handle_make_directories_at function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_directory_handle_make_directories_at(
+     libcpath_directory_handle_t *directory_handle )
+{
+	char absolute_directory_name[ 3 ] = { (char) LIBCPATH_SEPARATOR, 'x', 0 };
+
+#if defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY )
+	char nested_directory_name[ 6 ] = {
+		'a', (char) LIBCPATH_SEPARATOR, 'b', (char) LIBCPATH_SEPARATOR, 'c', 0 };
+	char file_directory_name[ 7 ] = {
+		'f', 'i', 'l', 'e', (char) LIBCPATH_SEPARATOR, 'd', 0 };
+
+	char directory_name[ 512 ];
+	char filename[ 512 ];
+	char temporary_directory_name[ 256 ];
+
+	libcpath_directory_handle_t *temporary_directory_handle = NULL;
+	size_t relative_directory_name_length                   = 0;
+#endif
+	libcerror_error_t *error                                = NULL;
+	int result                                              = 0;
+
+#if defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY )
+	filename[ 0 ]                 = 0;
+	temporary_directory_name[ 0 ] = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcpath_directory_handle_make_directories_at(
+	          directory_handle,
+	          ".",
+	          1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY )
+	/* Test that a nested directory tree is made
+	 */
+	result = cpath_test_make_temporary_directory(
+	          temporary_directory_name,
+	          256 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcpath_directory_handle_initialize(
+	          &temporary_directory_handle,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_handle_open(
+	          temporary_directory_handle,
+	          temporary_directory_name,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cpath_test_join_path(
+	          directory_name,
+	          512,
+	          temporary_directory_name,
+	          nested_directory_name );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	relative_directory_name_length = narrow_string_length(
+	                                  nested_directory_name );
+
+	result = libcpath_directory_handle_make_directories_at(
+	          temporary_directory_handle,
+	          nested_directory_name,
+	          relative_directory_name_length,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cpath_test_directory_exists(
+	          directory_name );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test that an existing directory tree is not considered an error
+	 */
+	result = libcpath_directory_handle_make_directories_at(
+	          temporary_directory_handle,
+	          nested_directory_name,
+	          relative_directory_name_length,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a directory tree is not made through a regular file
+	 */
+	result = cpath_test_join_path(
+	          filename,
+	          512,
+	          temporary_directory_name,
+	          "file" );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = cpath_test_make_file(
+	          filename );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	relative_directory_name_length = narrow_string_length(
+	                                  file_directory_name );
+
+	result = libcpath_directory_handle_make_directories_at(
+	          temporary_directory_handle,
+	          file_directory_name,
+	          relative_directory_name_length,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcpath_directory_handle_free(
+	          &temporary_directory_handle,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cpath_test_remove_file(
+	          filename );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	filename[ 0 ] = 0;
+
+	result = cpath_test_remove_directories(
+	          temporary_directory_name,
+	          nested_directory_name );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = cpath_test_directory_exists(
+	          temporary_directory_name );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	temporary_directory_name[ 0 ] = 0;
+
+#endif /* defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY ) */
+
+	/* Test error cases
+	 */
+	result = libcpath_directory_handle_make_directories_at(
+	          NULL,
+	          ".",
+	          1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_directory_handle_make_directories_at(
+	          directory_handle,
+	          NULL,
+	          1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_directory_handle_make_directories_at(
+	          directory_handle,
+	          absolute_directory_name,
+	          2,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY )
+	if( temporary_directory_handle != NULL )
+	{
+		libcpath_directory_handle_free(
+		 &temporary_directory_handle,
+		 NULL );
+	}
+	if( filename[ 0 ] != 0 )
+	{
+		cpath_test_remove_file(
+		 filename );
+	}
+	if( temporary_directory_name[ 0 ] != 0 )
+	{
+		cpath_test_remove_directories(
+		 temporary_directory_name,
+		 nested_directory_name );
+	}
+#endif
+	return( 0 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libcpath_directory_handle_open_wide and libcpath_directory_handle_open_at_wide functions
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_directory_handle_open_wide(
+     void )
+{
+	libcerror_error_t *error                             = NULL;
+	libcpath_directory_handle_t *directory_handle        = NULL;
+	libcpath_directory_handle_t *parent_directory_handle = NULL;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_directory_handle_initialize(
+	          &parent_directory_handle,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_handle_initialize(
+	          &directory_handle,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcpath_directory_handle_open_wide(
+	          parent_directory_handle,
+	          L".",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_handle_open_at_wide(
+	          directory_handle,
+	          parent_directory_handle,
+	          L".",
+	          1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_handle_make_directory_at_wide(
+	          directory_handle,
+	          L".",
+	          1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_handle_make_directories_at_wide(
+	          directory_handle,
+	          L".",
+	          1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_directory_handle_open_wide(
+	          parent_directory_handle,
+	          L".",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_directory_handle_open_wide(
+	          NULL,
+	          L".",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_directory_handle_open_at_wide(
+	          directory_handle,
+	          parent_directory_handle,
+	          NULL,
+	          1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_directory_handle_make_directory_at_wide(
+	          directory_handle,
+	          NULL,
+	          1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_directory_handle_make_directories_at_wide(
+	          directory_handle,
+	          L".",
+	          0,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcpath_directory_handle_free(
+	          &directory_handle,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_handle_free(
+	          &parent_directory_handle,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_handle != NULL )
+	{
+		libcpath_directory_handle_free(
+		 &directory_handle,
+		 NULL );
+	}
+	if( parent_directory_handle != NULL )
+	{
+		libcpath_directory_handle_free(
+		 &parent_directory_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CPATH_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CPATH_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CPATH_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CPATH_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error                      = NULL;
+	libcpath_directory_handle_t *directory_handle = NULL;
+	int result                                    = 0;
+
+	CPATH_TEST_UNREFERENCED_PARAMETER( argc )
+	CPATH_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CPATH_TEST_RUN(
+	 "libcpath_directory_handle_initialize",
+	 cpath_test_directory_handle_initialize );
+
+	CPATH_TEST_RUN(
+	 "libcpath_directory_handle_free",
+	 cpath_test_directory_handle_free );
+
+	CPATH_TEST_RUN(
+	 "libcpath_directory_handle_open",
+	 cpath_test_directory_handle_open );
+
+	/* Initialize directory handle for tests
+	 */
+	result = libcpath_directory_handle_initialize(
+	          &directory_handle,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "directory_handle",
+	 directory_handle );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_directory_handle_open(
+	          directory_handle,
+	          ".",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_RUN_WITH_ARGS(
+	 "libcpath_directory_handle_open_at",
+	 cpath_test_directory_handle_open_at,
+	 directory_handle );
+
+	CPATH_TEST_RUN_WITH_ARGS(
+	 "libcpath_directory_handle_change_directory",
+	 cpath_test_directory_handle_change_directory,
+	 directory_handle );
+
+	CPATH_TEST_RUN_WITH_ARGS(
+	 "libcpath_directory_handle_make_directory_at",
+	 cpath_test_directory_handle_make_directory_at,
+	 directory_handle );
+
+	CPATH_TEST_RUN_WITH_ARGS(
+	 "libcpath_directory_handle_make_directories_at",
+	 cpath_test_directory_handle_make_directories_at,
+	 directory_handle );
+
+	CPATH_TEST_RUN(
+	 "libcpath_directory_handle_change_directory_with_cache",
+	 cpath_test_directory_handle_change_directory_with_cache );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+	CPATH_TEST_RUN(
+	 "libcpath_directory_handle_open_wide",
+	 cpath_test_directory_handle_open_wide );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+	/* Clean up
+	 */
+	result = libcpath_directory_handle_free(
+	          &directory_handle,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "directory_handle",
+	 directory_handle );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory_handle != NULL )
+	{
+		libcpath_directory_handle_free(
+		 &directory_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
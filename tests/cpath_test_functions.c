@@ -0,0 +1,346 @@
+/*
+ * Functions for testing
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_LIMITS_H ) || defined( WINAPI )
+#include <limits.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "cpath_test_functions.h"
+#include "cpath_test_libcpath.h"
+
+#if defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY )
+
+/* Makes a uniquely named temporary directory
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_test_make_temporary_directory(
+     char *directory_name,
+     size_t directory_name_size )
+{
+#if defined( WINAPI )
+	char temporary_path[ MAX_PATH + 1 ];
+
+	DWORD temporary_path_length = 0;
+#else
+	const char *temporary_path  = NULL;
+#endif
+	int print_count             = 0;
+
+	if( directory_name == NULL )
+	{
+		return( -1 );
+	}
+	if( ( directory_name_size == 0 )
+	 || ( directory_name_size > (size_t) INT_MAX ) )
+	{
+		return( -1 );
+	}
+#if defined( WINAPI )
+	temporary_path_length = GetTempPathA(
+	                         MAX_PATH + 1,
+	                         temporary_path );
+
+	if( ( temporary_path_length == 0 )
+	 || ( temporary_path_length > MAX_PATH ) )
+	{
+		return( -1 );
+	}
+	/* GetTempPathA returns a path with a trailing directory separator
+	 */
+	print_count = narrow_string_snprintf(
+	               directory_name,
+	               directory_name_size,
+	               "%scpath_test_XXXXXX",
+	               temporary_path );
+
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= directory_name_size ) )
+	{
+		return( -1 );
+	}
+	if( _mktemp_s(
+	     directory_name,
+	     (size_t) print_count + 1 ) != 0 )
+	{
+		return( -1 );
+	}
+	if( CreateDirectoryA(
+	     directory_name,
+	     NULL ) == 0 )
+	{
+		return( -1 );
+	}
+#else
+	temporary_path = getenv(
+	                  "TMPDIR" );
+
+	if( ( temporary_path == NULL )
+	 || ( temporary_path[ 0 ] == 0 ) )
+	{
+		temporary_path = "/tmp";
+	}
+	print_count = narrow_string_snprintf(
+	               directory_name,
+	               directory_name_size,
+	               "%s/cpath_test_XXXXXX",
+	               temporary_path );
+
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= directory_name_size ) )
+	{
+		return( -1 );
+	}
+	if( mkdtemp(
+	     directory_name ) == NULL )
+	{
+		return( -1 );
+	}
+#endif /* defined( WINAPI ) */
+
+	return( 1 );
+}
+
+/* Determines if a directory exists
+ * Returns 1 if the directory exists, 0 if not or -1 on error
+ */
+int cpath_test_directory_exists(
+     const char *directory_name )
+{
+#if defined( WINAPI )
+	DWORD file_attributes = 0;
+#else
+	struct stat file_statistics;
+#endif
+
+	if( directory_name == NULL )
+	{
+		return( -1 );
+	}
+#if defined( WINAPI )
+	file_attributes = GetFileAttributesA(
+	                   directory_name );
+
+	if( file_attributes == INVALID_FILE_ATTRIBUTES )
+	{
+		return( 0 );
+	}
+	if( ( file_attributes & FILE_ATTRIBUTE_DIRECTORY ) == 0 )
+	{
+		return( 0 );
+	}
+#else
+	if( stat(
+	     directory_name,
+	     &file_statistics ) != 0 )
+	{
+		return( 0 );
+	}
+	if( S_ISDIR( file_statistics.st_mode ) == 0 )
+	{
+		return( 0 );
+	}
+#endif /* defined( WINAPI ) */
+
+	return( 1 );
+}
+
+/* Makes an empty regular file
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_test_make_file(
+     const char *filename )
+{
+	FILE *file_stream = NULL;
+
+	if( filename == NULL )
+	{
+		return( -1 );
+	}
+	file_stream = file_stream_open(
+	               filename,
+	               "w" );
+
+	if( file_stream == NULL )
+	{
+		return( -1 );
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Removes a regular file
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_test_remove_file(
+     const char *filename )
+{
+	if( filename == NULL )
+	{
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( DeleteFileA(
+	     filename ) == 0 )
+	{
+		return( -1 );
+	}
+#else
+	if( unlink(
+	     filename ) != 0 )
+	{
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Combines a directory name and a relative path
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_test_join_path(
+     char *path,
+     size_t path_size,
+     const char *directory_name,
+     const char *relative_path )
+{
+	int print_count = 0;
+
+	if( ( path == NULL )
+	 || ( directory_name == NULL )
+	 || ( relative_path == NULL ) )
+	{
+		return( -1 );
+	}
+	if( ( path_size == 0 )
+	 || ( path_size > (size_t) INT_MAX ) )
+	{
+		return( -1 );
+	}
+	print_count = narrow_string_snprintf(
+	               path,
+	               path_size,
+	               "%s%c%s",
+	               directory_name,
+	               (char) LIBCPATH_SEPARATOR,
+	               relative_path );
+
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= path_size ) )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Removes the empty directories of a relative directory name, starting with
+ * the last segment, and then the base directory they were made in
+ * Directories that do not exist are skipped
+ * Returns 1 if successful or -1 on error
+ */
+int cpath_test_remove_directories(
+     const char *base_directory_name,
+     const char *relative_directory_name )
+{
+	char directory_name[ 512 ];
+
+	size_t base_directory_name_length = 0;
+	size_t directory_name_index       = 0;
+	int result                        = 1;
+
+	if( ( base_directory_name == NULL )
+	 || ( relative_directory_name == NULL ) )
+	{
+		return( -1 );
+	}
+	base_directory_name_length = narrow_string_length(
+	                              base_directory_name );
+
+	if( cpath_test_join_path(
+	     directory_name,
+	     512,
+	     base_directory_name,
+	     relative_directory_name ) != 1 )
+	{
+		return( -1 );
+	}
+	directory_name_index = narrow_string_length(
+	                        directory_name );
+
+	for( ;; )
+	{
+		if( cpath_test_directory_exists(
+		     directory_name ) == 1 )
+		{
+#if defined( WINAPI )
+			if( RemoveDirectoryA(
+			     directory_name ) == 0 )
+#else
+			if( rmdir(
+			     directory_name ) != 0 )
+#endif
+			{
+				result = -1;
+			}
+		}
+		if( directory_name_index <= base_directory_name_length )
+		{
+			break;
+		}
+		/* Strip the last segment and its directory separators
+		 */
+		while( ( directory_name_index > base_directory_name_length )
+		    && ( directory_name[ directory_name_index - 1 ] != (char) LIBCPATH_SEPARATOR ) )
+		{
+			directory_name_index--;
+		}
+		while( ( directory_name_index > base_directory_name_length )
+		    && ( directory_name[ directory_name_index - 1 ] == (char) LIBCPATH_SEPARATOR ) )
+		{
+			directory_name_index--;
+		}
+		directory_name[ directory_name_index ] = 0;
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY ) */
+
@@ -0,0 +1,70 @@
+/*
+ * Functions for testing
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CPATH_TEST_FUNCTIONS_H )
+#define _CPATH_TEST_FUNCTIONS_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The file system tests require a temporary directory that can be removed again
+ */
+#if defined( WINAPI ) || ( defined( HAVE_MKDTEMP ) && defined( HAVE_RMDIR ) && defined( HAVE_UNLINK ) )
+#define HAVE_CPATH_TEST_TEMPORARY_DIRECTORY	1
+#endif
+
+#if defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY )
+
+int cpath_test_make_temporary_directory(
+     char *directory_name,
+     size_t directory_name_size );
+
+int cpath_test_directory_exists(
+     const char *directory_name );
+
+int cpath_test_make_file(
+     const char *filename );
+
+int cpath_test_remove_file(
+     const char *filename );
+
+int cpath_test_join_path(
+     char *path,
+     size_t path_size,
+     const char *directory_name,
+     const char *relative_path );
+
+int cpath_test_remove_directories(
+     const char *base_directory_name,
+     const char *relative_directory_name );
+
+#endif /* defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CPATH_TEST_FUNCTIONS_H ) */
+
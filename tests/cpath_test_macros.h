@@ -183,6 +183,13 @@
 		goto on_error; \
 	}
 
+#define CPATH_TEST_ASSERT_NOT_EQUAL_UINT32( name, value, expected_value ) \
+	if( value == expected_value ) \
+	{ \
+		fprintf( stdout, "%s:%d %s (%" PRIu32 ") == %" PRIu32 "\n", __FILE__, __LINE__, name, value, expected_value ); \
+		goto on_error; \
+	}
+
 #define CPATH_TEST_ASSERT_LESS_THAN_UINT32( name, value, expected_value ) \
 	if( value >= expected_value ) \
 	{ \
@@ -211,6 +218,13 @@
 		goto on_error; \
 	}
 
+#define CPATH_TEST_ASSERT_NOT_EQUAL_UINT64( name, value, expected_value ) \
+	if( value == expected_value ) \
+	{ \
+		fprintf( stdout, "%s:%d %s (%" PRIu64 ") == %" PRIu64 "\n", __FILE__, __LINE__, name, value, expected_value ); \
+		goto on_error; \
+	}
+
 #define CPATH_TEST_ASSERT_LESS_THAN_UINT64( name, value, expected_value ) \
 	if( value >= expected_value ) \
 	{ \
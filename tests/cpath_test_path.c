@@ -46,6 +46,7 @@
 #define HAVE_CPATH_TEST_FUNCTION_HOOK	1
 #endif
 
+#include "cpath_test_functions.h"
 #include "cpath_test_libcerror.h"
 #include "cpath_test_libcpath.h"
 #include "cpath_test_macros.h"
@@ -322,6 +323,105 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libcpath_path_change_directory_with_error_code function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_change_directory_with_error_code(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t error_code      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_change_directory_with_error_code(
+	          ".",
+	          &error_code,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_UINT32(
+	 "error_code",
+	 error_code,
+	 (uint32_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a directory that does not exist is reported without an error
+	 */
+	result = libcpath_path_change_directory_with_error_code(
+	          "cpath_test_missing_directory",
+	          &error_code,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_NOT_EQUAL_UINT32(
+	 "error_code",
+	 error_code,
+	 (uint32_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_change_directory_with_error_code(
+	          NULL,
+	          &error_code,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_change_directory_with_error_code(
+	          ".",
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
 
 /* Tests the libcpath_GetCurrentDirectoryA function
@@ -591,24 +691,22 @@ on_error:
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI )
-
-/* Tests the libcpath_path_get_path_type function
+/* Tests the libcpath_path_get_current_working_directory_exact function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_path_get_path_type(
+int cpath_test_path_get_current_working_directory_exact(
      void )
 {
-	libcerror_error_t *error = NULL;
-	uint8_t path_type        = 0;
-	int result               = 0;
+	libcerror_error_t *error              = NULL;
+	char *current_working_directory       = NULL;
+	size_t current_working_directory_size = 0;
+	int result                            = 0;
 
 	/* Test regular cases
 	 */
-	result = libcpath_path_get_path_type(
-	          ".",
-	          1,
-	          &path_type,
+	result = libcpath_path_get_current_working_directory_exact(
+	          &current_working_directory,
+	          &current_working_directory_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -616,159 +714,197 @@ int cpath_test_path_get_path_type(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_RELATIVE );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "current_working_directory",
+	 current_working_directory );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "current_working_directory_size",
+	 current_working_directory_size,
+	 narrow_string_length( current_working_directory ) + 1 );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type(
-	          "\\",
-	          1,
-	          &path_type,
+	memory_free(
+	 current_working_directory );
+
+	current_working_directory = NULL;
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_current_working_directory_exact(
+	          NULL,
+	          &current_working_directory_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_ABSOLUTE );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type(
-	          "c:",
-	          2,
-	          &path_type,
+	libcerror_error_free(
+	 &error );
+
+	current_working_directory = (char *) 0x12345678UL;
+
+	result = libcpath_path_get_current_working_directory_exact(
+	          &current_working_directory,
+	          &current_working_directory_size,
 	          &error );
 
+	current_working_directory = NULL;
+
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_RELATIVE );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type(
-	          "C:\\Windows",
-	          10,
-	          &path_type,
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_current_working_directory_exact(
+	          &current_working_directory,
+	          NULL,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_ABSOLUTE );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type(
-	          "\\\\server\\share\\directory",
-	          24,
-	          &path_type,
-	          &error );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	libcerror_error_free(
+	 &error );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_UNC );
+#if defined( HAVE_CPATH_TEST_MEMORY )
 
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	/* Test libcpath_path_get_current_working_directory_exact with malloc failing
+	 */
+	cpath_test_malloc_attempts_before_fail = 0;
 
-	result = libcpath_path_get_path_type(
-	          "\\\\?\\Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}",
-	          48,
-	          &path_type,
+	result = libcpath_path_get_current_working_directory_exact(
+	          &current_working_directory,
+	          &current_working_directory_size,
 	          &error );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	if( cpath_test_malloc_attempts_before_fail != -1 )
+	{
+		cpath_test_malloc_attempts_before_fail = -1;
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_EXTENDED_LENGTH );
+		if( current_working_directory != NULL )
+		{
+			memory_free(
+			 current_working_directory );
 
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+			current_working_directory = NULL;
+		}
+	}
+	else
+	{
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	result = libcpath_path_get_path_type(
-	          "\\\\.\\PhysicalDrive0",
-	          18,
-	          &path_type,
-	          &error );
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "current_working_directory",
+		 current_working_directory );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_DEVICE );
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
 
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+#if defined( HAVE_CPATH_TEST_FUNCTION_HOOK )
 
-	result = libcpath_path_get_path_type(
-	          "\\\\.\\C:",
-	          6,
-	          &path_type,
-	          &error );
+	/* Test libcpath_path_get_current_working_directory_exact with getcwd failing
+	 */
+	cpath_test_getcwd_attempts_before_fail = 0;
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+	result = libcpath_path_get_current_working_directory_exact(
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_DEVICE );
+	if( cpath_test_getcwd_attempts_before_fail != -1 )
+	{
+		cpath_test_getcwd_attempts_before_fail = -1;
+	}
+	else
+	{
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "current_working_directory",
+		 current_working_directory );
 
-	result = libcpath_path_get_path_type(
-	          "\\\\.\\C:\\",
-	          7,
-	          &path_type,
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CPATH_TEST_FUNCTION_HOOK ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( current_working_directory != NULL )
+	{
+		memory_free(
+		 current_working_directory );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_enable_current_working_directory_cache,
+ * libcpath_path_disable_current_working_directory_cache and
+ * libcpath_path_refresh_current_working_directory_cache functions
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_current_working_directory_cache(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	char *cached_full_path                = NULL;
+	char *current_working_directory       = NULL;
+	char *full_path                       = NULL;
+	size_t cached_full_path_size          = 0;
+	size_t current_working_directory_size = 0;
+	size_t full_path_size                 = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_path_get_current_working_directory(
+	          &current_working_directory,
+	          &current_working_directory_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -776,19 +912,19 @@ int cpath_test_path_get_path_type(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_DEVICE );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "current_working_directory",
+	 current_working_directory );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type(
-	          "\\\\?\\C:\\Windows",
-	          14,
-	          &path_type,
+	result = libcpath_path_get_full_path(
+	          "cache_test",
+	          10,
+	          &full_path,
+	          &full_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -796,19 +932,13 @@ int cpath_test_path_get_path_type(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_EXTENDED_LENGTH );
-
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type(
-	          "\\\\?\\UNC\\server\\share\\directory",
-	          30,
-	          &path_type,
+	/* Test regular cases
+	 */
+	result = libcpath_path_enable_current_working_directory_cache(
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -816,120 +946,87 @@ int cpath_test_path_get_path_type(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_EXTENDED_LENGTH_UNC );
-
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcpath_path_get_path_type(
-	          NULL,
-	          1,
-	          &path_type,
+	result = libcpath_path_get_full_path(
+	          "cache_test",
+	          10,
+	          &cached_full_path,
+	          &cached_full_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "cached_full_path",
+	 cached_full_path );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "cached_full_path_size",
+	 cached_full_path_size,
+	 full_path_size );
 
-	result = libcpath_path_get_path_type(
-	          ".",
-	          0,
-	          &path_type,
-	          &error );
+	result = narrow_string_compare(
+	          cached_full_path,
+	          full_path,
+	          full_path_size );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+	memory_free(
+	 cached_full_path );
 
-	libcerror_error_free(
-	 &error );
+	cached_full_path = NULL;
 
-	result = libcpath_path_get_path_type(
-	          ".",
-	          (size_t) SSIZE_MAX + 1,
-	          &path_type,
+	memory_free(
+	 full_path );
+
+	full_path = NULL;
+
+	result = libcpath_path_refresh_current_working_directory_cache(
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcpath_path_get_path_type(
-	          ".",
-	          1,
-	          NULL,
+	/* Test that changing the directory invalidates the cache
+	 */
+	result = libcpath_path_change_directory(
+	          "..",
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libcpath_path_get_volume_name function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_path_get_volume_name(
-     void )
-{
-	libcerror_error_t *error    = NULL;
-	char *volume_name           = NULL;
-	size_t directory_name_index = 0;
-	size_t volume_name_length   = 0;
-	int result                  = 0;
-
-	/* Test regular cases
-	 */
-	result = libcpath_path_get_volume_name(
-	          ".",
-	          1,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	result = libcpath_path_get_full_path(
+	          "cache_test",
+	          10,
+	          &cached_full_path,
+	          &cached_full_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -937,26 +1034,11 @@ int cpath_test_path_get_volume_name(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 0 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 0 );
-
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_volume_name(
-	          "\\",
-	          1,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	result = libcpath_path_disable_current_working_directory_cache(
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -964,30 +1046,15 @@ int cpath_test_path_get_volume_name(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 (size_t) 0 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 (size_t) 0 );
-
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_volume_name(
-	          "c:",
-	          2,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	result = libcpath_path_get_full_path(
+	          "cache_test",
+	          10,
+	          &full_path,
+	          &full_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -995,40 +1062,37 @@ int cpath_test_path_get_volume_name(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 (size_t) 2 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 (size_t) 2 );
-
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "cached_full_path_size",
+	 cached_full_path_size,
+	 full_path_size );
+
 	result = narrow_string_compare(
-	          volume_name,
-	          "c:",
-	          2 );
+	          cached_full_path,
+	          full_path,
+	          full_path_size );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 0 );
 
-	result = libcpath_path_get_volume_name(
-	          "C:\\Windows",
-	          10,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	memory_free(
+	 cached_full_path );
+
+	cached_full_path = NULL;
+
+	memory_free(
+	 full_path );
+
+	full_path = NULL;
+
+	result = libcpath_path_change_directory(
+	          current_working_directory,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -1036,40 +1100,15 @@ int cpath_test_path_get_volume_name(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 (size_t) 2 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 (size_t) 3 );
-
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          volume_name,
-	          "C:",
-	          2 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+#if defined( HAVE_CPATH_TEST_FUNCTION_HOOK )
 
-	result = libcpath_path_get_volume_name(
-	          "\\\\server\\share\\directory",
-	          24,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	/* Test libcpath_path_refresh_current_working_directory_cache with getcwd failing
+	 */
+	result = libcpath_path_enable_current_working_directory_cache(
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -1077,40 +1116,34 @@ int cpath_test_path_get_volume_name(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 (size_t) 12 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 (size_t) 15 );
-
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          volume_name,
-	          "server\\share",
-	          12 );
+	cpath_test_getcwd_attempts_before_fail = 0;
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+	result = libcpath_path_refresh_current_working_directory_cache(
+	          &error );
 
-	result = libcpath_path_get_volume_name(
-	          "\\\\?\\Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}",
-	          48,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	if( cpath_test_getcwd_attempts_before_fail != -1 )
+	{
+		cpath_test_getcwd_attempts_before_fail = -1;
+	}
+	else
+	{
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	result = libcpath_path_disable_current_working_directory_cache(
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -1118,81 +1151,102 @@ int cpath_test_path_get_volume_name(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 44 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 48 );
-
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          volume_name,
-	          "Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}",
-	          44 );
+#endif /* defined( HAVE_CPATH_TEST_FUNCTION_HOOK ) */
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+	/* Clean up
+	 */
+	memory_free(
+	 current_working_directory );
 
-	result = libcpath_path_get_volume_name(
-	          "\\\\.\\PhysicalDrive0",
-	          18,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	current_working_directory = NULL;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( full_path != NULL )
+	{
+		memory_free(
+		 full_path );
+	}
+	if( cached_full_path != NULL )
+	{
+		memory_free(
+		 cached_full_path );
+	}
+	if( current_working_directory != NULL )
+	{
+		libcpath_path_change_directory(
+		 current_working_directory,
+		 NULL );
+
+		memory_free(
+		 current_working_directory );
+	}
+	libcpath_path_disable_current_working_directory_cache(
+	 NULL );
+
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
+
+/* Tests the libcpath_path_get_cached_current_working_directory function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_cached_current_working_directory(
+     void )
+{
+	const char *cached_current_working_directory   = NULL;
+	const char *current_working_directory          = NULL;
+	libcerror_error_t *error                       = NULL;
+	size_t cached_current_working_directory_length = 0;
+	size_t current_working_directory_length        = 0;
+	int result                                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_cached_current_working_directory(
+	          &current_working_directory,
+	          &current_working_directory_length,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 14 );
+	 0 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 18 );
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "current_working_directory",
+	 current_working_directory );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          volume_name,
-	          "PhysicalDrive0",
-	          14 );
+	result = libcpath_path_enable_current_working_directory_cache(
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
-	result = libcpath_path_get_volume_name(
-	          "\\\\.\\C:",
-	          6,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_cached_current_working_directory(
+	          &current_working_directory,
+	          &current_working_directory_length,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -1201,39 +1255,23 @@ int cpath_test_path_get_volume_name(
 	 1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 2 );
+	 "current_working_directory",
+	 current_working_directory );
 
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 6 );
+	 "current_working_directory_length",
+	 current_working_directory_length,
+	 narrow_string_length( current_working_directory ) );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          volume_name,
-	          "C:",
-	          2 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-	result = libcpath_path_get_volume_name(
-	          "\\\\.\\C:\\",
-	          7,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	/* Test that the cached value is reused
+	 */
+	result = libcpath_path_get_cached_current_working_directory(
+	          &cached_current_working_directory,
+	          &cached_current_working_directory_length,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -1241,81 +1279,104 @@ int cpath_test_path_get_volume_name(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 2 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "cached_current_working_directory",
+	 (int) ( cached_current_working_directory == current_working_directory ),
+	 1 );
 
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 7 );
+	 "cached_current_working_directory_length",
+	 cached_current_working_directory_length,
+	 current_working_directory_length );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          volume_name,
-	          "C:",
-	          2 );
+	/* Test error cases
+	 */
+	result = libcpath_path_get_cached_current_working_directory(
+	          NULL,
+	          &current_working_directory_length,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	result = libcpath_path_get_volume_name(
-	          "\\\\?\\C:\\Windows",
-	          14,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
-	          &error );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_cached_current_working_directory(
+	          &current_working_directory,
+	          NULL,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
+	 "error",
+	 error );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 2 );
+	libcerror_error_free(
+	 &error );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 7 );
+	/* Clean up
+	 */
+	result = libcpath_path_disable_current_working_directory_cache(
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          volume_name,
-	          "C:",
-	          2 );
+	return( 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libcpath_path_disable_current_working_directory_cache(
+	 NULL );
 
-	result = libcpath_path_get_volume_name(
-	          "\\\\?\\UNC\\server\\share\\directory",
-	          30,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI )
+
+/* Tests the libcpath_path_get_path_type function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_path_type(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t path_type        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_path_type(
+	          ".",
+	          1,
+	          &path_type,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -1323,185 +1384,199 @@ int cpath_test_path_get_volume_name(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 12 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 21 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_RELATIVE );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          volume_name,
-	          "server\\share",
-	          12 );
+	result = libcpath_path_get_path_type(
+	          "\\",
+	          1,
+	          &path_type,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
-	/* Test error cases
-	 */
-	result = libcpath_path_get_volume_name(
-	          NULL,
-	          1,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_ABSOLUTE );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_path_type(
+	          "c:",
+	          2,
+	          &path_type,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_RELATIVE );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcpath_path_get_volume_name(
-	          ".",
-	          0,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	result = libcpath_path_get_path_type(
+	          "C:\\Windows",
+	          10,
+	          &path_type,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_ABSOLUTE );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcpath_path_get_volume_name(
-	          ".",
-	          (size_t) SSIZE_MAX + 1,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	result = libcpath_path_get_path_type(
+	          "\\\\server\\share\\directory",
+	          24,
+	          &path_type,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_UNC );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcpath_path_get_volume_name(
-	          ".",
-	          1,
-	          NULL,
-	          &volume_name_length,
-	          &directory_name_index,
+	result = libcpath_path_get_path_type(
+	          "\\\\?\\Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}",
+	          48,
+	          &path_type,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_EXTENDED_LENGTH );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcpath_path_get_volume_name(
-	          ".",
-	          1,
-	          &volume_name,
-	          NULL,
-	          &directory_name_index,
+	result = libcpath_path_get_path_type(
+	          "\\\\.\\PhysicalDrive0",
+	          18,
+	          &path_type,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_DEVICE );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcpath_path_get_volume_name(
-	          ".",
-	          1,
-	          &volume_name,
-	          &volume_name_length,
-	          NULL,
+	result = libcpath_path_get_path_type(
+	          "\\\\.\\C:",
+	          6,
+	          &path_type,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_DEVICE );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libcpath_path_get_path_type(
+	          "\\\\.\\C:\\",
+	          7,
+	          &path_type,
+	          &error );
 
-	return( 1 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_DEVICE );
 
-/* Tests the libcpath_path_get_current_working_directory_by_volume function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_path_get_current_working_directory_by_volume(
-     void )
-{
-	libcerror_error_t *error              = NULL;
-	char *current_working_directory       = NULL;
-	size_t current_working_directory_size = 0;
-	int result                            = 0;
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Test regular cases
-	 */
-	result = libcpath_path_get_current_working_directory_by_volume(
-	          "C:",
-	          2,
-	          &current_working_directory,
-	          &current_working_directory_size,
+	result = libcpath_path_get_path_type(
+	          "\\\\?\\C:\\Windows",
+	          14,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_EXTENDED_LENGTH );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_path_type(
+	          "\\\\?\\UNC\\server\\share\\directory",
+	          30,
+	          &path_type,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -1509,17 +1584,21 @@ int cpath_test_path_get_current_working_directory_by_volume(
 	 result,
 	 1 );
 
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_EXTENDED_LENGTH_UNC );
+
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	/* Test error cases
 	 */
-	result = libcpath_path_get_current_working_directory_by_volume(
-	          "C:",
-	          (size_t) SSIZE_MAX + 1,
-	          &current_working_directory,
-	          &current_working_directory_size,
+	result = libcpath_path_get_path_type(
+	          NULL,
+	          1,
+	          &path_type,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -1534,11 +1613,10 @@ int cpath_test_path_get_current_working_directory_by_volume(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_current_working_directory_by_volume(
-	          "C:",
-	          2,
-	          NULL,
-	          &current_working_directory_size,
+	result = libcpath_path_get_path_type(
+	          ".",
+	          0,
+	          &path_type,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -1553,10 +1631,27 @@ int cpath_test_path_get_current_working_directory_by_volume(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_current_working_directory_by_volume(
-	          "C:",
-	          2,
-	          &current_working_directory,
+	result = libcpath_path_get_path_type(
+	          ".",
+	          (size_t) SSIZE_MAX + 1,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_path_type(
+	          ".",
+	          1,
 	          NULL,
 	          &error );
 
@@ -1583,77 +1678,26 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) */
-
-/* Tests the libcpath_path_get_full_path function
+/* Tests the libcpath_path_get_volume_name function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_path_get_full_path(
+int cpath_test_path_get_volume_name(
      void )
 {
-#if defined( WINAPI ) || defined( __MINGW32__ )
-	char *absolute_paths[] = {
-		"\\home\\user\\test.txt",
-		"c:\\home\\user\\test.txt",
-		"c:\\home\\user\\\\test.txt",
-		"c:\\home\\username\\..\\user\\test.txt",
-		"c:\\..\\home\\user\\test.txt",
-		"c:\\..\\home\\username\\..\\user\\test.txt",
-	};
-	char *relative_paths[] = {
-		"user\\test.txt",
-		"username\\..\\user\\test.txt",
-	};
-#if defined( WINAPI )
-	char *special_paths[] = {
-		"\\\\.\\PhysicalDrive0",
-		"\\\\?\\Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}"
-	};
-	char *unc_paths[] = {
-		"\\\\172.0.0.1\\C$\\test.txt",
-		"\\\\?\\UNC\\172.0.0.1\\C$\\test.txt",
-	};
-#endif /* defined( WINAPI ) */
-#else
-	char *absolute_paths[] = {
-		"/home/user/test.txt",
-		"/home/user//test.txt",
-		"/../home/user/test.txt",
-		"/../home/username/../user/test.txt",
-	};
-	char *relative_paths[] = {
-		"user/test.txt",
-		"username/../user/test.txt",
-	};
-#endif /* defined( WINAPI ) || defined( __MINGW32__ ) */
-
-	libcerror_error_t *error                = NULL;
-	char *current_working_directory         = NULL;
-	char *expected_path                     = NULL;
-	char *full_path                         = NULL;
-	char *path                              = NULL;
-	size_t current_working_directory_length = 0;
-	size_t current_working_directory_size   = 0;
-	size_t expected_full_path_length        = 0;
-	size_t expected_path_length             = 0;
-	size_t full_path_length                 = 0;
-	size_t full_path_size                   = 0;
-	size_t path_length                      = 0;
-	int path_index                          = 0;
-	int result                              = 0;
-	int string_index                        = 0;
-
-#if defined( WINAPI ) || defined( __MINGW32__ )
-	int number_of_absolute_paths            = 6;
-#else
-	int number_of_absolute_paths            = 4;
-#endif
+	libcerror_error_t *error    = NULL;
+	char *volume_name           = NULL;
+	size_t directory_name_index = 0;
+	size_t volume_name_length   = 0;
+	int result                  = 0;
 
-	/* Initialize test
+	/* Test regular cases
 	 */
-	result = libcpath_path_get_current_working_directory(
-	          &current_working_directory,
-	          &current_working_directory_size,
+	result = libcpath_path_get_volume_name(
+	          ".",
+	          1,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -1661,351 +1705,11353 @@ int cpath_test_path_get_full_path(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "current_working_directory",
-	 current_working_directory );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 0 );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	current_working_directory_length = narrow_string_length(
-	                                    current_working_directory );
-
-	/* Test regular cases
-	 */
-#if defined( WINAPI )
-	expected_path = "\\\\?\\C:\\home\\user\\test.txt";
-#elif defined( __MINGW32__ )
-	expected_path = "C:\\home\\user\\test.txt";
-#else
-	expected_path = "/home/user/test.txt";
-#endif
-	expected_path_length = narrow_string_length(
-	                        expected_path );
+	result = libcpath_path_get_volume_name(
+	          "\\",
+	          1,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
 
-	for( path_index = 0;
-	     path_index < number_of_absolute_paths;
-	     path_index++ )
-	{
-		path = absolute_paths[ path_index ];
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		path_length = narrow_string_length(
-		               path );
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "volume_name",
+	 volume_name );
 
-		result = libcpath_path_get_full_path(
-		          path,
-		          path_length,
-		          &full_path,
-		          &full_path_size,
-		          &error );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 (size_t) 0 );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 (size_t) 0 );
 
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "full_path",
-		 full_path );
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_size",
-		 full_path_size,
-		 expected_path_length + 1 );
+	result = libcpath_path_get_volume_name(
+	          "c:",
+	          2,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          volume_name,
+	          "c:",
+	          2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name(
+	          "C:\\Windows",
+	          10,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 (size_t) 3 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          volume_name,
+	          "C:",
+	          2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name(
+	          "\\\\server\\share\\directory",
+	          24,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 (size_t) 12 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 (size_t) 15 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          volume_name,
+	          "server\\share",
+	          12 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name(
+	          "\\\\?\\Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}",
+	          48,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 44 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 48 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          volume_name,
+	          "Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}",
+	          44 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name(
+	          "\\\\.\\PhysicalDrive0",
+	          18,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 14 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 18 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          volume_name,
+	          "PhysicalDrive0",
+	          14 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name(
+	          "\\\\.\\C:",
+	          6,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 2 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 6 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          volume_name,
+	          "C:",
+	          2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name(
+	          "\\\\.\\C:\\",
+	          7,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 2 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 7 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          volume_name,
+	          "C:",
+	          2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name(
+	          "\\\\?\\C:\\Windows",
+	          14,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 2 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 7 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          volume_name,
+	          "C:",
+	          2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name(
+	          "\\\\?\\UNC\\server\\share\\directory",
+	          30,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 12 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 21 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          volume_name,
+	          "server\\share",
+	          12 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_volume_name(
+	          NULL,
+	          1,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_volume_name(
+	          ".",
+	          0,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_volume_name(
+	          ".",
+	          (size_t) SSIZE_MAX + 1,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_volume_name(
+	          ".",
+	          1,
+	          NULL,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_volume_name(
+	          ".",
+	          1,
+	          &volume_name,
+	          NULL,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_volume_name(
+	          ".",
+	          1,
+	          &volume_name,
+	          &volume_name_length,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_current_working_directory_by_volume function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_current_working_directory_by_volume(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	char *current_working_directory       = NULL;
+	size_t current_working_directory_size = 0;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_current_working_directory_by_volume(
+	          "C:",
+	          2,
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_current_working_directory_by_volume(
+	          "C:",
+	          (size_t) SSIZE_MAX + 1,
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_current_working_directory_by_volume(
+	          "C:",
+	          2,
+	          NULL,
+	          &current_working_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_current_working_directory_by_volume(
+	          "C:",
+	          2,
+	          &current_working_directory,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) */
+
+/* Tests the libcpath_path_get_full_path function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_full_path(
+     void )
+{
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	char *absolute_paths[] = {
+		"\\home\\user\\test.txt",
+		"c:\\home\\user\\test.txt",
+		"c:\\home\\user\\\\test.txt",
+		"c:\\home\\username\\..\\user\\test.txt",
+		"c:\\..\\home\\user\\test.txt",
+		"c:\\..\\home\\username\\..\\user\\test.txt",
+	};
+	char *relative_paths[] = {
+		"user\\test.txt",
+		"username\\..\\user\\test.txt",
+	};
+#if defined( WINAPI )
+	char *special_paths[] = {
+		"\\\\.\\PhysicalDrive0",
+		"\\\\?\\Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}"
+	};
+	char *unc_paths[] = {
+		"\\\\172.0.0.1\\C$\\test.txt",
+		"\\\\?\\UNC\\172.0.0.1\\C$\\test.txt",
+	};
+#endif /* defined( WINAPI ) */
+#else
+	char *absolute_paths[] = {
+		"/home/user/test.txt",
+		"/home/user//test.txt",
+		"/../home/user/test.txt",
+		"/../home/username/../user/test.txt",
+		"/home/./user/test.txt",
+		"/home/user/../../../home/user/test.txt",
+	};
+	char *relative_paths[] = {
+		"user/test.txt",
+		"username/../user/test.txt",
+		"./user/./test.txt",
+		"username/subdir/../../user/test.txt",
+	};
+#endif /* defined( WINAPI ) || defined( __MINGW32__ ) */
+
+	libcerror_error_t *error                = NULL;
+	char *current_working_directory         = NULL;
+	char *expected_path                     = NULL;
+	char *full_path                         = NULL;
+	char *path                              = NULL;
+	size_t current_working_directory_length = 0;
+	size_t current_working_directory_size   = 0;
+	size_t expected_full_path_length        = 0;
+	size_t expected_path_length             = 0;
+	size_t full_path_length                 = 0;
+	size_t full_path_size                   = 0;
+	size_t path_length                      = 0;
+	int path_index                          = 0;
+	int result                              = 0;
+	int string_index                        = 0;
+
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	int number_of_absolute_paths            = 6;
+	int number_of_relative_paths            = 2;
+#else
+	int number_of_absolute_paths            = 6;
+	int number_of_relative_paths            = 4;
+#endif
+
+	/* Initialize test
+	 */
+	result = libcpath_path_get_current_working_directory(
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "current_working_directory",
+	 current_working_directory );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	current_working_directory_length = narrow_string_length(
+	                                    current_working_directory );
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI )
+	expected_path = "\\\\?\\C:\\home\\user\\test.txt";
+#elif defined( __MINGW32__ )
+	expected_path = "C:\\home\\user\\test.txt";
+#else
+	expected_path = "/home/user/test.txt";
+#endif
+	expected_path_length = narrow_string_length(
+	                        expected_path );
+
+	for( path_index = 0;
+	     path_index < number_of_absolute_paths;
+	     path_index++ )
+	{
+		path = absolute_paths[ path_index ];
+
+		path_length = narrow_string_length(
+		               path );
+
+		result = libcpath_path_get_full_path(
+		          path,
+		          path_length,
+		          &full_path,
+		          &full_path_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "full_path",
+		 full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_size",
+		 full_path_size,
+		 expected_path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Skip the drive letter in the comparison, given it is determined runtime */
+#if defined( WINAPI )
+		if( ( full_path[ 0 ] != '\\' )
+		 || ( full_path[ 1 ] != '\\' )
+		 || ( full_path[ 2 ] != '?' )
+		 || ( full_path[ 3 ] != '\\' ) )
+		{
+			result = 1;
+		}
+		else
+		{
+			result = narrow_string_compare_no_case(
+			          &( full_path[ 5 ] ),
+			          &( expected_path[ 5 ] ),
+			          expected_path_length - 5 );
+		}
+#elif defined( __MINGW32__ )
+		result = narrow_string_compare_no_case(
+		          &( full_path[ 2 ] ),
+		          &( expected_path[ 2 ] ),
+		          expected_path_length - 2 );
+#else
+		result = narrow_string_compare(
+		          full_path,
+		          expected_path,
+		          expected_path_length );
+#endif
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		full_path_length = narrow_string_length(
+		                    full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_size",
+		 full_path_size,
+		 full_path_length + 1 );
+
+		memory_free(
+		 full_path );
+
+		full_path = NULL;
+	}
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	expected_path = "\\user\\test.txt";
+#else
+	expected_path = "/user/test.txt";
+#endif
+	expected_path_length = narrow_string_length(
+	                        expected_path );
+
+	expected_full_path_length = current_working_directory_length + expected_path_length;
+
+#if defined( WINAPI )
+	expected_full_path_length += 4;
+#endif
+
+	for( path_index = 0;
+	     path_index < number_of_relative_paths;
+	     path_index++ )
+	{
+		path = relative_paths[ path_index ];
+
+		path_length = narrow_string_length(
+		               path );
+
+		result = libcpath_path_get_full_path(
+		          path,
+		          path_length,
+		          &full_path,
+		          &full_path_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "full_path",
+		 full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_size",
+		 full_path_size,
+		 expected_full_path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+#if defined( WINAPI )
+		/* A full path on Windows is prefixed with \\?\ while
+		 * the current working directory is not.
+		 */
+		result = narrow_string_compare_no_case(
+		          full_path,
+		          "\\\\?\\",
+		          4 );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		string_index = 4;
+#else
+		string_index = 0;
+#endif
+#if defined( WINAPI ) || defined( __MINGW32__ )
+		result = narrow_string_compare_no_case(
+		          &( full_path[ string_index ] ),
+		          current_working_directory,
+		          current_working_directory_length );
+#else
+		result = narrow_string_compare(
+		          &( full_path[ string_index ] ),
+		          current_working_directory,
+		          current_working_directory_length );
+#endif
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+#if defined( WINAPI ) || defined( __MINGW32__ )
+		result = narrow_string_compare_no_case(
+		          &( full_path[ string_index + current_working_directory_length ] ),
+		          expected_path,
+		          expected_path_length );
+#else
+		result = narrow_string_compare(
+		          &( full_path[ string_index + current_working_directory_length ] ),
+		          expected_path,
+		          expected_path_length );
+#endif
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		full_path_length = narrow_string_length(
+		                    full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_length",
+		 full_path_length,
+		 expected_full_path_length );
+
+		memory_free(
+		 full_path );
+
+		full_path = NULL;
+	}
+#if defined( WINAPI )
+	for( path_index = 0;
+	     path_index < 2;
+	     path_index++ )
+	{
+		path = special_paths[ path_index ];
+
+		path_length = narrow_string_length(
+		               path );
+
+		result = libcpath_path_get_full_path(
+		          path,
+		          path_length,
+		          &full_path,
+		          &full_path_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "full_path",
+		 full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_size",
+		 full_path_size,
+		 path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = narrow_string_compare_no_case(
+		          full_path,
+		          path,
+		          path_length );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		full_path_length = narrow_string_length(
+		                    full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_length",
+		 full_path_length,
+		 path_length );
+
+		memory_free(
+		 full_path );
+
+		full_path = NULL;
+	}
+	expected_path = "\\\\?\\UNC\\172.0.0.1\\C$\\test.txt";
+
+	expected_path_length = narrow_string_length(
+	                        expected_path );
+
+	for( path_index = 0;
+	     path_index < 2;
+	     path_index++ )
+	{
+		path = unc_paths[ path_index ];
+
+		path_length = narrow_string_length(
+		               path );
+
+		result = libcpath_path_get_full_path(
+		          path,
+		          path_length,
+		          &full_path,
+		          &full_path_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "full_path",
+		 full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_size",
+		 full_path_size,
+		 expected_path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = narrow_string_compare_no_case(
+		          full_path,
+		          expected_path,
+		          expected_path_length );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		full_path_length = narrow_string_length(
+		                    full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_length",
+		 full_path_length,
+		 expected_path_length );
+
+		memory_free(
+		 full_path );
+
+		full_path = NULL;
+	}
+#endif /* defined( WINAPI ) */
+
+#if !defined( WINAPI ) && !defined( __MINGW32__ )
+	/* Test that the root directory resolves to itself
+	 */
+	result = libcpath_path_get_full_path(
+	          "/",
+	          1,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "full_path",
+	 full_path );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_path_size",
+	 full_path_size,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          full_path,
+	          "/",
+	          2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 full_path );
+
+	full_path = NULL;
+
+#endif /* !defined( WINAPI ) && !defined( __MINGW32__ ) */
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_full_path(
+	          NULL,
+	          8,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path(
+	          "test.txt",
+	          0,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path(
+	          "test.txt",
+	          (size_t) -1,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path(
+	          "test.txt",
+	          8,
+	          NULL,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	full_path = (char *) 0x12345678UL;
+
+	result = libcpath_path_get_full_path(
+	          "test.txt",
+	          8,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	full_path = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path(
+	          "test.txt",
+	          8,
+	          &full_path,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CPATH_TEST_FUNCTION_HOOK )
+
+	/* Test libcpath_path_change_directory with getcwd failing
+	 */
+	cpath_test_getcwd_attempts_before_fail = 0;
+
+	result = libcpath_path_get_full_path(
+	          "test.txt",
+	          8,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	if( cpath_test_getcwd_attempts_before_fail != -1 )
+	{
+		cpath_test_getcwd_attempts_before_fail = -1;
+	}
+	else
+	{
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "full_path",
+		 full_path );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CPATH_TEST_FUNCTION_HOOK ) */
+
+	/* Clean up
+	 */
+	memory_free(
+	 current_working_directory );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( full_path != NULL )
+	{
+		memory_free(
+		 full_path );
+	}
+	if( current_working_directory != NULL )
+	{
+		memory_free(
+		 current_working_directory );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_full_path_to_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_full_path_to_buffer(
+     void )
+{
+	char full_path[ 64 ];
+
+	libcerror_error_t *error       = NULL;
+	char *expected_full_path       = NULL;
+	char *expected_path            = NULL;
+	char *path                     = NULL;
+	char *relative_full_path       = NULL;
+	size_t expected_full_path_size = 0;
+	size_t expected_path_length    = 0;
+	size_t path_length             = 0;
+	size_t required_full_path_size = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI )
+	path          = "c:\\home\\username\\..\\user\\test.txt";
+	expected_path = "\\\\?\\C:\\home\\user\\test.txt";
+#elif defined( __MINGW32__ )
+	path          = "c:\\home\\username\\..\\user\\test.txt";
+	expected_path = "C:\\home\\user\\test.txt";
+#else
+	path          = "/home/username/../user/test.txt";
+	expected_path = "/home/user/test.txt";
+#endif
+	path_length = narrow_string_length(
+	               path );
+
+	expected_path_length = narrow_string_length(
+	                        expected_path );
+
+	result = libcpath_path_get_full_path_to_buffer(
+	          path,
+	          path_length,
+	          full_path,
+	          64,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_full_path_size",
+	 required_full_path_size,
+	 expected_path_length + 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          full_path,
+	          expected_path,
+	          expected_path_length + 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test libcpath_path_get_full_path_to_buffer with a full path of the exact size
+	 */
+	result = libcpath_path_get_full_path_to_buffer(
+	          path,
+	          path_length,
+	          full_path,
+	          expected_path_length + 1,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_full_path_size",
+	 required_full_path_size,
+	 expected_path_length + 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          full_path,
+	          expected_path,
+	          expected_path_length + 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test libcpath_path_get_full_path_to_buffer with a full path that is too small
+	 */
+	result = libcpath_path_get_full_path_to_buffer(
+	          path,
+	          path_length,
+	          full_path,
+	          expected_path_length,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_full_path_size",
+	 required_full_path_size,
+	 expected_path_length + 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test libcpath_path_get_full_path_to_buffer with a relative path
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	path = "username\\..\\user\\test.txt";
+#else
+	path = "username/../user/test.txt";
+#endif
+	path_length = narrow_string_length(
+	               path );
+
+	result = libcpath_path_get_full_path(
+	          path,
+	          path_length,
+	          &expected_full_path,
+	          &expected_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "expected_full_path",
+	 expected_full_path );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_full_path_to_buffer(
+	          path,
+	          path_length,
+	          full_path,
+	          0,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_full_path_size",
+	 required_full_path_size,
+	 expected_full_path_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	relative_full_path = narrow_string_allocate(
+	                      required_full_path_size );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "relative_full_path",
+	 relative_full_path );
+
+	result = libcpath_path_get_full_path_to_buffer(
+	          path,
+	          path_length,
+	          relative_full_path,
+	          required_full_path_size,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_full_path_size",
+	 required_full_path_size,
+	 expected_full_path_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          relative_full_path,
+	          expected_full_path,
+	          expected_full_path_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 relative_full_path );
+
+	relative_full_path = NULL;
+
+	memory_free(
+	 expected_full_path );
+
+	expected_full_path = NULL;
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_full_path_to_buffer(
+	          NULL,
+	          path_length,
+	          full_path,
+	          64,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path_to_buffer(
+	          path,
+	          0,
+	          full_path,
+	          64,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path_to_buffer(
+	          path,
+	          path_length,
+	          NULL,
+	          64,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path_to_buffer(
+	          path,
+	          path_length,
+	          full_path,
+	          (size_t) SSIZE_MAX + 1,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path_to_buffer(
+	          path,
+	          path_length,
+	          full_path,
+	          64,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( relative_full_path != NULL )
+	{
+		memory_free(
+		 relative_full_path );
+	}
+	if( expected_full_path != NULL )
+	{
+		memory_free(
+		 expected_full_path );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_full_paths function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_full_paths(
+     void )
+{
+	const char *invalid_paths[ 2 ] = { "test", NULL };
+	const char *paths[ 3 ]         = { "test", "test/../test2", "test/./test3" };
+	size_t path_lengths[ 3 ]       = { 4, 13, 12 };
+	libcerror_error_t *error       = NULL;
+	char *full_path                = NULL;
+	char *full_paths               = NULL;
+	size_t *full_path_offsets      = NULL;
+	size_t full_path_size          = 0;
+	size_t full_paths_offset       = 0;
+	size_t full_paths_size         = 0;
+	int path_number                = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_full_paths(
+	          paths,
+	          path_lengths,
+	          3,
+	          &full_paths,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "full_paths",
+	 full_paths );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "full_path_offsets",
+	 full_path_offsets );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( path_number = 0;
+	     path_number < 3;
+	     path_number++ )
+	{
+		result = libcpath_path_get_full_path(
+		          paths[ path_number ],
+		          path_lengths[ path_number ],
+		          &full_path,
+		          &full_path_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_offsets[ path_number ]",
+		 full_path_offsets[ path_number ],
+		 full_paths_offset );
+
+		result = narrow_string_compare(
+		          &( full_paths[ full_path_offsets[ path_number ] ] ),
+		          full_path,
+		          full_path_size );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		memory_free(
+		 full_path );
+
+		full_path = NULL;
+
+		full_paths_offset += full_path_size;
+	}
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_paths_size",
+	 full_paths_size,
+	 full_paths_offset );
+
+	memory_free(
+	 full_paths );
+
+	full_paths = NULL;
+
+	memory_free(
+	 full_path_offsets );
+
+	full_path_offsets = NULL;
+
+	/* Test that no paths is not considered an error
+	 */
+	full_paths_size = 1;
+
+	result = libcpath_path_get_full_paths(
+	          paths,
+	          path_lengths,
+	          0,
+	          &full_paths,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "full_paths",
+	 full_paths );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_paths_size",
+	 full_paths_size,
+	 (size_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "full_path_offsets",
+	 full_path_offsets );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_full_paths(
+	          NULL,
+	          path_lengths,
+	          3,
+	          &full_paths,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_paths(
+	          paths,
+	          NULL,
+	          3,
+	          &full_paths,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_paths(
+	          paths,
+	          path_lengths,
+	          -1,
+	          &full_paths,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_paths(
+	          paths,
+	          path_lengths,
+	          3,
+	          NULL,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_paths(
+	          paths,
+	          path_lengths,
+	          3,
+	          &full_paths,
+	          NULL,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_paths(
+	          paths,
+	          path_lengths,
+	          3,
+	          &full_paths,
+	          &full_paths_size,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_paths(
+	          invalid_paths,
+	          path_lengths,
+	          2,
+	          &full_paths,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "full_paths",
+	 full_paths );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "full_path_offsets",
+	 full_path_offsets );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( full_path != NULL )
+	{
+		memory_free(
+		 full_path );
+	}
+	if( full_paths != NULL )
+	{
+		memory_free(
+		 full_paths );
+	}
+	if( full_path_offsets != NULL )
+	{
+		memory_free(
+		 full_path_offsets );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
+
+/* Tests the libcpath_path_append_normalized_segments function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_append_normalized_segments(
+     void )
+{
+	char full_path[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	char *expected_path      = NULL;
+	char *path               = NULL;
+	size_t full_path_index   = 0;
+	size_t path_length       = 0;
+	int result               = 0;
+
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	path          = "home\\\\username\\.\\..\\..\\..\\user\\test.txt";
+	expected_path = "\\user\\test.txt\\";
+#else
+	path          = "home//username/./../../../user/test.txt";
+	expected_path = "/user/test.txt/";
+#endif
+	path_length = narrow_string_length(
+	               path );
+
+	/* Test regular cases
+	 */
+	full_path[ 0 ]  = LIBCPATH_SEPARATOR;
+	full_path_index = 1;
+
+	result = libcpath_path_append_normalized_segments(
+	          full_path,
+	          32,
+	          1,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_path_index",
+	 full_path_index,
+	 (size_t) 15 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          full_path,
+	          expected_path,
+	          15 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	full_path_index = 1;
+
+	result = libcpath_path_append_normalized_segments(
+	          NULL,
+	          32,
+	          1,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_append_normalized_segments(
+	          full_path,
+	          (size_t) SSIZE_MAX + 1,
+	          1,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_append_normalized_segments(
+	          full_path,
+	          32,
+	          33,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_append_normalized_segments(
+	          full_path,
+	          32,
+	          1,
+	          NULL,
+	          path,
+	          path_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	full_path_index = 0;
+
+	result = libcpath_path_append_normalized_segments(
+	          full_path,
+	          32,
+	          1,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          &error );
+
+	full_path_index = 1;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_append_normalized_segments(
+	          full_path,
+	          32,
+	          1,
+	          &full_path_index,
+	          NULL,
+	          path_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_append_normalized_segments(
+	          full_path,
+	          32,
+	          1,
+	          &full_path_index,
+	          path,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a full path that is too small
+	 */
+	result = libcpath_path_append_normalized_segments(
+	          full_path,
+	          8,
+	          1,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_normalized_segments_length function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_normalized_segments_length(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	char *path                       = NULL;
+	size_t number_of_parent_segments = 0;
+	size_t path_length               = 0;
+	size_t segments_length           = 0;
+	int result                       = 0;
+
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	path = "..\\home\\\\username\\.\\..\\..\\..\\user\\test.txt";
+#else
+	path = "../home//username/./../../../user/test.txt";
+#endif
+	path_length = narrow_string_length(
+	               path );
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_normalized_segments_length(
+	          path,
+	          path_length,
+	          &number_of_parent_segments,
+	          &segments_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_parent_segments",
+	 number_of_parent_segments,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "segments_length",
+	 segments_length,
+	 (size_t) 14 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_normalized_segments_length(
+	          NULL,
+	          path_length,
+	          &number_of_parent_segments,
+	          &segments_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_normalized_segments_length(
+	          path,
+	          (size_t) SSIZE_MAX + 1,
+	          &number_of_parent_segments,
+	          &segments_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_normalized_segments_length(
+	          path,
+	          path_length,
+	          NULL,
+	          &segments_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_normalized_segments_length(
+	          path,
+	          path_length,
+	          &number_of_parent_segments,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_prepend_normalized_segments function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_prepend_normalized_segments(
+     void )
+{
+	char full_path[ 32 ];
+
+	libcerror_error_t *error         = NULL;
+	char *expected_path              = NULL;
+	char *path                       = NULL;
+	size_t full_path_index           = 0;
+	size_t number_of_parent_segments = 0;
+	size_t path_length               = 0;
+	int result                       = 0;
+
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	path          = "home\\\\username\\.\\..\\..\\..\\user\\test.txt";
+	expected_path = "\\user\\test.txt\\";
+#else
+	path          = "home//username/./../../../user/test.txt";
+	expected_path = "/user/test.txt/";
+#endif
+	path_length = narrow_string_length(
+	               path );
+
+	/* Test regular cases
+	 */
+	full_path[ 0 ]  = LIBCPATH_SEPARATOR;
+	full_path_index = 15;
+
+	result = libcpath_path_prepend_normalized_segments(
+	          full_path,
+	          32,
+	          1,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          &number_of_parent_segments,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_path_index",
+	 full_path_index,
+	 (size_t) 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_parent_segments",
+	 number_of_parent_segments,
+	 (size_t) 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          full_path,
+	          expected_path,
+	          15 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	full_path_index           = 15;
+	number_of_parent_segments = 0;
+
+	result = libcpath_path_prepend_normalized_segments(
+	          NULL,
+	          32,
+	          1,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          &number_of_parent_segments,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_prepend_normalized_segments(
+	          full_path,
+	          (size_t) SSIZE_MAX + 1,
+	          1,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          &number_of_parent_segments,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_prepend_normalized_segments(
+	          full_path,
+	          32,
+	          33,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          &number_of_parent_segments,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_prepend_normalized_segments(
+	          full_path,
+	          32,
+	          1,
+	          NULL,
+	          path,
+	          path_length,
+	          &number_of_parent_segments,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	full_path_index = 33;
+
+	result = libcpath_path_prepend_normalized_segments(
+	          full_path,
+	          32,
+	          1,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          &number_of_parent_segments,
+	          &error );
+
+	full_path_index = 15;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_prepend_normalized_segments(
+	          full_path,
+	          32,
+	          1,
+	          &full_path_index,
+	          NULL,
+	          path_length,
+	          &number_of_parent_segments,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_prepend_normalized_segments(
+	          full_path,
+	          32,
+	          1,
+	          &full_path_index,
+	          path,
+	          (size_t) SSIZE_MAX + 1,
+	          &number_of_parent_segments,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_prepend_normalized_segments(
+	          full_path,
+	          32,
+	          1,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libcpath_path_prepend_normalized_segments with a full path that is too small
+	 */
+	full_path_index = 8;
+
+	result = libcpath_path_prepend_normalized_segments(
+	          full_path,
+	          32,
+	          1,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          &number_of_parent_segments,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_resolve_full_path function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_resolve_full_path(
+     void )
+{
+	char full_path[ 64 ];
+
+	libcerror_error_t *error       = NULL;
+	char *base_directory           = NULL;
+	char *expected_path            = NULL;
+	char *full_path_prefix         = NULL;
+	char *path                     = NULL;
+	size_t base_directory_length   = 0;
+	size_t path_length             = 0;
+	size_t required_full_path_size = 0;
+	int result                     = 0;
+
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	full_path_prefix = "\\";
+	base_directory   = "home\\username";
+	path             = "..\\user\\subdirectory\\..\\test.txt";
+	expected_path    = "\\home\\user\\test.txt";
+#else
+	full_path_prefix = "/";
+	base_directory   = "home/username";
+	path             = "../user/subdirectory/../test.txt";
+	expected_path    = "/home/user/test.txt";
+#endif
+	base_directory_length = narrow_string_length(
+	                         base_directory );
+
+	path_length = narrow_string_length(
+	               path );
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_resolve_full_path(
+	          full_path_prefix,
+	          1,
+	          base_directory,
+	          base_directory_length,
+	          path,
+	          path_length,
+	          full_path,
+	          64,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_full_path_size",
+	 required_full_path_size,
+	 (size_t) 20 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          full_path,
+	          expected_path,
+	          20 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test libcpath_path_resolve_full_path with a full path that is smaller than
+	 * the intermediate segments
+	 */
+	result = libcpath_path_resolve_full_path(
+	          full_path_prefix,
+	          1,
+	          base_directory,
+	          base_directory_length,
+	          path,
+	          path_length,
+	          full_path,
+	          20,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_full_path_size",
+	 required_full_path_size,
+	 (size_t) 20 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          full_path,
+	          expected_path,
+	          20 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test libcpath_path_resolve_full_path with a full path that is too small
+	 */
+	result = libcpath_path_resolve_full_path(
+	          full_path_prefix,
+	          1,
+	          base_directory,
+	          base_directory_length,
+	          path,
+	          path_length,
+	          full_path,
+	          19,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_full_path_size",
+	 required_full_path_size,
+	 (size_t) 20 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test libcpath_path_resolve_full_path without a base directory
+	 */
+	result = libcpath_path_resolve_full_path(
+	          full_path_prefix,
+	          1,
+	          NULL,
+	          0,
+	          base_directory,
+	          2,
+	          full_path,
+	          2,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_full_path_size",
+	 required_full_path_size,
+	 (size_t) 4 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_resolve_full_path(
+	          NULL,
+	          1,
+	          base_directory,
+	          base_directory_length,
+	          path,
+	          path_length,
+	          full_path,
+	          64,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_resolve_full_path(
+	          full_path_prefix,
+	          1,
+	          base_directory,
+	          base_directory_length,
+	          NULL,
+	          path_length,
+	          full_path,
+	          64,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_resolve_full_path(
+	          full_path_prefix,
+	          1,
+	          base_directory,
+	          base_directory_length,
+	          path,
+	          path_length,
+	          NULL,
+	          64,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_resolve_full_path(
+	          full_path_prefix,
+	          1,
+	          base_directory,
+	          base_directory_length,
+	          path,
+	          path_length,
+	          full_path,
+	          (size_t) SSIZE_MAX + 1,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_resolve_full_path(
+	          full_path_prefix,
+	          1,
+	          base_directory,
+	          base_directory_length,
+	          path,
+	          path_length,
+	          full_path,
+	          64,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_sanitized_character_size function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_sanitized_character_size(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	size_t sanitized_character_size = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_sanitized_character_size(
+	          (char) 0,
+	          &sanitized_character_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_character_size",
+	 sanitized_character_size,
+	 (size_t) 4 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_sanitized_character_size(
+	          LIBCPATH_ESCAPE_CHARACTER,
+	          &sanitized_character_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_character_size",
+	 sanitized_character_size,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_sanitized_character_size(
+	          '!',
+	          &sanitized_character_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_character_size",
+	 sanitized_character_size,
+	 (size_t) 4 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_sanitized_character_size(
+	          'A',
+	          &sanitized_character_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_character_size",
+	 sanitized_character_size,
+	 (size_t) 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_sanitized_character_size(
+	          'A',
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_sanitized_character function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_sanitized_character(
+     void )
+{
+	char sanitized_path[ 32 ];
+
+	libcerror_error_t *error      = NULL;
+	char *expected_sanitized_path = NULL;
+	size_t sanitized_path_index   = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	sanitized_path_index = 0;
+
+	result = libcpath_path_get_sanitized_character(
+	          (char) 0,
+	          4,
+	          sanitized_path,
+	          32,
+	          &sanitized_path_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 4 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	expected_sanitized_path = "^x00";
+#else
+	expected_sanitized_path = "\\x00";
+#endif
+
+	result = narrow_string_compare(
+	          sanitized_path,
+	          expected_sanitized_path,
+	          4 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	sanitized_path_index = 0;
+
+	result = libcpath_path_get_sanitized_character(
+	          LIBCPATH_ESCAPE_CHARACTER,
+	          2,
+	          sanitized_path,
+	          32,
+	          &sanitized_path_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	expected_sanitized_path = "^^";
+#else
+	expected_sanitized_path = "\\\\";
+#endif
+
+	result = narrow_string_compare(
+	          sanitized_path,
+	          expected_sanitized_path,
+	          2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	sanitized_path_index = 0;
+
+	result = libcpath_path_get_sanitized_character(
+	          'A',
+	          1,
+	          sanitized_path,
+	          32,
+	          &sanitized_path_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          sanitized_path,
+	          "A",
+	          1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	sanitized_path_index = 0;
+
+	result = libcpath_path_get_sanitized_character(
+	          'A',
+	          8,
+	          sanitized_path,
+	          32,
+	          &sanitized_path_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_character(
+	          'A',
+	          1,
+	          NULL,
+	          32,
+	          &sanitized_path_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_character(
+	          'A',
+	          1,
+	          sanitized_path,
+	          (size_t) SSIZE_MAX + 1,
+	          &sanitized_path_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_character(
+	          'A',
+	          1,
+	          sanitized_path,
+	          32,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sanitized_path_index = 32;
+
+	result = libcpath_path_get_sanitized_character(
+	          'A',
+	          1,
+	          sanitized_path,
+	          32,
+	          &sanitized_path_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 32 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_unescaped_string_length function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_unescaped_string_length(
+     void )
+{
+	char test_string[ 40 ];
+
+	libcerror_error_t *error        = NULL;
+	size_t sanitized_character_size = 0;
+	size_t unescaped_string_length  = 0;
+	int character                   = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	for( character = 0;
+	     character < 40;
+	     character++ )
+	{
+		test_string[ character ] = 'A';
+	}
+	result = libcpath_path_get_unescaped_string_length(
+	          test_string,
+	          40,
+	          1,
+	          &unescaped_string_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "unescaped_string_length",
+	 unescaped_string_length,
+	 (size_t) 40 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that every character is classified the same as by
+	 * libcpath_path_get_sanitized_character_size, both in the first
+	 * 16 characters and in the remainder of the string
+	 */
+	for( character = 0;
+	     character < 256;
+	     character++ )
+	{
+		result = libcpath_path_get_sanitized_character_size(
+		          (char) character,
+		          &sanitized_character_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		test_string[ 20 ] = (char) character;
+
+		result = libcpath_path_get_unescaped_string_length(
+		          test_string,
+		          40,
+		          0,
+		          &unescaped_string_length,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		if( sanitized_character_size == 1 )
+		{
+			CPATH_TEST_ASSERT_EQUAL_SIZE(
+			 "unescaped_string_length",
+			 unescaped_string_length,
+			 (size_t) 40 );
+		}
+		else
+		{
+			CPATH_TEST_ASSERT_EQUAL_SIZE(
+			 "unescaped_string_length",
+			 unescaped_string_length,
+			 (size_t) 20 );
+		}
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		test_string[ 20 ] = 'A';
+		test_string[ 35 ] = (char) character;
+
+		result = libcpath_path_get_unescaped_string_length(
+		          test_string,
+		          40,
+		          0,
+		          &unescaped_string_length,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		if( sanitized_character_size == 1 )
+		{
+			CPATH_TEST_ASSERT_EQUAL_SIZE(
+			 "unescaped_string_length",
+			 unescaped_string_length,
+			 (size_t) 40 );
+		}
+		else
+		{
+			CPATH_TEST_ASSERT_EQUAL_SIZE(
+			 "unescaped_string_length",
+			 unescaped_string_length,
+			 (size_t) 35 );
+		}
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		test_string[ 35 ] = 'A';
+	}
+	/* Test that the directory separator is only escaped when requested
+	 */
+	test_string[ 20 ] = LIBCPATH_SEPARATOR;
+
+	result = libcpath_path_get_unescaped_string_length(
+	          test_string,
+	          40,
+	          0,
+	          &unescaped_string_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "unescaped_string_length",
+	 unescaped_string_length,
+	 (size_t) 40 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_unescaped_string_length(
+	          test_string,
+	          40,
+	          1,
+	          &unescaped_string_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "unescaped_string_length",
+	 unescaped_string_length,
+	 (size_t) 20 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_unescaped_string_length(
+	          NULL,
+	          40,
+	          1,
+	          &unescaped_string_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_unescaped_string_length(
+	          test_string,
+	          (size_t) SSIZE_MAX + 1,
+	          1,
+	          &unescaped_string_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_unescaped_string_length(
+	          test_string,
+	          40,
+	          1,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_sanitized_string function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_sanitized_string(
+     void )
+{
+	char sanitized_string[ 32 ];
+
+	libcerror_error_t *error              = NULL;
+	char *expected_string                 = NULL;
+	char *test_string                     = NULL;
+	size_t expected_string_size           = 0;
+	size_t required_sanitized_string_size = 0;
+	size_t test_string_length             = 0;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	test_string          = "t\x00sT!.t^|\\";
+	test_string_length   = 10;
+	expected_string      = "t^x00sT^x21.t^^^x7c^x5c";
+	expected_string_size = 24;
+#else
+	test_string          = "t\x00sT!.t\\|/";
+	test_string_length   = 10;
+	expected_string      = "t\\x00sT\\x21.t\\\\\\x7c\\x2f";
+	expected_string_size = 24;
+#endif
+	result = libcpath_path_get_sanitized_string(
+	          test_string,
+	          test_string_length,
+	          1,
+	          NULL,
+	          0,
+	          &required_sanitized_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_sanitized_string_size",
+	 required_sanitized_string_size,
+	 expected_string_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_sanitized_string(
+	          test_string,
+	          test_string_length,
+	          1,
+	          sanitized_string,
+	          32,
+	          &required_sanitized_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_sanitized_string_size",
+	 required_sanitized_string_size,
+	 expected_string_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          sanitized_string,
+	          expected_string,
+	          expected_string_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that the directory separator is only escaped when requested
+	 */
+	result = libcpath_path_get_sanitized_string(
+	          test_string,
+	          test_string_length,
+	          0,
+	          NULL,
+	          0,
+	          &required_sanitized_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_sanitized_string_size",
+	 required_sanitized_string_size,
+	 expected_string_size - 3 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_sanitized_string(
+	          NULL,
+	          test_string_length,
+	          1,
+	          sanitized_string,
+	          32,
+	          &required_sanitized_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_string(
+	          test_string,
+	          (size_t) SSIZE_MAX,
+	          1,
+	          sanitized_string,
+	          32,
+	          &required_sanitized_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_string(
+	          test_string,
+	          test_string_length,
+	          1,
+	          sanitized_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &required_sanitized_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_string(
+	          test_string,
+	          test_string_length,
+	          1,
+	          sanitized_string,
+	          32,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_string(
+	          test_string,
+	          test_string_length,
+	          1,
+	          sanitized_string,
+	          expected_string_size - 1,
+	          &required_sanitized_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_unsanitized_string function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_unsanitized_string(
+     void )
+{
+	char unsanitized_string[ 32 ];
+
+	libcerror_error_t *error                = NULL;
+	char *expected_string                   = NULL;
+	char *test_string                       = NULL;
+	size_t expected_string_size             = 0;
+	size_t required_unsanitized_string_size = 0;
+	size_t test_string_length               = 0;
+	int result                              = 0;
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	test_string          = "t^x00sT^x21.t^^^x7c^x5c^x1:^x1A";
+	test_string_length   = 31;
+	expected_string      = "t\x00sT!.t^|\\\x1a\x1a";
+	expected_string_size = 13;
+#else
+	test_string          = "t\\x00sT\\x21.t\\\\\\x7c\\x2f\\x1:\\x1A";
+	test_string_length   = 31;
+	expected_string      = "t\x00sT!.t\\|/\x1a\x1a";
+	expected_string_size = 13;
+#endif
+	result = libcpath_path_get_unsanitized_string(
+	          test_string,
+	          test_string_length,
+	          unsanitized_string,
+	          32,
+	          &required_unsanitized_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_unsanitized_string_size",
+	 required_unsanitized_string_size,
+	 expected_string_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          unsanitized_string,
+	          expected_string,
+	          expected_string_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_unsanitized_string(
+	          NULL,
+	          test_string_length,
+	          unsanitized_string,
+	          32,
+	          &required_unsanitized_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_unsanitized_string(
+	          test_string,
+	          (size_t) SSIZE_MAX,
+	          unsanitized_string,
+	          32,
+	          &required_unsanitized_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_unsanitized_string(
+	          test_string,
+	          test_string_length,
+	          NULL,
+	          32,
+	          &required_unsanitized_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_unsanitized_string(
+	          test_string,
+	          test_string_length,
+	          unsanitized_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &required_unsanitized_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_unsanitized_string(
+	          test_string,
+	          test_string_length,
+	          unsanitized_string,
+	          32,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_unsanitized_string(
+	          test_string,
+	          test_string_length,
+	          unsanitized_string,
+	          expected_string_size - 1,
+	          &required_unsanitized_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an unsupported escape sequence
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	test_string = "t^y00";
+#else
+	test_string = "t\\y00";
+#endif
+	result = libcpath_path_get_unsanitized_string(
+	          test_string,
+	          5,
+	          unsanitized_string,
+	          32,
+	          &required_unsanitized_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an unsupported hexadecimal digit
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	test_string = "t^x0g";
+#else
+	test_string = "t\\x0g";
+#endif
+	result = libcpath_path_get_unsanitized_string(
+	          test_string,
+	          5,
+	          unsanitized_string,
+	          32,
+	          &required_unsanitized_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a truncated escape sequence
+	 */
+	result = libcpath_path_get_unsanitized_string(
+	          test_string,
+	          4,
+	          unsanitized_string,
+	          32,
+	          &required_unsanitized_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
+
+/* Tests the libcpath_path_get_sanitized_filename function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_sanitized_filename(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	char *expected_filename        = NULL;
+	char *sanitized_filename       = NULL;
+	char *test_filename            = NULL;
+	size_t expected_filename_size  = 0;
+	size_t sanitized_filename_size = 0;
+	size_t test_filename_length    = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	/* Test libcpath_path_get_sanitized_filename without replacement characters
+	 */
+	test_filename          = "test.txt";
+	test_filename_length   = 8;
+	expected_filename      = "test.txt";
+	expected_filename_size = 9;
+
+	result = libcpath_path_get_sanitized_filename(
+	          test_filename,
+	          test_filename_length,
+	          &sanitized_filename,
+	          &sanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "sanitized_filename",
+	 sanitized_filename );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_filename_size",
+	 sanitized_filename_size,
+	 expected_filename_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          sanitized_filename,
+	          expected_filename,
+	          expected_filename_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 sanitized_filename );
+
+	sanitized_filename      = NULL;
+	sanitized_filename_size = 0;
+
+	/* Test libcpath_path_get_sanitized_filename with replacement characters
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	test_filename          = "t\x00sT!.t^|";
+	test_filename_length   = 9;
+	expected_filename      = "t^x00sT^x21.t^^^x7c";
+	expected_filename_size = 20;
+#else
+	test_filename          = "t\x00sT!.t\\|";
+	test_filename_length   = 9;
+	expected_filename      = "t\\x00sT\\x21.t\\\\\\x7c";
+	expected_filename_size = 20;
+#endif
+
+	result = libcpath_path_get_sanitized_filename(
+	          test_filename,
+	          test_filename_length,
+	          &sanitized_filename,
+	          &sanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "sanitized_filename",
+	 sanitized_filename );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_filename_size",
+	 sanitized_filename_size,
+	 expected_filename_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          sanitized_filename,
+	          expected_filename,
+	          expected_filename_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 sanitized_filename );
+
+	sanitized_filename      = NULL;
+	sanitized_filename_size = 0;
+
+	/* Test error cases
+	 */
+	test_filename        = "test.txt";
+	test_filename_length = 8;
+
+	result = libcpath_path_get_sanitized_filename(
+	          NULL,
+	          test_filename_length,
+	          &sanitized_filename,
+	          &sanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_filename(
+	          test_filename,
+	          (size_t) -1,
+	          &sanitized_filename,
+	          &sanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_filename(
+	          test_filename,
+	          test_filename_length,
+	          NULL,
+	          &sanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sanitized_filename = (char *) 0x12345678UL;
+
+	result = libcpath_path_get_sanitized_filename(
+	          test_filename,
+	          test_filename_length,
+	          &sanitized_filename,
+	          &sanitized_filename_size,
+	          &error );
+
+	sanitized_filename = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_filename(
+	          test_filename,
+	          test_filename_length,
+	          &sanitized_filename,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CPATH_TEST_MEMORY )
+
+	/* Test libcpath_path_get_sanitized_filename with malloc failing
+	 */
+	cpath_test_malloc_attempts_before_fail = 0;
+
+	result = libcpath_path_get_sanitized_filename(
+	          test_filename,
+	          test_filename_length,
+	          &sanitized_filename,
+	          &sanitized_filename_size,
+	          &error );
+
+	if( cpath_test_malloc_attempts_before_fail != -1 )
+	{
+		cpath_test_malloc_attempts_before_fail = -1;
+
+		if( sanitized_filename != NULL )
+		{
+			memory_free(
+			 sanitized_filename );
+
+			sanitized_filename = NULL;
+		}
+	}
+	else
+	{
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "sanitized_filename",
+		 sanitized_filename );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "sanitized_filename_size",
+		 sanitized_filename_size,
+		 (size_t) 0 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( sanitized_filename != NULL )
+	{
+		memory_free(
+		 sanitized_filename );
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_sanitized_filename_to_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_sanitized_filename_to_buffer(
+     void )
+{
+	char sanitized_filename[ 32 ];
+
+	libcerror_error_t *error                = NULL;
+	char *expected_filename                 = NULL;
+	char *test_filename                     = NULL;
+	size_t expected_filename_size           = 0;
+	size_t required_sanitized_filename_size = 0;
+	size_t test_filename_length             = 0;
+	int result                              = 0;
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	test_filename          = "t\x00sT!.t^|";
+	test_filename_length   = 9;
+	expected_filename      = "t^x00sT^x21.t^^^x7c";
+	expected_filename_size = 20;
+#else
+	test_filename          = "t\x00sT!.t\\|";
+	test_filename_length   = 9;
+	expected_filename      = "t\\x00sT\\x21.t\\\\\\x7c";
+	expected_filename_size = 20;
+#endif
+
+	result = libcpath_path_get_sanitized_filename_to_buffer(
+	          test_filename,
+	          test_filename_length,
+	          sanitized_filename,
+	          32,
+	          &required_sanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_sanitized_filename_size",
+	 required_sanitized_filename_size,
+	 expected_filename_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          sanitized_filename,
+	          expected_filename,
+	          expected_filename_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test libcpath_path_get_sanitized_filename_to_buffer with a sanitized filename that is too small
+	 */
+	result = libcpath_path_get_sanitized_filename_to_buffer(
+	          test_filename,
+	          test_filename_length,
+	          sanitized_filename,
+	          expected_filename_size - 1,
+	          &required_sanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_sanitized_filename_size",
+	 required_sanitized_filename_size,
+	 expected_filename_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_sanitized_filename_to_buffer(
+	          NULL,
+	          test_filename_length,
+	          sanitized_filename,
+	          32,
+	          &required_sanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_filename_to_buffer(
+	          test_filename,
+	          0,
+	          sanitized_filename,
+	          32,
+	          &required_sanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_filename_to_buffer(
+	          test_filename,
+	          test_filename_length,
+	          NULL,
+	          32,
+	          &required_sanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_filename_to_buffer(
+	          test_filename,
+	          test_filename_length,
+	          sanitized_filename,
+	          (size_t) SSIZE_MAX + 1,
+	          &required_sanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_filename_to_buffer(
+	          test_filename,
+	          test_filename_length,
+	          sanitized_filename,
+	          32,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_sanitized_path function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_sanitized_path(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	char *expected_path        = NULL;
+	char *sanitized_path       = NULL;
+	char *test_path            = NULL;
+	size_t expected_path_size  = 0;
+	size_t sanitized_path_size = 0;
+	size_t test_path_length    = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	/* Test libcpath_path_get_sanitized_path without replacement characters
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	test_path          = "test\\test.txt";
+	test_path_length   = 13;
+	expected_path      = "test\\test.txt";
+	expected_path_size = 14;
+#else
+	test_path          = "test/test.txt";
+	test_path_length   = 13;
+	expected_path      = "test/test.txt";
+	expected_path_size = 14;
+#endif
+
+	result = libcpath_path_get_sanitized_path(
+	          test_path,
+	          test_path_length,
+	          &sanitized_path,
+	          &sanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "sanitized_path",
+	 sanitized_path );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_size",
+	 sanitized_path_size,
+	 expected_path_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          sanitized_path,
+	          expected_path,
+	          expected_path_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 sanitized_path );
+
+	sanitized_path      = NULL;
+	sanitized_path_size = 0;
+
+	/* Test libcpath_path_get_sanitized_path with replacement characters
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	test_path          = "test\\t\x00sT!.t^|";
+	test_path_length   = 14;
+	expected_path      = "test\\t^x00sT^x21.t^^^x7c";
+	expected_path_size = 25;
+#else
+	test_path          = "test/t\x00sT!.t\\|";
+	test_path_length   = 14;
+	expected_path      = "test/t\\x00sT\\x21.t\\\\\\x7c";
+	expected_path_size = 25;
+#endif
+
+	result = libcpath_path_get_sanitized_path(
+	          test_path,
+	          test_path_length,
+	          &sanitized_path,
+	          &sanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "sanitized_path",
+	 sanitized_path );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_size",
+	 sanitized_path_size,
+	 expected_path_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          sanitized_path,
+	          expected_path,
+	          expected_path_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 sanitized_path );
+
+	sanitized_path      = NULL;
+	sanitized_path_size = 0;
+
+	/* Test error cases
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	test_path        = "test\\test.txt";
+	test_path_length = 13;
+#else
+	test_path        = "test/test.txt";
+	test_path_length = 13;
+#endif
+
+	result = libcpath_path_get_sanitized_path(
+	          NULL,
+	          test_path_length,
+	          &sanitized_path,
+	          &sanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_path(
+	          test_path,
+	          (size_t) -1,
+	          &sanitized_path,
+	          &sanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_path(
+	          test_path,
+	          test_path_length,
+	          NULL,
+	          &sanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sanitized_path = (char *) 0x12345678UL;
+
+	result = libcpath_path_get_sanitized_path(
+	          test_path,
+	          test_path_length,
+	          &sanitized_path,
+	          &sanitized_path_size,
+	          &error );
+
+	sanitized_path = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_path(
+	          test_path,
+	          test_path_length,
+	          &sanitized_path,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CPATH_TEST_MEMORY )
+
+	/* Test libcpath_path_get_sanitized_path with malloc failing
+	 */
+	cpath_test_malloc_attempts_before_fail = 0;
+
+	result = libcpath_path_get_sanitized_path(
+	          test_path,
+	          test_path_length,
+	          &sanitized_path,
+	          &sanitized_path_size,
+	          &error );
+
+	if( cpath_test_malloc_attempts_before_fail != -1 )
+	{
+		cpath_test_malloc_attempts_before_fail = -1;
+
+		if( sanitized_path != NULL )
+		{
+			memory_free(
+			 sanitized_path );
+
+			sanitized_path = NULL;
+		}
+	}
+	else
+	{
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "sanitized_path",
+		 sanitized_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "sanitized_path_size",
+		 sanitized_path_size,
+		 (size_t) 0 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( sanitized_path != NULL )
+	{
+		memory_free(
+		 sanitized_path );
+	}
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_sanitized_path_to_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_sanitized_path_to_buffer(
+     void )
+{
+	char sanitized_path[ 32 ];
+
+	libcerror_error_t *error            = NULL;
+	char *expected_path                 = NULL;
+	char *test_path                     = NULL;
+	size_t expected_path_size           = 0;
+	size_t required_sanitized_path_size = 0;
+	size_t test_path_length             = 0;
+	int result                          = 0;
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	test_path          = "test\\t\x00sT!.t^|";
+	test_path_length   = 14;
+	expected_path      = "test\\t^x00sT^x21.t^^^x7c";
+	expected_path_size = 25;
+#else
+	test_path          = "test/t\x00sT!.t\\|";
+	test_path_length   = 14;
+	expected_path      = "test/t\\x00sT\\x21.t\\\\\\x7c";
+	expected_path_size = 25;
+#endif
+
+	result = libcpath_path_get_sanitized_path_to_buffer(
+	          test_path,
+	          test_path_length,
+	          sanitized_path,
+	          32,
+	          &required_sanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_sanitized_path_size",
+	 required_sanitized_path_size,
+	 expected_path_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          sanitized_path,
+	          expected_path,
+	          expected_path_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test libcpath_path_get_sanitized_path_to_buffer with a sanitized path that is too small
+	 */
+	result = libcpath_path_get_sanitized_path_to_buffer(
+	          test_path,
+	          test_path_length,
+	          sanitized_path,
+	          expected_path_size - 1,
+	          &required_sanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_sanitized_path_size",
+	 required_sanitized_path_size,
+	 expected_path_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_sanitized_path_to_buffer(
+	          NULL,
+	          test_path_length,
+	          sanitized_path,
+	          32,
+	          &required_sanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_path_to_buffer(
+	          test_path,
+	          0,
+	          sanitized_path,
+	          32,
+	          &required_sanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_path_to_buffer(
+	          test_path,
+	          test_path_length,
+	          NULL,
+	          32,
+	          &required_sanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_path_to_buffer(
+	          test_path,
+	          test_path_length,
+	          sanitized_path,
+	          (size_t) SSIZE_MAX + 1,
+	          &required_sanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_path_to_buffer(
+	          test_path,
+	          test_path_length,
+	          sanitized_path,
+	          32,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_unsanitized_filename function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_unsanitized_filename(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	char *expected_filename          = NULL;
+	char *sanitized_filename         = NULL;
+	char *unsanitized_filename       = NULL;
+	size_t expected_filename_size    = 0;
+	size_t sanitized_filename_length = 0;
+	size_t unsanitized_filename_size = 0;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	sanitized_filename        = "t^x00sT^x21.t^^^x7c";
+	sanitized_filename_length = 19;
+	expected_filename         = "t\x00sT!.t^|";
+	expected_filename_size    = 10;
+#else
+	sanitized_filename        = "t\\x00sT\\x21.t\\\\\\x7c";
+	sanitized_filename_length = 19;
+	expected_filename         = "t\x00sT!.t\\|";
+	expected_filename_size    = 10;
+#endif
+	result = libcpath_path_get_unsanitized_filename(
+	          sanitized_filename,
+	          sanitized_filename_length,
+	          &unsanitized_filename,
+	          &unsanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "unsanitized_filename",
+	 unsanitized_filename );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "unsanitized_filename_size",
+	 unsanitized_filename_size,
+	 expected_filename_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          unsanitized_filename,
+	          expected_filename,
+	          expected_filename_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 unsanitized_filename );
+
+	unsanitized_filename      = NULL;
+	unsanitized_filename_size = 0;
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_unsanitized_filename(
+	          NULL,
+	          sanitized_filename_length,
+	          &unsanitized_filename,
+	          &unsanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_unsanitized_filename(
+	          sanitized_filename,
+	          0,
+	          &unsanitized_filename,
+	          &unsanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_unsanitized_filename(
+	          sanitized_filename,
+	          (size_t) SSIZE_MAX,
+	          &unsanitized_filename,
+	          &unsanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_unsanitized_filename(
+	          sanitized_filename,
+	          sanitized_filename_length,
+	          NULL,
+	          &unsanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	unsanitized_filename = (char *) 0x12345678UL;
+
+	result = libcpath_path_get_unsanitized_filename(
+	          sanitized_filename,
+	          sanitized_filename_length,
+	          &unsanitized_filename,
+	          &unsanitized_filename_size,
+	          &error );
+
+	unsanitized_filename = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_unsanitized_filename(
+	          sanitized_filename,
+	          sanitized_filename_length,
+	          &unsanitized_filename,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an unsupported escape sequence
+	 */
+	result = libcpath_path_get_unsanitized_filename(
+	          sanitized_filename,
+	          3,
+	          &unsanitized_filename,
+	          &unsanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "unsanitized_filename",
+	 unsanitized_filename );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( unsanitized_filename != NULL )
+	{
+		memory_free(
+		 unsanitized_filename );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_unsanitized_path function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_unsanitized_path(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	char *expected_path          = NULL;
+	char *sanitized_path         = NULL;
+	char *unsanitized_path       = NULL;
+	size_t expected_path_size    = 0;
+	size_t sanitized_path_length = 0;
+	size_t unsanitized_path_size = 0;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	sanitized_path        = "dir\\t^x00sT^x21.t^^^x7c";
+	sanitized_path_length = 23;
+	expected_path         = "dir\\t\x00sT!.t^|";
+	expected_path_size    = 14;
+#else
+	sanitized_path        = "dir/t\\x00sT\\x21.t\\\\\\x7c";
+	sanitized_path_length = 23;
+	expected_path         = "dir/t\x00sT!.t\\|";
+	expected_path_size    = 14;
+#endif
+	result = libcpath_path_get_unsanitized_path(
+	          sanitized_path,
+	          sanitized_path_length,
+	          &unsanitized_path,
+	          &unsanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "unsanitized_path",
+	 unsanitized_path );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "unsanitized_path_size",
+	 unsanitized_path_size,
+	 expected_path_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          unsanitized_path,
+	          expected_path,
+	          expected_path_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 unsanitized_path );
+
+	unsanitized_path      = NULL;
+	unsanitized_path_size = 0;
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_unsanitized_path(
+	          NULL,
+	          sanitized_path_length,
+	          &unsanitized_path,
+	          &unsanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_unsanitized_path(
+	          sanitized_path,
+	          0,
+	          &unsanitized_path,
+	          &unsanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_unsanitized_path(
+	          sanitized_path,
+	          (size_t) SSIZE_MAX,
+	          &unsanitized_path,
+	          &unsanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_unsanitized_path(
+	          sanitized_path,
+	          sanitized_path_length,
+	          NULL,
+	          &unsanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	unsanitized_path = (char *) 0x12345678UL;
+
+	result = libcpath_path_get_unsanitized_path(
+	          sanitized_path,
+	          sanitized_path_length,
+	          &unsanitized_path,
+	          &unsanitized_path_size,
+	          &error );
+
+	unsanitized_path = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_unsanitized_path(
+	          sanitized_path,
+	          sanitized_path_length,
+	          &unsanitized_path,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an unsupported escape sequence
+	 */
+	result = libcpath_path_get_unsanitized_path(
+	          sanitized_path,
+	          7,
+	          &unsanitized_path,
+	          &unsanitized_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "unsanitized_path",
+	 unsanitized_path );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( unsanitized_path != NULL )
+	{
+		memory_free(
+		 unsanitized_path );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_join function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_join(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	const char *expected_path = NULL;
+	const char *test_path1    = NULL;
+	const char *test_path2    = NULL;
+	const char *test_path3    = NULL;
+	const char *test_path4    = NULL;
+	char *path                = NULL;
+	size_t path_size          = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	test_path1    = "\\first\\second";
+	test_path2    = "third\\fourth";
+	test_path3    = "\\first\\second\\";
+	test_path4    = "\\third\\fourth";
+	expected_path = "\\first\\second\\third\\fourth";
+#else
+	test_path1    = "/first/second";
+	test_path2    = "third/fourth";
+	test_path3    = "/first/second/";
+	test_path4    = "/third/fourth";
+	expected_path = "/first/second/third/fourth";
+#endif
+
+	result = libcpath_path_join(
+	          &path,
+	          &path_size,
+	          test_path1,
+	          13,
+	          test_path2,
+	          12,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          path,
+	          expected_path,
+	          26 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 path );
+
+	path = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_size",
+	 path_size,
+	 (size_t) 27 );
+
+	result = libcpath_path_join(
+	          &path,
+	          &path_size,
+	          test_path3,
+	          14,
+	          test_path2,
+	          12,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          path,
+	          expected_path,
+	          26 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 path );
+
+	path = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_size",
+	 path_size,
+	 (size_t) 27 );
+
+	result = libcpath_path_join(
+	          &path,
+	          &path_size,
+	          test_path1,
+	          13,
+	          test_path4,
+	          13,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          path,
+	          expected_path,
+	          26 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 path );
+
+	path = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_size",
+	 path_size,
+	 (size_t) 27 );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_join(
+	          NULL,
+	          &path_size,
+	          test_path1,
+	          13,
+	          test_path2,
+	          12,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	path = (char *) 0x12345678UL;
+
+	result = libcpath_path_join(
+	          &path,
+	          &path_size,
+	          test_path1,
+	          13,
+	          test_path2,
+	          12,
+	          &error );
+
+	path = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join(
+	          &path,
+	          NULL,
+	          test_path1,
+	          13,
+	          test_path2,
+	          12,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join(
+	          &path,
+	          &path_size,
+	          NULL,
+	          13,
+	          test_path2,
+	          12,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join(
+	          &path,
+	          &path_size,
+	          test_path1,
+	          (size_t) SSIZE_MAX + 1,
+	          test_path2,
+	          12,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join(
+	          &path,
+	          &path_size,
+	          test_path1,
+	          13,
+	          NULL,
+	          12,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join(
+	          &path,
+	          &path_size,
+	          test_path1,
+	          13,
+	          test_path2,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_join_to_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_join_to_buffer(
+     void )
+{
+	char path[ 32 ];
+
+	libcerror_error_t *error  = NULL;
+	const char *expected_path = NULL;
+	const char *test_path1    = NULL;
+	const char *test_path2    = NULL;
+	size_t required_path_size = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	test_path1    = "\\first\\second\\";
+	test_path2    = "\\third\\fourth";
+	expected_path = "\\first\\second\\third\\fourth";
+#else
+	test_path1    = "/first/second/";
+	test_path2    = "/third/fourth";
+	expected_path = "/first/second/third/fourth";
+#endif
+
+	result = libcpath_path_join_to_buffer(
+	          path,
+	          32,
+	          &required_path_size,
+	          test_path1,
+	          14,
+	          test_path2,
+	          13,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_path_size",
+	 required_path_size,
+	 (size_t) 27 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          path,
+	          expected_path,
+	          27 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test libcpath_path_join_to_buffer with a path that is too small
+	 */
+	result = libcpath_path_join_to_buffer(
+	          path,
+	          26,
+	          &required_path_size,
+	          test_path1,
+	          14,
+	          test_path2,
+	          13,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_path_size",
+	 required_path_size,
+	 (size_t) 27 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_join_to_buffer(
+	          NULL,
+	          32,
+	          &required_path_size,
+	          test_path1,
+	          14,
+	          test_path2,
+	          13,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_to_buffer(
+	          path,
+	          (size_t) SSIZE_MAX + 1,
+	          &required_path_size,
+	          test_path1,
+	          14,
+	          test_path2,
+	          13,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_to_buffer(
+	          path,
+	          32,
+	          NULL,
+	          test_path1,
+	          14,
+	          test_path2,
+	          13,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_to_buffer(
+	          path,
+	          32,
+	          &required_path_size,
+	          NULL,
+	          14,
+	          test_path2,
+	          13,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_to_buffer(
+	          path,
+	          32,
+	          &required_path_size,
+	          test_path1,
+	          (size_t) SSIZE_MAX + 1,
+	          test_path2,
+	          13,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_to_buffer(
+	          path,
+	          32,
+	          &required_path_size,
+	          test_path1,
+	          14,
+	          NULL,
+	          13,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_to_buffer(
+	          path,
+	          32,
+	          &required_path_size,
+	          test_path1,
+	          14,
+	          test_path2,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_join_normalized function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_join_normalized(
+     void )
+{
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	char *directory_names[ 7 ] = {
+		"C:\\home\\\\user\\.\\", "C:\\", "home\\user", "home", "\\\\server\\share", "", "" };
+	char *filenames[ 7 ] = {
+		"..\\other\\.\\file.txt", "..\\..\\file.txt", "..\\..\\..\\file.txt", "..", "dir\\..\\file.txt", ".", "file.txt" };
+	char *expected_paths[ 7 ] = {
+		"C:\\home\\other\\file.txt", "C:\\file.txt", "..\\file.txt", ".", "\\\\server\\share\\file.txt", ".", "file.txt" };
+#else
+	char *directory_names[ 7 ] = {
+		"/home//user/./", "/", "home/user", "home", "//home", "", "" };
+	char *filenames[ 7 ] = {
+		"../other/./file.txt", "../../file.txt", "../../../file.txt", "..", "dir/../file.txt", ".", "file.txt" };
+	char *expected_paths[ 7 ] = {
+		"/home/other/file.txt", "/file.txt", "../file.txt", ".", "/home/file.txt", ".", "file.txt" };
+#endif
+
+	libcerror_error_t *error     = NULL;
+	char *path                   = NULL;
+	size_t directory_name_length = 0;
+	size_t expected_path_length  = 0;
+	size_t filename_length       = 0;
+	size_t path_size             = 0;
+	int result                   = 0;
+	int test_index               = 0;
+
+	/* Test regular cases
+	 */
+	for( test_index = 0;
+	     test_index < 7;
+	     test_index++ )
+	{
+		directory_name_length = narrow_string_length(
+		                         directory_names[ test_index ] );
+
+		filename_length = narrow_string_length(
+		                   filenames[ test_index ] );
+
+		expected_path_length = narrow_string_length(
+		                        expected_paths[ test_index ] );
+
+		result = libcpath_path_join_normalized(
+		          &path,
+		          &path_size,
+		          directory_names[ test_index ],
+		          directory_name_length,
+		          filenames[ test_index ],
+		          filename_length,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "path",
+		 path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "path_size",
+		 path_size,
+		 expected_path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = narrow_string_compare(
+		          path,
+		          expected_paths[ test_index ],
+		          path_size );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		memory_free(
+		 path );
+
+		path = NULL;
+	}
+	/* Test error cases
+	 */
+	directory_name_length = narrow_string_length(
+	                         directory_names[ 0 ] );
+
+	filename_length = narrow_string_length(
+	                   filenames[ 0 ] );
+
+	result = libcpath_path_join_normalized(
+	          NULL,
+	          &path_size,
+	          directory_names[ 0 ],
+	          directory_name_length,
+	          filenames[ 0 ],
+	          filename_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	path = (char *) 0x12345678UL;
+
+	result = libcpath_path_join_normalized(
+	          &path,
+	          &path_size,
+	          directory_names[ 0 ],
+	          directory_name_length,
+	          filenames[ 0 ],
+	          filename_length,
+	          &error );
+
+	path = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_normalized(
+	          &path,
+	          NULL,
+	          directory_names[ 0 ],
+	          directory_name_length,
+	          filenames[ 0 ],
+	          filename_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_normalized(
+	          &path,
+	          &path_size,
+	          NULL,
+	          directory_name_length,
+	          filenames[ 0 ],
+	          filename_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_normalized(
+	          &path,
+	          &path_size,
+	          directory_names[ 0 ],
+	          (size_t) SSIZE_MAX + 1,
+	          filenames[ 0 ],
+	          filename_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_normalized(
+	          &path,
+	          &path_size,
+	          directory_names[ 0 ],
+	          directory_name_length,
+	          NULL,
+	          filename_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_normalized(
+	          &path,
+	          &path_size,
+	          directory_names[ 0 ],
+	          directory_name_length,
+	          filenames[ 0 ],
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_normalized(
+	          &path,
+	          &path_size,
+	          directory_names[ 0 ],
+	          (size_t) SSIZE_MAX,
+	          filenames[ 0 ],
+	          filename_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_relative_path function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_relative_path(
+     void )
+{
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	char *from_paths[ 7 ] = {
+		"C:\\home\\user\\export", "C:\\home\\user\\export", "C:\\home\\user", "C:\\home\\user\\export", "C:\\home\\user", "C:\\home\\\\user\\.\\docs\\..", "C:\\" };
+	char *to_paths[ 7 ] = {
+		"C:\\home\\user\\export\\dir\\file.txt", "C:\\home\\user\\other\\file.txt", "C:\\home\\user", "C:\\home", "C:\\home\\username\\file.txt", "C:\\home\\user\\file.txt", "C:\\home\\file.txt" };
+	char *expected_paths[ 7 ] = {
+		"dir\\file.txt", "..\\other\\file.txt", ".", "..\\..", "..\\username\\file.txt", "file.txt", "home\\file.txt" };
+#else
+	char *from_paths[ 7 ] = {
+		"/home/user/export", "/home/user/export", "/home/user", "/home/user/export", "/home/user", "/home//user/./docs/..", "/" };
+	char *to_paths[ 7 ] = {
+		"/home/user/export/dir/file.txt", "/home/user/other/file.txt", "/home/user", "/home", "/home/username/file.txt", "/home/user/file.txt", "/home/file.txt" };
+	char *expected_paths[ 7 ] = {
+		"dir/file.txt", "../other/file.txt", ".", "../..", "../username/file.txt", "file.txt", "home/file.txt" };
+#endif
+
+	libcerror_error_t *error    = NULL;
+	char *relative_path         = NULL;
+	size_t expected_path_length = 0;
+	size_t from_path_length     = 0;
+	size_t relative_path_size   = 0;
+	size_t to_path_length       = 0;
+	int result                  = 0;
+	int test_index              = 0;
+
+	/* Test regular cases
+	 */
+	for( test_index = 0;
+	     test_index < 7;
+	     test_index++ )
+	{
+		from_path_length = narrow_string_length(
+		                    from_paths[ test_index ] );
+
+		to_path_length = narrow_string_length(
+		                  to_paths[ test_index ] );
+
+		expected_path_length = narrow_string_length(
+		                        expected_paths[ test_index ] );
+
+		result = libcpath_path_get_relative_path(
+		          from_paths[ test_index ],
+		          from_path_length,
+		          to_paths[ test_index ],
+		          to_path_length,
+		          &relative_path,
+		          &relative_path_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "relative_path",
+		 relative_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "relative_path_size",
+		 relative_path_size,
+		 expected_path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = narrow_string_compare(
+		          relative_path,
+		          expected_paths[ test_index ],
+		          relative_path_size );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		memory_free(
+		 relative_path );
+
+		relative_path = NULL;
+	}
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	/* Test paths on different volumes
+	 */
+	result = libcpath_path_get_relative_path(
+	          "C:\\home",
+	          7,
+	          "D:\\home",
+	          7,
+	          &relative_path,
+	          &relative_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "relative_path",
+	 relative_path );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( WINAPI ) || defined( __MINGW32__ ) */
+
+	/* Test error cases
+	 */
+	from_path_length = narrow_string_length(
+	                    from_paths[ 0 ] );
+
+	to_path_length = narrow_string_length(
+	                  to_paths[ 0 ] );
+
+	result = libcpath_path_get_relative_path(
+	          from_paths[ 0 ],
+	          from_path_length,
+	          to_paths[ 0 ],
+	          to_path_length,
+	          NULL,
+	          &relative_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	relative_path = (char *) 0x12345678UL;
+
+	result = libcpath_path_get_relative_path(
+	          from_paths[ 0 ],
+	          from_path_length,
+	          to_paths[ 0 ],
+	          to_path_length,
+	          &relative_path,
+	          &relative_path_size,
+	          &error );
+
+	relative_path = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_relative_path(
+	          from_paths[ 0 ],
+	          from_path_length,
+	          to_paths[ 0 ],
+	          to_path_length,
+	          &relative_path,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_relative_path(
+	          NULL,
+	          from_path_length,
+	          to_paths[ 0 ],
+	          to_path_length,
+	          &relative_path,
+	          &relative_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_relative_path(
+	          from_paths[ 0 ],
+	          from_path_length,
+	          NULL,
+	          to_path_length,
+	          &relative_path,
+	          &relative_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( relative_path != NULL )
+	{
+		memory_free(
+		 relative_path );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_first_segment function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_first_segment(
+     void )
+{
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	char *path = "\\\\home\\user";
+#else
+	char *path = "//home/user";
+#endif
+
+	libcerror_error_t *error = NULL;
+	const char *segment      = NULL;
+	size_t path_index        = 0;
+	size_t path_length       = 0;
+	size_t segment_length    = 0;
+	int result               = 0;
+
+	path_length = narrow_string_length(
+	               path );
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_first_segment(
+	          path,
+	          path_length,
+	          &path_index,
+	          &segment,
+	          &segment_length,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_index",
+	 path_index,
+	 (size_t) 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "segment_length",
+	 segment_length,
+	 (size_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_first_segment(
+	          path,
+	          path_length,
+	          &path_index,
+	          &segment,
+	          &segment_length,
+	          LIBCPATH_SEGMENT_FLAG_SKIP_EMPTY,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_index",
+	 path_index,
+	 (size_t) 7 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "segment_length",
+	 segment_length,
+	 (size_t) 4 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          segment,
+	          "home",
+	          4 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_INTPTR(
+	 "segment",
+	 (intptr_t) segment,
+	 (intptr_t) &( path[ 2 ] ) );
+
+	/* Test a path without segments
+	 */
+	result = libcpath_path_get_first_segment(
+	          path,
+	          2,
+	          &path_index,
+	          &segment,
+	          &segment_length,
+	          LIBCPATH_SEGMENT_FLAG_SKIP_EMPTY,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_first_segment(
+	          path,
+	          path_length,
+	          NULL,
+	          &segment,
+	          &segment_length,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_first_segment(
+	          NULL,
+	          path_length,
+	          &path_index,
+	          &segment,
+	          &segment_length,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_next_segment function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_next_segment(
+     void )
+{
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	char *path = "\\home\\\\user\\.\\file.txt";
+#else
+	char *path = "/home//user/./file.txt";
+#endif
+	char *expected_segments[ 6 ] = {
+		"", "home", "", "user", ".", "file.txt" };
+	char *expected_skipped_segments[ 3 ] = {
+		"home", "user", "file.txt" };
+
+	libcerror_error_t *error       = NULL;
+	const char *segment            = NULL;
+	size_t expected_segment_length = 0;
+	size_t path_index              = 0;
+	size_t path_length             = 0;
+	size_t segment_length          = 0;
+	int result                     = 0;
+	int segment_index              = 0;
+
+	path_length = narrow_string_length(
+	               path );
+
+	/* Test regular cases
+	 */
+	path_index    = 0;
+	segment_index = 0;
+
+	do
+	{
+		result = libcpath_path_get_next_segment(
+		          path,
+		          path_length,
+		          &path_index,
+		          &segment,
+		          &segment_length,
+		          0,
+		          &error );
+
+		CPATH_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 0 )
+		{
+			break;
+		}
+		CPATH_TEST_ASSERT_LESS_THAN_INT(
+		 "segment_index",
+		 segment_index,
+		 6 );
+
+		expected_segment_length = narrow_string_length(
+		                           expected_segments[ segment_index ] );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "segment_length",
+		 segment_length,
+		 expected_segment_length );
+
+		result = narrow_string_compare(
+		          segment,
+		          expected_segments[ segment_index ],
+		          segment_length );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		segment_index++;
+	}
+	while( result == 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "segment_index",
+	 segment_index,
+	 6 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_index",
+	 path_index,
+	 path_length + 1 );
+
+	path_index    = 0;
+	segment_index = 0;
+
+	do
+	{
+		result = libcpath_path_get_next_segment(
+		          path,
+		          path_length,
+		          &path_index,
+		          &segment,
+		          &segment_length,
+		          LIBCPATH_SEGMENT_FLAG_SKIP_EMPTY | LIBCPATH_SEGMENT_FLAG_SKIP_CURRENT,
+		          &error );
+
+		CPATH_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 0 )
+		{
+			break;
+		}
+		CPATH_TEST_ASSERT_LESS_THAN_INT(
+		 "segment_index",
+		 segment_index,
+		 3 );
+
+		expected_segment_length = narrow_string_length(
+		                           expected_skipped_segments[ segment_index ] );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "segment_length",
+		 segment_length,
+		 expected_segment_length );
+
+		result = narrow_string_compare(
+		          segment,
+		          expected_skipped_segments[ segment_index ],
+		          segment_length );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		segment_index++;
+	}
+	while( result == 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "segment_index",
+	 segment_index,
+	 3 );
+
+	/* Test error cases
+	 */
+	path_index = 0;
+
+	result = libcpath_path_get_next_segment(
+	          NULL,
+	          path_length,
+	          &path_index,
+	          &segment,
+	          &segment_length,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_next_segment(
+	          path,
+	          (size_t) SSIZE_MAX,
+	          &path_index,
+	          &segment,
+	          &segment_length,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_next_segment(
+	          path,
+	          path_length,
+	          NULL,
+	          &segment,
+	          &segment_length,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_next_segment(
+	          path,
+	          path_length,
+	          &path_index,
+	          NULL,
+	          &segment_length,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_next_segment(
+	          path,
+	          path_length,
+	          &path_index,
+	          &segment,
+	          NULL,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_next_segment(
+	          path,
+	          path_length,
+	          &path_index,
+	          &segment,
+	          &segment_length,
+	          0xff,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_parse_windows_path function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_parse_windows_path(
+     void )
+{
+	char *paths[ 11 ] = {
+		"C:\\dir\\file.txt", "C:file.txt", "\\dir\\file.txt", "dir\\file.txt",
+		"\\\\server\\share\\dir", "\\\\server", "\\\\.\\PhysicalDrive0", "\\\\.\\C:\\dir",
+		"\\\\?\\C:\\dir", "\\\\?\\GLOBALROOT\\dir", "\\\\?\\UNC\\server\\share\\dir" };
+	uint8_t expected_path_types[ 11 ] = {
+		LIBCPATH_WINDOWS_PATH_TYPE_ABSOLUTE, LIBCPATH_WINDOWS_PATH_TYPE_RELATIVE,
+		LIBCPATH_WINDOWS_PATH_TYPE_ABSOLUTE, LIBCPATH_WINDOWS_PATH_TYPE_RELATIVE,
+		LIBCPATH_WINDOWS_PATH_TYPE_UNC, LIBCPATH_WINDOWS_PATH_TYPE_UNC,
+		LIBCPATH_WINDOWS_PATH_TYPE_DEVICE, LIBCPATH_WINDOWS_PATH_TYPE_DEVICE,
+		LIBCPATH_WINDOWS_PATH_TYPE_EXTENDED_LENGTH, LIBCPATH_WINDOWS_PATH_TYPE_EXTENDED_LENGTH,
+		LIBCPATH_WINDOWS_PATH_TYPE_EXTENDED_LENGTH_UNC };
+	size_t expected_volume_name_indexes[ 11 ] = {
+		0, 0, 0, 0, 2, 2, 4, 4, 4, 4, 8 };
+	size_t expected_volume_name_lengths[ 11 ] = {
+		2, 2, 0, 0, 12, 6, 14, 2, 2, 10, 12 };
+	size_t expected_directory_name_indexes[ 11 ] = {
+		3, 2, 0, 0, 15, 8, 18, 7, 7, 15, 21 };
+
+	libcerror_error_t *error    = NULL;
+	size_t directory_name_index = 0;
+	size_t path_length          = 0;
+	size_t volume_name_index    = 0;
+	size_t volume_name_length   = 0;
+	uint8_t path_type           = 0;
+	int path_index              = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	for( path_index = 0;
+	     path_index < 11;
+	     path_index++ )
+	{
+		path_length = narrow_string_length(
+		               paths[ path_index ] );
+
+		result = libcpath_path_parse_windows_path(
+		          paths[ path_index ],
+		          path_length,
+		          &path_type,
+		          &volume_name_index,
+		          &volume_name_length,
+		          &directory_name_index,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		CPATH_TEST_ASSERT_EQUAL_UINT8(
+		 "path_type",
+		 path_type,
+		 expected_path_types[ path_index ] );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "volume_name_index",
+		 volume_name_index,
+		 expected_volume_name_indexes[ path_index ] );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "volume_name_length",
+		 volume_name_length,
+		 expected_volume_name_lengths[ path_index ] );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "directory_name_index",
+		 directory_name_index,
+		 expected_directory_name_indexes[ path_index ] );
+	}
+	/* Test error cases
+	 */
+	path_length = narrow_string_length(
+	               paths[ 0 ] );
+
+	result = libcpath_path_parse_windows_path(
+	          NULL,
+	          path_length,
+	          &path_type,
+	          &volume_name_index,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_parse_windows_path(
+	          paths[ 0 ],
+	          0,
+	          &path_type,
+	          &volume_name_index,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_parse_windows_path(
+	          paths[ 0 ],
+	          (size_t) SSIZE_MAX,
+	          &path_type,
+	          &volume_name_index,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_parse_windows_path(
+	          paths[ 0 ],
+	          path_length,
+	          NULL,
+	          &volume_name_index,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_parse_windows_path(
+	          paths[ 0 ],
+	          path_length,
+	          &path_type,
+	          NULL,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_parse_windows_path(
+	          paths[ 0 ],
+	          path_length,
+	          &path_type,
+	          &volume_name_index,
+	          NULL,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_parse_windows_path(
+	          paths[ 0 ],
+	          path_length,
+	          &path_type,
+	          &volume_name_index,
+	          &volume_name_length,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
+
+/* Tests the libcpath_CreateDirectoryA function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_CreateDirectoryA(
+     void )
+{
+	BOOL result = FALSE;
+
+	/* Test regular cases
+	 */
+
+	/* Test error cases
+	 */
+	result = libcpath_CreateDirectoryA(
+	          NULL,
+	          NULL );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 FALSE );
+
+	result = libcpath_CreateDirectoryA(
+	          ".",
+	          NULL );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 FALSE );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+
+/* Tests the libcpath_path_make_directory function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_make_directory(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+
+	/* Test error cases
+	 */
+	result = libcpath_path_make_directory(
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_make_directory_with_error_code function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_make_directory_with_error_code(
+     void )
+{
+#if defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY )
+	char filename[ 512 ];
+	char temporary_directory_name[ 256 ];
+#endif
+	libcerror_error_t *error = NULL;
+	uint32_t error_code      = 0;
+	int result               = 0;
+
+#if defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY )
+	filename[ 0 ]                 = 0;
+	temporary_directory_name[ 0 ] = 0;
+#endif
+
+	/* Test that a directory that already exists is reported without an error
+	 */
+	result = libcpath_path_make_directory_with_error_code(
+	          ".",
+	          &error_code,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_NOT_EQUAL_UINT32(
+	 "error_code",
+	 error_code,
+	 (uint32_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY )
+	/* Test that a regular file with the same name is reported as an error
+	 */
+	result = cpath_test_make_temporary_directory(
+	          temporary_directory_name,
+	          256 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = cpath_test_join_path(
+	          filename,
+	          512,
+	          temporary_directory_name,
+	          "file" );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = cpath_test_make_file(
+	          filename );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcpath_path_make_directory_with_error_code(
+	          filename,
+	          &error_code,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_NOT_EQUAL_UINT32(
+	 "error_code",
+	 error_code,
+	 (uint32_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = cpath_test_remove_file(
+	          filename );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	filename[ 0 ] = 0;
+
+	result = cpath_test_remove_directories(
+	          temporary_directory_name,
+	          "" );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	temporary_directory_name[ 0 ] = 0;
+
+#endif /* defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY ) */
+
+	/* Test error cases
+	 */
+	result = libcpath_path_make_directory_with_error_code(
+	          NULL,
+	          &error_code,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_make_directory_with_error_code(
+	          ".",
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY )
+	if( filename[ 0 ] != 0 )
+	{
+		cpath_test_remove_file(
+		 filename );
+	}
+	if( temporary_directory_name[ 0 ] != 0 )
+	{
+		cpath_test_remove_directories(
+		 temporary_directory_name,
+		 "" );
+	}
+#endif
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
+
+/* Tests the libcpath_path_make_directory_component function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_make_directory_component(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_make_directory_component(
+	          ".",
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_make_directory_component(
+	          NULL,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
+
+/* Tests the libcpath_path_make_directories function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_make_directories(
+     void )
+{
+#if defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY )
+	char nested_directory_name[ 6 ] = {
+		'a', (char) LIBCPATH_SEPARATOR, 'b', (char) LIBCPATH_SEPARATOR, 'c', 0 };
+	char file_directory_name[ 7 ] = {
+		'f', 'i', 'l', 'e', (char) LIBCPATH_SEPARATOR, 'd', 0 };
+
+	char directory_name[ 512 ];
+	char filename[ 512 ];
+	char temporary_directory_name[ 256 ];
+
+	size_t directory_name_length = 0;
+#endif
+	libcerror_error_t *error     = NULL;
+	int result                   = 0;
+
+#if defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY )
+	filename[ 0 ]                 = 0;
+	temporary_directory_name[ 0 ] = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_make_directories(
+	          ".",
+	          1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY )
+	/* Test that a nested directory tree is made
+	 */
+	result = cpath_test_make_temporary_directory(
+	          temporary_directory_name,
+	          256 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = cpath_test_join_path(
+	          directory_name,
+	          512,
+	          temporary_directory_name,
+	          nested_directory_name );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	directory_name_length = narrow_string_length(
+	                         directory_name );
+
+	result = libcpath_path_make_directories(
+	          directory_name,
+	          directory_name_length,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = cpath_test_directory_exists(
+	          directory_name );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test that an existing directory tree is not considered an error
+	 */
+	result = libcpath_path_make_directories(
+	          directory_name,
+	          directory_name_length,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a directory tree is not made through a regular file
+	 */
+	result = cpath_test_join_path(
+	          filename,
+	          512,
+	          temporary_directory_name,
+	          "file" );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = cpath_test_make_file(
+	          filename );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = cpath_test_join_path(
+	          directory_name,
+	          512,
+	          temporary_directory_name,
+	          file_directory_name );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	directory_name_length = narrow_string_length(
+	                         directory_name );
+
+	result = libcpath_path_make_directories(
+	          directory_name,
+	          directory_name_length,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = cpath_test_remove_file(
+	          filename );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	filename[ 0 ] = 0;
+
+	result = cpath_test_remove_directories(
+	          temporary_directory_name,
+	          nested_directory_name );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = cpath_test_directory_exists(
+	          temporary_directory_name );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	temporary_directory_name[ 0 ] = 0;
+
+#endif /* defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY ) */
+
+	/* Test error cases
+	 */
+	result = libcpath_path_make_directories(
+	          NULL,
+	          1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_make_directories(
+	          ".",
+	          0,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_make_directories(
+	          ".",
+	          (size_t) SSIZE_MAX + 1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+#if defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY )
+	if( filename[ 0 ] != 0 )
+	{
+		cpath_test_remove_file(
+		 filename );
+	}
+	if( temporary_directory_name[ 0 ] != 0 )
+	{
+		cpath_test_remove_directories(
+		 temporary_directory_name,
+		 nested_directory_name );
+	}
+#endif
+	return( 0 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
+
+/* Tests the libcpath_SetCurrentDirectoryW function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_SetCurrentDirectoryW(
+     void )
+{
+	BOOL result = FALSE;
+
+	/* Test regular cases
+	 */
+	result = libcpath_SetCurrentDirectoryW(
+	          L"." );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 TRUE );
+
+	/* Test error cases
+	 */
+	result = libcpath_SetCurrentDirectoryW(
+	          NULL );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 FALSE );
+
+	result = libcpath_SetCurrentDirectoryW(
+	          L"bogus" );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 FALSE );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+
+/* Tests the libcpath_path_change_directory_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_change_directory_wide(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI ) && defined( __CYGWIN__)
+
+	libcpath_path_change_directory_wide(
+	 L".",
+	 &error );
+
+	/* Note that on Cygwin SetCurrentDirectoryW can return path too long.
+	 */
+	if( *error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+#else
+	result = libcpath_path_change_directory_wide(
+	          L".",
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( WINAPI ) && defined( __CYGWIN__) */
+
+
+	/* Test error cases
+	 */
+	result = libcpath_path_change_directory_wide(
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_change_directory_wide_with_error_code function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_change_directory_wide_with_error_code(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t error_code      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_change_directory_wide_with_error_code(
+	          L".",
+	          &error_code,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_UINT32(
+	 "error_code",
+	 error_code,
+	 (uint32_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a directory that does not exist is reported without an error
+	 */
+	result = libcpath_path_change_directory_wide_with_error_code(
+	          L"cpath_test_missing_directory",
+	          &error_code,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_NOT_EQUAL_UINT32(
+	 "error_code",
+	 error_code,
+	 (uint32_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_change_directory_wide_with_error_code(
+	          NULL,
+	          &error_code,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_change_directory_wide_with_error_code(
+	          L".",
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
+
+/* Tests the libcpath_GetCurrentDirectoryW function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_GetCurrentDirectoryW(
+     void )
+{
+	wchar_t buffer[ 256 ];
+
+	DWORD result = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_GetCurrentDirectoryW(
+	          256,
+	          buffer );
+
+	CPATH_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_GetCurrentDirectoryW(
+	          0,
+	          NULL );
+
+	CPATH_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+
+/* Tests the libcpath_path_get_current_working_directory_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_current_working_directory_wide(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	wchar_t *current_working_directory    = NULL;
+	size_t current_working_directory_size = 0;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_current_working_directory_wide(
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "current_working_directory",
+	 current_working_directory );
+
+	memory_free(
+	 current_working_directory );
+
+	current_working_directory = NULL;
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_current_working_directory_wide(
+	          NULL,
+	          &current_working_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	current_working_directory = (wchar_t *) 0x12345678UL;
+
+	result = libcpath_path_get_current_working_directory_wide(
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	current_working_directory = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_current_working_directory_wide(
+	          &current_working_directory,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CPATH_TEST_MEMORY )
+
+	/* Test libcpath_path_get_current_working_directory_wide with malloc failing
+	 */
+	cpath_test_malloc_attempts_before_fail = 0;
+
+	result = libcpath_path_get_current_working_directory_wide(
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	if( cpath_test_malloc_attempts_before_fail != -1 )
+	{
+		cpath_test_malloc_attempts_before_fail = -1;
+
+		if( current_working_directory != NULL )
+		{
+			memory_free(
+			 current_working_directory );
+
+			current_working_directory = NULL;
+		}
+	}
+	else
+	{
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "current_working_directory",
+		 current_working_directory );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Test libcpath_path_get_current_working_directory_wide with memset failing
+	 */
+	cpath_test_memset_attempts_before_fail = 0;
+
+	result = libcpath_path_get_current_working_directory_wide(
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	if( cpath_test_memset_attempts_before_fail != -1 )
+	{
+		cpath_test_memset_attempts_before_fail = -1;
+
+		if( current_working_directory != NULL )
+		{
+			memory_free(
+			 current_working_directory );
+
+			current_working_directory = NULL;
+		}
+	}
+	else
+	{
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "current_working_directory",
+		 current_working_directory );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( current_working_directory != NULL )
+	{
+		memory_free(
+		 current_working_directory );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
+
+/* Tests the libcpath_path_get_cached_current_working_directory_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_cached_current_working_directory_wide(
+     void )
+{
+	const wchar_t *cached_current_working_directory = NULL;
+	const wchar_t *current_working_directory        = NULL;
+	libcerror_error_t *error                        = NULL;
+	size_t cached_current_working_directory_length  = 0;
+	size_t current_working_directory_length         = 0;
+	int result                                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_cached_current_working_directory_wide(
+	          &current_working_directory,
+	          &current_working_directory_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "current_working_directory",
+	 current_working_directory );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_enable_current_working_directory_cache(
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_cached_current_working_directory_wide(
+	          &current_working_directory,
+	          &current_working_directory_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "current_working_directory",
+	 current_working_directory );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "current_working_directory_length",
+	 current_working_directory_length,
+	 wide_string_length( current_working_directory ) );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the cached value is reused
+	 */
+	result = libcpath_path_get_cached_current_working_directory_wide(
+	          &cached_current_working_directory,
+	          &cached_current_working_directory_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "cached_current_working_directory",
+	 (int) ( cached_current_working_directory == current_working_directory ),
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "cached_current_working_directory_length",
+	 cached_current_working_directory_length,
+	 current_working_directory_length );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_cached_current_working_directory_wide(
+	          NULL,
+	          &current_working_directory_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_cached_current_working_directory_wide(
+	          &current_working_directory,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcpath_path_disable_current_working_directory_cache(
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libcpath_path_disable_current_working_directory_cache(
+	 NULL );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI )
+
+/* Tests the libcpath_path_get_path_type_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_path_type_wide(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t path_type        = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_path_type_wide(
+	          L".",
+	          1,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_RELATIVE );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L"\\",
+	          1,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_ABSOLUTE );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L"c:",
+	          2,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_RELATIVE );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L"C:\\Windows",
+	          10,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_ABSOLUTE );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L"\\\\server\\share\\directory",
+	          24,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_UNC );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L"\\\\?\\Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}",
+	          48,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_EXTENDED_LENGTH );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L"\\\\.\\PhysicalDrive0",
+	          18,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_DEVICE );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L"\\\\.\\C:",
+	          6,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_DEVICE );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L"\\\\.\\C:\\",
+	          7,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_DEVICE );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L"\\\\?\\C:\\Windows",
+	          14,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_EXTENDED_LENGTH );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L"\\\\?\\UNC\\server\\share\\directory",
+	          30,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "path_type",
+	 path_type,
+	 LIBCPATH_TYPE_EXTENDED_LENGTH_UNC );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_path_type_wide(
+	          NULL,
+	          1,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L".",
+	          0,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L".",
+	          (size_t) SSIZE_MAX + 1,
+	          &path_type,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_path_type_wide(
+	          L".",
+	          1,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_volume_name_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_volume_name_wide(
+     void )
+{
+	libcerror_error_t *error    = NULL;
+	wchar_t *volume_name        = NULL;
+	size_t directory_name_index = 0;
+	size_t volume_name_length   = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_volume_name_wide(
+	          L".",
+	          1,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L"\\",
+	          1,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 (size_t) 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 (size_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L"c:",
+	          2,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          volume_name,
+	          L"c:",
+	          2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L"C:\\Windows",
+	          10,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 (size_t) 3 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          volume_name,
+	          L"C:",
+	          2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L"\\\\server\\share\\directory",
+	          24,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 (size_t) 12 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 (size_t) 15 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          volume_name,
+	          L"server\\share",
+	          12 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L"\\\\?\\Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}",
+	          48,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 44 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 48 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          volume_name,
+	          L"Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}",
+	          44 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L"\\\\.\\PhysicalDrive0",
+	          18,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 14 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 18 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          volume_name,
+	          L"PhysicalDrive0",
+	          14 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L"\\\\.\\C:",
+	          6,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 2 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 6 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          volume_name,
+	          L"C:",
+	          2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L"\\\\.\\C:\\",
+	          7,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 2 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 7 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          volume_name,
+	          L"C:",
+	          2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L"\\\\?\\C:\\Windows",
+	          14,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 2 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 7 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          volume_name,
+	          L"C:",
+	          2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L"\\\\?\\UNC\\server\\share\\directory",
+	          30,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "volume_name",
+	 volume_name );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "volume_name_length",
+	 volume_name_length,
+	 12 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "directory_name_index",
+	 directory_name_index,
+	 21 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          volume_name,
+	          L"server\\share",
+	          12 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_volume_name_wide(
+	          NULL,
+	          1,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L".",
+	          0,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L".",
+	          (size_t) SSIZE_MAX + 1,
+	          &volume_name,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L".",
+	          1,
+	          NULL,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L".",
+	          1,
+	          &volume_name,
+	          NULL,
+	          &directory_name_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_volume_name_wide(
+	          L".",
+	          1,
+	          &volume_name,
+	          &volume_name_length,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_current_working_directory_by_volume_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_current_working_directory_by_volume_wide(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	wchar_t *current_working_directory    = NULL;
+	size_t current_working_directory_size = 0;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_current_working_directory_by_volume_wide(
+	          L"C:",
+	          2,
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_current_working_directory_by_volume_wide(
+	          L"C:",
+	          (size_t) SSIZE_MAX + 1,
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_current_working_directory_by_volume_wide(
+	          L"C:",
+	          2,
+	          NULL,
+	          &current_working_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_current_working_directory_by_volume_wide(
+	          L"C:",
+	          2,
+	          &current_working_directory,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) */
+
+/* Tests the libcpath_path_get_full_path_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_full_path_wide(
+     void )
+{
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	wchar_t *absolute_paths[] = {
+		L"\\home\\user\\test.txt",
+		L"c:\\home\\user\\test.txt",
+		L"c:\\home\\user\\\\test.txt",
+		L"c:\\home\\username\\..\\user\\test.txt",
+		L"c:\\..\\home\\user\\test.txt",
+		L"c:\\..\\home\\username\\..\\user\\test.txt",
+	};
+	wchar_t *relative_paths[] = {
+		L"user\\test.txt",
+		L"username\\..\\user\\test.txt",
+	};
+#if defined( WINAPI )
+	wchar_t *special_paths[] = {
+		L"\\\\.\\PhysicalDrive0",
+		L"\\\\?\\Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}"
+	};
+	wchar_t *unc_paths[] = {
+		L"\\\\172.0.0.1\\C$\\test.txt",
+		L"\\\\?\\UNC\\172.0.0.1\\C$\\test.txt",
+	};
+#endif /* defined( WINAPI ) */
+#else
+	wchar_t *absolute_paths[] = {
+		L"/home/user/test.txt",
+		L"/home/user//test.txt",
+		L"/../home/user/test.txt",
+		L"/../home/username/../user/test.txt",
+		L"/home/./user/test.txt",
+		L"/home/user/../../../home/user/test.txt",
+	};
+	wchar_t *relative_paths[] = {
+		L"user/test.txt",
+		L"username/../user/test.txt",
+		L"./user/./test.txt",
+		L"username/subdir/../../user/test.txt",
+	};
+#endif /* defined( WINAPI ) || defined( __MINGW32__ ) */
+
+	libcerror_error_t *error                = NULL;
+	wchar_t *current_working_directory      = NULL;
+	wchar_t *expected_path                  = NULL;
+	wchar_t *full_path                      = NULL;
+	wchar_t *path                           = NULL;
+	size_t current_working_directory_length = 0;
+	size_t current_working_directory_size   = 0;
+	size_t expected_full_path_length        = 0;
+	size_t expected_path_length             = 0;
+	size_t full_path_length                 = 0;
+	size_t full_path_size                   = 0;
+	size_t path_length                      = 0;
+	int path_index                          = 0;
+	int result                              = 0;
+	int string_index                        = 0;
+
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	int number_of_absolute_paths            = 6;
+	int number_of_relative_paths            = 2;
+#else
+	int number_of_absolute_paths            = 6;
+	int number_of_relative_paths            = 4;
+#endif
+
+	/* Initialize test
+	 */
+	result = libcpath_path_get_current_working_directory_wide(
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "current_working_directory",
+	 current_working_directory );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	current_working_directory_length = wide_string_length(
+	                                    current_working_directory );
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI )
+	expected_path = L"\\\\?\\C:\\home\\user\\test.txt";
+#elif defined( __MINGW32__ )
+	expected_path = L"C:\\home\\user\\test.txt";
+#else
+	expected_path = L"/home/user/test.txt";
+#endif
+	expected_path_length = wide_string_length(
+	                        expected_path );
+
+	for( path_index = 0;
+	     path_index < number_of_absolute_paths;
+	     path_index++ )
+	{
+		path = absolute_paths[ path_index ];
+
+		path_length = wide_string_length(
+		               path );
+
+		result = libcpath_path_get_full_path_wide(
+		          path,
+		          path_length,
+		          &full_path,
+		          &full_path_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "full_path",
+		 full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_size",
+		 full_path_size,
+		 expected_path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		full_path_length = wide_string_length(
+		                    full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_size",
+		 full_path_size,
+		 full_path_length + 1 );
+
+		/* Skip the drive letter in the comparison, given it is determined runtime */
+
+#if defined( WINAPI )
+		if( ( full_path[ 0 ] != (wchar_t) '\\' )
+		 || ( full_path[ 1 ] != (wchar_t) '\\' )
+		 || ( full_path[ 2 ] != (wchar_t) '?' )
+		 || ( full_path[ 3 ] != (wchar_t) '\\' ) )
+		{
+			result = 1;
+		}
+		else
+		{
+			result = wide_string_compare_no_case(
+			          &( full_path[ 5 ] ),
+			          &( expected_path[ 5 ] ),
+			          expected_path_length - 5 );
+		}
+#elif defined( __MINGW32__ )
+		result = wide_string_compare_no_case(
+		          &( full_path[ 2 ] ),
+		          &( expected_path[ 2 ] ),
+		          expected_path_length - 2 );
+#else
+		result = wide_string_compare(
+		          full_path,
+		          expected_path,
+		          expected_path_length );
+#endif
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		memory_free(
+		 full_path );
+
+		full_path = NULL;
+	}
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	expected_path = L"\\user\\test.txt";
+#else
+	expected_path = L"/user/test.txt";
+#endif
+	expected_path_length = wide_string_length(
+	                        expected_path );
+
+	expected_full_path_length = current_working_directory_length + expected_path_length;
+
+#if defined( WINAPI )
+	expected_full_path_length += 4;
+#endif
+
+	for( path_index = 0;
+	     path_index < number_of_relative_paths;
+	     path_index++ )
+	{
+		path = relative_paths[ path_index ];
+
+		path_length = wide_string_length(
+		               path );
+
+		result = libcpath_path_get_full_path_wide(
+		          path,
+		          path_length,
+		          &full_path,
+		          &full_path_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "full_path",
+		 full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_size",
+		 full_path_size,
+		 expected_full_path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+#if defined( WINAPI )
+		/* A full path on Windows is prefixed with \\?\ while
+		 * the current working directory is not.
+		 */
+		result = wide_string_compare_no_case(
+		          full_path,
+		          L"\\\\?\\",
+		          4 );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		string_index = 4;
+#else
+		string_index = 0;
+#endif
+#if defined( WINAPI ) || defined( __MINGW32__ )
+		result = wide_string_compare_no_case(
+		          &( full_path[ string_index ] ),
+		          current_working_directory,
+		          current_working_directory_length );
+#else
+		result = wide_string_compare(
+		          &( full_path[ string_index ] ),
+		          current_working_directory,
+		          current_working_directory_length );
+#endif
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+#if defined( WINAPI ) || defined( __MINGW32__ )
+		result = wide_string_compare_no_case(
+		          &( full_path[ string_index + current_working_directory_length ] ),
+		          expected_path,
+		          expected_path_length );
+#else
+		result = wide_string_compare(
+		          &( full_path[ string_index + current_working_directory_length ] ),
+		          expected_path,
+		          expected_path_length );
+#endif
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		full_path_length = wide_string_length(
+		                    full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_length",
+		 full_path_length,
+		 expected_full_path_length );
+
+		memory_free(
+		 full_path );
+
+		full_path = NULL;
+	}
+#if defined( WINAPI )
+	for( path_index = 0;
+	     path_index < 2;
+	     path_index++ )
+	{
+		path = special_paths[ path_index ];
+
+		path_length = wide_string_length(
+		               path );
+
+		result = libcpath_path_get_full_path_wide(
+		          path,
+		          path_length,
+		          &full_path,
+		          &full_path_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "full_path",
+		 full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_size",
+		 full_path_size,
+		 path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = wide_string_compare_no_case(
+		          full_path,
+		          path,
+		          path_length );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		full_path_length = wide_string_length(
+		                    full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_length",
+		 full_path_length,
+		 path_length );
+
+		memory_free(
+		 full_path );
+
+		full_path = NULL;
+	}
+	expected_path = L"\\\\?\\UNC\\172.0.0.1\\C$\\test.txt";
+
+	expected_path_length = wide_string_length(
+	                        expected_path );
+
+	for( path_index = 0;
+	     path_index < 2;
+	     path_index++ )
+	{
+		path = unc_paths[ path_index ];
+
+		path_length = wide_string_length(
+		               path );
+
+		result = libcpath_path_get_full_path_wide(
+		          path,
+		          path_length,
+		          &full_path,
+		          &full_path_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "full_path",
+		 full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_size",
+		 full_path_size,
+		 expected_path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = wide_string_compare_no_case(
+		          full_path,
+		          expected_path,
+		          expected_path_length );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		full_path_length = wide_string_length(
+		                    full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_length",
+		 full_path_length,
+		 expected_path_length );
+
+		memory_free(
+		 full_path );
+
+		full_path = NULL;
+	}
+#endif /* defined( WINAPI ) */
+
+#if !defined( WINAPI ) && !defined( __MINGW32__ )
+	/* Test that the root directory resolves to itself
+	 */
+	result = libcpath_path_get_full_path_wide(
+	          L"/",
+	          1,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "full_path",
+	 full_path );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_path_size",
+	 full_path_size,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          full_path,
+	          L"/",
+	          2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 full_path );
+
+	full_path = NULL;
+
+#endif /* !defined( WINAPI ) && !defined( __MINGW32__ ) */
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_full_path_wide(
+	          NULL,
+	          8,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path_wide(
+	          L"test.txt",
+	          0,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path_wide(
+	          L"test.txt",
+	          (size_t) -1,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path_wide(
+	          L"test.txt",
+	          8,
+	          NULL,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	full_path = (wchar_t *) 0x12345678UL;
+
+	result = libcpath_path_get_full_path_wide(
+	          L"test.txt",
+	          8,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	full_path = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path_wide(
+	          L"test.txt",
+	          8,
+	          &full_path,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CPATH_TEST_FUNCTION_HOOK )
+
+	/* Test libcpath_path_change_directory with getcwd failing
+	 */
+	cpath_test_getcwd_attempts_before_fail = 0;
+
+	result = libcpath_path_get_full_path_wide(
+	          L"test.txt",
+	          8,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	if( cpath_test_getcwd_attempts_before_fail != -1 )
+	{
+		cpath_test_getcwd_attempts_before_fail = -1;
+	}
+	else
+	{
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "full_path",
+		 full_path );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CPATH_TEST_FUNCTION_HOOK ) */
+
+	/* Clean up
+	 */
+	memory_free(
+	 current_working_directory );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( full_path != NULL )
+	{
+		memory_free(
+		 full_path );
+	}
+	if( current_working_directory != NULL )
+	{
+		memory_free(
+		 current_working_directory );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_full_path_to_buffer_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_full_path_to_buffer_wide(
+     void )
+{
+	wchar_t full_path[ 64 ];
+
+	libcerror_error_t *error       = NULL;
+	wchar_t *expected_full_path    = NULL;
+	wchar_t *expected_path         = NULL;
+	wchar_t *path                  = NULL;
+	wchar_t *relative_full_path    = NULL;
+	size_t expected_full_path_size = 0;
+	size_t expected_path_length    = 0;
+	size_t path_length             = 0;
+	size_t required_full_path_size = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI )
+	path          = L"c:\\home\\username\\..\\user\\test.txt";
+	expected_path = L"\\\\?\\C:\\home\\user\\test.txt";
+#elif defined( __MINGW32__ )
+	path          = L"c:\\home\\username\\..\\user\\test.txt";
+	expected_path = L"C:\\home\\user\\test.txt";
+#else
+	path          = L"/home/username/../user/test.txt";
+	expected_path = L"/home/user/test.txt";
+#endif
+	path_length = wide_string_length(
+	               path );
+
+	expected_path_length = wide_string_length(
+	                        expected_path );
+
+	result = libcpath_path_get_full_path_to_buffer_wide(
+	          path,
+	          path_length,
+	          full_path,
+	          64,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_full_path_size",
+	 required_full_path_size,
+	 expected_path_length + 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          full_path,
+	          expected_path,
+	          expected_path_length + 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test libcpath_path_get_full_path_to_buffer_wide with a full path of the exact size
+	 */
+	result = libcpath_path_get_full_path_to_buffer_wide(
+	          path,
+	          path_length,
+	          full_path,
+	          expected_path_length + 1,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_full_path_size",
+	 required_full_path_size,
+	 expected_path_length + 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          full_path,
+	          expected_path,
+	          expected_path_length + 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test libcpath_path_get_full_path_to_buffer_wide with a full path that is too small
+	 */
+	result = libcpath_path_get_full_path_to_buffer_wide(
+	          path,
+	          path_length,
+	          full_path,
+	          expected_path_length,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_full_path_size",
+	 required_full_path_size,
+	 expected_path_length + 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test libcpath_path_get_full_path_to_buffer_wide with a relative path
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	path = L"username\\..\\user\\test.txt";
+#else
+	path = L"username/../user/test.txt";
+#endif
+	path_length = wide_string_length(
+	               path );
+
+	result = libcpath_path_get_full_path_wide(
+	          path,
+	          path_length,
+	          &expected_full_path,
+	          &expected_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "expected_full_path",
+	 expected_full_path );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_full_path_to_buffer_wide(
+	          path,
+	          path_length,
+	          full_path,
+	          0,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_full_path_size",
+	 required_full_path_size,
+	 expected_full_path_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	relative_full_path = wide_string_allocate(
+	                      required_full_path_size );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "relative_full_path",
+	 relative_full_path );
+
+	result = libcpath_path_get_full_path_to_buffer_wide(
+	          path,
+	          path_length,
+	          relative_full_path,
+	          required_full_path_size,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_full_path_size",
+	 required_full_path_size,
+	 expected_full_path_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          relative_full_path,
+	          expected_full_path,
+	          expected_full_path_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 relative_full_path );
+
+	relative_full_path = NULL;
+
+	memory_free(
+	 expected_full_path );
+
+	expected_full_path = NULL;
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_full_path_to_buffer_wide(
+	          NULL,
+	          path_length,
+	          full_path,
+	          64,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path_to_buffer_wide(
+	          path,
+	          0,
+	          full_path,
+	          64,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path_to_buffer_wide(
+	          path,
+	          path_length,
+	          NULL,
+	          64,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path_to_buffer_wide(
+	          path,
+	          path_length,
+	          full_path,
+	          (size_t) SSIZE_MAX + 1,
+	          &required_full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_path_to_buffer_wide(
+	          path,
+	          path_length,
+	          full_path,
+	          64,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( relative_full_path != NULL )
+	{
+		memory_free(
+		 relative_full_path );
+	}
+	if( expected_full_path != NULL )
+	{
+		memory_free(
+		 expected_full_path );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_full_paths_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_full_paths_wide(
+     void )
+{
+	const wchar_t *invalid_paths[ 2 ] = { L"test", NULL };
+	const wchar_t *paths[ 3 ]         = { L"test", L"test/../test2", L"test/./test3" };
+	size_t path_lengths[ 3 ]          = { 4, 13, 12 };
+	libcerror_error_t *error          = NULL;
+	wchar_t *full_path                = NULL;
+	wchar_t *full_paths               = NULL;
+	size_t *full_path_offsets         = NULL;
+	size_t full_path_size             = 0;
+	size_t full_paths_offset          = 0;
+	size_t full_paths_size            = 0;
+	int path_number                   = 0;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_full_paths_wide(
+	          paths,
+	          path_lengths,
+	          3,
+	          &full_paths,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "full_paths",
+	 full_paths );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "full_path_offsets",
+	 full_path_offsets );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( path_number = 0;
+	     path_number < 3;
+	     path_number++ )
+	{
+		result = libcpath_path_get_full_path_wide(
+		          paths[ path_number ],
+		          path_lengths[ path_number ],
+		          &full_path,
+		          &full_path_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
 		CPATH_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		/* Skip the drive letter in the comparison, given it is determined runtime */
-#if defined( WINAPI )
-		if( ( full_path[ 0 ] != '\\' )
-		 || ( full_path[ 1 ] != '\\' )
-		 || ( full_path[ 2 ] != '?' )
-		 || ( full_path[ 3 ] != '\\' ) )
-		{
-			result = 1;
-		}
-		else
-		{
-			result = narrow_string_compare_no_case(
-			          &( full_path[ 5 ] ),
-			          &( expected_path[ 5 ] ),
-			          expected_path_length - 5 );
-		}
-#elif defined( __MINGW32__ )
-		result = narrow_string_compare_no_case(
-		          &( full_path[ 2 ] ),
-		          &( expected_path[ 2 ] ),
-		          expected_path_length - 2 );
-#else
-		result = narrow_string_compare(
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_offsets[ path_number ]",
+		 full_path_offsets[ path_number ],
+		 full_paths_offset );
+
+		result = wide_string_compare(
+		          &( full_paths[ full_path_offsets[ path_number ] ] ),
 		          full_path,
-		          expected_path,
-		          expected_path_length );
-#endif
+		          full_path_size );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		memory_free(
+		 full_path );
+
+		full_path = NULL;
+
+		full_paths_offset += full_path_size;
+	}
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_paths_size",
+	 full_paths_size,
+	 full_paths_offset );
+
+	memory_free(
+	 full_paths );
+
+	full_paths = NULL;
+
+	memory_free(
+	 full_path_offsets );
+
+	full_path_offsets = NULL;
+
+	/* Test that no paths is not considered an error
+	 */
+	full_paths_size = 1;
+
+	result = libcpath_path_get_full_paths_wide(
+	          paths,
+	          path_lengths,
+	          0,
+	          &full_paths,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "full_paths",
+	 full_paths );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_paths_size",
+	 full_paths_size,
+	 (size_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "full_path_offsets",
+	 full_path_offsets );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_full_paths_wide(
+	          NULL,
+	          path_lengths,
+	          3,
+	          &full_paths,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_paths_wide(
+	          paths,
+	          NULL,
+	          3,
+	          &full_paths,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_paths_wide(
+	          paths,
+	          path_lengths,
+	          -1,
+	          &full_paths,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_paths_wide(
+	          paths,
+	          path_lengths,
+	          3,
+	          NULL,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_paths_wide(
+	          paths,
+	          path_lengths,
+	          3,
+	          &full_paths,
+	          NULL,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_paths_wide(
+	          paths,
+	          path_lengths,
+	          3,
+	          &full_paths,
+	          &full_paths_size,
+	          NULL,
+	          &error );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		full_path_length = narrow_string_length(
-		                    full_path );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_size",
-		 full_path_size,
-		 full_path_length + 1 );
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_full_paths_wide(
+	          invalid_paths,
+	          path_lengths,
+	          2,
+	          &full_paths,
+	          &full_paths_size,
+	          &full_path_offsets,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "full_paths",
+	 full_paths );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "full_path_offsets",
+	 full_path_offsets );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
 
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( full_path != NULL )
+	{
 		memory_free(
 		 full_path );
-
-		full_path = NULL;
 	}
+	if( full_paths != NULL )
+	{
+		memory_free(
+		 full_paths );
+	}
+	if( full_path_offsets != NULL )
+	{
+		memory_free(
+		 full_path_offsets );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
+
+/* Tests the libcpath_path_append_normalized_segments_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_append_normalized_segments_wide(
+     void )
+{
+	wchar_t full_path[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	wchar_t *expected_path   = NULL;
+	wchar_t *path            = NULL;
+	size_t full_path_index   = 0;
+	size_t path_length       = 0;
+	int result               = 0;
+
 #if defined( WINAPI ) || defined( __MINGW32__ )
-	expected_path = "\\user\\test.txt";
+	path          = L"home\\\\username\\.\\..\\..\\..\\user\\test.txt";
+	expected_path = L"\\user\\test.txt\\";
 #else
-	expected_path = "/user/test.txt";
+	path          = L"home//username/./../../../user/test.txt";
+	expected_path = L"/user/test.txt/";
 #endif
-	expected_path_length = narrow_string_length(
-	                        expected_path );
+	path_length = wide_string_length(
+	               path );
 
-	expected_full_path_length = current_working_directory_length + expected_path_length;
+	/* Test regular cases
+	 */
+	full_path[ 0 ]  = (wchar_t) LIBCPATH_SEPARATOR;
+	full_path_index = 1;
 
-#if defined( WINAPI )
-	expected_full_path_length += 4;
-#endif
+	result = libcpath_path_append_normalized_segments_wide(
+	          full_path,
+	          32,
+	          1,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          &error );
 
-	for( path_index = 0;
-	     path_index < 2;
-	     path_index++ )
-	{
-		path = relative_paths[ path_index ];
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		path_length = narrow_string_length(
-		               path );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_path_index",
+	 full_path_index,
+	 (size_t) 15 );
 
-		result = libcpath_path_get_full_path(
-		          path,
-		          path_length,
-		          &full_path,
-		          &full_path_size,
-		          &error );
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	result = wide_string_compare(
+	          full_path,
+	          expected_path,
+	          15 );
 
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "full_path",
-		 full_path );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	full_path_index = 1;
+
+	result = libcpath_path_append_normalized_segments_wide(
+	          NULL,
+	          32,
+	          1,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_append_normalized_segments_wide(
+	          full_path,
+	          (size_t) SSIZE_MAX + 1,
+	          1,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_append_normalized_segments_wide(
+	          full_path,
+	          32,
+	          33,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_append_normalized_segments_wide(
+	          full_path,
+	          32,
+	          1,
+	          NULL,
+	          path,
+	          path_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	full_path_index = 0;
+
+	result = libcpath_path_append_normalized_segments_wide(
+	          full_path,
+	          32,
+	          1,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          &error );
+
+	full_path_index = 1;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_append_normalized_segments_wide(
+	          full_path,
+	          32,
+	          1,
+	          &full_path_index,
+	          NULL,
+	          path_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_append_normalized_segments_wide(
+	          full_path,
+	          32,
+	          1,
+	          &full_path_index,
+	          path,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a full path that is too small
+	 */
+	result = libcpath_path_append_normalized_segments_wide(
+	          full_path,
+	          8,
+	          1,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_size",
-		 full_path_size,
-		 expected_full_path_length + 1 );
+	libcerror_error_free(
+	 &error );
 
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	return( 1 );
 
-#if defined( WINAPI )
-		/* A full path on Windows is prefixed with \\?\ while
-		 * the current working directory is not.
-		 */
-		result = narrow_string_compare_no_case(
-		          full_path,
-		          "\\\\?\\",
-		          4 );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
+/* Tests the libcpath_path_get_normalized_segments_length_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_normalized_segments_length_wide(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	wchar_t *path                    = NULL;
+	size_t number_of_parent_segments = 0;
+	size_t path_length               = 0;
+	size_t segments_length           = 0;
+	int result                       = 0;
 
-		string_index = 4;
-#else
-		string_index = 0;
-#endif
 #if defined( WINAPI ) || defined( __MINGW32__ )
-		result = narrow_string_compare_no_case(
-		          &( full_path[ string_index ] ),
-		          current_working_directory,
-		          current_working_directory_length );
+	path = L"..\\home\\\\username\\.\\..\\..\\..\\user\\test.txt";
 #else
-		result = narrow_string_compare(
-		          &( full_path[ string_index ] ),
-		          current_working_directory,
-		          current_working_directory_length );
+	path = L"../home//username/./../../../user/test.txt";
 #endif
+	path_length = wide_string_length(
+	               path );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_normalized_segments_length_wide(
+	          path,
+	          path_length,
+	          &number_of_parent_segments,
+	          &segments_length,
+	          &error );
 
-#if defined( WINAPI ) || defined( __MINGW32__ )
-		result = narrow_string_compare_no_case(
-		          &( full_path[ string_index + current_working_directory_length ] ),
-		          expected_path,
-		          expected_path_length );
-#else
-		result = narrow_string_compare(
-		          &( full_path[ string_index + current_working_directory_length ] ),
-		          expected_path,
-		          expected_path_length );
-#endif
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_parent_segments",
+	 number_of_parent_segments,
+	 (size_t) 2 );
 
-		full_path_length = narrow_string_length(
-		                    full_path );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "segments_length",
+	 segments_length,
+	 (size_t) 14 );
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_length",
-		 full_path_length,
-		 expected_full_path_length );
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		memory_free(
-		 full_path );
+	/* Test error cases
+	 */
+	result = libcpath_path_get_normalized_segments_length_wide(
+	          NULL,
+	          path_length,
+	          &number_of_parent_segments,
+	          &segments_length,
+	          &error );
 
-		full_path = NULL;
-	}
-#if defined( WINAPI )
-	for( path_index = 0;
-	     path_index < 2;
-	     path_index++ )
-	{
-		path = special_paths[ path_index ];
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		path_length = narrow_string_length(
-		               path );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		result = libcpath_path_get_full_path(
-		          path,
-		          path_length,
-		          &full_path,
-		          &full_path_size,
-		          &error );
+	libcerror_error_free(
+	 &error );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	result = libcpath_path_get_normalized_segments_length_wide(
+	          path,
+	          (size_t) SSIZE_MAX + 1,
+	          &number_of_parent_segments,
+	          &segments_length,
+	          &error );
 
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "full_path",
-		 full_path );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_size",
-		 full_path_size,
-		 path_length + 1 );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	libcerror_error_free(
+	 &error );
 
-		result = narrow_string_compare_no_case(
-		          full_path,
-		          path,
-		          path_length );
+	result = libcpath_path_get_normalized_segments_length_wide(
+	          path,
+	          path_length,
+	          NULL,
+	          &segments_length,
+	          &error );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		full_path_length = narrow_string_length(
-		                    full_path );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_length",
-		 full_path_length,
-		 path_length );
+	libcerror_error_free(
+	 &error );
 
-		memory_free(
-		 full_path );
+	result = libcpath_path_get_normalized_segments_length_wide(
+	          path,
+	          path_length,
+	          &number_of_parent_segments,
+	          NULL,
+	          &error );
 
-		full_path = NULL;
-	}
-	expected_path = "\\\\?\\UNC\\172.0.0.1\\C$\\test.txt";
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	expected_path_length = narrow_string_length(
-	                        expected_path );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	for( path_index = 0;
-	     path_index < 2;
-	     path_index++ )
-	{
-		path = unc_paths[ path_index ];
+	libcerror_error_free(
+	 &error );
 
-		path_length = narrow_string_length(
-		               path );
+	return( 1 );
 
-		result = libcpath_path_get_full_path(
-		          path,
-		          path_length,
-		          &full_path,
-		          &full_path_size,
-		          &error );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+/* Tests the libcpath_path_prepend_normalized_segments_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_prepend_normalized_segments_wide(
+     void )
+{
+	wchar_t full_path[ 32 ];
 
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "full_path",
-		 full_path );
+	libcerror_error_t *error         = NULL;
+	wchar_t *expected_path           = NULL;
+	wchar_t *path                    = NULL;
+	size_t full_path_index           = 0;
+	size_t number_of_parent_segments = 0;
+	size_t path_length               = 0;
+	int result                       = 0;
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_size",
-		 full_path_size,
-		 expected_path_length + 1 );
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	path          = L"home\\\\username\\.\\..\\..\\..\\user\\test.txt";
+	expected_path = L"\\user\\test.txt\\";
+#else
+	path          = L"home//username/./../../../user/test.txt";
+	expected_path = L"/user/test.txt/";
+#endif
+	path_length = wide_string_length(
+	               path );
 
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	/* Test regular cases
+	 */
+	full_path[ 0 ]  = (wchar_t) LIBCPATH_SEPARATOR;
+	full_path_index = 15;
 
-		result = narrow_string_compare_no_case(
-		          full_path,
-		          expected_path,
-		          expected_path_length );
+	result = libcpath_path_prepend_normalized_segments_wide(
+	          full_path,
+	          32,
+	          1,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          &number_of_parent_segments,
+	          &error );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_path_index",
+	 full_path_index,
+	 (size_t) 1 );
 
-		full_path_length = narrow_string_length(
-		                    full_path );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "number_of_parent_segments",
+	 number_of_parent_segments,
+	 (size_t) 1 );
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_length",
-		 full_path_length,
-		 expected_path_length );
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		memory_free(
-		 full_path );
+	result = wide_string_compare(
+	          full_path,
+	          expected_path,
+	          15 );
 
-		full_path = NULL;
-	}
-#endif /* defined( WINAPI ) */
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
 	/* Test error cases
 	 */
-	result = libcpath_path_get_full_path(
+	full_path_index           = 15;
+	number_of_parent_segments = 0;
+
+	result = libcpath_path_prepend_normalized_segments_wide(
 	          NULL,
-	          8,
-	          &full_path,
-	          &full_path_size,
+	          32,
+	          1,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          &number_of_parent_segments,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2020,11 +13066,14 @@ int cpath_test_path_get_full_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_full_path(
-	          "test.txt",
-	          0,
-	          &full_path,
-	          &full_path_size,
+	result = libcpath_path_prepend_normalized_segments_wide(
+	          full_path,
+	          (size_t) SSIZE_MAX + 1,
+	          1,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          &number_of_parent_segments,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2039,11 +13088,14 @@ int cpath_test_path_get_full_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_full_path(
-	          "test.txt",
-	          (size_t) -1,
-	          &full_path,
-	          &full_path_size,
+	result = libcpath_path_prepend_normalized_segments_wide(
+	          full_path,
+	          32,
+	          33,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          &number_of_parent_segments,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2058,11 +13110,14 @@ int cpath_test_path_get_full_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_full_path(
-	          "test.txt",
-	          8,
+	result = libcpath_path_prepend_normalized_segments_wide(
+	          full_path,
+	          32,
+	          1,
 	          NULL,
-	          &full_path_size,
+	          path,
+	          path_length,
+	          &number_of_parent_segments,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2077,16 +13132,19 @@ int cpath_test_path_get_full_path(
 	libcerror_error_free(
 	 &error );
 
-	full_path = (char *) 0x12345678UL;
+	full_path_index = 33;
 
-	result = libcpath_path_get_full_path(
-	          "test.txt",
-	          8,
-	          &full_path,
-	          &full_path_size,
+	result = libcpath_path_prepend_normalized_segments_wide(
+	          full_path,
+	          32,
+	          1,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          &number_of_parent_segments,
 	          &error );
 
-	full_path = NULL;
+	full_path_index = 15;
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -2100,11 +13158,14 @@ int cpath_test_path_get_full_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_full_path(
-	          "test.txt",
-	          8,
-	          &full_path,
+	result = libcpath_path_prepend_normalized_segments_wide(
+	          full_path,
+	          32,
+	          1,
+	          &full_path_index,
 	          NULL,
+	          path_length,
+	          &number_of_parent_segments,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2119,164 +13180,62 @@ int cpath_test_path_get_full_path(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_CPATH_TEST_FUNCTION_HOOK )
-
-	/* Test libcpath_path_change_directory with getcwd failing
-	 */
-	cpath_test_getcwd_attempts_before_fail = 0;
-
-	result = libcpath_path_get_full_path(
-	          "test.txt",
-	          8,
-	          &full_path,
-	          &full_path_size,
-	          &error );
-
-	if( cpath_test_getcwd_attempts_before_fail != -1 )
-	{
-		cpath_test_getcwd_attempts_before_fail = -1;
-	}
-	else
-	{
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "full_path",
-		 full_path );
-
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_CPATH_TEST_FUNCTION_HOOK ) */
-
-	/* Clean up
-	 */
-	memory_free(
-	 current_working_directory );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( full_path != NULL )
-	{
-		memory_free(
-		 full_path );
-	}
-	if( current_working_directory != NULL )
-	{
-		memory_free(
-		 current_working_directory );
-	}
-	return( 0 );
-}
-
-#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
-
-/* Tests the libcpath_path_get_sanitized_character_size function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_path_get_sanitized_character_size(
-     void )
-{
-	libcerror_error_t *error        = NULL;
-	size_t sanitized_character_size = 0;
-	int result                      = 0;
-
-	/* Test regular cases
-	 */
-	result = libcpath_path_get_sanitized_character_size(
-	          (char) 0,
-	          &sanitized_character_size,
+	result = libcpath_path_prepend_normalized_segments_wide(
+	          full_path,
+	          32,
+	          1,
+	          &full_path_index,
+	          path,
+	          (size_t) SSIZE_MAX + 1,
+	          &number_of_parent_segments,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_character_size",
-	 sanitized_character_size,
-	 (size_t) 4 );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_sanitized_character_size(
-	          LIBCPATH_ESCAPE_CHARACTER,
-	          &sanitized_character_size,
-	          &error );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_character_size",
-	 sanitized_character_size,
-	 (size_t) 2 );
-
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	libcerror_error_free(
+	 &error );
 
-	result = libcpath_path_get_sanitized_character_size(
-	          '!',
-	          &sanitized_character_size,
+	result = libcpath_path_prepend_normalized_segments_wide(
+	          full_path,
+	          32,
+	          1,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          NULL,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_character_size",
-	 sanitized_character_size,
-	 (size_t) 4 );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_sanitized_character_size(
-	          'A',
-	          &sanitized_character_size,
-	          &error );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_character_size",
-	 sanitized_character_size,
-	 (size_t) 1 );
-
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases
+	/* Test libcpath_path_prepend_normalized_segments_wide with a full path that is too small
 	 */
-	result = libcpath_path_get_sanitized_character_size(
-	          'A',
-	          NULL,
+	full_path_index = 8;
+
+	result = libcpath_path_prepend_normalized_segments_wide(
+	          full_path,
+	          32,
+	          1,
+	          &full_path_index,
+	          path,
+	          path_length,
+	          &number_of_parent_segments,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2302,29 +13261,53 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcpath_path_get_sanitized_character function
+/* Tests the libcpath_path_resolve_full_path_wide function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_path_get_sanitized_character(
+int cpath_test_path_resolve_full_path_wide(
      void )
 {
-	char sanitized_path[ 32 ];
+	wchar_t full_path[ 64 ];
 
-	libcerror_error_t *error      = NULL;
-	char *expected_sanitized_path = NULL;
-	size_t sanitized_path_index   = 0;
-	int result                    = 0;
+	libcerror_error_t *error       = NULL;
+	wchar_t *base_directory        = NULL;
+	wchar_t *expected_path         = NULL;
+	wchar_t *full_path_prefix      = NULL;
+	wchar_t *path                  = NULL;
+	size_t base_directory_length   = 0;
+	size_t path_length             = 0;
+	size_t required_full_path_size = 0;
+	int result                     = 0;
+
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	full_path_prefix = L"\\";
+	base_directory   = L"home\\username";
+	path             = L"..\\user\\subdirectory\\..\\test.txt";
+	expected_path    = L"\\home\\user\\test.txt";
+#else
+	full_path_prefix = L"/";
+	base_directory   = L"home/username";
+	path             = L"../user/subdirectory/../test.txt";
+	expected_path    = L"/home/user/test.txt";
+#endif
+	base_directory_length = wide_string_length(
+	                         base_directory );
+
+	path_length = wide_string_length(
+	               path );
 
 	/* Test regular cases
 	 */
-	sanitized_path_index = 0;
-
-	result = libcpath_path_get_sanitized_character(
-	          (char) 0,
-	          4,
-	          sanitized_path,
-	          32,
-	          &sanitized_path_index,
+	result = libcpath_path_resolve_full_path_wide(
+	          full_path_prefix,
+	          1,
+	          base_directory,
+	          base_directory_length,
+	          path,
+	          path_length,
+	          full_path,
+	          64,
+	          &required_full_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2332,39 +13315,38 @@ int cpath_test_path_get_sanitized_character(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 4 );
-
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_full_path_size",
+	 required_full_path_size,
+	 (size_t) 20 );
+
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-#if defined( WINAPI ) || defined( __MINGW32__ )
-	expected_sanitized_path = "^x00";
-#else
-	expected_sanitized_path = "\\x00";
-#endif
-
-	result = narrow_string_compare(
-	          sanitized_path,
-	          expected_sanitized_path,
-	          4 );
+	result = wide_string_compare(
+	          full_path,
+	          expected_path,
+	          20 );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 0 );
 
-	sanitized_path_index = 0;
-
-	result = libcpath_path_get_sanitized_character(
-	          LIBCPATH_ESCAPE_CHARACTER,
-	          2,
-	          sanitized_path,
-	          32,
-	          &sanitized_path_index,
+	/* Test libcpath_path_resolve_full_path_wide with a full path that is smaller than
+	 * the intermediate segments
+	 */
+	result = libcpath_path_resolve_full_path_wide(
+	          full_path_prefix,
+	          1,
+	          base_directory,
+	          base_directory_length,
+	          path,
+	          path_length,
+	          full_path,
+	          20,
+	          &required_full_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2373,74 +13355,92 @@ int cpath_test_path_get_sanitized_character(
 	 1 );
 
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 2 );
+	 "required_full_path_size",
+	 required_full_path_size,
+	 (size_t) 20 );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-#if defined( WINAPI ) || defined( __MINGW32__ )
-	expected_sanitized_path = "^^";
-#else
-	expected_sanitized_path = "\\\\";
-#endif
-
-	result = narrow_string_compare(
-	          sanitized_path,
-	          expected_sanitized_path,
-	          2 );
+	result = wide_string_compare(
+	          full_path,
+	          expected_path,
+	          20 );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 0 );
 
-	sanitized_path_index = 0;
-
-	result = libcpath_path_get_sanitized_character(
-	          'A',
+	/* Test libcpath_path_resolve_full_path_wide with a full path that is too small
+	 */
+	result = libcpath_path_resolve_full_path_wide(
+	          full_path_prefix,
 	          1,
-	          sanitized_path,
-	          32,
-	          &sanitized_path_index,
+	          base_directory,
+	          base_directory_length,
+	          path,
+	          path_length,
+	          full_path,
+	          19,
+	          &required_full_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 1 );
+	 "required_full_path_size",
+	 required_full_path_size,
+	 (size_t) 20 );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          sanitized_path,
-	          "A",
-	          1 );
+	/* Test libcpath_path_resolve_full_path_wide without a base directory
+	 */
+	result = libcpath_path_resolve_full_path_wide(
+	          full_path_prefix,
+	          1,
+	          NULL,
+	          0,
+	          base_directory,
+	          2,
+	          full_path,
+	          2,
+	          &required_full_path_size,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 0 );
 
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_full_path_size",
+	 required_full_path_size,
+	 (size_t) 4 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
-	sanitized_path_index = 0;
-
-	result = libcpath_path_get_sanitized_character(
-	          'A',
-	          8,
-	          sanitized_path,
-	          32,
-	          &sanitized_path_index,
+	result = libcpath_path_resolve_full_path_wide(
+	          NULL,
+	          1,
+	          base_directory,
+	          base_directory_length,
+	          path,
+	          path_length,
+	          full_path,
+	          64,
+	          &required_full_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2448,11 +13448,6 @@ int cpath_test_path_get_sanitized_character(
 	 result,
 	 -1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 0 );
-
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2460,12 +13455,16 @@ int cpath_test_path_get_sanitized_character(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_sanitized_character(
-	          'A',
+	result = libcpath_path_resolve_full_path_wide(
+	          full_path_prefix,
 	          1,
+	          base_directory,
+	          base_directory_length,
 	          NULL,
-	          32,
-	          &sanitized_path_index,
+	          path_length,
+	          full_path,
+	          64,
+	          &required_full_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2473,11 +13472,6 @@ int cpath_test_path_get_sanitized_character(
 	 result,
 	 -1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 0 );
-
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2485,12 +13479,16 @@ int cpath_test_path_get_sanitized_character(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_sanitized_character(
-	          'A',
+	result = libcpath_path_resolve_full_path_wide(
+	          full_path_prefix,
 	          1,
-	          sanitized_path,
-	          (size_t) SSIZE_MAX + 1,
-	          &sanitized_path_index,
+	          base_directory,
+	          base_directory_length,
+	          path,
+	          path_length,
+	          NULL,
+	          64,
+	          &required_full_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2498,11 +13496,6 @@ int cpath_test_path_get_sanitized_character(
 	 result,
 	 -1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 0 );
-
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2510,12 +13503,16 @@ int cpath_test_path_get_sanitized_character(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_sanitized_character(
-	          'A',
+	result = libcpath_path_resolve_full_path_wide(
+	          full_path_prefix,
 	          1,
-	          sanitized_path,
-	          32,
-	          NULL,
+	          base_directory,
+	          base_directory_length,
+	          path,
+	          path_length,
+	          full_path,
+	          (size_t) SSIZE_MAX + 1,
+	          &required_full_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2523,11 +13520,6 @@ int cpath_test_path_get_sanitized_character(
 	 result,
 	 -1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 0 );
-
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2535,14 +13527,16 @@ int cpath_test_path_get_sanitized_character(
 	libcerror_error_free(
 	 &error );
 
-	sanitized_path_index = 32;
-
-	result = libcpath_path_get_sanitized_character(
-	          'A',
+	result = libcpath_path_resolve_full_path_wide(
+	          full_path_prefix,
 	          1,
-	          sanitized_path,
-	          32,
-	          &sanitized_path_index,
+	          base_directory,
+	          base_directory_length,
+	          path,
+	          path_length,
+	          full_path,
+	          64,
+	          NULL,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2550,11 +13544,6 @@ int cpath_test_path_get_sanitized_character(
 	 result,
 	 -1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 32 );
-
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2573,217 +13562,98 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
-
-/* Tests the libcpath_path_get_sanitized_filename function
+/* Tests the libcpath_path_get_sanitized_character_size_wide function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_path_get_sanitized_filename(
+int cpath_test_path_get_sanitized_character_size_wide(
      void )
 {
-	libcerror_error_t *error       = NULL;
-	char *expected_filename        = NULL;
-	char *sanitized_filename       = NULL;
-	char *test_filename            = NULL;
-	size_t expected_filename_size  = 0;
-	size_t sanitized_filename_size = 0;
-	size_t test_filename_length    = 0;
-	int result                     = 0;
-
-	/* Test regular cases
-	 */
-	/* Test libcpath_path_get_sanitized_filename without replacement characters
-	 */
-	test_filename          = "test.txt";
-	test_filename_length   = 8;
-	expected_filename      = "test.txt";
-	expected_filename_size = 9;
-
-	result = libcpath_path_get_sanitized_filename(
-	          test_filename,
-	          test_filename_length,
-	          &sanitized_filename,
-	          &sanitized_filename_size,
-	          &error );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "sanitized_filename",
-	 sanitized_filename );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_filename_size",
-	 sanitized_filename_size,
-	 expected_filename_size );
-
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = narrow_string_compare(
-	          sanitized_filename,
-	          expected_filename,
-	          expected_filename_size );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-	memory_free(
-	 sanitized_filename );
-
-	sanitized_filename      = NULL;
-	sanitized_filename_size = 0;
-
-	/* Test libcpath_path_get_sanitized_filename with replacement characters
-	 */
-#if defined( WINAPI ) || defined( __MINGW32__ )
-	test_filename          = "t\x00sT!.t^|";
-	test_filename_length   = 9;
-	expected_filename      = "t^x00sT^x21.t^^^x7c";
-	expected_filename_size = 20;
-#else
-	test_filename          = "t\x00sT!.t\\|";
-	test_filename_length   = 9;
-	expected_filename      = "t\\x00sT\\x21.t\\\\\\x7c";
-	expected_filename_size = 20;
-#endif
-
-	result = libcpath_path_get_sanitized_filename(
-	          test_filename,
-	          test_filename_length,
-	          &sanitized_filename,
-	          &sanitized_filename_size,
-	          &error );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "sanitized_filename",
-	 sanitized_filename );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_filename_size",
-	 sanitized_filename_size,
-	 expected_filename_size );
-
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = narrow_string_compare(
-	          sanitized_filename,
-	          expected_filename,
-	          expected_filename_size );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-	memory_free(
-	 sanitized_filename );
-
-	sanitized_filename      = NULL;
-	sanitized_filename_size = 0;
+	libcerror_error_t *error        = NULL;
+	size_t sanitized_character_size = 0;
+	int result                      = 0;
 
-	/* Test error cases
+	/* Test regular cases
 	 */
-	test_filename        = "test.txt";
-	test_filename_length = 8;
-
-	result = libcpath_path_get_sanitized_filename(
-	          NULL,
-	          test_filename_length,
-	          &sanitized_filename,
-	          &sanitized_filename_size,
+	result = libcpath_path_get_sanitized_character_size_wide(
+	          (wchar_t) 0,
+	          &sanitized_character_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_character_size",
+	 sanitized_character_size,
+	 (size_t) 4 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcpath_path_get_sanitized_filename(
-	          test_filename,
-	          (size_t) -1,
-	          &sanitized_filename,
-	          &sanitized_filename_size,
+	result = libcpath_path_get_sanitized_character_size_wide(
+	          (wchar_t) LIBCPATH_ESCAPE_CHARACTER,
+	          &sanitized_character_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_character_size",
+	 sanitized_character_size,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcpath_path_get_sanitized_filename(
-	          test_filename,
-	          test_filename_length,
-	          NULL,
-	          &sanitized_filename_size,
+	result = libcpath_path_get_sanitized_character_size_wide(
+	          (wchar_t) '!',
+	          &sanitized_character_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_character_size",
+	 sanitized_character_size,
+	 (size_t) 4 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	sanitized_filename = (char *) 0x12345678UL;
-
-	result = libcpath_path_get_sanitized_filename(
-	          test_filename,
-	          test_filename_length,
-	          &sanitized_filename,
-	          &sanitized_filename_size,
+	result = libcpath_path_get_sanitized_character_size_wide(
+	          (wchar_t) 'A',
+	          &sanitized_character_size,
 	          &error );
 
-	sanitized_filename = NULL;
-
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_character_size",
+	 sanitized_character_size,
+	 (size_t) 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcpath_path_get_sanitized_filename(
-	          test_filename,
-	          test_filename_length,
-	          &sanitized_filename,
+	/* Test error cases
+	 */
+	result = libcpath_path_get_sanitized_character_size_wide(
+	          (wchar_t) 'A',
 	          NULL,
 	          &error );
 
@@ -2799,64 +13669,9 @@ int cpath_test_path_get_sanitized_filename(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_CPATH_TEST_MEMORY )
-
-	/* Test libcpath_path_get_sanitized_filename with malloc failing
-	 */
-	cpath_test_malloc_attempts_before_fail = 0;
-
-	result = libcpath_path_get_sanitized_filename(
-	          test_filename,
-	          test_filename_length,
-	          &sanitized_filename,
-	          &sanitized_filename_size,
-	          &error );
-
-	if( cpath_test_malloc_attempts_before_fail != -1 )
-	{
-		cpath_test_malloc_attempts_before_fail = -1;
-
-		if( sanitized_filename != NULL )
-		{
-			memory_free(
-			 sanitized_filename );
-
-			sanitized_filename = NULL;
-		}
-	}
-	else
-	{
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "sanitized_filename",
-		 sanitized_filename );
-
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "sanitized_filename_size",
-		 sanitized_filename_size,
-		 (size_t) 0 );
-
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
-
 	return( 1 );
 
 on_error:
-	if( sanitized_filename != NULL )
-	{
-		memory_free(
-		 sanitized_filename );
-	}
 	if( error != NULL )
 	{
 		libcerror_error_free(
@@ -2865,42 +13680,29 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcpath_path_get_sanitized_path function
+/* Tests the libcpath_path_get_sanitized_character_wide function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_path_get_sanitized_path(
+int cpath_test_path_get_sanitized_character_wide(
      void )
 {
-	libcerror_error_t *error   = NULL;
-	char *expected_path        = NULL;
-	char *sanitized_path       = NULL;
-	char *test_path            = NULL;
-	size_t expected_path_size  = 0;
-	size_t sanitized_path_size = 0;
-	size_t test_path_length    = 0;
-	int result                 = 0;
+	wchar_t sanitized_path[ 32 ];
+
+	libcerror_error_t *error         = NULL;
+	wchar_t *expected_sanitized_path = NULL;
+	size_t sanitized_path_index      = 0;
+	int result                       = 0;
 
 	/* Test regular cases
 	 */
-	/* Test libcpath_path_get_sanitized_path without replacement characters
-	 */
-#if defined( WINAPI ) || defined( __MINGW32__ )
-	test_path          = "test\\test.txt";
-	test_path_length   = 13;
-	expected_path      = "test\\test.txt";
-	expected_path_size = 14;
-#else
-	test_path          = "test/test.txt";
-	test_path_length   = 13;
-	expected_path      = "test/test.txt";
-	expected_path_size = 14;
-#endif
+	sanitized_path_index = 0;
 
-	result = libcpath_path_get_sanitized_path(
-	          test_path,
-	          test_path_length,
-	          &sanitized_path,
-	          &sanitized_path_size,
+	result = libcpath_path_get_sanitized_character_wide(
+	          (wchar_t) 0,
+	          4,
+	          sanitized_path,
+	          32,
+	          &sanitized_path_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2908,54 +13710,79 @@ int cpath_test_path_get_sanitized_path(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "sanitized_path",
-	 sanitized_path );
-
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_size",
-	 sanitized_path_size,
-	 expected_path_size );
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 4 );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	expected_sanitized_path = L"^x00";
+#else
+	expected_sanitized_path = L"\\x00";
+#endif
+
 	result = narrow_string_compare(
 	          sanitized_path,
-	          expected_path,
-	          expected_path_size );
+	          expected_sanitized_path,
+	          4 );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 0 );
 
-	memory_free(
-	 sanitized_path );
+	sanitized_path_index = 0;
 
-	sanitized_path      = NULL;
-	sanitized_path_size = 0;
+	result = libcpath_path_get_sanitized_character_wide(
+	          (wchar_t) LIBCPATH_ESCAPE_CHARACTER,
+	          2,
+	          sanitized_path,
+	          32,
+	          &sanitized_path_index,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 2 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Test libcpath_path_get_sanitized_path with replacement characters
-	 */
 #if defined( WINAPI ) || defined( __MINGW32__ )
-	test_path          = "test\\t\x00sT!.t^|";
-	test_path_length   = 14;
-	expected_path      = "test\\t^x00sT^x21.t^^^x7c";
-	expected_path_size = 25;
+	expected_sanitized_path = L"^^";
 #else
-	test_path          = "test/t\x00sT!.t\\|";
-	test_path_length   = 14;
-	expected_path      = "test/t\\x00sT\\x21.t\\\\\\x7c";
-	expected_path_size = 25;
+	expected_sanitized_path = L"\\\\";
 #endif
 
-	result = libcpath_path_get_sanitized_path(
-	          test_path,
-	          test_path_length,
-	          &sanitized_path,
-	          &sanitized_path_size,
+	result = narrow_string_compare(
+	          sanitized_path,
+	          expected_sanitized_path,
+	          2 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	sanitized_path_index = 0;
+
+	result = libcpath_path_get_sanitized_character_wide(
+	          (wchar_t) 'A',
+	          1,
+	          sanitized_path,
+	          32,
+	          &sanitized_path_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -2963,14 +13790,10 @@ int cpath_test_path_get_sanitized_path(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "sanitized_path",
-	 sanitized_path );
-
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_size",
-	 sanitized_path_size,
-	 expected_path_size );
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 1 );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -2978,35 +13801,24 @@ int cpath_test_path_get_sanitized_path(
 
 	result = narrow_string_compare(
 	          sanitized_path,
-	          expected_path,
-	          expected_path_size );
+	          L"A",
+	          1 );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 0 );
 
-	memory_free(
-	 sanitized_path );
-
-	sanitized_path      = NULL;
-	sanitized_path_size = 0;
-
 	/* Test error cases
 	 */
-#if defined( WINAPI ) || defined( __MINGW32__ )
-	test_path        = "test\\test.txt";
-	test_path_length = 13;
-#else
-	test_path        = "test/test.txt";
-	test_path_length = 13;
-#endif
+	sanitized_path_index = 0;
 
-	result = libcpath_path_get_sanitized_path(
-	          NULL,
-	          test_path_length,
-	          &sanitized_path,
-	          &sanitized_path_size,
+	result = libcpath_path_get_sanitized_character_wide(
+	          (wchar_t) 'A',
+	          8,
+	          sanitized_path,
+	          32,
+	          &sanitized_path_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -3014,6 +13826,11 @@ int cpath_test_path_get_sanitized_path(
 	 result,
 	 -1 );
 
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 0 );
+
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -3021,11 +13838,12 @@ int cpath_test_path_get_sanitized_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_sanitized_path(
-	          test_path,
-	          (size_t) -1,
-	          &sanitized_path,
-	          &sanitized_path_size,
+	result = libcpath_path_get_sanitized_character_wide(
+	          (wchar_t) 'A',
+	          1,
+	          NULL,
+	          32,
+	          &sanitized_path_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -3033,6 +13851,11 @@ int cpath_test_path_get_sanitized_path(
 	 result,
 	 -1 );
 
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 0 );
+
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -3040,11 +13863,12 @@ int cpath_test_path_get_sanitized_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_sanitized_path(
-	          test_path,
-	          test_path_length,
-	          NULL,
-	          &sanitized_path_size,
+	result = libcpath_path_get_sanitized_character_wide(
+	          (wchar_t) 'A',
+	          1,
+	          sanitized_path,
+	          (size_t) SSIZE_MAX + 1,
+	          &sanitized_path_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -3052,6 +13876,11 @@ int cpath_test_path_get_sanitized_path(
 	 result,
 	 -1 );
 
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 0 );
+
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -3059,22 +13888,24 @@ int cpath_test_path_get_sanitized_path(
 	libcerror_error_free(
 	 &error );
 
-	sanitized_path = (char *) 0x12345678UL;
-
-	result = libcpath_path_get_sanitized_path(
-	          test_path,
-	          test_path_length,
-	          &sanitized_path,
-	          &sanitized_path_size,
+	result = libcpath_path_get_sanitized_character_wide(
+	          (wchar_t) 'A',
+	          1,
+	          sanitized_path,
+	          32,
+	          NULL,
 	          &error );
 
-	sanitized_path = NULL;
-
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 0 );
+
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -3082,11 +13913,14 @@ int cpath_test_path_get_sanitized_path(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_sanitized_path(
-	          test_path,
-	          test_path_length,
-	          &sanitized_path,
-	          NULL,
+	sanitized_path_index = 32;
+
+	result = libcpath_path_get_sanitized_character_wide(
+	          (wchar_t) 'A',
+	          1,
+	          sanitized_path,
+	          32,
+	          &sanitized_path_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -3094,6 +13928,11 @@ int cpath_test_path_get_sanitized_path(
 	 result,
 	 -1 );
 
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_index",
+	 sanitized_path_index,
+	 (size_t) 32 );
+
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -3101,64 +13940,9 @@ int cpath_test_path_get_sanitized_path(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_CPATH_TEST_MEMORY )
-
-	/* Test libcpath_path_get_sanitized_path with malloc failing
-	 */
-	cpath_test_malloc_attempts_before_fail = 0;
-
-	result = libcpath_path_get_sanitized_path(
-	          test_path,
-	          test_path_length,
-	          &sanitized_path,
-	          &sanitized_path_size,
-	          &error );
-
-	if( cpath_test_malloc_attempts_before_fail != -1 )
-	{
-		cpath_test_malloc_attempts_before_fail = -1;
-
-		if( sanitized_path != NULL )
-		{
-			memory_free(
-			 sanitized_path );
-
-			sanitized_path = NULL;
-		}
-	}
-	else
-	{
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "sanitized_path",
-		 sanitized_path );
-
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "sanitized_path_size",
-		 sanitized_path_size,
-		 (size_t) 0 );
-
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
-
 	return( 1 );
 
 on_error:
-	if( sanitized_path != NULL )
-	{
-		memory_free(
-		 sanitized_path );
-	}
 	if( error != NULL )
 	{
 		libcerror_error_free(
@@ -3167,83 +13951,42 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcpath_path_join function
+/* Tests the libcpath_path_get_sanitized_string_wide function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_path_join(
+int cpath_test_path_get_sanitized_string_wide(
      void )
-{
-	libcerror_error_t *error  = NULL;
-	const char *expected_path = NULL;
-	const char *test_path1    = NULL;
-	const char *test_path2    = NULL;
-	const char *test_path3    = NULL;
-	const char *test_path4    = NULL;
-	char *path                = NULL;
-	size_t path_size          = 0;
-	int result                = 0;
-
-	/* Test regular cases
-	 */
-#if defined( WINAPI ) || defined( __MINGW32__ )
-	test_path1    = "\\first\\second";
-	test_path2    = "third\\fourth";
-	test_path3    = "\\first\\second\\";
-	test_path4    = "\\third\\fourth";
-	expected_path = "\\first\\second\\third\\fourth";
-#else
-	test_path1    = "/first/second";
-	test_path2    = "third/fourth";
-	test_path3    = "/first/second/";
-	test_path4    = "/third/fourth";
-	expected_path = "/first/second/third/fourth";
-#endif
-
-	result = libcpath_path_join(
-	          &path,
-	          &path_size,
-	          test_path1,
-	          13,
-	          test_path2,
-	          12,
-	          &error );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	result = narrow_string_compare(
-	          path,
-	          expected_path,
-	          26 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-	memory_free(
-	 path );
-
-	path = NULL;
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "path_size",
-	 path_size,
-	 (size_t) 27 );
+{
+	wchar_t sanitized_string[ 32 ];
 
-	result = libcpath_path_join(
-	          &path,
-	          &path_size,
-	          test_path3,
-	          14,
-	          test_path2,
-	          12,
+	libcerror_error_t *error              = NULL;
+	wchar_t *expected_string              = NULL;
+	wchar_t *test_string                  = NULL;
+	size_t expected_string_size           = 0;
+	size_t required_sanitized_string_size = 0;
+	size_t test_string_length             = 0;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	test_string          = L"t\x00sT!.t^|\\";
+	test_string_length   = 10;
+	expected_string      = L"t^x00sT^x21.t^^^x7c^x5c";
+	expected_string_size = 24;
+#else
+	test_string          = L"t\x00sT!.t\\|/";
+	test_string_length   = 10;
+	expected_string      = L"t\\x00sT\\x21.t\\\\\\x7c\\x2f";
+	expected_string_size = 24;
+#endif
+	result = libcpath_path_get_sanitized_string_wide(
+	          test_string,
+	          test_string_length,
+	          1,
+	          NULL,
+	          0,
+	          &required_sanitized_string_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -3251,37 +13994,22 @@ int cpath_test_path_join(
 	 result,
 	 1 );
 
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_sanitized_string_size",
+	 required_sanitized_string_size,
+	 expected_string_size );
+
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          path,
-	          expected_path,
-	          26 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-	memory_free(
-	 path );
-
-	path = NULL;
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "path_size",
-	 path_size,
-	 (size_t) 27 );
-
-	result = libcpath_path_join(
-	          &path,
-	          &path_size,
-	          test_path1,
-	          13,
-	          test_path4,
-	          13,
+	result = libcpath_path_get_sanitized_string_wide(
+	          test_string,
+	          test_string_length,
+	          1,
+	          sanitized_string,
+	          32,
+	          &required_sanitized_string_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -3289,85 +14017,59 @@ int cpath_test_path_join(
 	 result,
 	 1 );
 
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_sanitized_string_size",
+	 required_sanitized_string_size,
+	 expected_string_size );
+
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          path,
-	          expected_path,
-	          26 );
+	result = wide_string_compare(
+	          sanitized_string,
+	          expected_string,
+	          expected_string_size );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 0 );
 
-	memory_free(
-	 path );
-
-	path = NULL;
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "path_size",
-	 path_size,
-	 (size_t) 27 );
-
-	/* Test error cases
+	/* Test that the directory separator is only escaped when requested
 	 */
-	result = libcpath_path_join(
+	result = libcpath_path_get_sanitized_string_wide(
+	          test_string,
+	          test_string_length,
+	          0,
 	          NULL,
-	          &path_size,
-	          test_path1,
-	          13,
-	          test_path2,
-	          12,
+	          0,
+	          &required_sanitized_string_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	path = (char *) 0x12345678UL;
-
-	result = libcpath_path_join(
-	          &path,
-	          &path_size,
-	          test_path1,
-	          13,
-	          test_path2,
-	          12,
-	          &error );
-
-	path = NULL;
+	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_sanitized_string_size",
+	 required_sanitized_string_size,
+	 expected_string_size - 3 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcpath_path_join(
-	          &path,
+	/* Test error cases
+	 */
+	result = libcpath_path_get_sanitized_string_wide(
 	          NULL,
-	          test_path1,
-	          13,
-	          test_path2,
-	          12,
+	          test_string_length,
+	          1,
+	          sanitized_string,
+	          32,
+	          &required_sanitized_string_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -3382,13 +14084,13 @@ int cpath_test_path_join(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_join(
-	          &path,
-	          &path_size,
-	          NULL,
-	          13,
-	          test_path2,
-	          12,
+	result = libcpath_path_get_sanitized_string_wide(
+	          test_string,
+	          (size_t) SSIZE_MAX,
+	          1,
+	          sanitized_string,
+	          32,
+	          &required_sanitized_string_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -3403,13 +14105,13 @@ int cpath_test_path_join(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_join(
-	          &path,
-	          &path_size,
-	          test_path1,
+	result = libcpath_path_get_sanitized_string_wide(
+	          test_string,
+	          test_string_length,
+	          1,
+	          sanitized_string,
 	          (size_t) SSIZE_MAX + 1,
-	          test_path2,
-	          12,
+	          &required_sanitized_string_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -3424,13 +14126,13 @@ int cpath_test_path_join(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_join(
-	          &path,
-	          &path_size,
-	          test_path1,
-	          13,
+	result = libcpath_path_get_sanitized_string_wide(
+	          test_string,
+	          test_string_length,
+	          1,
+	          sanitized_string,
+	          32,
 	          NULL,
-	          12,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -3445,13 +14147,13 @@ int cpath_test_path_join(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_join(
-	          &path,
-	          &path_size,
-	          test_path1,
-	          13,
-	          test_path2,
-	          (size_t) SSIZE_MAX + 1,
+	result = libcpath_path_get_sanitized_string_wide(
+	          test_string,
+	          test_string_length,
+	          1,
+	          sanitized_string,
+	          expected_string_size - 1,
+	          &required_sanitized_string_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -3474,71 +14176,78 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( path != NULL )
-	{
-		memory_free(
-		 path );
-	}
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
-
-/* Tests the libcpath_CreateDirectoryA function
+/* Tests the libcpath_path_get_unsanitized_string_wide function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_CreateDirectoryA(
+int cpath_test_path_get_unsanitized_string_wide(
      void )
 {
-	BOOL result = FALSE;
+	wchar_t unsanitized_string[ 32 ];
 
-	/* Test regular cases
-	 */
+	libcerror_error_t *error                = NULL;
+	wchar_t *expected_string                = NULL;
+	wchar_t *test_string                    = NULL;
+	size_t expected_string_size             = 0;
+	size_t required_unsanitized_string_size = 0;
+	size_t test_string_length               = 0;
+	int result                              = 0;
 
-	/* Test error cases
+	/* Test regular cases
 	 */
-	result = libcpath_CreateDirectoryA(
-	          NULL,
-	          NULL );
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	test_string          = L"t^x00sT^x21.t^^^x7c^x5c^x1:^x1A";
+	test_string_length   = 31;
+	expected_string      = L"t\x00sT!.t^|\\\x1a\x1a";
+	expected_string_size = 13;
+#else
+	test_string          = L"t\\x00sT\\x21.t\\\\\\x7c\\x2f\\x1:\\x1A";
+	test_string_length   = 31;
+	expected_string      = L"t\x00sT!.t\\|/\x1a\x1a";
+	expected_string_size = 13;
+#endif
+	result = libcpath_path_get_unsanitized_string_wide(
+	          test_string,
+	          test_string_length,
+	          unsanitized_string,
+	          32,
+	          &required_unsanitized_string_size,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 FALSE );
+	 1 );
 
-	result = libcpath_CreateDirectoryA(
-	          ".",
-	          NULL );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_unsanitized_string_size",
+	 required_unsanitized_string_size,
+	 expected_string_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          unsanitized_string,
+	          expected_string,
+	          sizeof( wchar_t ) * expected_string_size );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 FALSE );
-
-	return( 1 );
-
-on_error:
-	return( 0 );
-}
-
-#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 ) */
-
-/* Tests the libcpath_path_make_directory function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_path_make_directory(
-     void )
-{
-	libcerror_error_t *error = NULL;
-	int result               = 0;
-
-	/* Test regular cases
-	 */
+	 0 );
 
 	/* Test error cases
 	 */
-	result = libcpath_path_make_directory(
+	result = libcpath_path_get_unsanitized_string_wide(
 	          NULL,
+	          test_string_length,
+	          unsanitized_string,
+	          32,
+	          &required_unsanitized_string_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -3553,110 +14262,168 @@ int cpath_test_path_make_directory(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
+	result = libcpath_path_get_unsanitized_string_wide(
+	          test_string,
+	          (size_t) SSIZE_MAX,
+	          unsanitized_string,
+	          32,
+	          &required_unsanitized_string_size,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
+	libcerror_error_free(
+	 &error );
 
-/* Tests the libcpath_SetCurrentDirectoryW function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_SetCurrentDirectoryW(
-     void )
-{
-	BOOL result = FALSE;
+	result = libcpath_path_get_unsanitized_string_wide(
+	          test_string,
+	          test_string_length,
+	          NULL,
+	          32,
+	          &required_unsanitized_string_size,
+	          &error );
 
-	/* Test regular cases
-	 */
-	result = libcpath_SetCurrentDirectoryW(
-	          L"." );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_unsanitized_string_wide(
+	          test_string,
+	          test_string_length,
+	          unsanitized_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &required_unsanitized_string_size,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 TRUE );
+	 -1 );
 
-	/* Test error cases
-	 */
-	result = libcpath_SetCurrentDirectoryW(
-	          NULL );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_unsanitized_string_wide(
+	          test_string,
+	          test_string_length,
+	          unsanitized_string,
+	          32,
+	          NULL,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 FALSE );
+	 -1 );
 
-	result = libcpath_SetCurrentDirectoryW(
-	          L"bogus" );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_unsanitized_string_wide(
+	          test_string,
+	          test_string_length,
+	          unsanitized_string,
+	          expected_string_size - 1,
+	          &required_unsanitized_string_size,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 FALSE );
+	 -1 );
 
-	return( 1 );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-on_error:
-	return( 0 );
-}
+	libcerror_error_free(
+	 &error );
 
-#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+	/* Test with an unsupported escape sequence
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	test_string = L"t^y00";
+#else
+	test_string = L"t\\y00";
+#endif
+	result = libcpath_path_get_unsanitized_string_wide(
+	          test_string,
+	          5,
+	          unsanitized_string,
+	          32,
+	          &required_unsanitized_string_size,
+	          &error );
 
-/* Tests the libcpath_path_change_directory_wide function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_path_change_directory_wide(
-     void )
-{
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	/* Test regular cases
-	 */
-#if defined( WINAPI ) && defined( __CYGWIN__)
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	libcpath_path_change_directory_wide(
-	 L".",
+	libcerror_error_free(
 	 &error );
 
-	/* Note that on Cygwin SetCurrentDirectoryW can return path too long.
+	/* Test with an unsupported hexadecimal digit
 	 */
-	if( *error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	test_string = L"t^x0g";
 #else
-	result = libcpath_path_change_directory_wide(
-	          L".",
+	test_string = L"t\\x0g";
+#endif
+	result = libcpath_path_get_unsanitized_string_wide(
+	          test_string,
+	          5,
+	          unsanitized_string,
+	          32,
+	          &required_unsanitized_string_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-#endif /* defined( WINAPI ) && defined( __CYGWIN__) */
-
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases
+	/* Test with a truncated escape sequence
 	 */
-	result = libcpath_path_change_directory_wide(
-	          NULL,
+	result = libcpath_path_get_unsanitized_string_wide(
+	          test_string,
+	          4,
+	          unsanitized_string,
+	          32,
+	          &required_unsanitized_string_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -3682,90 +14449,176 @@ on_error:
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
 
-/* Tests the libcpath_GetCurrentDirectoryW function
+/* Tests the libcpath_path_get_sanitized_filename_wide function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_GetCurrentDirectoryW(
+int cpath_test_path_get_sanitized_filename_wide(
      void )
 {
-	wchar_t buffer[ 256 ];
-
-	DWORD result = 0;
+	libcerror_error_t *error       = NULL;
+	wchar_t *expected_filename     = NULL;
+	wchar_t *sanitized_filename    = NULL;
+	wchar_t *test_filename         = NULL;
+	size_t expected_filename_size  = 0;
+	size_t sanitized_filename_size = 0;
+	size_t test_filename_length    = 0;
+	int result                     = 0;
 
 	/* Test regular cases
 	 */
-	result = libcpath_GetCurrentDirectoryW(
-	          256,
-	          buffer );
+	/* Test libcpath_path_get_sanitized_filename without replacement characters
+	 */
+	test_filename          = L"test.txt";
+	test_filename_length   = 8;
+	expected_filename      = L"test.txt";
+	expected_filename_size = 9;
 
-	CPATH_TEST_ASSERT_NOT_EQUAL_INT(
+	result = libcpath_path_get_sanitized_filename_wide(
+	          test_filename,
+	          test_filename_length,
+	          &sanitized_filename,
+	          &sanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
-	result = libcpath_GetCurrentDirectoryW(
-	          0,
-	          NULL );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "sanitized_filename",
+	 sanitized_filename );
 
-	CPATH_TEST_ASSERT_NOT_EQUAL_INT(
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_filename_size",
+	 sanitized_filename_size,
+	 expected_filename_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          sanitized_filename,
+	          expected_filename,
+	          expected_filename_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 0 );
 
-	/* Test error cases
+	memory_free(
+	 sanitized_filename );
+
+	sanitized_filename      = NULL;
+	sanitized_filename_size = 0;
+
+	/* Test libcpath_path_get_sanitized_filename with replacement characters
 	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	test_filename          = L"t\x00sT!.t^|";
+	test_filename_length   = 9;
+	expected_filename      = L"t^x00sT^x21.t^^^x7c";
+	expected_filename_size = 20;
+#else
+	test_filename          = L"t\x00sT!.t\\|";
+	test_filename_length   = 9;
+	expected_filename      = L"t\\x00sT\\x21.t\\\\\\x7c";
+	expected_filename_size = 20;
+#endif
 
-	return( 1 );
+	result = libcpath_path_get_sanitized_filename_wide(
+	          test_filename,
+	          test_filename_length,
+	          &sanitized_filename,
+	          &sanitized_filename_size,
+	          &error );
 
-on_error:
-	return( 0 );
-}
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "sanitized_filename",
+	 sanitized_filename );
 
-/* Tests the libcpath_path_get_current_working_directory_wide function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_path_get_current_working_directory_wide(
-     void )
-{
-	libcerror_error_t *error              = NULL;
-	wchar_t *current_working_directory    = NULL;
-	size_t current_working_directory_size = 0;
-	int result                            = 0;
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_filename_size",
+	 sanitized_filename_size,
+	 expected_filename_size );
 
-	/* Test regular cases
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          sanitized_filename,
+	          expected_filename,
+	          expected_filename_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 sanitized_filename );
+
+	sanitized_filename      = NULL;
+	sanitized_filename_size = 0;
+
+	/* Test error cases
 	 */
-	result = libcpath_path_get_current_working_directory_wide(
-	          &current_working_directory,
-	          &current_working_directory_size,
+	test_filename        = L"test.txt";
+	test_filename_length = 8;
+
+	result = libcpath_path_get_sanitized_filename_wide(
+	          NULL,
+	          test_filename_length,
+	          &sanitized_filename,
+	          &sanitized_filename_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "current_working_directory",
-	 current_working_directory );
+	 "error",
+	 error );
 
-	memory_free(
-	 current_working_directory );
+	libcerror_error_free(
+	 &error );
 
-	current_working_directory = NULL;
+	result = libcpath_path_get_sanitized_filename_wide(
+	          test_filename,
+	          (size_t) -1,
+	          &sanitized_filename,
+	          &sanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcpath_path_get_current_working_directory_wide(
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_filename_wide(
+	          test_filename,
+	          test_filename_length,
 	          NULL,
-	          &current_working_directory_size,
+	          &sanitized_filename_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -3780,14 +14633,16 @@ int cpath_test_path_get_current_working_directory_wide(
 	libcerror_error_free(
 	 &error );
 
-	current_working_directory = (wchar_t *) 0x12345678UL;
+	sanitized_filename = (wchar_t *) 0x12345678UL;
 
-	result = libcpath_path_get_current_working_directory_wide(
-	          &current_working_directory,
-	          &current_working_directory_size,
+	result = libcpath_path_get_sanitized_filename_wide(
+	          test_filename,
+	          test_filename_length,
+	          &sanitized_filename,
+	          &sanitized_filename_size,
 	          &error );
 
-	current_working_directory = NULL;
+	sanitized_filename = NULL;
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -3801,8 +14656,10 @@ int cpath_test_path_get_current_working_directory_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_current_working_directory_wide(
-	          &current_working_directory,
+	result = libcpath_path_get_sanitized_filename_wide(
+	          test_filename,
+	          test_filename_length,
+	          &sanitized_filename,
 	          NULL,
 	          &error );
 
@@ -3820,25 +14677,27 @@ int cpath_test_path_get_current_working_directory_wide(
 
 #if defined( HAVE_CPATH_TEST_MEMORY )
 
-	/* Test libcpath_path_get_current_working_directory_wide with malloc failing
+	/* Test libcpath_path_get_sanitized_filename with malloc failing
 	 */
 	cpath_test_malloc_attempts_before_fail = 0;
 
-	result = libcpath_path_get_current_working_directory_wide(
-	          &current_working_directory,
-	          &current_working_directory_size,
+	result = libcpath_path_get_sanitized_filename_wide(
+	          test_filename,
+	          test_filename_length,
+	          &sanitized_filename,
+	          &sanitized_filename_size,
 	          &error );
 
 	if( cpath_test_malloc_attempts_before_fail != -1 )
 	{
 		cpath_test_malloc_attempts_before_fail = -1;
 
-		if( current_working_directory != NULL )
+		if( sanitized_filename != NULL )
 		{
 			memory_free(
-			 current_working_directory );
+			 sanitized_filename );
 
-			current_working_directory = NULL;
+			sanitized_filename = NULL;
 		}
 	}
 	else
@@ -3849,47 +14708,13 @@ int cpath_test_path_get_current_working_directory_wide(
 		 -1 );
 
 		CPATH_TEST_ASSERT_IS_NULL(
-		 "current_working_directory",
-		 current_working_directory );
-
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-	/* Test libcpath_path_get_current_working_directory_wide with memset failing
-	 */
-	cpath_test_memset_attempts_before_fail = 0;
-
-	result = libcpath_path_get_current_working_directory_wide(
-	          &current_working_directory,
-	          &current_working_directory_size,
-	          &error );
-
-	if( cpath_test_memset_attempts_before_fail != -1 )
-	{
-		cpath_test_memset_attempts_before_fail = -1;
-
-		if( current_working_directory != NULL )
-		{
-			memory_free(
-			 current_working_directory );
-
-			current_working_directory = NULL;
-		}
-	}
-	else
-	{
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+		 "sanitized_filename",
+		 sanitized_filename );
 
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "current_working_directory",
-		 current_working_directory );
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "sanitized_filename_size",
+		 sanitized_filename_size,
+		 (size_t) 0 );
 
 		CPATH_TEST_ASSERT_IS_NOT_NULL(
 		 "error",
@@ -3903,37 +14728,55 @@ int cpath_test_path_get_current_working_directory_wide(
 	return( 1 );
 
 on_error:
+	if( sanitized_filename != NULL )
+	{
+		memory_free(
+		 sanitized_filename );
+	}
 	if( error != NULL )
 	{
 		libcerror_error_free(
 		 &error );
 	}
-	if( current_working_directory != NULL )
-	{
-		memory_free(
-		 current_working_directory );
-	}
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI )
-
-/* Tests the libcpath_path_get_path_type_wide function
+/* Tests the libcpath_path_get_sanitized_filename_to_buffer_wide function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_path_get_path_type_wide(
+int cpath_test_path_get_sanitized_filename_to_buffer_wide(
      void )
 {
-	libcerror_error_t *error = NULL;
-	uint8_t path_type        = 0;
-	int result               = 0;
+	wchar_t sanitized_filename[ 32 ];
+
+	libcerror_error_t *error                = NULL;
+	wchar_t *expected_filename              = NULL;
+	wchar_t *test_filename                  = NULL;
+	size_t expected_filename_size           = 0;
+	size_t required_sanitized_filename_size = 0;
+	size_t test_filename_length             = 0;
+	int result                              = 0;
 
 	/* Test regular cases
 	 */
-	result = libcpath_path_get_path_type_wide(
-	          L".",
-	          1,
-	          &path_type,
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	test_filename          = L"t\x00sT!.t^|";
+	test_filename_length   = 9;
+	expected_filename      = L"t^x00sT^x21.t^^^x7c";
+	expected_filename_size = 20;
+#else
+	test_filename          = L"t\x00sT!.t\\|";
+	test_filename_length   = 9;
+	expected_filename      = L"t\\x00sT\\x21.t\\\\\\x7c";
+	expected_filename_size = 20;
+#endif
+
+	result = libcpath_path_get_sanitized_filename_to_buffer_wide(
+	          test_filename,
+	          test_filename_length,
+	          sanitized_filename,
+	          32,
+	          &required_sanitized_filename_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -3941,99 +14784,198 @@ int cpath_test_path_get_path_type_wide(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_RELATIVE );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_sanitized_filename_size",
+	 required_sanitized_filename_size,
+	 expected_filename_size );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type_wide(
-	          L"\\",
-	          1,
-	          &path_type,
-	          &error );
+	result = wide_string_compare(
+	          sanitized_filename,
+	          expected_filename,
+	          expected_filename_size );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
+
+	/* Test libcpath_path_get_sanitized_filename_to_buffer_wide with a sanitized filename that is too small
+	 */
+	result = libcpath_path_get_sanitized_filename_to_buffer_wide(
+	          test_filename,
+	          test_filename_length,
+	          sanitized_filename,
+	          expected_filename_size - 1,
+	          &required_sanitized_filename_size,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_ABSOLUTE );
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_sanitized_filename_size",
+	 required_sanitized_filename_size,
+	 expected_filename_size );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type_wide(
-	          L"c:",
-	          2,
-	          &path_type,
+	/* Test error cases
+	 */
+	result = libcpath_path_get_sanitized_filename_to_buffer_wide(
+	          NULL,
+	          test_filename_length,
+	          sanitized_filename,
+	          32,
+	          &required_sanitized_filename_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_RELATIVE );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type_wide(
-	          L"C:\\Windows",
-	          10,
-	          &path_type,
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_filename_to_buffer_wide(
+	          test_filename,
+	          0,
+	          sanitized_filename,
+	          32,
+	          &required_sanitized_filename_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_filename_to_buffer_wide(
+	          test_filename,
+	          test_filename_length,
+	          NULL,
+	          32,
+	          &required_sanitized_filename_size,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_ABSOLUTE );
+	 "result",
+	 result,
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type_wide(
-	          L"\\\\server\\share\\directory",
-	          24,
-	          &path_type,
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_filename_to_buffer_wide(
+	          test_filename,
+	          test_filename_length,
+	          sanitized_filename,
+	          (size_t) SSIZE_MAX + 1,
+	          &required_sanitized_filename_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_filename_to_buffer_wide(
+	          test_filename,
+	          test_filename_length,
+	          sanitized_filename,
+	          32,
+	          NULL,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_UNC );
+	 "result",
+	 result,
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type_wide(
-	          L"\\\\?\\Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}",
-	          48,
-	          &path_type,
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_sanitized_path function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_sanitized_path_wide(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	wchar_t *expected_path     = NULL;
+	wchar_t *sanitized_path    = NULL;
+	wchar_t *test_path         = NULL;
+	size_t expected_path_size  = 0;
+	size_t sanitized_path_size = 0;
+	size_t test_path_length    = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	/* Test libcpath_path_get_sanitized_path without replacement characters
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	test_path          = L"test\\test.txt";
+	test_path_length   = 13;
+	expected_path      = L"test\\test.txt";
+	expected_path_size = 14;
+#else
+	test_path          = L"test/test.txt";
+	test_path_length   = 13;
+	expected_path      = L"test/test.txt";
+	expected_path_size = 14;
+#endif
+
+	result = libcpath_path_get_sanitized_path_wide(
+	          test_path,
+	          test_path_length,
+	          &sanitized_path,
+	          &sanitized_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4041,39 +14983,54 @@ int cpath_test_path_get_path_type_wide(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_EXTENDED_LENGTH );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "sanitized_path",
+	 sanitized_path );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_size",
+	 sanitized_path_size,
+	 expected_path_size );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type_wide(
-	          L"\\\\.\\PhysicalDrive0",
-	          18,
-	          &path_type,
-	          &error );
+	result = narrow_string_compare(
+	          sanitized_path,
+	          expected_path,
+	          expected_path_size );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_DEVICE );
+	memory_free(
+	 sanitized_path );
 
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	sanitized_path      = NULL;
+	sanitized_path_size = 0;
 
-	result = libcpath_path_get_path_type_wide(
-	          L"\\\\.\\C:",
-	          6,
-	          &path_type,
+	/* Test libcpath_path_get_sanitized_path with replacement characters
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	test_path          = L"test\\t\x00sT!.t^|";
+	test_path_length   = 14;
+	expected_path      = L"test\\t^x00sT^x21.t^^^x7c";
+	expected_path_size = 25;
+#else
+	test_path          = L"test/t\x00sT!.t\\|";
+	test_path_length   = 14;
+	expected_path      = L"test/t\\x00sT\\x21.t\\\\\\x7c";
+	expected_path_size = 25;
+#endif
+
+	result = libcpath_path_get_sanitized_path_wide(
+	          test_path,
+	          test_path_length,
+	          &sanitized_path,
+	          &sanitized_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4081,81 +15038,88 @@ int cpath_test_path_get_path_type_wide(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_DEVICE );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "sanitized_path",
+	 sanitized_path );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "sanitized_path_size",
+	 sanitized_path_size,
+	 expected_path_size );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type_wide(
-	          L"\\\\.\\C:\\",
-	          7,
-	          &path_type,
-	          &error );
+	result = narrow_string_compare(
+	          sanitized_path,
+	          expected_path,
+	          expected_path_size );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_DEVICE );
+	memory_free(
+	 sanitized_path );
 
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	sanitized_path      = NULL;
+	sanitized_path_size = 0;
 
-	result = libcpath_path_get_path_type_wide(
-	          L"\\\\?\\C:\\Windows",
-	          14,
-	          &path_type,
+	/* Test error cases
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	test_path        = L"test\\test.txt";
+	test_path_length = 13;
+#else
+	test_path        = L"test/test.txt";
+	test_path_length = 13;
+#endif
+
+	result = libcpath_path_get_sanitized_path_wide(
+	          NULL,
+	          test_path_length,
+	          &sanitized_path,
+	          &sanitized_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_EXTENDED_LENGTH );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_path_type_wide(
-	          L"\\\\?\\UNC\\server\\share\\directory",
-	          30,
-	          &path_type,
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_path_wide(
+	          test_path,
+	          (size_t) -1,
+	          &sanitized_path,
+	          &sanitized_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "path_type",
-	 path_type,
-	 LIBCPATH_TYPE_EXTENDED_LENGTH_UNC );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcpath_path_get_path_type_wide(
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_path_wide(
+	          test_path,
+	          test_path_length,
 	          NULL,
-	          1,
-	          &path_type,
+	          &sanitized_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4170,12 +15134,17 @@ int cpath_test_path_get_path_type_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_path_type_wide(
-	          L".",
-	          0,
-	          &path_type,
+	sanitized_path = (wchar_t *) 0x12345678UL;
+
+	result = libcpath_path_get_sanitized_path_wide(
+	          test_path,
+	          test_path_length,
+	          &sanitized_path,
+	          &sanitized_path_size,
 	          &error );
 
+	sanitized_path = NULL;
+
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -4188,10 +15157,11 @@ int cpath_test_path_get_path_type_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_path_type_wide(
-	          L".",
-	          (size_t) SSIZE_MAX + 1,
-	          &path_type,
+	result = libcpath_path_get_sanitized_path_wide(
+	          test_path,
+	          test_path_length,
+	          &sanitized_path,
+	          NULL,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4206,27 +15176,64 @@ int cpath_test_path_get_path_type_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_path_type_wide(
-	          L".",
-	          1,
-	          NULL,
-	          &error );
+#if defined( HAVE_CPATH_TEST_MEMORY )
+
+	/* Test libcpath_path_get_sanitized_path with malloc failing
+	 */
+	cpath_test_malloc_attempts_before_fail = 0;
+
+	result = libcpath_path_get_sanitized_path_wide(
+	          test_path,
+	          test_path_length,
+	          &sanitized_path,
+	          &sanitized_path_size,
+	          &error );
+
+	if( cpath_test_malloc_attempts_before_fail != -1 )
+	{
+		cpath_test_malloc_attempts_before_fail = -1;
+
+		if( sanitized_path != NULL )
+		{
+			memory_free(
+			 sanitized_path );
+
+			sanitized_path = NULL;
+		}
+	}
+	else
+	{
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "sanitized_path",
+		 sanitized_path );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "sanitized_path_size",
+		 sanitized_path_size,
+		 (size_t) 0 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
 
-	libcerror_error_free(
-	 &error );
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
 
 	return( 1 );
 
 on_error:
+	if( sanitized_path != NULL )
+	{
+		memory_free(
+		 sanitized_path );
+	}
 	if( error != NULL )
 	{
 		libcerror_error_free(
@@ -4235,26 +15242,42 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcpath_path_get_volume_name_wide function
+/* Tests the libcpath_path_get_sanitized_path_to_buffer_wide function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_path_get_volume_name_wide(
+int cpath_test_path_get_sanitized_path_to_buffer_wide(
      void )
 {
-	libcerror_error_t *error    = NULL;
-	wchar_t *volume_name        = NULL;
-	size_t directory_name_index = 0;
-	size_t volume_name_length   = 0;
-	int result                  = 0;
+	wchar_t sanitized_path[ 32 ];
+
+	libcerror_error_t *error            = NULL;
+	wchar_t *expected_path              = NULL;
+	wchar_t *test_path                  = NULL;
+	size_t expected_path_size           = 0;
+	size_t required_sanitized_path_size = 0;
+	size_t test_path_length             = 0;
+	int result                          = 0;
 
 	/* Test regular cases
 	 */
-	result = libcpath_path_get_volume_name_wide(
-	          L".",
-	          1,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	test_path          = L"test\\t\x00sT!.t^|";
+	test_path_length   = 14;
+	expected_path      = L"test\\t^x00sT^x21.t^^^x7c";
+	expected_path_size = 25;
+#else
+	test_path          = L"test/t\x00sT!.t\\|";
+	test_path_length   = 14;
+	expected_path      = L"test/t\\x00sT\\x21.t\\\\\\x7c";
+	expected_path_size = 25;
+#endif
+
+	result = libcpath_path_get_sanitized_path_to_buffer_wide(
+	          test_path,
+	          test_path_length,
+	          sanitized_path,
+	          32,
+	          &required_sanitized_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4263,261 +15286,194 @@ int cpath_test_path_get_volume_name_wide(
 	 1 );
 
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 0 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 0 );
+	 "required_sanitized_path_size",
+	 required_sanitized_path_size,
+	 expected_path_size );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_volume_name_wide(
-	          L"\\",
-	          1,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
-	          &error );
+	result = wide_string_compare(
+	          sanitized_path,
+	          expected_path,
+	          expected_path_size );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 (size_t) 0 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 (size_t) 0 );
-
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	 0 );
 
-	result = libcpath_path_get_volume_name_wide(
-	          L"c:",
-	          2,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	/* Test libcpath_path_get_sanitized_path_to_buffer_wide with a sanitized path that is too small
+	 */
+	result = libcpath_path_get_sanitized_path_to_buffer_wide(
+	          test_path,
+	          test_path_length,
+	          sanitized_path,
+	          expected_path_size - 1,
+	          &required_sanitized_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 (size_t) 2 );
+	 0 );
 
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 (size_t) 2 );
+	 "required_sanitized_path_size",
+	 required_sanitized_path_size,
+	 expected_path_size );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = wide_string_compare(
-	          volume_name,
-	          L"c:",
-	          2 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
-
-	result = libcpath_path_get_volume_name_wide(
-	          L"C:\\Windows",
-	          10,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	/* Test error cases
+	 */
+	result = libcpath_path_get_sanitized_path_to_buffer_wide(
+	          NULL,
+	          test_path_length,
+	          sanitized_path,
+	          32,
+	          &required_sanitized_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 (size_t) 2 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 (size_t) 3 );
-
-	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = wide_string_compare(
-	          volume_name,
-	          L"C:",
-	          2 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+	libcerror_error_free(
+	 &error );
 
-	result = libcpath_path_get_volume_name_wide(
-	          L"\\\\server\\share\\directory",
-	          24,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	result = libcpath_path_get_sanitized_path_to_buffer_wide(
+	          test_path,
+	          0,
+	          sanitized_path,
+	          32,
+	          &required_sanitized_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 (size_t) 12 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 (size_t) 15 );
-
-	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = wide_string_compare(
-	          volume_name,
-	          L"server\\share",
-	          12 );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+	libcerror_error_free(
+	 &error );
 
-	result = libcpath_path_get_volume_name_wide(
-	          L"\\\\?\\Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}",
-	          48,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	result = libcpath_path_get_sanitized_path_to_buffer_wide(
+	          test_path,
+	          test_path_length,
+	          NULL,
+	          32,
+	          &required_sanitized_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 44 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 48 );
-
-	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = wide_string_compare(
-	          volume_name,
-	          L"Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}",
-	          44 );
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_path_to_buffer_wide(
+	          test_path,
+	          test_path_length,
+	          sanitized_path,
+	          (size_t) SSIZE_MAX + 1,
+	          &required_sanitized_path_size,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	result = libcpath_path_get_volume_name_wide(
-	          L"\\\\.\\PhysicalDrive0",
-	          18,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_sanitized_path_to_buffer_wide(
+	          test_path,
+	          test_path_length,
+	          sanitized_path,
+	          32,
+	          NULL,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 14 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 18 );
-
-	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = wide_string_compare(
-	          volume_name,
-	          L"PhysicalDrive0",
-	          14 );
+	libcerror_error_free(
+	 &error );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+	return( 1 );
 
-	result = libcpath_path_get_volume_name_wide(
-	          L"\\\\.\\C:",
-	          6,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_unsanitized_filename_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_unsanitized_filename_wide(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	wchar_t *expected_filename       = NULL;
+	wchar_t *sanitized_filename      = NULL;
+	wchar_t *unsanitized_filename    = NULL;
+	size_t expected_filename_size    = 0;
+	size_t sanitized_filename_length = 0;
+	size_t unsanitized_filename_size = 0;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	sanitized_filename        = L"t^x00sT^x21.t^^^x7c";
+	sanitized_filename_length = 19;
+	expected_filename         = L"t\x00sT!.t^|";
+	expected_filename_size    = 10;
+#else
+	sanitized_filename        = L"t\\x00sT\\x21.t\\\\\\x7c";
+	sanitized_filename_length = 19;
+	expected_filename         = L"t\x00sT!.t\\|";
+	expected_filename_size    = 10;
+#endif
+	result = libcpath_path_get_unsanitized_filename_wide(
+	          sanitized_filename,
+	          sanitized_filename_length,
+	          &unsanitized_filename,
+	          &unsanitized_filename_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4526,204 +15482,271 @@ int cpath_test_path_get_volume_name_wide(
 	 1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 2 );
+	 "unsanitized_filename",
+	 unsanitized_filename );
 
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 6 );
+	 "unsanitized_filename_size",
+	 unsanitized_filename_size,
+	 expected_filename_size );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = wide_string_compare(
-	          volume_name,
-	          L"C:",
-	          2 );
+	result = memory_compare(
+	          unsanitized_filename,
+	          expected_filename,
+	          sizeof( wchar_t ) * expected_filename_size );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 0 );
 
-	result = libcpath_path_get_volume_name_wide(
-	          L"\\\\.\\C:\\",
-	          7,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	memory_free(
+	 unsanitized_filename );
+
+	unsanitized_filename      = NULL;
+	unsanitized_filename_size = 0;
+
+	/* Test error cases
+	 */
+	result = libcpath_path_get_unsanitized_filename_wide(
+	          NULL,
+	          sanitized_filename_length,
+	          &unsanitized_filename,
+	          &unsanitized_filename_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
+	 "error",
+	 error );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 2 );
+	libcerror_error_free(
+	 &error );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 7 );
+	result = libcpath_path_get_unsanitized_filename_wide(
+	          sanitized_filename,
+	          0,
+	          &unsanitized_filename,
+	          &unsanitized_filename_size,
+	          &error );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = wide_string_compare(
-	          volume_name,
-	          L"C:",
-	          2 );
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_unsanitized_filename_wide(
+	          sanitized_filename,
+	          (size_t) SSIZE_MAX,
+	          &unsanitized_filename,
+	          &unsanitized_filename_size,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	result = libcpath_path_get_volume_name_wide(
-	          L"\\\\?\\C:\\Windows",
-	          14,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_unsanitized_filename_wide(
+	          sanitized_filename,
+	          sanitized_filename_length,
+	          NULL,
+	          &unsanitized_filename_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
+	 "error",
+	 error );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 2 );
+	libcerror_error_free(
+	 &error );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 7 );
+	unsanitized_filename = (wchar_t *) 0x12345678UL;
 
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	result = libcpath_path_get_unsanitized_filename_wide(
+	          sanitized_filename,
+	          sanitized_filename_length,
+	          &unsanitized_filename,
+	          &unsanitized_filename_size,
+	          &error );
 
-	result = wide_string_compare(
-	          volume_name,
-	          L"C:",
-	          2 );
+	unsanitized_filename = NULL;
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	result = libcpath_path_get_volume_name_wide(
-	          L"\\\\?\\UNC\\server\\share\\directory",
-	          30,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_unsanitized_filename_wide(
+	          sanitized_filename,
+	          sanitized_filename_length,
+	          &unsanitized_filename,
+	          NULL,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "volume_name",
-	 volume_name );
+	 "error",
+	 error );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "volume_name_length",
-	 volume_name_length,
-	 12 );
+	libcerror_error_free(
+	 &error );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "directory_name_index",
-	 directory_name_index,
-	 21 );
+	/* Test with an unsupported escape sequence
+	 */
+	result = libcpath_path_get_unsanitized_filename_wide(
+	          sanitized_filename,
+	          3,
+	          &unsanitized_filename,
+	          &unsanitized_filename_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	CPATH_TEST_ASSERT_IS_NULL(
+	 "unsanitized_filename",
+	 unsanitized_filename );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = wide_string_compare(
-	          volume_name,
-	          L"server\\share",
-	          12 );
+	libcerror_error_free(
+	 &error );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+	return( 1 );
 
-	/* Test error cases
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( unsanitized_filename != NULL )
+	{
+		memory_free(
+		 unsanitized_filename );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_unsanitized_path_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_unsanitized_path_wide(
+     void )
+{
+	libcerror_error_t *error     = NULL;
+	wchar_t *expected_path       = NULL;
+	wchar_t *sanitized_path      = NULL;
+	wchar_t *unsanitized_path    = NULL;
+	size_t expected_path_size    = 0;
+	size_t sanitized_path_length = 0;
+	size_t unsanitized_path_size = 0;
+	int result                   = 0;
+
+	/* Test regular cases
 	 */
-	result = libcpath_path_get_volume_name_wide(
-	          NULL,
-	          1,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	sanitized_path        = L"dir\\t^x00sT^x21.t^^^x7c";
+	sanitized_path_length = 23;
+	expected_path         = L"dir\\t\x00sT!.t^|";
+	expected_path_size    = 14;
+#else
+	sanitized_path        = L"dir/t\\x00sT\\x21.t\\\\\\x7c";
+	sanitized_path_length = 23;
+	expected_path         = L"dir/t\x00sT!.t\\|";
+	expected_path_size    = 14;
+#endif
+	result = libcpath_path_get_unsanitized_path_wide(
+	          sanitized_path,
+	          sanitized_path_length,
+	          &unsanitized_path,
+	          &unsanitized_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "unsanitized_path",
+	 unsanitized_path );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "unsanitized_path_size",
+	 unsanitized_path_size,
+	 expected_path_size );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcpath_path_get_volume_name_wide(
-	          L".",
-	          0,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
-	          &error );
+	result = memory_compare(
+	          unsanitized_path,
+	          expected_path,
+	          sizeof( wchar_t ) * expected_path_size );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+	memory_free(
+	 unsanitized_path );
 
-	libcerror_error_free(
-	 &error );
+	unsanitized_path      = NULL;
+	unsanitized_path_size = 0;
 
-	result = libcpath_path_get_volume_name_wide(
-	          L".",
-	          (size_t) SSIZE_MAX + 1,
-	          &volume_name,
-	          &volume_name_length,
-	          &directory_name_index,
+	/* Test error cases
+	 */
+	result = libcpath_path_get_unsanitized_path_wide(
+	          NULL,
+	          sanitized_path_length,
+	          &unsanitized_path,
+	          &unsanitized_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4738,12 +15761,11 @@ int cpath_test_path_get_volume_name_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_volume_name_wide(
-	          L".",
-	          1,
-	          NULL,
-	          &volume_name_length,
-	          &directory_name_index,
+	result = libcpath_path_get_unsanitized_path_wide(
+	          sanitized_path,
+	          0,
+	          &unsanitized_path,
+	          &unsanitized_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4758,12 +15780,11 @@ int cpath_test_path_get_volume_name_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_volume_name_wide(
-	          L".",
-	          1,
-	          &volume_name,
-	          NULL,
-	          &directory_name_index,
+	result = libcpath_path_get_unsanitized_path_wide(
+	          sanitized_path,
+	          (size_t) SSIZE_MAX,
+	          &unsanitized_path,
+	          &unsanitized_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4778,12 +15799,11 @@ int cpath_test_path_get_volume_name_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_volume_name_wide(
-	          L".",
-	          1,
-	          &volume_name,
-	          &volume_name_length,
+	result = libcpath_path_get_unsanitized_path_wide(
+	          sanitized_path,
+	          sanitized_path_length,
 	          NULL,
+	          &unsanitized_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4798,54 +15818,16 @@ int cpath_test_path_get_volume_name_wide(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libcpath_path_get_current_working_directory_by_volume_wide function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_path_get_current_working_directory_by_volume_wide(
-     void )
-{
-	libcerror_error_t *error              = NULL;
-	wchar_t *current_working_directory    = NULL;
-	size_t current_working_directory_size = 0;
-	int result                            = 0;
+	unsanitized_path = (wchar_t *) 0x12345678UL;
 
-	/* Test regular cases
-	 */
-	result = libcpath_path_get_current_working_directory_by_volume_wide(
-	          L"C:",
-	          2,
-	          &current_working_directory,
-	          &current_working_directory_size,
+	result = libcpath_path_get_unsanitized_path_wide(
+	          sanitized_path,
+	          sanitized_path_length,
+	          &unsanitized_path,
+	          &unsanitized_path_size,
 	          &error );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	/* Test error cases
-	 */
-	result = libcpath_path_get_current_working_directory_by_volume_wide(
-	          L"C:",
-	          (size_t) SSIZE_MAX + 1,
-	          &current_working_directory,
-	          &current_working_directory_size,
-	          &error );
+	unsanitized_path = NULL;
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -4859,11 +15841,11 @@ int cpath_test_path_get_current_working_directory_by_volume_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_current_working_directory_by_volume_wide(
-	          L"C:",
-	          2,
+	result = libcpath_path_get_unsanitized_path_wide(
+	          sanitized_path,
+	          sanitized_path_length,
+	          &unsanitized_path,
 	          NULL,
-	          &current_working_directory_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4878,11 +15860,13 @@ int cpath_test_path_get_current_working_directory_by_volume_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_current_working_directory_by_volume_wide(
-	          L"C:",
-	          2,
-	          &current_working_directory,
-	          NULL,
+	/* Test with an unsupported escape sequence
+	 */
+	result = libcpath_path_get_unsanitized_path_wide(
+	          sanitized_path,
+	          7,
+	          &unsanitized_path,
+	          &unsanitized_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4890,6 +15874,10 @@ int cpath_test_path_get_current_working_directory_by_volume_wide(
 	 result,
 	 -1 );
 
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "unsanitized_path",
+	 unsanitized_path );
+
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -4905,80 +15893,91 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( unsanitized_path != NULL )
+	{
+		memory_free(
+		 unsanitized_path );
+	}
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) */
-
-/* Tests the libcpath_path_get_full_path_wide function
+/* Tests the libcpath_path_join_wide function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_path_get_full_path_wide(
+int cpath_test_path_join_wide(
      void )
 {
-#if defined( WINAPI ) || defined( __MINGW32__ )
-	wchar_t *absolute_paths[] = {
-		L"\\home\\user\\test.txt",
-		L"c:\\home\\user\\test.txt",
-		L"c:\\home\\user\\\\test.txt",
-		L"c:\\home\\username\\..\\user\\test.txt",
-		L"c:\\..\\home\\user\\test.txt",
-		L"c:\\..\\home\\username\\..\\user\\test.txt",
-	};
-	wchar_t *relative_paths[] = {
-		L"user\\test.txt",
-		L"username\\..\\user\\test.txt",
-	};
-#if defined( WINAPI )
-	wchar_t *special_paths[] = {
-		L"\\\\.\\PhysicalDrive0",
-		L"\\\\?\\Volume{4c1b02c4-d990-11dc-99ae-806e6f6e6963}"
-	};
-	wchar_t *unc_paths[] = {
-		L"\\\\172.0.0.1\\C$\\test.txt",
-		L"\\\\?\\UNC\\172.0.0.1\\C$\\test.txt",
-	};
-#endif /* defined( WINAPI ) */
-#else
-	wchar_t *absolute_paths[] = {
-		L"/home/user/test.txt",
-		L"/home/user//test.txt",
-		L"/../home/user/test.txt",
-		L"/../home/username/../user/test.txt",
-	};
-	wchar_t *relative_paths[] = {
-		L"user/test.txt",
-		L"username/../user/test.txt",
-	};
-#endif /* defined( WINAPI ) || defined( __MINGW32__ ) */
-
-	libcerror_error_t *error                = NULL;
-	wchar_t *current_working_directory      = NULL;
-	wchar_t *expected_path                  = NULL;
-	wchar_t *full_path                      = NULL;
-	wchar_t *path                           = NULL;
-	size_t current_working_directory_length = 0;
-	size_t current_working_directory_size   = 0;
-	size_t expected_full_path_length        = 0;
-	size_t expected_path_length             = 0;
-	size_t full_path_length                 = 0;
-	size_t full_path_size                   = 0;
-	size_t path_length                      = 0;
-	int path_index                          = 0;
-	int result                              = 0;
-	int string_index                        = 0;
+	libcerror_error_t *error     = NULL;
+	const wchar_t *expected_path = NULL;
+	wchar_t *path                = NULL;
+	const wchar_t *test_path1    = NULL;
+	const wchar_t *test_path2    = NULL;
+	const wchar_t *test_path3    = NULL;
+	const wchar_t *test_path4    = NULL;
+	size_t path_size             = 0;
+	int result                   = 0;
 
+	/* Test regular cases
+	 */
 #if defined( WINAPI ) || defined( __MINGW32__ )
-	int number_of_absolute_paths            = 6;
+	test_path1    = L"\\first\\second";
+	test_path2    = L"third\\fourth";
+	test_path3    = L"\\first\\second\\";
+	test_path4    = L"\\third\\fourth";
+	expected_path = L"\\first\\second\\third\\fourth";
 #else
-	int number_of_absolute_paths            = 4;
+	test_path1    = L"/first/second";
+	test_path2    = L"third/fourth";
+	test_path3    = L"/first/second/";
+	test_path4    = L"/third/fourth";
+	expected_path = L"/first/second/third/fourth";
 #endif
 
-	/* Initialize test
-	 */
-	result = libcpath_path_get_current_working_directory_wide(
-	          &current_working_directory,
-	          &current_working_directory_size,
+	result = libcpath_path_join_wide(
+	          &path,
+	          &path_size,
+	          test_path1,
+	          13,
+	          test_path2,
+	          12,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          path,
+	          expected_path,
+	          26 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 path );
+
+	path = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_size",
+	 path_size,
+	 (size_t) 27 );
+
+	result = libcpath_path_join_wide(
+	          &path,
+	          &path_size,
+	          test_path3,
+	          14,
+	          test_path2,
+	          12,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -4986,352 +15985,334 @@ int cpath_test_path_get_full_path_wide(
 	 result,
 	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "current_working_directory",
-	 current_working_directory );
-
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	current_working_directory_length = wide_string_length(
-	                                    current_working_directory );
-
-	/* Test regular cases
-	 */
-#if defined( WINAPI )
-	expected_path = L"\\\\?\\C:\\home\\user\\test.txt";
-#elif defined( __MINGW32__ )
-	expected_path = L"C:\\home\\user\\test.txt";
-#else
-	expected_path = L"/home/user/test.txt";
-#endif
-	expected_path_length = wide_string_length(
-	                        expected_path );
-
-	for( path_index = 0;
-	     path_index < number_of_absolute_paths;
-	     path_index++ )
-	{
-		path = absolute_paths[ path_index ];
-
-		path_length = wide_string_length(
-		               path );
-
-		result = libcpath_path_get_full_path_wide(
-		          path,
-		          path_length,
-		          &full_path,
-		          &full_path_size,
-		          &error );
+	result = narrow_string_compare(
+	          path,
+	          expected_path,
+	          26 );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "full_path",
-		 full_path );
+	memory_free(
+	 path );
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_size",
-		 full_path_size,
-		 expected_path_length + 1 );
+	path = NULL;
 
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_size",
+	 path_size,
+	 (size_t) 27 );
 
-		full_path_length = wide_string_length(
-		                    full_path );
+	result = libcpath_path_join_wide(
+	          &path,
+	          &path_size,
+	          test_path1,
+	          13,
+	          test_path4,
+	          13,
+	          &error );
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_size",
-		 full_path_size,
-		 full_path_length + 1 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		/* Skip the drive letter in the comparison, given it is determined runtime */
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-#if defined( WINAPI )
-		if( ( full_path[ 0 ] != (wchar_t) '\\' )
-		 || ( full_path[ 1 ] != (wchar_t) '\\' )
-		 || ( full_path[ 2 ] != (wchar_t) '?' )
-		 || ( full_path[ 3 ] != (wchar_t) '\\' ) )
-		{
-			result = 1;
-		}
-		else
-		{
-			result = wide_string_compare_no_case(
-			          &( full_path[ 5 ] ),
-			          &( expected_path[ 5 ] ),
-			          expected_path_length - 5 );
-		}
-#elif defined( __MINGW32__ )
-		result = wide_string_compare_no_case(
-		          &( full_path[ 2 ] ),
-		          &( expected_path[ 2 ] ),
-		          expected_path_length - 2 );
-#else
-		result = wide_string_compare(
-		          full_path,
-		          expected_path,
-		          expected_path_length );
-#endif
+	result = narrow_string_compare(
+	          path,
+	          expected_path,
+	          26 );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		memory_free(
-		 full_path );
+	memory_free(
+	 path );
 
-		full_path = NULL;
-	}
-#if defined( WINAPI ) || defined( __MINGW32__ )
-	expected_path = L"\\user\\test.txt";
-#else
-	expected_path = L"/user/test.txt";
-#endif
-	expected_path_length = wide_string_length(
-	                        expected_path );
+	path = NULL;
 
-	expected_full_path_length = current_working_directory_length + expected_path_length;
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_size",
+	 path_size,
+	 (size_t) 27 );
 
-#if defined( WINAPI )
-	expected_full_path_length += 4;
-#endif
+	/* Test error cases
+	 */
+	result = libcpath_path_join_wide(
+	          NULL,
+	          &path_size,
+	          test_path1,
+	          13,
+	          test_path2,
+	          12,
+	          &error );
 
-	for( path_index = 0;
-	     path_index < 2;
-	     path_index++ )
-	{
-		path = relative_paths[ path_index ];
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		path_length = wide_string_length(
-		               path );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		result = libcpath_path_get_full_path_wide(
-		          path,
-		          path_length,
-		          &full_path,
-		          &full_path_size,
-		          &error );
+	libcerror_error_free(
+	 &error );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	path = (wchar_t *) 0x12345678UL;
 
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "full_path",
-		 full_path );
+	result = libcpath_path_join_wide(
+	          &path,
+	          &path_size,
+	          test_path1,
+	          13,
+	          test_path2,
+	          12,
+	          &error );
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_size",
-		 full_path_size,
-		 expected_full_path_length + 1 );
+	path = NULL;
 
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-#if defined( WINAPI )
-		/* A full path on Windows is prefixed with \\?\ while
-		 * the current working directory is not.
-		 */
-		result = wide_string_compare_no_case(
-		          full_path,
-		          L"\\\\?\\",
-		          4 );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
+	libcerror_error_free(
+	 &error );
 
-		string_index = 4;
-#else
-		string_index = 0;
-#endif
-#if defined( WINAPI ) || defined( __MINGW32__ )
-		result = wide_string_compare_no_case(
-		          &( full_path[ string_index ] ),
-		          current_working_directory,
-		          current_working_directory_length );
-#else
-		result = wide_string_compare(
-		          &( full_path[ string_index ] ),
-		          current_working_directory,
-		          current_working_directory_length );
-#endif
+	result = libcpath_path_join_wide(
+	          &path,
+	          NULL,
+	          test_path1,
+	          13,
+	          test_path2,
+	          12,
+	          &error );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-#if defined( WINAPI ) || defined( __MINGW32__ )
-		result = wide_string_compare_no_case(
-		          &( full_path[ string_index + current_working_directory_length ] ),
-		          expected_path,
-		          expected_path_length );
-#else
-		result = wide_string_compare(
-		          &( full_path[ string_index + current_working_directory_length ] ),
-		          expected_path,
-		          expected_path_length );
-#endif
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
+	libcerror_error_free(
+	 &error );
 
-		full_path_length = wide_string_length(
-		                    full_path );
+	result = libcpath_path_join_wide(
+	          &path,
+	          &path_size,
+	          NULL,
+	          13,
+	          test_path2,
+	          12,
+	          &error );
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_length",
-		 full_path_length,
-		 expected_full_path_length );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		memory_free(
-		 full_path );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		full_path = NULL;
-	}
-#if defined( WINAPI )
-	for( path_index = 0;
-	     path_index < 2;
-	     path_index++ )
-	{
-		path = special_paths[ path_index ];
+	libcerror_error_free(
+	 &error );
 
-		path_length = wide_string_length(
-		               path );
+	result = libcpath_path_join_wide(
+	          &path,
+	          &path_size,
+	          test_path1,
+	          (size_t) SSIZE_MAX + 1,
+	          test_path2,
+	          12,
+	          &error );
 
-		result = libcpath_path_get_full_path_wide(
-		          path,
-		          path_length,
-		          &full_path,
-		          &full_path_size,
-		          &error );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "full_path",
-		 full_path );
+	libcerror_error_free(
+	 &error );
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_size",
-		 full_path_size,
-		 path_length + 1 );
+	result = libcpath_path_join_wide(
+	          &path,
+	          &path_size,
+	          test_path1,
+	          13,
+	          NULL,
+	          12,
+	          &error );
 
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		result = wide_string_compare_no_case(
-		          full_path,
-		          path,
-		          path_length );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
+	libcerror_error_free(
+	 &error );
 
-		full_path_length = wide_string_length(
-		                    full_path );
+	result = libcpath_path_join_wide(
+	          &path,
+	          &path_size,
+	          test_path1,
+	          13,
+	          test_path2,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_length",
-		 full_path_length,
-		 path_length );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		memory_free(
-		 full_path );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		full_path = NULL;
-	}
-	expected_path = L"\\\\?\\UNC\\172.0.0.1\\C$\\test.txt";
+	libcerror_error_free(
+	 &error );
 
-	expected_path_length = wide_string_length(
-	                        expected_path );
+	return( 1 );
 
-	for( path_index = 0;
-	     path_index < 2;
-	     path_index++ )
+on_error:
+	if( error != NULL )
 	{
-		path = unc_paths[ path_index ];
+		libcerror_error_free(
+		 &error );
+	}
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	return( 0 );
+}
 
-		path_length = wide_string_length(
-		               path );
+/* Tests the libcpath_path_join_to_buffer_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_join_to_buffer_wide(
+     void )
+{
+	wchar_t path[ 32 ];
 
-		result = libcpath_path_get_full_path_wide(
-		          path,
-		          path_length,
-		          &full_path,
-		          &full_path_size,
-		          &error );
+	libcerror_error_t *error     = NULL;
+	const wchar_t *expected_path = NULL;
+	const wchar_t *test_path1    = NULL;
+	const wchar_t *test_path2    = NULL;
+	size_t required_path_size    = 0;
+	int result                   = 0;
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	/* Test regular cases
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	test_path1    = L"\\first\\second\\";
+	test_path2    = L"\\third\\fourth";
+	expected_path = L"\\first\\second\\third\\fourth";
+#else
+	test_path1    = L"/first/second/";
+	test_path2    = L"/third/fourth";
+	expected_path = L"/first/second/third/fourth";
+#endif
 
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "full_path",
-		 full_path );
+	result = libcpath_path_join_to_buffer_wide(
+	          path,
+	          32,
+	          &required_path_size,
+	          test_path1,
+	          14,
+	          test_path2,
+	          13,
+	          &error );
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_size",
-		 full_path_size,
-		 expected_path_length + 1 );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_path_size",
+	 required_path_size,
+	 (size_t) 27 );
 
-		result = wide_string_compare_no_case(
-		          full_path,
-		          expected_path,
-		          expected_path_length );
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 0 );
+	result = wide_string_compare(
+	          path,
+	          expected_path,
+	          27 );
 
-		full_path_length = wide_string_length(
-		                    full_path );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "full_path_length",
-		 full_path_length,
-		 expected_path_length );
+	/* Test libcpath_path_join_to_buffer_wide with a path that is too small
+	 */
+	result = libcpath_path_join_to_buffer_wide(
+	          path,
+	          26,
+	          &required_path_size,
+	          test_path1,
+	          14,
+	          test_path2,
+	          13,
+	          &error );
 
-		memory_free(
-		 full_path );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
 
-		full_path = NULL;
-	}
-#endif /* defined( WINAPI ) */
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "required_path_size",
+	 required_path_size,
+	 (size_t) 27 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test error cases
 	 */
-	result = libcpath_path_get_full_path_wide(
+	result = libcpath_path_join_to_buffer_wide(
 	          NULL,
-	          8,
-	          &full_path,
-	          &full_path_size,
+	          32,
+	          &required_path_size,
+	          test_path1,
+	          14,
+	          test_path2,
+	          13,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -5346,11 +16327,14 @@ int cpath_test_path_get_full_path_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_full_path_wide(
-	          L"test.txt",
-	          0,
-	          &full_path,
-	          &full_path_size,
+	result = libcpath_path_join_to_buffer_wide(
+	          path,
+	          (size_t) SSIZE_MAX + 1,
+	          &required_path_size,
+	          test_path1,
+	          14,
+	          test_path2,
+	          13,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -5365,11 +16349,14 @@ int cpath_test_path_get_full_path_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_full_path_wide(
-	          L"test.txt",
-	          (size_t) -1,
-	          &full_path,
-	          &full_path_size,
+	result = libcpath_path_join_to_buffer_wide(
+	          path,
+	          32,
+	          NULL,
+	          test_path1,
+	          14,
+	          test_path2,
+	          13,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -5384,11 +16371,14 @@ int cpath_test_path_get_full_path_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_full_path_wide(
-	          L"test.txt",
-	          8,
+	result = libcpath_path_join_to_buffer_wide(
+	          path,
+	          32,
+	          &required_path_size,
 	          NULL,
-	          &full_path_size,
+	          14,
+	          test_path2,
+	          13,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -5403,17 +16393,16 @@ int cpath_test_path_get_full_path_wide(
 	libcerror_error_free(
 	 &error );
 
-	full_path = (wchar_t *) 0x12345678UL;
-
-	result = libcpath_path_get_full_path_wide(
-	          L"test.txt",
-	          8,
-	          &full_path,
-	          &full_path_size,
+	result = libcpath_path_join_to_buffer_wide(
+	          path,
+	          32,
+	          &required_path_size,
+	          test_path1,
+	          (size_t) SSIZE_MAX + 1,
+	          test_path2,
+	          13,
 	          &error );
 
-	full_path = NULL;
-
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -5426,11 +16415,14 @@ int cpath_test_path_get_full_path_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_full_path_wide(
-	          L"test.txt",
-	          8,
-	          &full_path,
+	result = libcpath_path_join_to_buffer_wide(
+	          path,
+	          32,
+	          &required_path_size,
+	          test_path1,
+	          14,
 	          NULL,
+	          13,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -5445,47 +16437,27 @@ int cpath_test_path_get_full_path_wide(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_CPATH_TEST_FUNCTION_HOOK )
-
-	/* Test libcpath_path_change_directory with getcwd failing
-	 */
-	cpath_test_getcwd_attempts_before_fail = 0;
-
-	result = libcpath_path_get_full_path_wide(
-	          L"test.txt",
-	          8,
-	          &full_path,
-	          &full_path_size,
+	result = libcpath_path_join_to_buffer_wide(
+	          path,
+	          32,
+	          &required_path_size,
+	          test_path1,
+	          14,
+	          test_path2,
+	          (size_t) SSIZE_MAX + 1,
 	          &error );
 
-	if( cpath_test_getcwd_attempts_before_fail != -1 )
-	{
-		cpath_test_getcwd_attempts_before_fail = -1;
-	}
-	else
-	{
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "full_path",
-		 full_path );
-
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_CPATH_TEST_FUNCTION_HOOK ) */
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	/* Clean up
-	 */
-	memory_free(
-	 current_working_directory );
+	libcerror_error_free(
+	 &error );
 
 	return( 1 );
 
@@ -5495,114 +16467,263 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( full_path != NULL )
-	{
-		memory_free(
-		 full_path );
-	}
-	if( current_working_directory != NULL )
-	{
-		memory_free(
-		 current_working_directory );
-	}
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
-
-/* Tests the libcpath_path_get_sanitized_character_size_wide function
+/* Tests the libcpath_path_join_normalized_wide function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_path_get_sanitized_character_size_wide(
+int cpath_test_path_join_normalized_wide(
      void )
 {
-	libcerror_error_t *error        = NULL;
-	size_t sanitized_character_size = 0;
-	int result                      = 0;
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	wchar_t *directory_names[ 7 ] = {
+		L"C:\\home\\\\user\\.\\", L"C:\\", L"home\\user", L"home", L"\\\\server\\share", L"", L"" };
+	wchar_t *filenames[ 7 ] = {
+		L"..\\other\\.\\file.txt", L"..\\..\\file.txt", L"..\\..\\..\\file.txt", L"..", L"dir\\..\\file.txt", L".", L"file.txt" };
+	wchar_t *expected_paths[ 7 ] = {
+		L"C:\\home\\other\\file.txt", L"C:\\file.txt", L"..\\file.txt", L".", L"\\\\server\\share\\file.txt", L".", L"file.txt" };
+#else
+	wchar_t *directory_names[ 7 ] = {
+		L"/home//user/./", L"/", L"home/user", L"home", L"//home", L"", L"" };
+	wchar_t *filenames[ 7 ] = {
+		L"../other/./file.txt", L"../../file.txt", L"../../../file.txt", L"..", L"dir/../file.txt", L".", L"file.txt" };
+	wchar_t *expected_paths[ 7 ] = {
+		L"/home/other/file.txt", L"/file.txt", L"../file.txt", L".", L"/home/file.txt", L".", L"file.txt" };
+#endif
+
+	libcerror_error_t *error     = NULL;
+	wchar_t *path                = NULL;
+	size_t directory_name_length = 0;
+	size_t expected_path_length  = 0;
+	size_t filename_length       = 0;
+	size_t path_size             = 0;
+	int result                   = 0;
+	int test_index               = 0;
 
 	/* Test regular cases
 	 */
-	result = libcpath_path_get_sanitized_character_size_wide(
-	          (wchar_t) 0,
-	          &sanitized_character_size,
+	for( test_index = 0;
+	     test_index < 7;
+	     test_index++ )
+	{
+		directory_name_length = wide_string_length(
+		                         directory_names[ test_index ] );
+
+		filename_length = wide_string_length(
+		                   filenames[ test_index ] );
+
+		expected_path_length = wide_string_length(
+		                        expected_paths[ test_index ] );
+
+		result = libcpath_path_join_normalized_wide(
+		          &path,
+		          &path_size,
+		          directory_names[ test_index ],
+		          directory_name_length,
+		          filenames[ test_index ],
+		          filename_length,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "path",
+		 path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "path_size",
+		 path_size,
+		 expected_path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = wide_string_compare(
+		          path,
+		          expected_paths[ test_index ],
+		          path_size );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		memory_free(
+		 path );
+
+		path = NULL;
+	}
+	/* Test error cases
+	 */
+	directory_name_length = wide_string_length(
+	                         directory_names[ 0 ] );
+
+	filename_length = wide_string_length(
+	                   filenames[ 0 ] );
+
+	result = libcpath_path_join_normalized_wide(
+	          NULL,
+	          &path_size,
+	          directory_names[ 0 ],
+	          directory_name_length,
+	          filenames[ 0 ],
+	          filename_length,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_character_size",
-	 sanitized_character_size,
-	 (size_t) 4 );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	libcerror_error_free(
+	 &error );
+
+	path = (wchar_t *) 0x12345678UL;
+
+	result = libcpath_path_join_normalized_wide(
+	          &path,
+	          &path_size,
+	          directory_names[ 0 ],
+	          directory_name_length,
+	          filenames[ 0 ],
+	          filename_length,
+	          &error );
+
+	path = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_sanitized_character_size_wide(
-	          (wchar_t) LIBCPATH_ESCAPE_CHARACTER,
-	          &sanitized_character_size,
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_normalized_wide(
+	          &path,
+	          NULL,
+	          directory_names[ 0 ],
+	          directory_name_length,
+	          filenames[ 0 ],
+	          filename_length,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_character_size",
-	 sanitized_character_size,
-	 (size_t) 2 );
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_normalized_wide(
+	          &path,
+	          &path_size,
+	          NULL,
+	          directory_name_length,
+	          filenames[ 0 ],
+	          filename_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_normalized_wide(
+	          &path,
+	          &path_size,
+	          directory_names[ 0 ],
+	          (size_t) SSIZE_MAX + 1,
+	          filenames[ 0 ],
+	          filename_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_sanitized_character_size_wide(
-	          (wchar_t) '!',
-	          &sanitized_character_size,
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_normalized_wide(
+	          &path,
+	          &path_size,
+	          directory_names[ 0 ],
+	          directory_name_length,
+	          NULL,
+	          filename_length,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_character_size",
-	 sanitized_character_size,
-	 (size_t) 4 );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = libcpath_path_get_sanitized_character_size_wide(
-	          (wchar_t) 'A',
-	          &sanitized_character_size,
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_normalized_wide(
+	          &path,
+	          &path_size,
+	          directory_names[ 0 ],
+	          directory_name_length,
+	          filenames[ 0 ],
+	          (size_t) SSIZE_MAX + 1,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_character_size",
-	 sanitized_character_size,
-	 (size_t) 1 );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libcpath_path_get_sanitized_character_size_wide(
-	          (wchar_t) 'A',
-	          NULL,
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_join_normalized_wide(
+	          &path,
+	          &path_size,
+	          directory_names[ 0 ],
+	          (size_t) SSIZE_MAX,
+	          filenames[ 0 ],
+	          filename_length,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -5625,223 +16746,386 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
 	return( 0 );
 }
 
-/* Tests the libcpath_path_get_sanitized_character_wide function
+/* Tests the libcpath_path_get_relative_path_wide function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_path_get_sanitized_character_wide(
+int cpath_test_path_get_relative_path_wide(
      void )
 {
-	wchar_t sanitized_path[ 32 ];
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	wchar_t *from_paths[ 7 ] = {
+		L"C:\\home\\user\\export", L"C:\\home\\user\\export", L"C:\\home\\user", L"C:\\home\\user\\export", L"C:\\home\\user", L"C:\\home\\\\user\\.\\docs\\..", L"C:\\" };
+	wchar_t *to_paths[ 7 ] = {
+		L"C:\\home\\user\\export\\dir\\file.txt", L"C:\\home\\user\\other\\file.txt", L"C:\\home\\user", L"C:\\home", L"C:\\home\\username\\file.txt", L"C:\\home\\user\\file.txt", L"C:\\home\\file.txt" };
+	wchar_t *expected_paths[ 7 ] = {
+		L"dir\\file.txt", L"..\\other\\file.txt", L".", L"..\\..", L"..\\username\\file.txt", L"file.txt", L"home\\file.txt" };
+#else
+	wchar_t *from_paths[ 7 ] = {
+		L"/home/user/export", L"/home/user/export", L"/home/user", L"/home/user/export", L"/home/user", L"/home//user/./docs/..", L"/" };
+	wchar_t *to_paths[ 7 ] = {
+		L"/home/user/export/dir/file.txt", L"/home/user/other/file.txt", L"/home/user", L"/home", L"/home/username/file.txt", L"/home/user/file.txt", L"/home/file.txt" };
+	wchar_t *expected_paths[ 7 ] = {
+		L"dir/file.txt", L"../other/file.txt", L".", L"../..", L"../username/file.txt", L"file.txt", L"home/file.txt" };
+#endif
 
-	libcerror_error_t *error         = NULL;
-	wchar_t *expected_sanitized_path = NULL;
-	size_t sanitized_path_index      = 0;
-	int result                       = 0;
+	libcerror_error_t *error    = NULL;
+	wchar_t *relative_path      = NULL;
+	size_t expected_path_length = 0;
+	size_t from_path_length     = 0;
+	size_t relative_path_size   = 0;
+	size_t to_path_length       = 0;
+	int result                  = 0;
+	int test_index              = 0;
 
 	/* Test regular cases
 	 */
-	sanitized_path_index = 0;
+	for( test_index = 0;
+	     test_index < 7;
+	     test_index++ )
+	{
+		from_path_length = wide_string_length(
+		                    from_paths[ test_index ] );
+
+		to_path_length = wide_string_length(
+		                  to_paths[ test_index ] );
+
+		expected_path_length = wide_string_length(
+		                        expected_paths[ test_index ] );
+
+		result = libcpath_path_get_relative_path_wide(
+		          from_paths[ test_index ],
+		          from_path_length,
+		          to_paths[ test_index ],
+		          to_path_length,
+		          &relative_path,
+		          &relative_path_size,
+		          &error );
 
-	result = libcpath_path_get_sanitized_character_wide(
-	          (wchar_t) 0,
-	          4,
-	          sanitized_path,
-	          32,
-	          &sanitized_path_index,
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "relative_path",
+		 relative_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "relative_path_size",
+		 relative_path_size,
+		 expected_path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = wide_string_compare(
+		          relative_path,
+		          expected_paths[ test_index ],
+		          relative_path_size );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		memory_free(
+		 relative_path );
+
+		relative_path = NULL;
+	}
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	/* Test paths on different volumes
+	 */
+	result = libcpath_path_get_relative_path_wide(
+	          L"C:\\home",
+	          7,
+	          L"D:\\home",
+	          7,
+	          &relative_path,
+	          &relative_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 0 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 4 );
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "relative_path",
+	 relative_path );
 
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-#if defined( WINAPI ) || defined( __MINGW32__ )
-	expected_sanitized_path = L"^x00";
-#else
-	expected_sanitized_path = L"\\x00";
-#endif
+#endif /* defined( WINAPI ) || defined( __MINGW32__ ) */
 
-	result = narrow_string_compare(
-	          sanitized_path,
-	          expected_sanitized_path,
-	          4 );
+	/* Test error cases
+	 */
+	from_path_length = wide_string_length(
+	                    from_paths[ 0 ] );
+
+	to_path_length = wide_string_length(
+	                  to_paths[ 0 ] );
+
+	result = libcpath_path_get_relative_path_wide(
+	          from_paths[ 0 ],
+	          from_path_length,
+	          to_paths[ 0 ],
+	          to_path_length,
+	          NULL,
+	          &relative_path_size,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	sanitized_path_index = 0;
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	result = libcpath_path_get_sanitized_character_wide(
-	          (wchar_t) LIBCPATH_ESCAPE_CHARACTER,
-	          2,
-	          sanitized_path,
-	          32,
-	          &sanitized_path_index,
+	libcerror_error_free(
+	 &error );
+
+	relative_path = (wchar_t *) 0x12345678UL;
+
+	result = libcpath_path_get_relative_path_wide(
+	          from_paths[ 0 ],
+	          from_path_length,
+	          to_paths[ 0 ],
+	          to_path_length,
+	          &relative_path,
+	          &relative_path_size,
 	          &error );
 
+	relative_path = NULL;
+
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 2 );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-#if defined( WINAPI ) || defined( __MINGW32__ )
-	expected_sanitized_path = L"^^";
-#else
-	expected_sanitized_path = L"\\\\";
-#endif
+	libcerror_error_free(
+	 &error );
 
-	result = narrow_string_compare(
-	          sanitized_path,
-	          expected_sanitized_path,
-	          2 );
+	result = libcpath_path_get_relative_path_wide(
+	          from_paths[ 0 ],
+	          from_path_length,
+	          to_paths[ 0 ],
+	          to_path_length,
+	          &relative_path,
+	          NULL,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	sanitized_path_index = 0;
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	result = libcpath_path_get_sanitized_character_wide(
-	          (wchar_t) 'A',
-	          1,
-	          sanitized_path,
-	          32,
-	          &sanitized_path_index,
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_relative_path_wide(
+	          NULL,
+	          from_path_length,
+	          to_paths[ 0 ],
+	          to_path_length,
+	          &relative_path,
+	          &relative_path_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 1 );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          sanitized_path,
-	          L"A",
-	          1 );
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_relative_path_wide(
+	          from_paths[ 0 ],
+	          from_path_length,
+	          NULL,
+	          to_path_length,
+	          &relative_path,
+	          &relative_path_size,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	/* Test error cases
-	 */
-	sanitized_path_index = 0;
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	result = libcpath_path_get_sanitized_character_wide(
-	          (wchar_t) 'A',
-	          8,
-	          sanitized_path,
-	          32,
-	          &sanitized_path_index,
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( relative_path != NULL )
+	{
+		memory_free(
+		 relative_path );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_get_first_segment_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_get_first_segment_wide(
+     void )
+{
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	wchar_t *path = L"\\\\home\\user";
+#else
+	wchar_t *path = L"//home/user";
+#endif
+
+	libcerror_error_t *error = NULL;
+	const wchar_t *segment   = NULL;
+	size_t path_index        = 0;
+	size_t path_length       = 0;
+	size_t segment_length    = 0;
+	int result               = 0;
+
+	path_length = wide_string_length(
+	               path );
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_get_first_segment_wide(
+	          path,
+	          path_length,
+	          &path_index,
+	          &segment,
+	          &segment_length,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
+	 "path_index",
+	 path_index,
+	 (size_t) 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "segment_length",
+	 segment_length,
 	 (size_t) 0 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcpath_path_get_sanitized_character_wide(
-	          (wchar_t) 'A',
-	          1,
-	          NULL,
-	          32,
-	          &sanitized_path_index,
+	result = libcpath_path_get_first_segment_wide(
+	          path,
+	          path_length,
+	          &path_index,
+	          &segment,
+	          &segment_length,
+	          LIBCPATH_SEGMENT_FLAG_SKIP_EMPTY,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 0 );
+	 "path_index",
+	 path_index,
+	 (size_t) 7 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "segment_length",
+	 segment_length,
+	 (size_t) 4 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = wide_string_compare(
+	          segment,
+	          L"home",
+	          4 );
 
-	result = libcpath_path_get_sanitized_character_wide(
-	          (wchar_t) 'A',
-	          1,
-	          sanitized_path,
-	          (size_t) SSIZE_MAX + 1,
-	          &sanitized_path_index,
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_INTPTR(
+	 "segment",
+	 (intptr_t) segment,
+	 (intptr_t) &( path[ 2 ] ) );
+
+	/* Test a path without segments
+	 */
+	result = libcpath_path_get_first_segment_wide(
+	          path,
+	          2,
+	          &path_index,
+	          &segment,
+	          &segment_length,
+	          LIBCPATH_SEGMENT_FLAG_SKIP_EMPTY,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 0 );
+	 0 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libcpath_path_get_sanitized_character_wide(
-	          (wchar_t) 'A',
-	          1,
-	          sanitized_path,
-	          32,
+	/* Test error cases
+	 */
+	result = libcpath_path_get_first_segment_wide(
+	          path,
+	          path_length,
 	          NULL,
+	          &segment,
+	          &segment_length,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -5849,11 +17133,6 @@ int cpath_test_path_get_sanitized_character_wide(
 	 result,
 	 -1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 0 );
-
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -5861,14 +17140,13 @@ int cpath_test_path_get_sanitized_character_wide(
 	libcerror_error_free(
 	 &error );
 
-	sanitized_path_index = 32;
-
-	result = libcpath_path_get_sanitized_character_wide(
-	          (wchar_t) 'A',
-	          1,
-	          sanitized_path,
-	          32,
-	          &sanitized_path_index,
+	result = libcpath_path_get_first_segment_wide(
+	          NULL,
+	          path_length,
+	          &path_index,
+	          &segment,
+	          &segment_length,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -5876,11 +17154,6 @@ int cpath_test_path_get_sanitized_character_wide(
 	 result,
 	 -1 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_index",
-	 sanitized_path_index,
-	 (size_t) 32 );
-
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -5899,138 +17172,170 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
-
-/* Tests the libcpath_path_get_sanitized_filename_wide function
+/* Tests the libcpath_path_get_next_segment_wide function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_path_get_sanitized_filename_wide(
+int cpath_test_path_get_next_segment_wide(
      void )
 {
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	wchar_t *path = L"\\home\\\\user\\.\\file.txt";
+#else
+	wchar_t *path = L"/home//user/./file.txt";
+#endif
+	wchar_t *expected_segments[ 6 ] = {
+		L"", L"home", L"", L"user", L".", L"file.txt" };
+	wchar_t *expected_skipped_segments[ 3 ] = {
+		L"home", L"user", L"file.txt" };
+
 	libcerror_error_t *error       = NULL;
-	wchar_t *expected_filename     = NULL;
-	wchar_t *sanitized_filename    = NULL;
-	wchar_t *test_filename         = NULL;
-	size_t expected_filename_size  = 0;
-	size_t sanitized_filename_size = 0;
-	size_t test_filename_length    = 0;
+	const wchar_t *segment         = NULL;
+	size_t expected_segment_length = 0;
+	size_t path_index              = 0;
+	size_t path_length             = 0;
+	size_t segment_length          = 0;
 	int result                     = 0;
+	int segment_index              = 0;
+
+	path_length = wide_string_length(
+	               path );
 
 	/* Test regular cases
 	 */
-	/* Test libcpath_path_get_sanitized_filename without replacement characters
-	 */
-	test_filename          = L"test.txt";
-	test_filename_length   = 8;
-	expected_filename      = L"test.txt";
-	expected_filename_size = 9;
+	path_index    = 0;
+	segment_index = 0;
 
-	result = libcpath_path_get_sanitized_filename_wide(
-	          test_filename,
-	          test_filename_length,
-	          &sanitized_filename,
-	          &sanitized_filename_size,
-	          &error );
+	do
+	{
+		result = libcpath_path_get_next_segment_wide(
+		          path,
+		          path_length,
+		          &path_index,
+		          &segment,
+		          &segment_length,
+		          0,
+		          &error );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		CPATH_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "sanitized_filename",
-	 sanitized_filename );
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_filename_size",
-	 sanitized_filename_size,
-	 expected_filename_size );
+		if( result == 0 )
+		{
+			break;
+		}
+		CPATH_TEST_ASSERT_LESS_THAN_INT(
+		 "segment_index",
+		 segment_index,
+		 6 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		expected_segment_length = wide_string_length(
+		                           expected_segments[ segment_index ] );
 
-	result = narrow_string_compare(
-	          sanitized_filename,
-	          expected_filename,
-	          expected_filename_size );
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "segment_length",
+		 segment_length,
+		 expected_segment_length );
+
+		result = wide_string_compare(
+		          segment,
+		          expected_segments[ segment_index ],
+		          segment_length );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		segment_index++;
+	}
+	while( result == 0 );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+	 "segment_index",
+	 segment_index,
+	 6 );
 
-	memory_free(
-	 sanitized_filename );
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_index",
+	 path_index,
+	 path_length + 1 );
 
-	sanitized_filename      = NULL;
-	sanitized_filename_size = 0;
+	path_index    = 0;
+	segment_index = 0;
 
-	/* Test libcpath_path_get_sanitized_filename with replacement characters
-	 */
-#if defined( WINAPI ) || defined( __MINGW32__ )
-	test_filename          = L"t\x00sT!.t^|";
-	test_filename_length   = 9;
-	expected_filename      = L"t^x00sT^x21.t^^^x7c";
-	expected_filename_size = 20;
-#else
-	test_filename          = L"t\x00sT!.t\\|";
-	test_filename_length   = 9;
-	expected_filename      = L"t\\x00sT\\x21.t\\\\\\x7c";
-	expected_filename_size = 20;
-#endif
+	do
+	{
+		result = libcpath_path_get_next_segment_wide(
+		          path,
+		          path_length,
+		          &path_index,
+		          &segment,
+		          &segment_length,
+		          LIBCPATH_SEGMENT_FLAG_SKIP_EMPTY | LIBCPATH_SEGMENT_FLAG_SKIP_CURRENT,
+		          &error );
 
-	result = libcpath_path_get_sanitized_filename_wide(
-	          test_filename,
-	          test_filename_length,
-	          &sanitized_filename,
-	          &sanitized_filename_size,
-	          &error );
+		CPATH_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "sanitized_filename",
-	 sanitized_filename );
+		if( result == 0 )
+		{
+			break;
+		}
+		CPATH_TEST_ASSERT_LESS_THAN_INT(
+		 "segment_index",
+		 segment_index,
+		 3 );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_filename_size",
-	 sanitized_filename_size,
-	 expected_filename_size );
+		expected_segment_length = wide_string_length(
+		                           expected_skipped_segments[ segment_index ] );
 
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "segment_length",
+		 segment_length,
+		 expected_segment_length );
 
-	result = narrow_string_compare(
-	          sanitized_filename,
-	          expected_filename,
-	          expected_filename_size );
+		result = wide_string_compare(
+		          segment,
+		          expected_skipped_segments[ segment_index ],
+		          segment_length );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
 
-	memory_free(
-	 sanitized_filename );
+		segment_index++;
+	}
+	while( result == 0 );
 
-	sanitized_filename      = NULL;
-	sanitized_filename_size = 0;
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "segment_index",
+	 segment_index,
+	 3 );
 
 	/* Test error cases
 	 */
-	test_filename        = L"test.txt";
-	test_filename_length = 8;
+	path_index = 0;
 
-	result = libcpath_path_get_sanitized_filename_wide(
+	result = libcpath_path_get_next_segment_wide(
 	          NULL,
-	          test_filename_length,
-	          &sanitized_filename,
-	          &sanitized_filename_size,
+	          path_length,
+	          &path_index,
+	          &segment,
+	          &segment_length,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -6045,11 +17350,13 @@ int cpath_test_path_get_sanitized_filename_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_sanitized_filename_wide(
-	          test_filename,
-	          (size_t) -1,
-	          &sanitized_filename,
-	          &sanitized_filename_size,
+	result = libcpath_path_get_next_segment_wide(
+	          path,
+	          (size_t) SSIZE_MAX,
+	          &path_index,
+	          &segment,
+	          &segment_length,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -6064,11 +17371,34 @@ int cpath_test_path_get_sanitized_filename_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_sanitized_filename_wide(
-	          test_filename,
-	          test_filename_length,
+	result = libcpath_path_get_next_segment_wide(
+	          path,
+	          path_length,
+	          NULL,
+	          &segment,
+	          &segment_length,
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_get_next_segment_wide(
+	          path,
+	          path_length,
+	          &path_index,
 	          NULL,
-	          &sanitized_filename_size,
+	          &segment_length,
+	          0,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -6083,17 +17413,15 @@ int cpath_test_path_get_sanitized_filename_wide(
 	libcerror_error_free(
 	 &error );
 
-	sanitized_filename = (wchar_t *) 0x12345678UL;
-
-	result = libcpath_path_get_sanitized_filename_wide(
-	          test_filename,
-	          test_filename_length,
-	          &sanitized_filename,
-	          &sanitized_filename_size,
+	result = libcpath_path_get_next_segment_wide(
+	          path,
+	          path_length,
+	          &path_index,
+	          &segment,
+	          NULL,
+	          0,
 	          &error );
 
-	sanitized_filename = NULL;
-
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -6106,11 +17434,13 @@ int cpath_test_path_get_sanitized_filename_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_sanitized_filename_wide(
-	          test_filename,
-	          test_filename_length,
-	          &sanitized_filename,
-	          NULL,
+	result = libcpath_path_get_next_segment_wide(
+	          path,
+	          path_length,
+	          &path_index,
+	          &segment,
+	          &segment_length,
+	          0xff,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -6125,64 +17455,9 @@ int cpath_test_path_get_sanitized_filename_wide(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_CPATH_TEST_MEMORY )
-
-	/* Test libcpath_path_get_sanitized_filename with malloc failing
-	 */
-	cpath_test_malloc_attempts_before_fail = 0;
-
-	result = libcpath_path_get_sanitized_filename_wide(
-	          test_filename,
-	          test_filename_length,
-	          &sanitized_filename,
-	          &sanitized_filename_size,
-	          &error );
-
-	if( cpath_test_malloc_attempts_before_fail != -1 )
-	{
-		cpath_test_malloc_attempts_before_fail = -1;
-
-		if( sanitized_filename != NULL )
-		{
-			memory_free(
-			 sanitized_filename );
-
-			sanitized_filename = NULL;
-		}
-	}
-	else
-	{
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "sanitized_filename",
-		 sanitized_filename );
-
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "sanitized_filename_size",
-		 sanitized_filename_size,
-		 (size_t) 0 );
-
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
-
 	return( 1 );
 
 on_error:
-	if( sanitized_filename != NULL )
-	{
-		memory_free(
-		 sanitized_filename );
-	}
 	if( error != NULL )
 	{
 		libcerror_error_free(
@@ -6191,148 +17466,140 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcpath_path_get_sanitized_path function
+/* Tests the libcpath_path_parse_windows_path_wide function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_path_get_sanitized_path_wide(
+int cpath_test_path_parse_windows_path_wide(
      void )
 {
-	libcerror_error_t *error   = NULL;
-	wchar_t *expected_path     = NULL;
-	wchar_t *sanitized_path    = NULL;
-	wchar_t *test_path         = NULL;
-	size_t expected_path_size  = 0;
-	size_t sanitized_path_size = 0;
-	size_t test_path_length    = 0;
-	int result                 = 0;
+	wchar_t *paths[ 11 ] = {
+		L"C:\\dir\\file.txt", L"C:file.txt", L"\\dir\\file.txt", L"dir\\file.txt",
+		L"\\\\server\\share\\dir", L"\\\\server", L"\\\\.\\PhysicalDrive0", L"\\\\.\\C:\\dir",
+		L"\\\\?\\C:\\dir", L"\\\\?\\GLOBALROOT\\dir", L"\\\\?\\UNC\\server\\share\\dir" };
+	uint8_t expected_path_types[ 11 ] = {
+		LIBCPATH_WINDOWS_PATH_TYPE_ABSOLUTE, LIBCPATH_WINDOWS_PATH_TYPE_RELATIVE,
+		LIBCPATH_WINDOWS_PATH_TYPE_ABSOLUTE, LIBCPATH_WINDOWS_PATH_TYPE_RELATIVE,
+		LIBCPATH_WINDOWS_PATH_TYPE_UNC, LIBCPATH_WINDOWS_PATH_TYPE_UNC,
+		LIBCPATH_WINDOWS_PATH_TYPE_DEVICE, LIBCPATH_WINDOWS_PATH_TYPE_DEVICE,
+		LIBCPATH_WINDOWS_PATH_TYPE_EXTENDED_LENGTH, LIBCPATH_WINDOWS_PATH_TYPE_EXTENDED_LENGTH,
+		LIBCPATH_WINDOWS_PATH_TYPE_EXTENDED_LENGTH_UNC };
+	size_t expected_volume_name_indexes[ 11 ] = {
+		0, 0, 0, 0, 2, 2, 4, 4, 4, 4, 8 };
+	size_t expected_volume_name_lengths[ 11 ] = {
+		2, 2, 0, 0, 12, 6, 14, 2, 2, 10, 12 };
+	size_t expected_directory_name_indexes[ 11 ] = {
+		3, 2, 0, 0, 15, 8, 18, 7, 7, 15, 21 };
+
+	libcerror_error_t *error    = NULL;
+	size_t directory_name_index = 0;
+	size_t path_length          = 0;
+	size_t volume_name_index    = 0;
+	size_t volume_name_length   = 0;
+	uint8_t path_type           = 0;
+	int path_index              = 0;
+	int result                  = 0;
 
 	/* Test regular cases
 	 */
-	/* Test libcpath_path_get_sanitized_path without replacement characters
-	 */
-#if defined( WINAPI ) || defined( __MINGW32__ )
-	test_path          = L"test\\test.txt";
-	test_path_length   = 13;
-	expected_path      = L"test\\test.txt";
-	expected_path_size = 14;
-#else
-	test_path          = L"test/test.txt";
-	test_path_length   = 13;
-	expected_path      = L"test/test.txt";
-	expected_path_size = 14;
-#endif
-
-	result = libcpath_path_get_sanitized_path_wide(
-	          test_path,
-	          test_path_length,
-	          &sanitized_path,
-	          &sanitized_path_size,
-	          &error );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "sanitized_path",
-	 sanitized_path );
+	for( path_index = 0;
+	     path_index < 11;
+	     path_index++ )
+	{
+		path_length = wide_string_length(
+		               paths[ path_index ] );
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_size",
-	 sanitized_path_size,
-	 expected_path_size );
+		result = libcpath_path_parse_windows_path_wide(
+		          paths[ path_index ],
+		          path_length,
+		          &path_type,
+		          &volume_name_index,
+		          &volume_name_length,
+		          &directory_name_index,
+		          &error );
 
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	result = narrow_string_compare(
-	          sanitized_path,
-	          expected_path,
-	          expected_path_size );
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+		CPATH_TEST_ASSERT_EQUAL_UINT8(
+		 "path_type",
+		 path_type,
+		 expected_path_types[ path_index ] );
 
-	memory_free(
-	 sanitized_path );
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "volume_name_index",
+		 volume_name_index,
+		 expected_volume_name_indexes[ path_index ] );
 
-	sanitized_path      = NULL;
-	sanitized_path_size = 0;
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "volume_name_length",
+		 volume_name_length,
+		 expected_volume_name_lengths[ path_index ] );
 
-	/* Test libcpath_path_get_sanitized_path with replacement characters
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "directory_name_index",
+		 directory_name_index,
+		 expected_directory_name_indexes[ path_index ] );
+	}
+	/* Test error cases
 	 */
-#if defined( WINAPI ) || defined( __MINGW32__ )
-	test_path          = L"test\\t\x00sT!.t^|";
-	test_path_length   = 14;
-	expected_path      = L"test\\t^x00sT^x21.t^^^x7c";
-	expected_path_size = 25;
-#else
-	test_path          = L"test/t\x00sT!.t\\|";
-	test_path_length   = 14;
-	expected_path      = L"test/t\\x00sT\\x21.t\\\\\\x7c";
-	expected_path_size = 25;
-#endif
+	path_length = wide_string_length(
+	               paths[ 0 ] );
 
-	result = libcpath_path_get_sanitized_path_wide(
-	          test_path,
-	          test_path_length,
-	          &sanitized_path,
-	          &sanitized_path_size,
+	result = libcpath_path_parse_windows_path_wide(
+	          NULL,
+	          path_length,
+	          &path_type,
+	          &volume_name_index,
+	          &volume_name_length,
+	          &directory_name_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "sanitized_path",
-	 sanitized_path );
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "sanitized_path_size",
-	 sanitized_path_size,
-	 expected_path_size );
-
-	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          sanitized_path,
-	          expected_path,
-	          expected_path_size );
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_parse_windows_path_wide(
+	          paths[ 0 ],
+	          0,
+	          &path_type,
+	          &volume_name_index,
+	          &volume_name_length,
+	          &directory_name_index,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
-
-	memory_free(
-	 sanitized_path );
+	 -1 );
 
-	sanitized_path      = NULL;
-	sanitized_path_size = 0;
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	/* Test error cases
-	 */
-#if defined( WINAPI ) || defined( __MINGW32__ )
-	test_path        = L"test\\test.txt";
-	test_path_length = 13;
-#else
-	test_path        = L"test/test.txt";
-	test_path_length = 13;
-#endif
+	libcerror_error_free(
+	 &error );
 
-	result = libcpath_path_get_sanitized_path_wide(
-	          NULL,
-	          test_path_length,
-	          &sanitized_path,
-	          &sanitized_path_size,
+	result = libcpath_path_parse_windows_path_wide(
+	          paths[ 0 ],
+	          (size_t) SSIZE_MAX,
+	          &path_type,
+	          &volume_name_index,
+	          &volume_name_length,
+	          &directory_name_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -6347,11 +17614,13 @@ int cpath_test_path_get_sanitized_path_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_sanitized_path_wide(
-	          test_path,
-	          (size_t) -1,
-	          &sanitized_path,
-	          &sanitized_path_size,
+	result = libcpath_path_parse_windows_path_wide(
+	          paths[ 0 ],
+	          path_length,
+	          NULL,
+	          &volume_name_index,
+	          &volume_name_length,
+	          &directory_name_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -6366,11 +17635,13 @@ int cpath_test_path_get_sanitized_path_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_sanitized_path_wide(
-	          test_path,
-	          test_path_length,
+	result = libcpath_path_parse_windows_path_wide(
+	          paths[ 0 ],
+	          path_length,
+	          &path_type,
 	          NULL,
-	          &sanitized_path_size,
+	          &volume_name_length,
+	          &directory_name_index,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -6385,17 +17656,15 @@ int cpath_test_path_get_sanitized_path_wide(
 	libcerror_error_free(
 	 &error );
 
-	sanitized_path = (wchar_t *) 0x12345678UL;
-
-	result = libcpath_path_get_sanitized_path_wide(
-	          test_path,
-	          test_path_length,
-	          &sanitized_path,
-	          &sanitized_path_size,
+	result = libcpath_path_parse_windows_path_wide(
+	          paths[ 0 ],
+	          path_length,
+	          &path_type,
+	          &volume_name_index,
+	          NULL,
+	          &directory_name_index,
 	          &error );
 
-	sanitized_path = NULL;
-
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -6408,10 +17677,12 @@ int cpath_test_path_get_sanitized_path_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_get_sanitized_path_wide(
-	          test_path,
-	          test_path_length,
-	          &sanitized_path,
+	result = libcpath_path_parse_windows_path_wide(
+	          paths[ 0 ],
+	          path_length,
+	          &path_type,
+	          &volume_name_index,
+	          &volume_name_length,
 	          NULL,
 	          &error );
 
@@ -6427,64 +17698,9 @@ int cpath_test_path_get_sanitized_path_wide(
 	libcerror_error_free(
 	 &error );
 
-#if defined( HAVE_CPATH_TEST_MEMORY )
-
-	/* Test libcpath_path_get_sanitized_path with malloc failing
-	 */
-	cpath_test_malloc_attempts_before_fail = 0;
-
-	result = libcpath_path_get_sanitized_path_wide(
-	          test_path,
-	          test_path_length,
-	          &sanitized_path,
-	          &sanitized_path_size,
-	          &error );
-
-	if( cpath_test_malloc_attempts_before_fail != -1 )
-	{
-		cpath_test_malloc_attempts_before_fail = -1;
-
-		if( sanitized_path != NULL )
-		{
-			memory_free(
-			 sanitized_path );
-
-			sanitized_path = NULL;
-		}
-	}
-	else
-	{
-		CPATH_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		CPATH_TEST_ASSERT_IS_NULL(
-		 "sanitized_path",
-		 sanitized_path );
-
-		CPATH_TEST_ASSERT_EQUAL_SIZE(
-		 "sanitized_path_size",
-		 sanitized_path_size,
-		 (size_t) 0 );
-
-		CPATH_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
-
 	return( 1 );
 
 on_error:
-	if( sanitized_path != NULL )
-	{
-		memory_free(
-		 sanitized_path );
-	}
 	if( error != NULL )
 	{
 		libcerror_error_free(
@@ -6493,207 +17709,175 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcpath_path_join_wide function
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
+
+/* Tests the libcpath_CreateDirectoryW function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_path_join_wide(
+int cpath_test_CreateDirectoryW(
      void )
 {
-	libcerror_error_t *error     = NULL;
-	const wchar_t *expected_path = NULL;
-	wchar_t *path                = NULL;
-	const wchar_t *test_path1    = NULL;
-	const wchar_t *test_path2    = NULL;
-	const wchar_t *test_path3    = NULL;
-	const wchar_t *test_path4    = NULL;
-	size_t path_size             = 0;
-	int result                   = 0;
+	BOOL result = FALSE;
 
 	/* Test regular cases
 	 */
-#if defined( WINAPI ) || defined( __MINGW32__ )
-	test_path1    = L"\\first\\second";
-	test_path2    = L"third\\fourth";
-	test_path3    = L"\\first\\second\\";
-	test_path4    = L"\\third\\fourth";
-	expected_path = L"\\first\\second\\third\\fourth";
-#else
-	test_path1    = L"/first/second";
-	test_path2    = L"third/fourth";
-	test_path3    = L"/first/second/";
-	test_path4    = L"/third/fourth";
-	expected_path = L"/first/second/third/fourth";
-#endif
-
-	result = libcpath_path_join_wide(
-	          &path,
-	          &path_size,
-	          test_path1,
-	          13,
-	          test_path2,
-	          12,
-	          &error );
-
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
 
-	result = narrow_string_compare(
-	          path,
-	          expected_path,
-	          26 );
+	/* Test error cases
+	 */
+	result = libcpath_CreateDirectoryW(
+	          NULL,
+	          NULL );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
-
-	memory_free(
-	 path );
-
-	path = NULL;
-
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "path_size",
-	 path_size,
-	 (size_t) 27 );
+	 FALSE );
 
-	result = libcpath_path_join_wide(
-	          &path,
-	          &path_size,
-	          test_path3,
-	          14,
-	          test_path2,
-	          12,
-	          &error );
+	result = libcpath_CreateDirectoryW(
+	          L".",
+	          NULL );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	 FALSE );
 
-	result = narrow_string_compare(
-	          path,
-	          expected_path,
-	          26 );
+	return( 1 );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+on_error:
+	return( 0 );
+}
 
-	memory_free(
-	 path );
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 ) */
 
-	path = NULL;
+/* Tests the libcpath_path_make_directory_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_make_directory_wide(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "path_size",
-	 path_size,
-	 (size_t) 27 );
+	/* Test regular cases
+	 */
 
-	result = libcpath_path_join_wide(
-	          &path,
-	          &path_size,
-	          test_path1,
-	          13,
-	          test_path4,
-	          13,
+	/* Test error cases
+	 */
+	result = libcpath_path_make_directory_wide(
+	          NULL,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	CPATH_TEST_ASSERT_IS_NULL(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	result = narrow_string_compare(
-	          path,
-	          expected_path,
-	          26 );
+	libcerror_error_free(
+	 &error );
 
-	CPATH_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 0 );
+	return( 1 );
 
-	memory_free(
-	 path );
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
 
-	path = NULL;
+/* Tests the libcpath_path_make_directory_wide_with_error_code function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_make_directory_wide_with_error_code(
+     void )
+{
+#if defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY )
+	char filename[ 512 ];
+	char temporary_directory_name[ 256 ];
+	wchar_t wide_filename[ 512 ];
 
-	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "path_size",
-	 path_size,
-	 (size_t) 27 );
+	size_t filename_index    = 0;
+#endif
+	libcerror_error_t *error = NULL;
+	uint32_t error_code      = 0;
+	int result               = 0;
 
-	/* Test error cases
+#if defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY )
+	filename[ 0 ]                 = 0;
+	temporary_directory_name[ 0 ] = 0;
+#endif
+
+	/* Test that a directory that already exists is reported without an error
 	 */
-	result = libcpath_path_join_wide(
-	          NULL,
-	          &path_size,
-	          test_path1,
-	          13,
-	          test_path2,
-	          12,
+	result = libcpath_path_make_directory_wide_with_error_code(
+	          L".",
+	          &error_code,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	CPATH_TEST_ASSERT_NOT_EQUAL_UINT32(
+	 "error_code",
+	 error_code,
+	 (uint32_t) 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	path = (wchar_t *) 0x12345678UL;
+#if defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY )
+	/* Test that a regular file with the same name is reported as an error
+	 */
+	result = cpath_test_make_temporary_directory(
+	          temporary_directory_name,
+	          256 );
 
-	result = libcpath_path_join_wide(
-	          &path,
-	          &path_size,
-	          test_path1,
-	          13,
-	          test_path2,
-	          12,
-	          &error );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	path = NULL;
+	result = cpath_test_join_path(
+	          filename,
+	          512,
+	          temporary_directory_name,
+	          "file" );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+	result = cpath_test_make_file(
+	          filename );
 
-	libcerror_error_free(
-	 &error );
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	result = libcpath_path_join_wide(
-	          &path,
-	          NULL,
-	          test_path1,
-	          13,
-	          test_path2,
-	          12,
+	/* The temporary directory name is expected to consist of ASCII characters
+	 */
+	for( filename_index = 0;
+	     filename[ filename_index ] != 0;
+	     filename_index++ )
+	{
+		wide_filename[ filename_index ] = (wchar_t) filename[ filename_index ];
+	}
+	wide_filename[ filename_index ] = 0;
+
+	result = libcpath_path_make_directory_wide_with_error_code(
+	          wide_filename,
+	          &error_code,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -6701,6 +17885,11 @@ int cpath_test_path_join_wide(
 	 result,
 	 -1 );
 
+	CPATH_TEST_ASSERT_NOT_EQUAL_UINT32(
+	 "error_code",
+	 error_code,
+	 (uint32_t) 0 );
+
 	CPATH_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -6708,55 +17897,34 @@ int cpath_test_path_join_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_join_wide(
-	          &path,
-	          &path_size,
-	          NULL,
-	          13,
-	          test_path2,
-	          12,
-	          &error );
+	result = cpath_test_remove_file(
+	          filename );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
-
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+	 1 );
 
-	libcerror_error_free(
-	 &error );
+	filename[ 0 ] = 0;
 
-	result = libcpath_path_join_wide(
-	          &path,
-	          &path_size,
-	          test_path1,
-	          (size_t) SSIZE_MAX + 1,
-	          test_path2,
-	          12,
-	          &error );
+	result = cpath_test_remove_directories(
+	          temporary_directory_name,
+	          "" );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	CPATH_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+	temporary_directory_name[ 0 ] = 0;
 
-	libcerror_error_free(
-	 &error );
+#endif /* defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY ) */
 
-	result = libcpath_path_join_wide(
-	          &path,
-	          &path_size,
-	          test_path1,
-	          13,
+	/* Test error cases
+	 */
+	result = libcpath_path_make_directory_wide_with_error_code(
 	          NULL,
-	          12,
+	          &error_code,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -6771,13 +17939,9 @@ int cpath_test_path_join_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_path_join_wide(
-	          &path,
-	          &path_size,
-	          test_path1,
-	          13,
-	          test_path2,
-	          (size_t) SSIZE_MAX + 1,
+	result = libcpath_path_make_directory_wide_with_error_code(
+	          L".",
+	          NULL,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -6800,71 +17964,90 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( path != NULL )
+#if defined( HAVE_CPATH_TEST_TEMPORARY_DIRECTORY )
+	if( filename[ 0 ] != 0 )
 	{
-		memory_free(
-		 path );
+		cpath_test_remove_file(
+		 filename );
+	}
+	if( temporary_directory_name[ 0 ] != 0 )
+	{
+		cpath_test_remove_directories(
+		 temporary_directory_name,
+		 "" );
 	}
+#endif
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
-
-/* Tests the libcpath_CreateDirectoryW function
+/* Tests the libcpath_path_make_directories_wide function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_CreateDirectoryW(
+int cpath_test_path_make_directories_wide(
      void )
 {
-	BOOL result = FALSE;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
 	/* Test regular cases
 	 */
+	result = libcpath_path_make_directories_wide(
+	          L".",
+	          1,
+	          0755,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test error cases
 	 */
-	result = libcpath_CreateDirectoryW(
+	result = libcpath_path_make_directories_wide(
 	          NULL,
-	          NULL );
+	          1,
+	          0755,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 FALSE );
+	 -1 );
 
-	result = libcpath_CreateDirectoryW(
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_make_directories_wide(
 	          L".",
-	          NULL );
+	          0,
+	          0755,
+	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 FALSE );
-
-	return( 1 );
-
-on_error:
-	return( 0 );
-}
-
-#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 ) */
+	 -1 );
 
-/* Tests the libcpath_path_make_directory_wide function
- * Returns 1 if successful or 0 if not
- */
-int cpath_test_path_make_directory_wide(
-     void )
-{
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	/* Test regular cases
-	 */
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases
-	 */
-	result = libcpath_path_make_directory_wide(
-	          NULL,
+	result = libcpath_path_make_directories_wide(
+	          L".",
+	          (size_t) SSIZE_MAX + 1,
+	          0755,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -6923,6 +18106,10 @@ int main(
 	 "libcpath_path_change_directory",
 	 cpath_test_path_change_directory );
 
+	CPATH_TEST_RUN(
+	 "libcpath_path_change_directory_with_error_code",
+	 cpath_test_path_change_directory_with_error_code );
+
 #if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
 
 	CPATH_TEST_RUN(
@@ -6935,6 +18122,22 @@ int main(
 	 "libcpath_path_get_current_working_directory",
 	 cpath_test_path_get_current_working_directory );
 
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_current_working_directory_exact",
+	 cpath_test_path_get_current_working_directory_exact );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_current_working_directory_cache",
+	 cpath_test_path_current_working_directory_cache );
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_cached_current_working_directory",
+	 cpath_test_path_get_cached_current_working_directory );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
+
 #if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI )
 
 	CPATH_TEST_RUN(
@@ -6955,8 +18158,32 @@ int main(
 	 "libcpath_path_get_full_path",
 	 cpath_test_path_get_full_path );
 
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_full_path_to_buffer",
+	 cpath_test_path_get_full_path_to_buffer );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_full_paths",
+	 cpath_test_path_get_full_paths );
+
 #if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
 
+	CPATH_TEST_RUN(
+	 "libcpath_path_append_normalized_segments",
+	 cpath_test_path_append_normalized_segments );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_normalized_segments_length",
+	 cpath_test_path_get_normalized_segments_length );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_prepend_normalized_segments",
+	 cpath_test_path_prepend_normalized_segments );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_resolve_full_path",
+	 cpath_test_path_resolve_full_path );
+
 	CPATH_TEST_RUN(
 	 "libcpath_path_get_sanitized_character_size",
 	 cpath_test_path_get_sanitized_character_size );
@@ -6965,20 +18192,72 @@ int main(
 	 "libcpath_path_get_sanitized_character",
 	 cpath_test_path_get_sanitized_character );
 
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_unescaped_string_length",
+	 cpath_test_path_get_unescaped_string_length );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_sanitized_string",
+	 cpath_test_path_get_sanitized_string );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_unsanitized_string",
+	 cpath_test_path_get_unsanitized_string );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
 
 	CPATH_TEST_RUN(
 	 "libcpath_path_get_sanitized_filename",
 	 cpath_test_path_get_sanitized_filename );
 
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_sanitized_filename_to_buffer",
+	 cpath_test_path_get_sanitized_filename_to_buffer );
+
 	CPATH_TEST_RUN(
 	 "libcpath_path_get_sanitized_path",
 	 cpath_test_path_get_sanitized_path );
 
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_sanitized_path_to_buffer",
+	 cpath_test_path_get_sanitized_path_to_buffer );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_unsanitized_filename",
+	 cpath_test_path_get_unsanitized_filename );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_unsanitized_path",
+	 cpath_test_path_get_unsanitized_path );
+
 	CPATH_TEST_RUN(
 	 "libcpath_path_join",
 	 cpath_test_path_join );
 
+	CPATH_TEST_RUN(
+	 "libcpath_path_join_to_buffer",
+	 cpath_test_path_join_to_buffer );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_join_normalized",
+	 cpath_test_path_join_normalized );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_relative_path",
+	 cpath_test_path_get_relative_path );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_first_segment",
+	 cpath_test_path_get_first_segment );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_next_segment",
+	 cpath_test_path_get_next_segment );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_parse_windows_path",
+	 cpath_test_path_parse_windows_path );
+
 #if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
 
 	CPATH_TEST_RUN(
@@ -6991,6 +18270,22 @@ int main(
 	 "libcpath_path_make_directory",
 	 cpath_test_path_make_directory );
 
+	CPATH_TEST_RUN(
+	 "libcpath_path_make_directory_with_error_code",
+	 cpath_test_path_make_directory_with_error_code );
+
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_make_directory_component",
+	 cpath_test_path_make_directory_component );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_make_directories",
+	 cpath_test_path_make_directories );
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 #if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
@@ -7005,6 +18300,10 @@ int main(
 	 "libcpath_path_change_directory_wide",
 	 cpath_test_path_change_directory_wide );
 
+	CPATH_TEST_RUN(
+	 "libcpath_path_change_directory_wide_with_error_code",
+	 cpath_test_path_change_directory_wide_with_error_code );
+
 #if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
 
 	CPATH_TEST_RUN(
@@ -7017,6 +18316,14 @@ int main(
 	 "libcpath_path_get_current_working_directory_wide",
 	 cpath_test_path_get_current_working_directory_wide );
 
+#if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_cached_current_working_directory_wide",
+	 cpath_test_path_get_cached_current_working_directory_wide );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
+
 #if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI )
 
 	CPATH_TEST_RUN(
@@ -7037,8 +18344,32 @@ int main(
 	 "libcpath_path_get_full_path_wide",
 	 cpath_test_path_get_full_path_wide );
 
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_full_path_to_buffer_wide",
+	 cpath_test_path_get_full_path_to_buffer_wide );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_full_paths_wide",
+	 cpath_test_path_get_full_paths_wide );
+
 #if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
 
+	CPATH_TEST_RUN(
+	 "libcpath_path_append_normalized_segments_wide",
+	 cpath_test_path_append_normalized_segments_wide );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_normalized_segments_length_wide",
+	 cpath_test_path_get_normalized_segments_length_wide );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_prepend_normalized_segments_wide",
+	 cpath_test_path_prepend_normalized_segments_wide );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_resolve_full_path_wide",
+	 cpath_test_path_resolve_full_path_wide );
+
 	CPATH_TEST_RUN(
 	 "libcpath_path_get_sanitized_character_size_wide",
 	 cpath_test_path_get_sanitized_character_size_wide );
@@ -7047,20 +18378,68 @@ int main(
 	 "libcpath_path_get_sanitized_character_wide",
 	 cpath_test_path_get_sanitized_character_wide );
 
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_sanitized_string_wide",
+	 cpath_test_path_get_sanitized_string_wide );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_unsanitized_string_wide",
+	 cpath_test_path_get_unsanitized_string_wide );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
 
 	CPATH_TEST_RUN(
 	 "libcpath_path_get_sanitized_filename_wide",
 	 cpath_test_path_get_sanitized_filename_wide );
 
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_sanitized_filename_to_buffer_wide",
+	 cpath_test_path_get_sanitized_filename_to_buffer_wide );
+
 	CPATH_TEST_RUN(
 	 "libcpath_path_get_sanitized_path_wide",
 	 cpath_test_path_get_sanitized_path_wide );
 
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_sanitized_path_to_buffer_wide",
+	 cpath_test_path_get_sanitized_path_to_buffer_wide );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_unsanitized_filename_wide",
+	 cpath_test_path_get_unsanitized_filename_wide );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_unsanitized_path_wide",
+	 cpath_test_path_get_unsanitized_path_wide );
+
 	CPATH_TEST_RUN(
 	 "libcpath_path_join_wide",
 	 cpath_test_path_join_wide );
 
+	CPATH_TEST_RUN(
+	 "libcpath_path_join_to_buffer_wide",
+	 cpath_test_path_join_to_buffer_wide );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_join_normalized_wide",
+	 cpath_test_path_join_normalized_wide );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_relative_path_wide",
+	 cpath_test_path_get_relative_path_wide );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_first_segment_wide",
+	 cpath_test_path_get_first_segment_wide );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_get_next_segment_wide",
+	 cpath_test_path_get_next_segment_wide );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_parse_windows_path_wide",
+	 cpath_test_path_parse_windows_path_wide );
+
 #if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) && defined( WINAPI ) && ( WINVER <= 0x0500 )
 
 	CPATH_TEST_RUN(
@@ -7073,6 +18452,14 @@ int main(
 	 "libcpath_path_make_directory_wide",
 	 cpath_test_path_make_directory_wide );
 
+	CPATH_TEST_RUN(
+	 "libcpath_path_make_directory_wide_with_error_code",
+	 cpath_test_path_make_directory_wide_with_error_code );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_make_directories_wide",
+	 cpath_test_path_make_directories_wide );
+
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,1257 @@
+/*
+ * Library path builder type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cpath_test_libcerror.h"
+#include "cpath_test_libcpath.h"
+#include "cpath_test_macros.h"
+#include "cpath_test_memory.h"
+#include "cpath_test_unused.h"
+
+#include "../libcpath/libcpath_path_builder.h"
+
+/* Tests the libcpath_path_builder_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_builder_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libcpath_path_builder_t *path_builder = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_CPATH_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 1;
+	int number_of_memset_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_builder_initialize(
+	          &path_builder,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "path_builder",
+	 path_builder );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_builder_free(
+	          &path_builder,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "path_builder",
+	 path_builder );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_builder_initialize(
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	path_builder = (libcpath_path_builder_t *) 0x12345678UL;
+
+	result = libcpath_path_builder_initialize(
+	          &path_builder,
+	          &error );
+
+	path_builder = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CPATH_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcpath_path_builder_initialize with malloc failing
+		 */
+		cpath_test_malloc_attempts_before_fail = test_number;
+
+		result = libcpath_path_builder_initialize(
+		          &path_builder,
+		          &error );
+
+		if( cpath_test_malloc_attempts_before_fail != -1 )
+		{
+			cpath_test_malloc_attempts_before_fail = -1;
+
+			if( path_builder != NULL )
+			{
+				libcpath_path_builder_free(
+				 &path_builder,
+				 NULL );
+			}
+		}
+		else
+		{
+			CPATH_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CPATH_TEST_ASSERT_IS_NULL(
+			 "path_builder",
+			 path_builder );
+
+			CPATH_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcpath_path_builder_initialize with memset failing
+		 */
+		cpath_test_memset_attempts_before_fail = test_number;
+
+		result = libcpath_path_builder_initialize(
+		          &path_builder,
+		          &error );
+
+		if( cpath_test_memset_attempts_before_fail != -1 )
+		{
+			cpath_test_memset_attempts_before_fail = -1;
+
+			if( path_builder != NULL )
+			{
+				libcpath_path_builder_free(
+				 &path_builder,
+				 NULL );
+			}
+		}
+		else
+		{
+			CPATH_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CPATH_TEST_ASSERT_IS_NULL(
+			 "path_builder",
+			 path_builder );
+
+			CPATH_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_builder != NULL )
+	{
+		libcpath_path_builder_free(
+		 &path_builder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_builder_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_builder_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcpath_path_builder_free(
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Compares the path of a path builder with an expected path
+ * Returns 1 if equal, 0 if not or -1 on error
+ */
+int cpath_test_path_builder_compare_path(
+     libcpath_path_builder_t *path_builder,
+     const char *expected_path,
+     size_t expected_path_length,
+     libcerror_error_t **error )
+{
+	char path[ 64 ];
+
+	size_t path_size = 0;
+
+	if( libcpath_path_builder_get_path_size(
+	     path_builder,
+	     &path_size,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( path_size != ( expected_path_length + 1 ) )
+	{
+		return( 0 );
+	}
+	if( libcpath_path_builder_get_path(
+	     path_builder,
+	     path,
+	     64,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( narrow_string_compare(
+	     path,
+	     expected_path,
+	     path_size ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Tests the libcpath_path_builder_append_component and libcpath_path_builder_remove_last_component functions
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_builder_append_component(
+     libcpath_path_builder_t *path_builder )
+{
+	libcerror_error_t *error = NULL;
+	char *expected_path      = NULL;
+	int component_index      = 0;
+	int number_of_components = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_builder_clear(
+	          path_builder,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The first component is used as-is
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	result = libcpath_path_builder_append_component(
+	          path_builder,
+	          "C:\\dir\\\\",
+	          8,
+	          &error );
+#else
+	result = libcpath_path_builder_append_component(
+	          path_builder,
+	          "/dir//",
+	          6,
+	          &error );
+#endif
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	expected_path = "C:\\dir\\\\";
+#else
+	expected_path = "/dir//";
+#endif
+	result = cpath_test_path_builder_compare_path(
+	          path_builder,
+	          expected_path,
+	          narrow_string_length(
+	           expected_path ),
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Separators are trimmed the same way as libcpath_path_join
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	result = libcpath_path_builder_append_component(
+	          path_builder,
+	          "\\sub\\",
+	          5,
+	          &error );
+#else
+	result = libcpath_path_builder_append_component(
+	          path_builder,
+	          "/sub/",
+	          5,
+	          &error );
+#endif
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	result = libcpath_path_builder_append_component(
+	          path_builder,
+	          "\\\\file.txt",
+	          10,
+	          &error );
+#else
+	result = libcpath_path_builder_append_component(
+	          path_builder,
+	          "//file.txt",
+	          10,
+	          &error );
+#endif
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	expected_path = "C:\\dir\\sub\\file.txt";
+#else
+	expected_path = "/dir/sub/file.txt";
+#endif
+	result = cpath_test_path_builder_compare_path(
+	          path_builder,
+	          expected_path,
+	          narrow_string_length(
+	           expected_path ),
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_builder_get_number_of_components(
+	          path_builder,
+	          &number_of_components,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "number_of_components",
+	 number_of_components,
+	 3 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Removing components restores the path including the trimmed separators
+	 */
+	result = libcpath_path_builder_remove_last_component(
+	          path_builder,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_builder_remove_last_component(
+	          path_builder,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	expected_path = "C:\\dir\\\\";
+#else
+	expected_path = "/dir//";
+#endif
+	result = cpath_test_path_builder_compare_path(
+	          path_builder,
+	          expected_path,
+	          narrow_string_length(
+	           expected_path ),
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test appending many components, which requires the path to grow
+	 */
+	for( component_index = 0;
+	     component_index < 20;
+	     component_index++ )
+	{
+		result = libcpath_path_builder_append_component(
+		          path_builder,
+		          "a",
+		          1,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	expected_path = "C:\\dir\\a\\a\\a\\a\\a\\a\\a\\a\\a\\a\\a\\a\\a\\a\\a\\a\\a\\a\\a\\a";
+#else
+	expected_path = "/dir/a/a/a/a/a/a/a/a/a/a/a/a/a/a/a/a/a/a/a/a";
+#endif
+	result = cpath_test_path_builder_compare_path(
+	          path_builder,
+	          expected_path,
+	          narrow_string_length(
+	           expected_path ),
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( component_index = 0;
+	     component_index < 21;
+	     component_index++ )
+	{
+		result = libcpath_path_builder_remove_last_component(
+		          path_builder,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = cpath_test_path_builder_compare_path(
+	          path_builder,
+	          "",
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_builder_remove_last_component(
+	          path_builder,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_builder_append_component(
+	          NULL,
+	          "a",
+	          1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_builder_append_component(
+	          path_builder,
+	          NULL,
+	          1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_builder_append_component(
+	          path_builder,
+	          "a",
+	          (size_t) SSIZE_MAX,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_builder_remove_last_component(
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_path_builder_get_path function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_builder_get_path(
+     libcpath_path_builder_t *path_builder )
+{
+	char path[ 8 ];
+
+	libcerror_error_t *error = NULL;
+	size_t path_size         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_builder_clear(
+	          path_builder,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_builder_append_component(
+	          path_builder,
+	          "test",
+	          4,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_builder_get_path_size(
+	          path_builder,
+	          &path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_size",
+	 path_size,
+	 (size_t) 5 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_builder_get_path(
+	          path_builder,
+	          path,
+	          8,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          path,
+	          "test",
+	          5 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_builder_get_path_size(
+	          NULL,
+	          &path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_builder_get_path_size(
+	          path_builder,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_builder_get_path(
+	          NULL,
+	          path,
+	          8,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_builder_get_path(
+	          path_builder,
+	          NULL,
+	          8,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_builder_get_path(
+	          path_builder,
+	          path,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_builder_get_path(
+	          path_builder,
+	          path,
+	          4,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libcpath_path_builder_append_component_wide and libcpath_path_builder_get_path_wide functions
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_path_builder_append_component_wide(
+     libcpath_path_builder_t *path_builder )
+{
+	wchar_t path[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	wchar_t *expected_path   = NULL;
+	size_t path_size         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_path_builder_clear(
+	          path_builder,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	result = libcpath_path_builder_append_component_wide(
+	          path_builder,
+	          L"C:\\dir\\",
+	          7,
+	          &error );
+#else
+	result = libcpath_path_builder_append_component_wide(
+	          path_builder,
+	          L"/dir/",
+	          5,
+	          &error );
+#endif
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	result = libcpath_path_builder_append_component_wide(
+	          path_builder,
+	          L"\\file.txt",
+	          9,
+	          &error );
+#else
+	result = libcpath_path_builder_append_component_wide(
+	          path_builder,
+	          L"/file.txt",
+	          9,
+	          &error );
+#endif
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	expected_path = L"C:\\dir\\file.txt";
+#else
+	expected_path = L"/dir/file.txt";
+#endif
+	result = libcpath_path_builder_get_path_size_wide(
+	          path_builder,
+	          &path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "path_size",
+	 path_size,
+	 wide_string_length( expected_path ) + 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_builder_get_path_wide(
+	          path_builder,
+	          path,
+	          32,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          path,
+	          expected_path,
+	          path_size );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcpath_path_builder_append_component_wide(
+	          NULL,
+	          L"a",
+	          1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_builder_get_path_wide(
+	          path_builder,
+	          path,
+	          path_size - 1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test that narrow and wide components cannot be mixed
+	 */
+	result = libcpath_path_builder_append_component(
+	          path_builder,
+	          "a",
+	          1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_path_builder_get_path_size(
+	          path_builder,
+	          &path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* A cleared path builder can be reused for a narrow path
+	 */
+	result = libcpath_path_builder_clear(
+	          path_builder,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_builder_append_component(
+	          path_builder,
+	          "a",
+	          1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_builder_append_component_wide(
+	          path_builder,
+	          L"a",
+	          1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CPATH_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CPATH_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CPATH_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CPATH_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error              = NULL;
+	libcpath_path_builder_t *path_builder = NULL;
+	int result                            = 0;
+
+	CPATH_TEST_UNREFERENCED_PARAMETER( argc )
+	CPATH_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_builder_initialize",
+	 cpath_test_path_builder_initialize );
+
+	CPATH_TEST_RUN(
+	 "libcpath_path_builder_free",
+	 cpath_test_path_builder_free );
+
+	/* Initialize path builder for tests
+	 */
+	result = libcpath_path_builder_initialize(
+	          &path_builder,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "path_builder",
+	 path_builder );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_RUN_WITH_ARGS(
+	 "libcpath_path_builder_append_component",
+	 cpath_test_path_builder_append_component,
+	 path_builder );
+
+	CPATH_TEST_RUN_WITH_ARGS(
+	 "libcpath_path_builder_get_path",
+	 cpath_test_path_builder_get_path,
+	 path_builder );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+	CPATH_TEST_RUN_WITH_ARGS(
+	 "libcpath_path_builder_append_component_wide",
+	 cpath_test_path_builder_append_component_wide,
+	 path_builder );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+	/* Clean up
+	 */
+	result = libcpath_path_builder_free(
+	          &path_builder,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "path_builder",
+	 path_builder );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_builder != NULL )
+	{
+		libcpath_path_builder_free(
+		 &path_builder,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1270 @@
+/*
+ * Library resolution context type test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cpath_test_libcerror.h"
+#include "cpath_test_libcpath.h"
+#include "cpath_test_macros.h"
+#include "cpath_test_memory.h"
+#include "cpath_test_unused.h"
+
+#include "../libcpath/libcpath_resolution_context.h"
+
+/* Tests the libcpath_resolution_context_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_resolution_context_initialize(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libcpath_resolution_context_t *resolution_context = NULL;
+	int result                                        = 0;
+
+#if defined( HAVE_CPATH_TEST_MEMORY )
+	int number_of_malloc_fail_tests                   = 1;
+	int number_of_memset_fail_tests                   = 1;
+	int test_number                                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libcpath_resolution_context_initialize(
+	          &resolution_context,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "resolution_context",
+	 resolution_context );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_resolution_context_free(
+	          &resolution_context,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "resolution_context",
+	 resolution_context );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_resolution_context_initialize(
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	resolution_context = (libcpath_resolution_context_t *) 0x12345678UL;
+
+	result = libcpath_resolution_context_initialize(
+	          &resolution_context,
+	          &error );
+
+	resolution_context = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_CPATH_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcpath_resolution_context_initialize with malloc failing
+		 */
+		cpath_test_malloc_attempts_before_fail = test_number;
+
+		result = libcpath_resolution_context_initialize(
+		          &resolution_context,
+		          &error );
+
+		if( cpath_test_malloc_attempts_before_fail != -1 )
+		{
+			cpath_test_malloc_attempts_before_fail = -1;
+
+			if( resolution_context != NULL )
+			{
+				libcpath_resolution_context_free(
+				 &resolution_context,
+				 NULL );
+			}
+		}
+		else
+		{
+			CPATH_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CPATH_TEST_ASSERT_IS_NULL(
+			 "resolution_context",
+			 resolution_context );
+
+			CPATH_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libcpath_resolution_context_initialize with memset failing
+		 */
+		cpath_test_memset_attempts_before_fail = test_number;
+
+		result = libcpath_resolution_context_initialize(
+		          &resolution_context,
+		          &error );
+
+		if( cpath_test_memset_attempts_before_fail != -1 )
+		{
+			cpath_test_memset_attempts_before_fail = -1;
+
+			if( resolution_context != NULL )
+			{
+				libcpath_resolution_context_free(
+				 &resolution_context,
+				 NULL );
+			}
+		}
+		else
+		{
+			CPATH_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			CPATH_TEST_ASSERT_IS_NULL(
+			 "resolution_context",
+			 resolution_context );
+
+			CPATH_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_CPATH_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( resolution_context != NULL )
+	{
+		libcpath_resolution_context_free(
+		 &resolution_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_resolution_context_free function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_resolution_context_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libcpath_resolution_context_free(
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_resolution_context_set_base_directory function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_resolution_context_set_base_directory(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libcpath_resolution_context_t *resolution_context = NULL;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_resolution_context_initialize(
+	          &resolution_context,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "resolution_context",
+	 resolution_context );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	result = libcpath_resolution_context_set_base_directory(
+	          resolution_context,
+	          "C:\\home\\user",
+	          12,
+	          &error );
+#else
+	result = libcpath_resolution_context_set_base_directory(
+	          resolution_context,
+	          "/home/user",
+	          10,
+	          &error );
+#endif
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_resolution_context_set_base_directory(
+	          NULL,
+	          "/home/user",
+	          10,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_resolution_context_set_base_directory(
+	          resolution_context,
+	          NULL,
+	          10,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_resolution_context_set_base_directory(
+	          resolution_context,
+	          "/home/user",
+	          0,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the base directory is relative
+	 */
+	result = libcpath_resolution_context_set_base_directory(
+	          resolution_context,
+	          "user",
+	          4,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcpath_resolution_context_free(
+	          &resolution_context,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "resolution_context",
+	 resolution_context );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( resolution_context != NULL )
+	{
+		libcpath_resolution_context_free(
+		 &resolution_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_resolution_context_get_full_path function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_resolution_context_get_full_path(
+     void )
+{
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	char *base_directory = "C:\\home\\\\user\\.\\docs\\..";
+
+	char *paths[] = {
+		"test.txt",
+		"..\\other\\.\\test.txt",
+		"..\\..\\..\\test.txt",
+		".",
+		"\\test.txt",
+		"c:test.txt",
+		"D:\\\\data\\..\\test.txt",
+		"\\\\server\\share\\test.txt",
+	};
+	char *expected_full_paths[] = {
+		"C:\\home\\user\\test.txt",
+		"C:\\home\\other\\test.txt",
+		"C:\\test.txt",
+		"C:\\home\\user",
+		"C:\\test.txt",
+		"C:\\home\\user\\test.txt",
+		"D:\\test.txt",
+		"\\\\server\\share\\test.txt",
+	};
+#else
+	char *base_directory = "/home//user/./docs/..";
+
+	char *paths[] = {
+		"test.txt",
+		"../other/./test.txt",
+		"../../../test.txt",
+		".",
+		"//data/../test.txt",
+	};
+	char *expected_full_paths[] = {
+		"/home/user/test.txt",
+		"/home/other/test.txt",
+		"/test.txt",
+		"/home/user",
+		"/test.txt",
+	};
+#endif /* defined( WINAPI ) || defined( __MINGW32__ ) */
+
+	libcerror_error_t *error                          = NULL;
+	libcpath_resolution_context_t *resolution_context = NULL;
+	char *expected_full_path                          = NULL;
+	char *full_path                                   = NULL;
+	size_t expected_full_path_length                  = 0;
+	size_t full_path_size                             = 0;
+	int path_index                                    = 0;
+	int result                                        = 0;
+
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	int number_of_paths                               = 8;
+#else
+	int number_of_paths                               = 5;
+#endif
+
+	/* Initialize test
+	 */
+	result = libcpath_resolution_context_initialize(
+	          &resolution_context,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "resolution_context",
+	 resolution_context );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the base directory is not set
+	 */
+	result = libcpath_resolution_context_get_full_path(
+	          resolution_context,
+	          "test.txt",
+	          8,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_resolution_context_set_base_directory(
+	          resolution_context,
+	          base_directory,
+	          narrow_string_length(
+	           base_directory ),
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
+	{
+		expected_full_path = expected_full_paths[ path_index ];
+
+		expected_full_path_length = narrow_string_length(
+		                             expected_full_path );
+
+		result = libcpath_resolution_context_get_full_path(
+		          resolution_context,
+		          paths[ path_index ],
+		          narrow_string_length(
+		           paths[ path_index ] ),
+		          &full_path,
+		          &full_path_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "full_path",
+		 full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_size",
+		 full_path_size,
+		 expected_full_path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = narrow_string_compare(
+		          full_path,
+		          expected_full_path,
+		          expected_full_path_length + 1 );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		memory_free(
+		 full_path );
+
+		full_path = NULL;
+	}
+	/* Test error cases
+	 */
+	result = libcpath_resolution_context_get_full_path(
+	          NULL,
+	          "test.txt",
+	          8,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_resolution_context_get_full_path(
+	          resolution_context,
+	          NULL,
+	          8,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_resolution_context_get_full_path(
+	          resolution_context,
+	          "test.txt",
+	          0,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_resolution_context_get_full_path(
+	          resolution_context,
+	          "test.txt",
+	          8,
+	          NULL,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	full_path = (char *) 0x12345678UL;
+
+	result = libcpath_resolution_context_get_full_path(
+	          resolution_context,
+	          "test.txt",
+	          8,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	full_path = NULL;
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_resolution_context_get_full_path(
+	          resolution_context,
+	          "test.txt",
+	          8,
+	          &full_path,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcpath_resolution_context_free(
+	          &resolution_context,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "resolution_context",
+	 resolution_context );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( full_path != NULL )
+	{
+		memory_free(
+		 full_path );
+	}
+	if( resolution_context != NULL )
+	{
+		libcpath_resolution_context_free(
+		 &resolution_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_resolution_context_set_base_directory_from_current_working_directory function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_resolution_context_set_base_directory_from_current_working_directory(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libcpath_resolution_context_t *resolution_context = NULL;
+	char *current_working_directory                   = NULL;
+	char *full_path                                   = NULL;
+	size_t current_working_directory_length           = 0;
+	size_t current_working_directory_size             = 0;
+	size_t full_path_size                             = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_path_get_current_working_directory(
+	          &current_working_directory,
+	          &current_working_directory_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "current_working_directory",
+	 current_working_directory );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	current_working_directory_length = narrow_string_length(
+	                                    current_working_directory );
+
+	result = libcpath_resolution_context_initialize(
+	          &resolution_context,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "resolution_context",
+	 resolution_context );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libcpath_resolution_context_set_base_directory_from_current_working_directory(
+	          resolution_context,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_resolution_context_get_full_path(
+	          resolution_context,
+	          ".",
+	          1,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "full_path",
+	 full_path );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "full_path_size",
+	 full_path_size,
+	 current_working_directory_length + 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          full_path,
+	          current_working_directory,
+	          current_working_directory_length );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libcpath_resolution_context_set_base_directory_from_current_working_directory(
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 full_path );
+
+	full_path = NULL;
+
+	result = libcpath_resolution_context_free(
+	          &resolution_context,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "resolution_context",
+	 resolution_context );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 current_working_directory );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( full_path != NULL )
+	{
+		memory_free(
+		 full_path );
+	}
+	if( resolution_context != NULL )
+	{
+		libcpath_resolution_context_free(
+		 &resolution_context,
+		 NULL );
+	}
+	if( current_working_directory != NULL )
+	{
+		memory_free(
+		 current_working_directory );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libcpath_resolution_context_get_full_path_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_resolution_context_get_full_path_wide(
+     void )
+{
+#if defined( WINAPI ) || defined( __MINGW32__ )
+	wchar_t *base_directory = L"C:\\home\\\\user\\.\\docs\\..";
+
+	wchar_t *paths[] = {
+		L"test.txt",
+		L"..\\other\\.\\test.txt",
+		L"\\test.txt",
+		L"D:\\\\data\\..\\test.txt",
+	};
+	wchar_t *expected_full_paths[] = {
+		L"C:\\home\\user\\test.txt",
+		L"C:\\home\\other\\test.txt",
+		L"C:\\test.txt",
+		L"D:\\test.txt",
+	};
+#else
+	wchar_t *base_directory = L"/home//user/./docs/..";
+
+	wchar_t *paths[] = {
+		L"test.txt",
+		L"../other/./test.txt",
+		L"../../../test.txt",
+		L"//data/../test.txt",
+	};
+	wchar_t *expected_full_paths[] = {
+		L"/home/user/test.txt",
+		L"/home/other/test.txt",
+		L"/test.txt",
+		L"/test.txt",
+	};
+#endif /* defined( WINAPI ) || defined( __MINGW32__ ) */
+
+	libcerror_error_t *error                          = NULL;
+	libcpath_resolution_context_t *resolution_context = NULL;
+	wchar_t *expected_full_path                       = NULL;
+	wchar_t *full_path                                = NULL;
+	size_t expected_full_path_length                  = 0;
+	size_t full_path_size                             = 0;
+	int number_of_paths                               = 4;
+	int path_index                                    = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libcpath_resolution_context_initialize(
+	          &resolution_context,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "resolution_context",
+	 resolution_context );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the base directory is relative
+	 */
+	result = libcpath_resolution_context_set_base_directory_wide(
+	          resolution_context,
+	          L"user",
+	          4,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the base directory is not set
+	 */
+	result = libcpath_resolution_context_get_full_path_wide(
+	          resolution_context,
+	          L"test.txt",
+	          8,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_resolution_context_set_base_directory_wide(
+	          resolution_context,
+	          base_directory,
+	          wide_string_length(
+	           base_directory ),
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
+	{
+		expected_full_path = expected_full_paths[ path_index ];
+
+		expected_full_path_length = wide_string_length(
+		                             expected_full_path );
+
+		result = libcpath_resolution_context_get_full_path_wide(
+		          resolution_context,
+		          paths[ path_index ],
+		          wide_string_length(
+		           paths[ path_index ] ),
+		          &full_path,
+		          &full_path_size,
+		          &error );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		CPATH_TEST_ASSERT_IS_NOT_NULL(
+		 "full_path",
+		 full_path );
+
+		CPATH_TEST_ASSERT_EQUAL_SIZE(
+		 "full_path_size",
+		 full_path_size,
+		 expected_full_path_length + 1 );
+
+		CPATH_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = wide_string_compare(
+		          full_path,
+		          expected_full_path,
+		          expected_full_path_length + 1 );
+
+		CPATH_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		memory_free(
+		 full_path );
+
+		full_path = NULL;
+	}
+	/* Test error cases
+	 */
+	result = libcpath_resolution_context_get_full_path_wide(
+	          NULL,
+	          L"test.txt",
+	          8,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_resolution_context_get_full_path_wide(
+	          resolution_context,
+	          NULL,
+	          8,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcpath_resolution_context_free(
+	          &resolution_context,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "resolution_context",
+	 resolution_context );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( full_path != NULL )
+	{
+		memory_free(
+		 full_path );
+	}
+	if( resolution_context != NULL )
+	{
+		libcpath_resolution_context_free(
+		 &resolution_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CPATH_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CPATH_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CPATH_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CPATH_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CPATH_TEST_UNREFERENCED_PARAMETER( argc )
+	CPATH_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CPATH_TEST_RUN(
+	 "libcpath_resolution_context_initialize",
+	 cpath_test_resolution_context_initialize );
+
+	CPATH_TEST_RUN(
+	 "libcpath_resolution_context_free",
+	 cpath_test_resolution_context_free );
+
+	CPATH_TEST_RUN(
+	 "libcpath_resolution_context_set_base_directory",
+	 cpath_test_resolution_context_set_base_directory );
+
+	CPATH_TEST_RUN(
+	 "libcpath_resolution_context_get_full_path",
+	 cpath_test_resolution_context_get_full_path );
+
+	CPATH_TEST_RUN(
+	 "libcpath_resolution_context_set_base_directory_from_current_working_directory",
+	 cpath_test_resolution_context_set_base_directory_from_current_working_directory );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+	CPATH_TEST_RUN(
+	 "libcpath_resolution_context_get_full_path_wide",
+	 cpath_test_resolution_context_get_full_path_wide );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
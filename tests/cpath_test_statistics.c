@@ -0,0 +1,458 @@
+/*
+ * Library statistics functions test program
+ *
+ * Copyright (C) 2008-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "cpath_test_libcerror.h"
+#include "cpath_test_libcpath.h"
+#include "cpath_test_macros.h"
+#include "cpath_test_unused.h"
+
+/* Tests the libcpath_get_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_get_statistics(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	char *full_path                = NULL;
+	size_t full_path_size          = 0;
+	uint64_t allocated_size        = 0;
+	uint64_t elapsed_time          = 0;
+	uint64_t number_of_allocations = 0;
+	uint64_t number_of_calls       = 0;
+	int result                     = 0;
+
+	result = libcpath_enable_statistics(
+	          &error );
+
+	if( result == -1 )
+	{
+		/* Statistics are not supported by the compiler
+		 */
+		libcerror_error_free(
+		 &error );
+
+		return( 1 );
+	}
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_reset_statistics(
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_full_path(
+	          "file.txt",
+	          8,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 full_path );
+
+	full_path = NULL;
+
+	/* Test the statistics of the function that was called
+	 */
+	result = libcpath_get_statistics(
+	          LIBCPATH_STATISTICS_FUNCTION_PATH_GET_FULL_PATH,
+	          &number_of_calls,
+	          &number_of_allocations,
+	          &allocated_size,
+	          &elapsed_time,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_calls",
+	 number_of_calls,
+	 (uint64_t) 1 );
+
+	CPATH_TEST_ASSERT_NOT_EQUAL_UINT64(
+	 "number_of_allocations",
+	 number_of_allocations,
+	 (uint64_t) 0 );
+
+	CPATH_TEST_ASSERT_NOT_EQUAL_UINT64(
+	 "allocated_size",
+	 allocated_size,
+	 (uint64_t) 0 );
+
+	/* Test that nested calls are not recorded
+	 */
+	result = libcpath_get_statistics(
+	          LIBCPATH_STATISTICS_FUNCTION_PATH_GET_CURRENT_WORKING_DIRECTORY,
+	          &number_of_calls,
+	          &number_of_allocations,
+	          &allocated_size,
+	          &elapsed_time,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_calls",
+	 number_of_calls,
+	 (uint64_t) 0 );
+
+	result = libcpath_get_statistics(
+	          LIBCPATH_STATISTICS_FUNCTION_PATH_GET_CURRENT_WORKING_DIRECTORY_EXACT,
+	          &number_of_calls,
+	          &number_of_allocations,
+	          &allocated_size,
+	          &elapsed_time,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_calls",
+	 number_of_calls,
+	 (uint64_t) 0 );
+
+	/* Test that the statistics are cleared by a reset
+	 */
+	result = libcpath_reset_statistics(
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_get_statistics(
+	          LIBCPATH_STATISTICS_FUNCTION_PATH_GET_FULL_PATH,
+	          &number_of_calls,
+	          &number_of_allocations,
+	          &allocated_size,
+	          &elapsed_time,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_calls",
+	 number_of_calls,
+	 (uint64_t) 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_allocations",
+	 number_of_allocations,
+	 (uint64_t) 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_UINT64(
+	 "allocated_size",
+	 allocated_size,
+	 (uint64_t) 0 );
+
+	CPATH_TEST_ASSERT_EQUAL_UINT64(
+	 "elapsed_time",
+	 elapsed_time,
+	 (uint64_t) 0 );
+
+	/* Test that calls are not recorded while disabled
+	 */
+	result = libcpath_disable_statistics(
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_full_path(
+	          "file.txt",
+	          8,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 full_path );
+
+	full_path = NULL;
+
+	result = libcpath_get_statistics(
+	          LIBCPATH_STATISTICS_FUNCTION_PATH_GET_FULL_PATH,
+	          &number_of_calls,
+	          &number_of_allocations,
+	          &allocated_size,
+	          &elapsed_time,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_calls",
+	 number_of_calls,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libcpath_get_statistics(
+	          -1,
+	          &number_of_calls,
+	          &number_of_allocations,
+	          &allocated_size,
+	          &elapsed_time,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_get_statistics(
+	          LIBCPATH_STATISTICS_NUMBER_OF_FUNCTIONS,
+	          &number_of_calls,
+	          &number_of_allocations,
+	          &allocated_size,
+	          &elapsed_time,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_get_statistics(
+	          LIBCPATH_STATISTICS_FUNCTION_PATH_GET_FULL_PATH,
+	          NULL,
+	          &number_of_allocations,
+	          &allocated_size,
+	          &elapsed_time,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_get_statistics(
+	          LIBCPATH_STATISTICS_FUNCTION_PATH_GET_FULL_PATH,
+	          &number_of_calls,
+	          NULL,
+	          &allocated_size,
+	          &elapsed_time,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_get_statistics(
+	          LIBCPATH_STATISTICS_FUNCTION_PATH_GET_FULL_PATH,
+	          &number_of_calls,
+	          &number_of_allocations,
+	          NULL,
+	          &elapsed_time,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_get_statistics(
+	          LIBCPATH_STATISTICS_FUNCTION_PATH_GET_FULL_PATH,
+	          &number_of_calls,
+	          &number_of_allocations,
+	          &allocated_size,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( full_path != NULL )
+	{
+		memory_free(
+		 full_path );
+	}
+	libcpath_disable_statistics(
+	 NULL );
+
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc CPATH_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] CPATH_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc CPATH_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] CPATH_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	CPATH_TEST_UNREFERENCED_PARAMETER( argc )
+	CPATH_TEST_UNREFERENCED_PARAMETER( argv )
+
+	CPATH_TEST_RUN(
+	 "libcpath_get_statistics",
+	 cpath_test_get_statistics );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
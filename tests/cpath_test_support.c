@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <types.h>
 
@@ -163,6 +164,209 @@ on_error:
 	return( 0 );
 }
 
+/* The test memory context
+ */
+typedef struct cpath_test_memory_context cpath_test_memory_context_t;
+
+struct cpath_test_memory_context
+{
+	/* The number of allocations
+	 */
+	int number_of_allocations;
+};
+
+/* Test memory allocate function
+ * Returns a pointer to the allocated memory or NULL on error
+ */
+void *cpath_test_memory_allocate(
+       intptr_t *memory_context,
+       size_t size )
+{
+	( (cpath_test_memory_context_t *) memory_context )->number_of_allocations += 1;
+
+	return( memory_allocate(
+	         size ) );
+}
+
+/* Test memory reallocate function
+ * Returns a pointer to the reallocated memory or NULL on error
+ */
+void *cpath_test_memory_reallocate(
+       intptr_t *memory_context,
+       void *buffer,
+       size_t size )
+{
+	( (cpath_test_memory_context_t *) memory_context )->number_of_allocations += 1;
+
+	return( memory_reallocate(
+	         buffer,
+	         size ) );
+}
+
+/* Test memory free function
+ */
+void cpath_test_memory_free(
+      intptr_t *memory_context CPATH_TEST_ATTRIBUTE_UNUSED,
+      void *buffer )
+{
+	CPATH_TEST_UNREFERENCED_PARAMETER( memory_context )
+
+	memory_free(
+	 buffer );
+}
+
+/* Tests the libcpath_set_memory_functions function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_set_memory_functions(
+     void )
+{
+	cpath_test_memory_context_t memory_context;
+
+	libcerror_error_t *error = NULL;
+	char *full_path          = NULL;
+	size_t full_path_size    = 0;
+	int result               = 0;
+
+	memory_context.number_of_allocations = 0;
+
+	result = libcpath_set_memory_functions(
+	          &cpath_test_memory_allocate,
+	          &cpath_test_memory_reallocate,
+	          &cpath_test_memory_free,
+	          (intptr_t *) &memory_context,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_path_get_full_path(
+	          "file.txt",
+	          8,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "full_path",
+	 full_path );
+
+	CPATH_TEST_ASSERT_GREATER_THAN_INT(
+	 "memory_context.number_of_allocations",
+	 memory_context.number_of_allocations,
+	 0 );
+
+	cpath_test_memory_free(
+	 (intptr_t *) &memory_context,
+	 full_path );
+
+	full_path = NULL;
+
+	result = libcpath_set_memory_functions(
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the default memory functions are restored
+	 */
+	memory_context.number_of_allocations = 0;
+
+	result = libcpath_path_get_full_path(
+	          "file.txt",
+	          8,
+	          &full_path,
+	          &full_path_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "memory_context.number_of_allocations",
+	 memory_context.number_of_allocations,
+	 0 );
+
+	memory_free(
+	 full_path );
+
+	full_path = NULL;
+
+	/* Test error cases
+	 */
+	result = libcpath_set_memory_functions(
+	          &cpath_test_memory_allocate,
+	          NULL,
+	          &cpath_test_memory_free,
+	          (intptr_t *) &memory_context,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( full_path != NULL )
+	{
+		memory_free(
+		 full_path );
+	}
+	libcpath_set_memory_functions(
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL,
+	 NULL );
+
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -190,6 +394,10 @@ int main(
 	 "libcpath_set_codepage",
 	 cpath_test_set_codepage );
 
+	CPATH_TEST_RUN(
+	 "libcpath_set_memory_functions",
+	 cpath_test_set_memory_functions );
+
 	return( EXIT_SUCCESS );
 
 on_error:
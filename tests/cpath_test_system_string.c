@@ -39,6 +39,268 @@
 
 #if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
 
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) || defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libcpath_system_string_get_narrow_ascii_prefix_length function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_system_string_get_narrow_ascii_prefix_length(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	size_t ascii_prefix_length = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_system_string_get_narrow_ascii_prefix_length(
+	          "/home/user/documents/file.txt",
+	          30,
+	          &ascii_prefix_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_prefix_length",
+	 ascii_prefix_length,
+	 (size_t) 29 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_system_string_get_narrow_ascii_prefix_length(
+	          "/home/user/documents/caf\xc3\xa9.txt",
+	          31,
+	          &ascii_prefix_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_prefix_length",
+	 ascii_prefix_length,
+	 (size_t) 24 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_system_string_get_narrow_ascii_prefix_length(
+	          "/home/user/documents/file.txt",
+	          10,
+	          &ascii_prefix_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_prefix_length",
+	 ascii_prefix_length,
+	 (size_t) 10 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_system_string_get_narrow_ascii_prefix_length(
+	          NULL,
+	          30,
+	          &ascii_prefix_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_get_narrow_ascii_prefix_length(
+	          "/home/user/documents/file.txt",
+	          (size_t) -1,
+	          &ascii_prefix_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_get_narrow_ascii_prefix_length(
+	          "/home/user/documents/file.txt",
+	          30,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_system_string_get_wide_ascii_prefix_length function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_system_string_get_wide_ascii_prefix_length(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	size_t ascii_prefix_length = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_system_string_get_wide_ascii_prefix_length(
+	          L"/home/user/documents/file.txt",
+	          30,
+	          &ascii_prefix_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_prefix_length",
+	 ascii_prefix_length,
+	 (size_t) 29 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcpath_system_string_get_wide_ascii_prefix_length(
+	          L"/home/user/documents/caf\x00e9.txt",
+	          30,
+	          &ascii_prefix_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "ascii_prefix_length",
+	 ascii_prefix_length,
+	 (size_t) 24 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_system_string_get_wide_ascii_prefix_length(
+	          NULL,
+	          30,
+	          &ascii_prefix_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_get_wide_ascii_prefix_length(
+	          L"/home/user/documents/file.txt",
+	          (size_t) -1,
+	          &ascii_prefix_length,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_get_wide_ascii_prefix_length(
+	          L"/home/user/documents/file.txt",
+	          30,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) || defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 /* Tests the libcpath_system_string_size_to_narrow_string function
  * Returns 1 if successful or 0 if not
  */
@@ -539,6 +801,29 @@ int cpath_test_system_string_size_to_wide_string(
 	 "error",
 	 error );
 
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcpath_system_string_size_to_wide_string(
+	          "caf\xc3\xa9 string",
+	          13,
+	          &wide_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "wide_string_size",
+	 wide_string_size,
+	 (size_t) 12 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
 	/* Test error cases
 	 */
 	result = libcpath_system_string_size_to_wide_string(
@@ -633,6 +918,35 @@ int cpath_test_system_string_copy_to_wide_string(
 	 "error",
 	 error );
 
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcpath_system_string_copy_to_wide_string(
+	          "caf\xc3\xa9 string",
+	          13,
+	          wide_string,
+	          32,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          wide_string,
+	          L"caf\x00e9 string",
+	          12 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+#endif /* !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
 	/* Test error cases
 	 */
 	result = libcpath_system_string_copy_to_wide_string(
@@ -743,20 +1057,19 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcpath_system_string_size_from_wide_string function
+/* Tests the libcpath_system_string_get_maximum_size_to_wide_string function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_system_string_size_from_wide_string(
+int cpath_test_system_string_get_maximum_size_to_wide_string(
      void )
 {
-	libcerror_error_t *error  = NULL;
-	size_t system_string_size = 0;
-	int result                = 0;
+	libcerror_error_t *error = NULL;
+	size_t wide_string_size  = 0;
+	int result               = 0;
 
-	result = libcpath_system_string_size_from_wide_string(
-	          L"test string",
+	result = libcpath_system_string_get_maximum_size_to_wide_string(
 	          12,
-	          &system_string_size,
+	          &wide_string_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -764,19 +1077,719 @@ int cpath_test_system_string_size_from_wide_string(
 	 result,
 	 1 );
 
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	CPATH_TEST_ASSERT_EQUAL_SIZE(
-	 "system_string_size",
-	 system_string_size,
+	 "wide_string_size",
+	 wide_string_size,
 	 (size_t) 12 );
+#else
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "wide_string_size",
+	 wide_string_size,
+	 (size_t) 13 );
+#endif
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_system_string_get_maximum_size_to_wide_string(
+	          (size_t) -1,
+	          &wide_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_get_maximum_size_to_wide_string(
+	          12,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_system_string_convert_to_wide_string function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_system_string_convert_to_wide_string(
+     void )
+{
+	wchar_t wide_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	size_t wide_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_system_string_convert_to_wide_string(
+	          _SYSTEM_STRING( "test string" ),
+	          12,
+	          wide_string,
+	          32,
+	          &wide_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "wide_string_size",
+	 wide_string_size,
+	 (size_t) 12 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcpath_system_string_convert_to_wide_string(
+	          "caf\xc3\xa9 string",
+	          13,
+	          wide_string,
+	          32,
+	          &wide_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "wide_string_size",
+	 wide_string_size,
+	 (size_t) 12 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = wide_string_compare(
+	          wide_string,
+	          L"caf\x00e9 string",
+	          12 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+#endif /* !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	/* Test error cases
+	 */
+	result = libcpath_system_string_convert_to_wide_string(
+	          NULL,
+	          12,
+	          wide_string,
+	          32,
+	          &wide_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_convert_to_wide_string(
+	          _SYSTEM_STRING( "test string" ),
+	          (size_t) -1,
+	          wide_string,
+	          32,
+	          &wide_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_convert_to_wide_string(
+	          _SYSTEM_STRING( "test string" ),
+	          12,
+	          NULL,
+	          32,
+	          &wide_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_convert_to_wide_string(
+	          _SYSTEM_STRING( "test string" ),
+	          12,
+	          wide_string,
+	          (size_t) -1,
+	          &wide_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_convert_to_wide_string(
+	          _SYSTEM_STRING( "test string" ),
+	          12,
+	          wide_string,
+	          8,
+	          &wide_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_convert_to_wide_string(
+	          _SYSTEM_STRING( "test string" ),
+	          12,
+	          wide_string,
+	          32,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_system_string_size_from_wide_string function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_system_string_size_from_wide_string(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	size_t system_string_size = 0;
+	int result                = 0;
+
+	result = libcpath_system_string_size_from_wide_string(
+	          L"test string",
+	          12,
+	          &system_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "system_string_size",
+	 system_string_size,
+	 (size_t) 12 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcpath_system_string_size_from_wide_string(
+	          L"caf\x00e9 string",
+	          12,
+	          &system_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "system_string_size",
+	 system_string_size,
+	 (size_t) 13 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	/* Test error cases
+	 */
+	result = libcpath_system_string_size_from_wide_string(
+	          NULL,
+	          12,
+	          &system_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_size_from_wide_string(
+	          L"test string",
+	          (size_t) -1,
+	          &system_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_size_from_wide_string(
+	          L"test string",
+	          12,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_system_string_copy_from_wide_string function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_system_string_copy_from_wide_string(
+     void )
+{
+	system_character_t system_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	result = libcpath_system_string_copy_from_wide_string(
+	          system_string,
+	          32,
+	          L"test string",
+	          12,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcpath_system_string_copy_from_wide_string(
+	          system_string,
+	          32,
+	          L"caf\x00e9 string",
+	          12,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          system_string,
+	          "caf\xc3\xa9 string",
+	          13 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+#endif /* !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	/* Test error cases
+	 */
+	result = libcpath_system_string_copy_from_wide_string(
+	          NULL,
+	          32,
+	          L"test string",
+	          12,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_copy_from_wide_string(
+	          system_string,
+	          (size_t) -1,
+	          L"test string",
+	          12,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_copy_from_wide_string(
+	          system_string,
+	          32,
+	          NULL,
+	          12,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_copy_from_wide_string(
+	          system_string,
+	          32,
+	          L"test string",
+	          (size_t) -1,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_copy_from_wide_string(
+	          system_string,
+	          8,
+	          L"test string",
+	          12,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+/* TODO add test with failing system_string_copy */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_system_string_get_maximum_size_from_wide_string function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_system_string_get_maximum_size_from_wide_string(
+     void )
+{
+	libcerror_error_t *error  = NULL;
+	size_t system_string_size = 0;
+	int result                = 0;
+
+	result = libcpath_system_string_get_maximum_size_from_wide_string(
+	          12,
+	          &system_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "system_string_size",
+	 system_string_size,
+	 (size_t) 12 );
+#else
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "system_string_size",
+	 system_string_size,
+	 (size_t) 49 );
+#endif
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libcpath_system_string_get_maximum_size_from_wide_string(
+	          (size_t) -1,
+	          &system_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_get_maximum_size_from_wide_string(
+	          12,
+	          NULL,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libcpath_system_string_convert_from_wide_string function
+ * Returns 1 if successful or 0 if not
+ */
+int cpath_test_system_string_convert_from_wide_string(
+     void )
+{
+	system_character_t system_string[ 64 ];
+
+	libcerror_error_t *error  = NULL;
+	size_t system_string_size = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libcpath_system_string_convert_from_wide_string(
+	          system_string,
+	          64,
+	          L"test string",
+	          12,
+	          &system_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "system_string_size",
+	 system_string_size,
+	 (size_t) 12 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcpath_system_string_convert_from_wide_string(
+	          system_string,
+	          64,
+	          L"caf\x00e9 string",
+	          12,
+	          &system_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "system_string_size",
+	 system_string_size,
+	 (size_t) 13 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          system_string,
+	          "caf\xc3\xa9 string",
+	          13 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+#endif /* !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
 
-	CPATH_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	/* Test error cases
 	 */
-	result = libcpath_system_string_size_from_wide_string(
+	result = libcpath_system_string_convert_from_wide_string(
 	          NULL,
+	          64,
+	          L"test string",
 	          12,
 	          &system_string_size,
 	          &error );
@@ -793,7 +1806,49 @@ int cpath_test_system_string_size_from_wide_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_system_string_size_from_wide_string(
+	result = libcpath_system_string_convert_from_wide_string(
+	          system_string,
+	          (size_t) -1,
+	          L"test string",
+	          12,
+	          &system_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_convert_from_wide_string(
+	          system_string,
+	          64,
+	          NULL,
+	          12,
+	          &system_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_convert_from_wide_string(
+	          system_string,
+	          64,
 	          L"test string",
 	          (size_t) -1,
 	          &system_string_size,
@@ -811,7 +1866,29 @@ int cpath_test_system_string_size_from_wide_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_system_string_size_from_wide_string(
+	result = libcpath_system_string_convert_from_wide_string(
+	          system_string,
+	          8,
+	          L"test string",
+	          12,
+	          &system_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_convert_from_wide_string(
+	          system_string,
+	          64,
 	          L"test string",
 	          12,
 	          NULL,
@@ -840,22 +1917,109 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libcpath_system_string_copy_from_wide_string function
+/* Tests the libcpath_system_string_convert_from_wide_string_with_buffer function
  * Returns 1 if successful or 0 if not
  */
-int cpath_test_system_string_copy_from_wide_string(
+int cpath_test_system_string_convert_from_wide_string_with_buffer(
      void )
 {
-	system_character_t system_string[ 32 ];
+	system_character_t buffer[ 64 ];
 
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error          = NULL;
+	system_character_t *system_string = NULL;
+	size_t system_string_size         = 0;
+	int result                        = 0;
 
-	result = libcpath_system_string_copy_from_wide_string(
-	          system_string,
-	          32,
+	/* Test regular cases
+	 */
+	result = libcpath_system_string_convert_from_wide_string_with_buffer(
+	          L"test string",
+	          12,
+	          buffer,
+	          64,
+	          &system_string,
+	          &system_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "system_string_size",
+	 system_string_size,
+	 (size_t) 12 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A string that fits is converted into the buffer
+	 */
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "system_string == buffer",
+	 (int) ( system_string == buffer ),
+	 1 );
+
+	system_string = NULL;
+
+	/* A string that does not fit is converted into allocated memory
+	 */
+	result = libcpath_system_string_convert_from_wide_string_with_buffer(
 	          L"test string",
 	          12,
+	          buffer,
+	          8,
+	          &system_string,
+	          &system_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "system_string_size",
+	 system_string_size,
+	 (size_t) 12 );
+
+	CPATH_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "system_string == buffer",
+	 (int) ( system_string == buffer ),
+	 0 );
+
+	result = system_string_compare(
+	          system_string,
+	          _SYSTEM_STRING( "test string" ),
+	          12 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 system_string );
+
+	system_string = NULL;
+
+#if !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	/* A non-ASCII string is only converted into the buffer if its maximum
+	 * size fits
+	 */
+	result = libcpath_system_string_convert_from_wide_string_with_buffer(
+	          L"caf\x00e9",
+	          5,
+	          buffer,
+	          8,
+	          &system_string,
+	          &system_string_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -863,17 +2027,67 @@ int cpath_test_system_string_copy_from_wide_string(
 	 result,
 	 1 );
 
+	CPATH_TEST_ASSERT_EQUAL_SIZE(
+	 "system_string_size",
+	 system_string_size,
+	 (size_t) 6 );
+
 	CPATH_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "system_string == buffer",
+	 (int) ( system_string == buffer ),
+	 0 );
+
+	result = narrow_string_compare(
+	          system_string,
+	          "caf\xc3\xa9",
+	          6 );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 system_string );
+
+	system_string = NULL;
+
+#endif /* !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
 	/* Test error cases
 	 */
-	result = libcpath_system_string_copy_from_wide_string(
+	result = libcpath_system_string_convert_from_wide_string_with_buffer(
 	          NULL,
-	          32,
+	          12,
+	          buffer,
+	          64,
+	          &system_string,
+	          &system_string_size,
+	          &error );
+
+	CPATH_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	CPATH_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libcpath_system_string_convert_from_wide_string_with_buffer(
 	          L"test string",
 	          12,
+	          NULL,
+	          64,
+	          &system_string,
+	          &system_string_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -888,11 +2102,13 @@ int cpath_test_system_string_copy_from_wide_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_system_string_copy_from_wide_string(
-	          system_string,
-	          (size_t) -1,
+	result = libcpath_system_string_convert_from_wide_string_with_buffer(
 	          L"test string",
 	          12,
+	          buffer,
+	          (size_t) -1,
+	          &system_string,
+	          &system_string_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -907,11 +2123,13 @@ int cpath_test_system_string_copy_from_wide_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_system_string_copy_from_wide_string(
-	          system_string,
-	          32,
-	          NULL,
+	result = libcpath_system_string_convert_from_wide_string_with_buffer(
+	          L"test string",
 	          12,
+	          buffer,
+	          64,
+	          NULL,
+	          &system_string_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -926,11 +2144,13 @@ int cpath_test_system_string_copy_from_wide_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_system_string_copy_from_wide_string(
-	          system_string,
-	          32,
+	result = libcpath_system_string_convert_from_wide_string_with_buffer(
 	          L"test string",
-	          (size_t) -1,
+	          12,
+	          buffer,
+	          64,
+	          &system_string,
+	          NULL,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -945,11 +2165,15 @@ int cpath_test_system_string_copy_from_wide_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libcpath_system_string_copy_from_wide_string(
-	          system_string,
-	          8,
+	system_string = buffer;
+
+	result = libcpath_system_string_convert_from_wide_string_with_buffer(
 	          L"test string",
 	          12,
+	          buffer,
+	          64,
+	          &system_string,
+	          &system_string_size,
 	          &error );
 
 	CPATH_TEST_ASSERT_EQUAL_INT(
@@ -964,7 +2188,7 @@ int cpath_test_system_string_copy_from_wide_string(
 	libcerror_error_free(
 	 &error );
 
-/* TODO add test with failing system_string_copy */
+	system_string = NULL;
 
 	return( 1 );
 
@@ -974,6 +2198,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( ( system_string != NULL )
+	 && ( system_string != buffer ) )
+	{
+		memory_free(
+		 system_string );
+	}
 	return( 0 );
 }
 
@@ -998,6 +2228,18 @@ int main(
 
 #if defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT )
 
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER ) || defined( HAVE_WIDE_CHARACTER_TYPE )
+
+	CPATH_TEST_RUN(
+	 "libcpath_system_string_get_narrow_ascii_prefix_length",
+	 cpath_test_system_string_get_narrow_ascii_prefix_length );
+
+	CPATH_TEST_RUN(
+	 "libcpath_system_string_get_wide_ascii_prefix_length",
+	 cpath_test_system_string_get_wide_ascii_prefix_length );
+
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) || defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 	CPATH_TEST_RUN(
 	 "libcpath_system_string_size_to_narrow_string",
 	 cpath_test_system_string_size_to_narrow_string );
@@ -1024,6 +2266,14 @@ int main(
 	 "libcpath_system_string_copy_to_wide_string",
 	 cpath_test_system_string_copy_to_wide_string );
 
+	CPATH_TEST_RUN(
+	 "libcpath_system_string_get_maximum_size_to_wide_string",
+	 cpath_test_system_string_get_maximum_size_to_wide_string );
+
+	CPATH_TEST_RUN(
+	 "libcpath_system_string_convert_to_wide_string",
+	 cpath_test_system_string_convert_to_wide_string );
+
 	CPATH_TEST_RUN(
 	 "libcpath_system_string_size_from_wide_string",
 	 cpath_test_system_string_size_from_wide_string );
@@ -1032,6 +2282,18 @@ int main(
 	 "libcpath_system_string_copy_from_wide_string",
 	 cpath_test_system_string_copy_from_wide_string );
 
+	CPATH_TEST_RUN(
+	 "libcpath_system_string_get_maximum_size_from_wide_string",
+	 cpath_test_system_string_get_maximum_size_from_wide_string );
+
+	CPATH_TEST_RUN(
+	 "libcpath_system_string_convert_from_wide_string",
+	 cpath_test_system_string_convert_from_wide_string );
+
+	CPATH_TEST_RUN(
+	 "libcpath_system_string_convert_from_wide_string_with_buffer",
+	 cpath_test_system_string_convert_from_wide_string_with_buffer );
+
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBCPATH_DLL_IMPORT ) */
@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "error path support system_string"
+$LibraryTests = "arena directory_cache directory_handle error path path_builder resolution_context statistics support system_string"
 $LibraryTestsWithInput = ""
 $OptionSets = "" -split " "
 